@@ -59,6 +59,24 @@ typedef uint64_t Bench_Type;
  * and after the process you want to measure. You can refer to `<nuclei-sdk>/application/baremetal/demo_dsp`
  * for how to use it.
  *
+ * A single call measured by `BENCH_START` and `BENCH_END` includes the instruction cache fill. To get stable
+ * numbers, `BENCH_RUN(proc, iters, warmup, nsamples, stmt);` runs `stmt` `warmup` times without measuring it,
+ * then measures `iters` calls of it (at most `BENCH_RUN_MAX_ITERS`, a warning is printed when it is clamped),
+ * and prints the min, median, p90, p99 and max cycles and the median cycles per element when `stmt`
+ * processes `nsamples` elements.
+ *
+ * When `BENCH_MEMORY` is defined, `BENCH_START` also paints `BENCH_STACK_PAINT_SIZE` bytes of free stack
+ * and the scratch buffers registered by `BENCH_SCRATCH(buf, size);` before it, and `BENCH_END` prints
+ * `SCRATCH, proc, case, buf, used, size` for each scratch buffer and `MEMUSE, proc, case, stack, scratch_used,
+ * scratch_size`, where stack is the bytes of stack used below the caller, used is the highest byte of the
+ * scratch buffer written plus one, and case is the name of the calling function. The painting is not
+ * measured, but it disturbs the caches, so the cycles of this mode are not representative.
+ * The painted stack stops at `BENCH_STACK_LIMIT`, the bottom of the stack given by the linker script, and
+ * a warning is printed when less than `BENCH_STACK_PAINT_SIZE` bytes are free, the stack size of the
+ * Nuclei SDK is 2K by default, use such as `make STACKSZ=16K` to measure deeper stacks. A kernel which stores
+ * the painted value itself is undercounted: the stack up to its lowest word written which differs from
+ * `BENCH_PAINT_WORD`, and the scratch buffer up to its highest byte written which differs from `BENCH_PAINT_BYTE`.
+ *
  * If you want to disable the benchmark calculation, you can place `#define DISABLE_NMSIS_BENCH`
  * before include `nmsis_bench.h`
  *
@@ -100,11 +118,209 @@ __STATIC_FORCEINLINE void __prepare_bench_env(void)
 #endif /* #ifdef BENCH_XLEN_MODE */
 #endif /* #ifndef READ_CYCLE */
 
+#ifndef BENCH_RUN_MAX_ITERS
+/** Maximum number of iterations measured by BENCH_RUN, length of its cycle buffer on the stack */
+#define BENCH_RUN_MAX_ITERS     32
+#endif
+
+#if defined(BENCH_MEMORY) && !defined(DISABLE_NMSIS_BENCH)
+
+#ifndef BENCH_STACK_PAINT_SIZE
+/** Bytes of stack painted below the caller of BENCH_START, the largest stack usage which can be measured */
+#define BENCH_STACK_PAINT_SIZE  8192
+#endif
+
+#ifndef BENCH_STACK_LIMIT
+/** Lowest address of the stack, __StackLimit of the Nuclei SDK linker scripts, 0 when it is not defined */
+extern char __StackLimit[] __attribute__((weak));
+#define BENCH_STACK_LIMIT       ((unsigned long)__StackLimit)
+#endif
+
+/** Byte painted into the free stack and the scratch buffer */
+#define BENCH_PAINT_BYTE        0xA5U
+#define BENCH_PAINT_WORD        0xA5A5A5A5UL
+
+/** Read the stack pointer */
+__STATIC_FORCEINLINE unsigned long __bench_get_sp(void)
+{
+    unsigned long sp;
+    __ASM volatile("mv %0, sp" : "=r"(sp));
+    return sp;
+}
+
+/**
+ * \brief   Return the lowest address of the stack painted below top
+ * \param [in]     top        stack pointer of the caller of the measured function
+ * \return  top - BENCH_STACK_PAINT_SIZE, or BENCH_STACK_LIMIT when the stack below top is smaller
+ */
+__STATIC_INLINE unsigned long __bench_stack_bottom(unsigned long top)
+{
+    unsigned long limit = (BENCH_STACK_LIMIT + 3UL) & ~3UL;
+
+    if ((limit < top) && (top - limit < BENCH_STACK_PAINT_SIZE)) {
+        return limit;
+    }
+    return (top - BENCH_STACK_PAINT_SIZE) & ~3UL;
+}
+
+/**
+ * \brief   Paint the free stack below top with BENCH_PAINT_WORD
+ * \param [in]     top        stack pointer of the caller of the measured function
+ * \param [in]     proc       name of the benchmark
+ * \details
+ * The words from __bench_stack_bottom(top) up to the stack pointer of this function are painted,
+ * the frame of this function is reused by the measured function. A warning is printed once when
+ * the stack below top is smaller than BENCH_STACK_PAINT_SIZE.
+ */
+static __attribute__((noinline, unused)) void __bench_stack_paint(unsigned long top, const char *proc)
+{
+    static int warned = 0;
+    volatile uint32_t *ptr = (volatile uint32_t *)__bench_stack_bottom(top);
+    volatile uint32_t *end = (volatile uint32_t *)(__bench_get_sp() & ~3UL);
+
+    if ((warned == 0) && (top - (unsigned long)ptr < BENCH_STACK_PAINT_SIZE)) {
+        printf("WARNING, %s, only %lu bytes of stack measured, less than BENCH_STACK_PAINT_SIZE %lu, raise STACKSZ\n",
+               proc, top - (unsigned long)ptr, (unsigned long)BENCH_STACK_PAINT_SIZE);
+        warned = 1;
+    }
+    while (ptr < end) {
+        *ptr++ = (uint32_t)BENCH_PAINT_WORD;
+    }
+}
+
+/**
+ * \brief   Return the bytes of stack used below top since __bench_stack_paint
+ * \param [in]     top        stack pointer passed to __bench_stack_paint
+ * \return  bytes used, top - __bench_stack_bottom(top) means the painted stack was all used
+ */
+static __attribute__((noinline, unused)) unsigned long __bench_stack_used(unsigned long top)
+{
+    const volatile uint32_t *ptr = (const volatile uint32_t *)__bench_stack_bottom(top);
+
+    while (((unsigned long)ptr < top) && (*ptr == (uint32_t)BENCH_PAINT_WORD)) {
+        ptr++;
+    }
+    return top - (unsigned long)ptr;
+}
+
+/** Paint size bytes of the scratch buffer buf with BENCH_PAINT_BYTE */
+__STATIC_INLINE void __bench_scratch_paint(void *buf, unsigned long size)
+{
+    volatile uint8_t *ptr = (volatile uint8_t *)buf;
+
+    while (size-- > 0) {
+        *ptr++ = BENCH_PAINT_BYTE;
+    }
+}
+
+/** Return the highest byte written plus one of the scratch buffer buf painted by __bench_scratch_paint */
+__STATIC_INLINE unsigned long __bench_scratch_used(const void *buf, unsigned long size)
+{
+    const volatile uint8_t *ptr = (const volatile uint8_t *)buf;
+
+    while ((size > 0) && (ptr[size - 1] == BENCH_PAINT_BYTE)) {
+        size--;
+    }
+    return size;
+}
+
+/**
+ * \brief   Print the stack and scratch usage of proc measured since BENCH_MEM_START
+ * \details
+ * Print `SCRATCH, proc, case, name, used, size` for each scratch buffer registered by BENCH_SCRATCH,
+ * then `MEMUSE, proc, case, stack, scratch_used, scratch_size` with the sums of the scratch buffers.
+ */
+__STATIC_INLINE void __bench_mem_report(const char *proc, const char *tcase, unsigned long stack, void *const *buf,
+                                        const unsigned long *size, const char *const *name, unsigned long cnt)
+{
+    unsigned long i, used, sumused = 0, sumsize = 0;
+
+    for (i = 0; i < cnt; i++) {
+        used = __bench_scratch_used(buf[i], size[i]);
+        printf("SCRATCH, %s, %s, %s, %lu, %lu\n", proc, tcase, name[i], used, size[i]);
+        sumused += used;
+        sumsize += size[i];
+    }
+    printf("MEMUSE, %s, %s, %lu, %lu, %lu\n", proc, tcase, stack, sumused, sumsize);
+}
+
+#ifndef BENCH_SCRATCH_MAX
+/** Maximum number of scratch buffers registered by BENCH_SCRATCH for one benchmark */
+#define BENCH_SCRATCH_MAX       4
+#endif
+
+#define BENCH_MEM_DECLARE_VAR() static void *_bc_scrbuf[BENCH_SCRATCH_MAX]; \
+                                static unsigned long _bc_scrsize[BENCH_SCRATCH_MAX]; \
+                                static const char *_bc_scrname[BENCH_SCRATCH_MAX]; \
+                                static volatile unsigned long _bc_scrcnt, _bc_stktop;
+/** Register the scratch buffer buf of size bytes used by the next benchmark, such as the buffer of *_get_buffer_size */
+#define BENCH_SCRATCH(buf, size) if (_bc_scrcnt < BENCH_SCRATCH_MAX) { \
+                                    _bc_scrbuf[_bc_scrcnt] = (void *)(buf); \
+                                    _bc_scrsize[_bc_scrcnt] = (unsigned long)(size); \
+                                    _bc_scrname[_bc_scrcnt] = #buf; \
+                                    _bc_scrcnt += 1; \
+                                }
+/** Paint the scratch buffers and the free stack below the caller */
+#define BENCH_MEM_START(proc)   for (_bc_stktop = 0; _bc_stktop < _bc_scrcnt; _bc_stktop++) { \
+                                    __bench_scratch_paint(_bc_scrbuf[_bc_stktop], _bc_scrsize[_bc_stktop]); \
+                                } \
+                                _bc_stktop = __bench_get_sp(); \
+                                __bench_stack_paint(_bc_stktop, #proc);
+/** Print the stack and scratch usage, and unregister the scratch buffers */
+#define BENCH_MEM_END(proc)     __bench_mem_report(#proc, __func__, __bench_stack_used(_bc_stktop), \
+                                                   _bc_scrbuf, _bc_scrsize, _bc_scrname, _bc_scrcnt); \
+                                _bc_scrcnt = 0;
+#else
+#define BENCH_MEM_DECLARE_VAR()
+#define BENCH_SCRATCH(buf, size)
+#define BENCH_MEM_START(proc)
+#define BENCH_MEM_END(proc)
+#endif /* #if defined(BENCH_MEMORY) && !defined(DISABLE_NMSIS_BENCH) */
+
 #ifndef DISABLE_NMSIS_BENCH
 
+/**
+ * \brief   Print the statistics of the cycles measured by BENCH_RUN
+ * \param [in]     proc       name of the benchmark
+ * \param [in,out] cyc        cycles of each iteration, sorted by this function
+ * \param [in]     iters      number of iterations
+ * \param [in]     nsamples   number of elements processed by each iteration
+ * \details
+ * Print `BENCHRUN, proc, iters, nsamples, min, median, p90, p99, max, cpe` where the percentiles
+ * use the nearest rank and cpe is the median cycles per element with 2 decimals. p99 is the max
+ * with less than 100 iterations, the line keeps the same fields whatever BENCH_RUN_MAX_ITERS is.
+ * A `CSV, proc, median` line is also printed for the tools parsing the BENCH_END lines.
+ */
+__STATIC_INLINE void __bench_run_report(const char *proc, Bench_Type *cyc, unsigned long iters, unsigned long nsamples)
+{
+    unsigned long i, j, cpe;
+    Bench_Type val, med;
+
+    /* Insertion sort, iters is small */
+    for (i = 1; i < iters; i++) {
+        val = cyc[i];
+        for (j = i; (j > 0) && (cyc[j - 1] > val); j--) {
+            cyc[j] = cyc[j - 1];
+        }
+        cyc[j] = val;
+    }
+
+    med = cyc[(iters - 1) / 2];
+    if (nsamples == 0) {
+        nsamples = 1;
+    }
+    cpe = (unsigned long)((med * 100 + nsamples / 2) / nsamples);
+    printf("BENCHRUN, %s, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu.%02lu\n", proc, iters, nsamples,
+           (unsigned long)cyc[0], (unsigned long)med,
+           (unsigned long)cyc[(90 * iters + 99) / 100 - 1], (unsigned long)cyc[(99 * iters + 99) / 100 - 1],
+           (unsigned long)cyc[iters - 1], cpe / 100, cpe % 100);
+    printf("CSV, %s, %lu\n", proc, (unsigned long)med);
+}
+
 /** Declare benchmark required variables, need to be placed above all BENCH_xxx macros in each c source code if BENCH_xxx used */
 #define BENCH_DECLARE_VAR()     static volatile Bench_Type _bc_sttcyc, _bc_endcyc, _bc_usecyc, _bc_sumcyc; \
-                                static volatile unsigned long _bc_lpcnt, _bc_ercd;
+                                static volatile unsigned long _bc_lpcnt, _bc_ercd; \
+                                BENCH_MEM_DECLARE_VAR()
 
 /** Initialize benchmark environment, need to called in before other BENCH_xxx macros are called */
 #define BENCH_INIT()            printf("Benchmark initialized\n"); \
@@ -116,6 +332,7 @@ __STATIC_FORCEINLINE void __prepare_bench_env(void)
 
 /** Start to do benchmark for proc, and record start cycle, and reset error code */
 #define BENCH_START(proc)       _bc_ercd = 0; \
+                                BENCH_MEM_START(proc) \
                                 _bc_sttcyc = READ_CYCLE();
 
 /** Sample a benchmark for proc, and record this start -> sample cost cycle, and accumulate it to sum cycle */
@@ -125,7 +342,8 @@ __STATIC_FORCEINLINE void __prepare_bench_env(void)
 
 /** Mark end of benchmark for proc, and calc used cycle, and print it */
 #define BENCH_END(proc)         BENCH_SAMPLE(proc); \
-                                printf("CSV, %s, %lu\n", #proc, (unsigned long)_bc_usecyc);
+                                printf("CSV, %s, %lu\n", #proc, (unsigned long)_bc_usecyc); \
+                                BENCH_MEM_END(proc)
 
 /** Mark stop of benchmark, start -> sample -> sample -> stop, and print the sum cycle of a proc */
 #define BENCH_STOP(proc)        printf("CSV, %s, %lu\n", #proc, (unsigned long)_bc_sumcyc);
@@ -150,6 +368,36 @@ __STATIC_FORCEINLINE void __prepare_bench_env(void)
                                 } else { \
                                     printf("SUCCESS, %s\n", #proc); \
                                 }
+
+/**
+ * Run the statement stmt warmup times, then measure iters runs of it (at most BENCH_RUN_MAX_ITERS),
+ * and print their statistics with nsamples elements per run, see __bench_run_report.
+ * The sum cycle and loop count of BENCH_STAT are the ones of the measured runs.
+ */
+#define BENCH_RUN(proc, iters, warmup, nsamples, ...)                                          \
+                                do {                                                           \
+                                    Bench_Type _bc_runcyc[BENCH_RUN_MAX_ITERS];                \
+                                    unsigned long _bc_runi, _bc_runn = (iters);                \
+                                    if (_bc_runn > BENCH_RUN_MAX_ITERS) {                      \
+                                        printf("WARNING, %s, %lu iterations clamped to BENCH_RUN_MAX_ITERS %d\n", \
+                                               #proc, _bc_runn, BENCH_RUN_MAX_ITERS);          \
+                                        _bc_runn = BENCH_RUN_MAX_ITERS;                        \
+                                    }                                                          \
+                                    if (_bc_runn == 0) {                                       \
+                                        _bc_runn = 1;                                          \
+                                    }                                                          \
+                                    _bc_ercd = 0; _bc_sumcyc = 0; _bc_lpcnt = 0;               \
+                                    for (_bc_runi = 0; _bc_runi < (unsigned long)(warmup); _bc_runi++) { \
+                                        __VA_ARGS__;                                           \
+                                    }                                                          \
+                                    for (_bc_runi = 0; _bc_runi < _bc_runn; _bc_runi++) {      \
+                                        _bc_sttcyc = READ_CYCLE();                             \
+                                        __VA_ARGS__;                                           \
+                                        BENCH_SAMPLE(proc);                                    \
+                                        _bc_runcyc[_bc_runi] = _bc_usecyc;                     \
+                                    }                                                          \
+                                    __bench_run_report(#proc, _bc_runcyc, _bc_runn, (nsamples)); \
+                                } while (0)
 #else
 #define BENCH_DECLARE_VAR()     static volatile unsigned long _bc_ercd, _bc_lpcnt;
 #define BENCH_INIT()            _bc_ercd = 0; __prepare_bench_env();
@@ -159,6 +407,7 @@ __STATIC_FORCEINLINE void __prepare_bench_env(void)
 #define BENCH_END(proc)
 #define BENCH_STOP(proc)
 #define BENCH_STAT(proc)
+#define BENCH_RUN(proc, iters, warmup, nsamples, ...)   do { _bc_ercd = 0; __VA_ARGS__; } while (0)
 #define BENCH_GET_USECYC()      (0)
 #define BENCH_GET_SUMCYC()      (0)
 #define BENCH_GET_LPCNT()       (_bc_lpcnt)
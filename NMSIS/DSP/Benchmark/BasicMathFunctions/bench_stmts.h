@@ -0,0 +1,46 @@
+#ifndef __BASIC_MATH_BENCH_STMTS__
+#define __BASIC_MATH_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the BasicMathFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_abs_f32(pSrc, pDst, n) \
+    riscv_abs_f32(pSrc, pDst, n)
+#define BENCH_STMT_riscv_abs_q15(pSrc, pDst, n) \
+    riscv_abs_q15(pSrc, pDst, n)
+#define BENCH_STMT_riscv_add_f32(pSrcA, pSrcB, pDst, n) \
+    riscv_add_f32(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_add_q31(pSrcA, pSrcB, pDst, n) \
+    riscv_add_q31(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_add_q15(pSrcA, pSrcB, pDst, n) \
+    riscv_add_q15(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_add_q7(pSrcA, pSrcB, pDst, n) \
+    riscv_add_q7(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_sub_f32(pSrcA, pSrcB, pDst, n) \
+    riscv_sub_f32(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_mult_f32(pSrcA, pSrcB, pDst, n) \
+    riscv_mult_f32(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_mult_q31(pSrcA, pSrcB, pDst, n) \
+    riscv_mult_q31(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_mult_q15(pSrcA, pSrcB, pDst, n) \
+    riscv_mult_q15(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_mult_q7(pSrcA, pSrcB, pDst, n) \
+    riscv_mult_q7(pSrcA, pSrcB, pDst, n)
+#define BENCH_STMT_riscv_dot_prod_f32(pSrcA, pSrcB, n, pResult) \
+    riscv_dot_prod_f32(pSrcA, pSrcB, n, pResult)
+#define BENCH_STMT_riscv_dot_prod_q31(pSrcA, pSrcB, n, pResult) \
+    riscv_dot_prod_q31(pSrcA, pSrcB, n, pResult)
+#define BENCH_STMT_riscv_dot_prod_q15(pSrcA, pSrcB, n, pResult) \
+    riscv_dot_prod_q15(pSrcA, pSrcB, n, pResult)
+#define BENCH_STMT_riscv_dot_prod_q7(pSrcA, pSrcB, n, pResult) \
+    riscv_dot_prod_q7(pSrcA, pSrcB, n, pResult)
+#define BENCH_STMT_riscv_offset_f32(pSrc, offset, pDst, n) \
+    riscv_offset_f32(pSrc, offset, pDst, n)
+#define BENCH_STMT_riscv_scale_f32(pSrc, scale, pDst, n) \
+    riscv_scale_f32(pSrc, scale, pDst, n)
+#define BENCH_STMT_riscv_scale_q31(pSrc, scaleFract, shift, pDst, n) \
+    riscv_scale_q31(pSrc, scaleFract, shift, pDst, n)
+
+#endif /* __BASIC_MATH_BENCH_STMTS__ */
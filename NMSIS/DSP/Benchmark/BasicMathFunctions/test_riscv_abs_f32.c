@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/abs_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,7 +15,7 @@ void abs_riscv_abs_f32(void)
 
     // riscv_abs_f32.c
     BENCH_START(riscv_abs_f32);
-    riscv_abs_f32(abs_f32_input, abs_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_abs_f32(abs_f32_input, abs_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_abs_f32);
 
     return;
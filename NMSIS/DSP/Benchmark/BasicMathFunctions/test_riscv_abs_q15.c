@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/abs_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,7 +16,7 @@ void abs_riscv_abs_q15(void)
 
     // riscv_abs_q15.c
     BENCH_START(riscv_abs_q15);
-    riscv_abs_q15(abs_q15_input, abs_q15_output, ARRAY_SIZE_Q15);
+    BENCH_STMT_riscv_abs_q15(abs_q15_input, abs_q15_output, ARRAY_SIZE_Q15);
     BENCH_END(riscv_abs_q15);
 
     return;
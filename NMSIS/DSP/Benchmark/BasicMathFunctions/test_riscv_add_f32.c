@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/add_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void add_riscv_add_f32(void)
 
     // riscv_add_f32.c
     BENCH_START(riscv_add_f32);
-    riscv_add_f32(add_f32_input1, add_f32_input2, add_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_add_f32(add_f32_input1, add_f32_input2, add_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_add_f32);
 }
\ No newline at end of file
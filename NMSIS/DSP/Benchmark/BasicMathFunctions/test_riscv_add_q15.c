@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/add_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void add_riscv_add_q15(void)
 
     // riscv_add_q15.c
     BENCH_START(riscv_add_q15);
-    riscv_add_q15(add_q15_input1, add_q15_input2, add_q15_output, ARRAY_SIZE_Q15);
+    BENCH_STMT_riscv_add_q15(add_q15_input1, add_q15_input2, add_q15_output, ARRAY_SIZE_Q15);
     BENCH_END(riscv_add_q15);
 }
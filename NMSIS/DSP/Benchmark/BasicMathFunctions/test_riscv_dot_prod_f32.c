@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/dot_prod_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void dot_prod_riscv_dot_prod_f32(void)
 
     // f32_dot
     BENCH_START(riscv_dot_prod_f32);
-    riscv_dot_prod_f32(dot_prod_f32_input1, dot_prod_f32_input2, ARRAY_SIZE_F32, &dot_prod_f32_output);
+    BENCH_STMT_riscv_dot_prod_f32(dot_prod_f32_input1, dot_prod_f32_input2, ARRAY_SIZE_F32, &dot_prod_f32_output);
     BENCH_END(riscv_dot_prod_f32);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/dot_prod_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void dot_prod_riscv_dot_prod_q31(void)
 
     // q31_dot
     BENCH_START(riscv_dot_prod_q31);
-    riscv_dot_prod_q31(dot_prod_q31_input1, dot_prod_q31_input2, ARRAY_SIZE_Q31, &dot_prod_q63_output);
+    BENCH_STMT_riscv_dot_prod_q31(dot_prod_q31_input1, dot_prod_q31_input2, ARRAY_SIZE_Q31, &dot_prod_q63_output);
     BENCH_END(riscv_dot_prod_q31);
 }
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/mult_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void mul_riscv_mul_f32(void)
 
     // f32_mult
     BENCH_START(riscv_mult_f32);
-    riscv_mult_f32(mult_f32_input1, mult_f32_input2, mult_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_mult_f32(mult_f32_input1, mult_f32_input2, mult_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_mult_f32);
 }
\ No newline at end of file
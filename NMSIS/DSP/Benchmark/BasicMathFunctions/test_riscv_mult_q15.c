@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/mult_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void mul_riscv_mul_q15(void)
 
     // q15_mult
     BENCH_START(riscv_mult_q15);
-    riscv_mult_q15(mult_q15_input1, mult_q15_input2, mult_q15_output, ARRAY_SIZE_Q15);
+    BENCH_STMT_riscv_mult_q15(mult_q15_input1, mult_q15_input2, mult_q15_output, ARRAY_SIZE_Q15);
     BENCH_END(riscv_mult_q15);
 }
\ No newline at end of file
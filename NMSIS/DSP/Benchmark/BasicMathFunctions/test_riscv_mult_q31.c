@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/mult_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void mul_riscv_mul_q31(void)
 
     // q31_mult
     BENCH_START(riscv_mult_q31);
-    riscv_mult_q31(mult_q31_input1, mult_q31_input2, mult_q31_output, ARRAY_SIZE_Q31);
+    BENCH_STMT_riscv_mult_q31(mult_q31_input1, mult_q31_input2, mult_q31_output, ARRAY_SIZE_Q31);
     BENCH_END(riscv_mult_q31);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/mult_q7/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void mul_riscv_mul_q7(void)
 
     // q7_mult
     BENCH_START(riscv_mult_q7);
-    riscv_mult_q7(mult_q7_input1, mult_q7_input2, mult_q7_output, ARRAY_SIZE_Q7);
+    BENCH_STMT_riscv_mult_q7(mult_q7_input1, mult_q7_input2, mult_q7_output, ARRAY_SIZE_Q7);
     BENCH_END(riscv_mult_q7);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/offset_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -16,6 +17,6 @@ void offset_riscv_offset_f32(void)
     // f32_offset
     generate_rand_f32(&offset_f32, 1);
     BENCH_START(riscv_offset_f32);
-    riscv_offset_f32(offset_f32_input, offset_f32, offset_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_offset_f32(offset_f32_input, offset_f32, offset_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_offset_f32);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/scale_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,6 +16,6 @@ void scale_riscv_scale_f32(void)
     generate_rand_f32(&scale_f32, 1);
 
     BENCH_START(riscv_scale_f32);
-    riscv_scale_f32(scale_f32_input, scale_f32, scale_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_scale_f32(scale_f32_input, scale_f32, scale_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_scale_f32);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/scale_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,6 +14,6 @@ void scale_riscv_scale_q31(void)
     generate_rand_q31(scale_q31_input, ARRAY_SIZE_Q31);
 
     BENCH_START(riscv_scale_q31);
-    riscv_scale_q31(scale_q31_input, scaleFract_q31, shift_q31, scale_q31_output, ARRAY_SIZE_Q31);
+    BENCH_STMT_riscv_scale_q31(scale_q31_input, scaleFract_q31, shift_q31, scale_q31_output, ARRAY_SIZE_Q31);
     BENCH_END(riscv_scale_q31);
 }
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "BasicMathFunctions/bench_stmts.h"
 #include "TestData/BasicMathFunctions/sub_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,6 +15,6 @@ void sub_riscv_sub_f32(void)
     generate_rand_f32(sub_f32_input2, ARRAY_SIZE_F32);
 
     BENCH_START(riscv_sub_f32);
-    riscv_sub_f32(sub_f32_input1, sub_f32_input2, sub_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_sub_f32(sub_f32_input1, sub_f32_input2, sub_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_sub_f32);
 }
\ No newline at end of file
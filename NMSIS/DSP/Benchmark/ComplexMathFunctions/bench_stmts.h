@@ -0,0 +1,14 @@
+#ifndef __COMPLEX_MATH_BENCH_STMTS__
+#define __COMPLEX_MATH_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the ComplexMathFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_cmplx_mag_f32(pSrc, pDst, n) \
+    riscv_cmplx_mag_f32(pSrc, pDst, n)
+#define BENCH_STMT_riscv_cmplx_mult_cmplx_f32(pSrcA, pSrcB, pDst, n) \
+    riscv_cmplx_mult_cmplx_f32(pSrcA, pSrcB, pDst, n)
+
+#endif /* __COMPLEX_MATH_BENCH_STMTS__ */
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "ComplexMathFunctions/bench_stmts.h"
 #include "TestData/ComplexMathFunctions/cmplx_mag_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,7 +14,7 @@ void cmplx_mag_riscv_cmplx_mag_f32(void)
     generate_rand_f32(cmplx_mag_f32_input, 2 * ARRAY_SIZE_F32);
 
     BENCH_START(riscv_cmplx_mag_f32);
-    riscv_cmplx_mag_f32(cmplx_mag_f32_input, cmplx_mag_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_cmplx_mag_f32(cmplx_mag_f32_input, cmplx_mag_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_cmplx_mag_f32);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "ComplexMathFunctions/bench_stmts.h"
 #include "TestData/ComplexMathFunctions/cmplx_mult_cmplx_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -15,7 +16,7 @@ void cmplx_mult_cmplx_riscv_cmplx_mult_cmplx_f32(void)
     generate_rand_f32(cmplx_mult_cmplx_f32_input2, 2 * ARRAY_SIZE_F32);
 
     BENCH_START(riscv_cmplx_mult_cmplx_f32);
-    riscv_cmplx_mult_cmplx_f32(cmplx_mult_cmplx_f32_input1, cmplx_mult_cmplx_f32_input2, cmplx_mult_cmplx_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_cmplx_mult_cmplx_f32(cmplx_mult_cmplx_f32_input1, cmplx_mult_cmplx_f32_input2, cmplx_mult_cmplx_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_cmplx_mult_cmplx_f32);
 
     return;
@@ -0,0 +1,12 @@
+#ifndef __FAST_MATH_BENCH_STMTS__
+#define __FAST_MATH_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the FastMathFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_vexp_f32(pSrc, pDst, n) \
+    riscv_vexp_f32(pSrc, pDst, n)
+
+#endif /* __FAST_MATH_BENCH_STMTS__ */
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FastMathFunctions/bench_stmts.h"
 #include "TestData/FastMathFunctions/vexp_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,7 +14,7 @@ void vexp_riscv_vexp_f32(void)
     generate_rand_f32(vexp_f32_input, ARRAY_SIZE_F32);
 
     BENCH_START(riscv_vexp_f32);
-    riscv_vexp_f32(vexp_f32_input, vexp_f32_output, ARRAY_SIZE_F32);
+    BENCH_STMT_riscv_vexp_f32(vexp_f32_input, vexp_f32_output, ARRAY_SIZE_F32);
     BENCH_END(riscv_vexp_f32);
 
     return;
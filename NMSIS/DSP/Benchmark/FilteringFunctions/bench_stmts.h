@@ -0,0 +1,42 @@
+#ifndef __FILTERING_BENCH_STMTS__
+#define __FILTERING_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the FilteringFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_fir_f32(S, pSrc, pDst, n) \
+    riscv_fir_f32(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_fir_q31(S, pSrc, pDst, n) \
+    riscv_fir_q31(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_fir_q15(S, pSrc, pDst, n) \
+    riscv_fir_q15(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_fir_q7(S, pSrc, pDst, n) \
+    riscv_fir_q7(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_biquad_cascade_df1_f32(S, pSrc, pDst, n) \
+    riscv_biquad_cascade_df1_f32(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_biquad_cascade_df1_q31(S, pSrc, pDst, n) \
+    riscv_biquad_cascade_df1_q31(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_biquad_cascade_df1_q15(S, pSrc, pDst, n) \
+    riscv_biquad_cascade_df1_q15(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_biquad_cascade_df2T_f32(S, pSrc, pDst, n) \
+    riscv_biquad_cascade_df2T_f32(S, pSrc, pDst, n)
+#define BENCH_STMT_riscv_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_conv_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_conv_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_conv_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_conv_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_conv_q7(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_conv_q7(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_correlate_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_correlate_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_correlate_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_correlate_q15(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+#define BENCH_STMT_riscv_correlate_q7(pSrcA, srcALen, pSrcB, srcBLen, pDst) \
+    riscv_correlate_q7(pSrcA, srcALen, pSrcB, srcBLen, pDst)
+
+#endif /* __FILTERING_BENCH_STMTS__ */
@@ -16,6 +16,7 @@ extern void df2T_riscv_biquad_cascade_stereo_df2T_f16();
 extern void df2T_riscv_biquad_cascade_stereo_df2T_f32();
 
 extern void conv_riscv_conv_f32();
+extern void conv_riscv_conv_fft_f32();
 extern void conv_riscv_conv_q7();
 extern void conv_riscv_conv_q15();
 extern void conv_riscv_conv_q31();
@@ -27,6 +28,7 @@ extern void conv_iscv_conv_fast_opt_q15();
 
 extern void correlate_riscv_correlate_f16();
 extern void correlate_riscv_correlate_f32();
+extern void correlate_riscv_correlate_fft_f32();
 extern void correlate_riscv_correlate_f64();
 extern void correlate_riscv_correlate_q7();
 extern void correlate_riscv_correlate_q15();
@@ -47,6 +49,7 @@ extern void convPartial_riscv_conv_partial_opt_q15();
 extern void convPartial_riscv_conv_partial_fast_opt_q15();
 extern void fir_riscv_fir_f16();
 extern void fir_riscv_fir_f32();
+extern void fir_riscv_fir_fft_f32();
 extern void fir_riscv_fir_f64();
 extern void fir_riscv_fir_q7();
 extern void fir_riscv_fir_q15();
@@ -41,6 +41,7 @@ int main()
 
 #ifdef Test_Conv
     conv_riscv_conv_f32();
+    conv_riscv_conv_fft_f32();
     conv_riscv_conv_q7();
     conv_riscv_conv_q15();
     conv_riscv_conv_q31();
@@ -55,6 +56,7 @@ int main()
 
     correlate_riscv_correlate_f16();
     correlate_riscv_correlate_f32();
+    correlate_riscv_correlate_fft_f32();
     correlate_riscv_correlate_f64();
     correlate_riscv_correlate_q7();
     correlate_riscv_correlate_q15();
@@ -81,6 +83,7 @@ int main()
 #ifdef Test_FIR
     fir_riscv_fir_f16();
     fir_riscv_fir_f32();
+    fir_riscv_fir_fft_f32();
     fir_riscv_fir_f64();
     fir_riscv_fir_q7();
     fir_riscv_fir_q15();
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/FilteringFunctions/biquad_cascade_df1_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -16,7 +17,7 @@ void df1_riscv_biquad_cascade_df1_q15(void)
 
     riscv_biquad_cascade_df1_init_q15(&S, numStages, IIRCoeffsQ15LP, IIRStateq15, 1);
     BENCH_START(riscv_biquad_cascade_df1_q15);
-    riscv_biquad_cascade_df1_q15(&S, testInput_q15_50Hz_200Hz, biquad_cascade_df1_q15_output, TEST_LENGTH_SAMPLES);
+    BENCH_STMT_riscv_biquad_cascade_df1_q15(&S, testInput_q15_50Hz_200Hz, biquad_cascade_df1_q15_output, TEST_LENGTH_SAMPLES);
     BENCH_END(riscv_biquad_cascade_df1_q15);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/FilteringFunctions/biquad_cascade_df1_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -23,7 +24,7 @@ void df1_riscv_biquad_cascade_df1_q31(void)
 
     riscv_biquad_cascade_df1_init_q31(&S, numStages, IIRCoeffsQ31LP, IIRStateq31, 1);
     BENCH_START(riscv_biquad_cascade_df1_q31);
-    riscv_biquad_cascade_df1_q31(&S, testInput_q31_50Hz_200Hz, biquad_cascade_df1_q31_output, TEST_LENGTH_SAMPLES);
+    BENCH_STMT_riscv_biquad_cascade_df1_q31(&S, testInput_q31_50Hz_200Hz, biquad_cascade_df1_q31_output, TEST_LENGTH_SAMPLES);
     BENCH_END(riscv_biquad_cascade_df1_q31);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/conv_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,8 +15,8 @@ void conv_riscv_conv_f32(void)
     generate_rand_f32(test_conv_input_f32_B, ARRAYB_SIZE_F32);
 
     BENCH_START(riscv_conv_f32);
-    riscv_conv_f32(test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
-                 conv_f32_output);
+    BENCH_STMT_riscv_conv_f32(test_conv_input_f32_A, ARRAYA_SIZE_F32, test_conv_input_f32_B, ARRAYB_SIZE_F32,
+                            conv_f32_output);
     BENCH_END(riscv_conv_f32);
     return;
 }
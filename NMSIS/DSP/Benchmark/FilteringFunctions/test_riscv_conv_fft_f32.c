@@ -0,0 +1,22 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/ConvolutionFunctions/conv_fft_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void conv_riscv_conv_fft_f32(void)
+{
+    float32_t conv_fft_f32_output[ARRAYA_SIZE_F32 + ARRAYB_SIZE_F32 - 1];
+
+    generate_rand_f32(test_conv_fft_input_f32_A, ARRAYA_SIZE_F32);
+    generate_rand_f32(test_conv_fft_input_f32_B, ARRAYB_SIZE_F32);
+
+    TEST_ASSERT_TRUE(riscv_conv_fft_scratch_size_f32(ARRAYA_SIZE_F32, ARRAYB_SIZE_F32) <= CONV_FFT_SCRATCH_SIZE);
+    BENCH_START(riscv_conv_fft_f32);
+    riscv_conv_fft_f32(test_conv_fft_input_f32_A, ARRAYA_SIZE_F32, test_conv_fft_input_f32_B, ARRAYB_SIZE_F32,
+                       conv_fft_f32_output, conv_fft_f32_scratch);
+    BENCH_END(riscv_conv_fft_f32);
+    return;
+}
@@ -13,6 +13,8 @@ void conv_riscv_conv_opt_q15(void)
     generate_rand_q15(test_conv_input_q15_A, ARRAYA_SIZE_Q15);
     generate_rand_q15(test_conv_input_q15_B, ARRAYB_SIZE_Q15);
 
+    BENCH_SCRATCH(q15_pScratch1, sizeof(q15_pScratch1));
+    BENCH_SCRATCH(q15_pScratch2, sizeof(q15_pScratch2));
     BENCH_START(riscv_conv_opt_q15);
     riscv_conv_opt_q15(test_conv_input_q15_A, ARRAYA_SIZE_Q15, test_conv_input_q15_B, ARRAYB_SIZE_Q15,
                     conv_opt_q15_output, q15_pScratch1, q15_pScratch2);
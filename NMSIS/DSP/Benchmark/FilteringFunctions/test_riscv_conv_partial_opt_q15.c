@@ -14,6 +14,8 @@ void convPartial_riscv_conv_partial_opt_q15(void)
     generate_rand_q15(test_conv_input_q15_A, ARRAYA_SIZE_Q15);
     generate_rand_q15(test_conv_input_q15_B, ARRAYB_SIZE_Q15);
 
+    BENCH_SCRATCH(pScratch1, sizeof(pScratch1));
+    BENCH_SCRATCH(pScratch2, sizeof(pScratch2));
     BENCH_START(riscv_conv_partial_opt_q15);
     riscv_status result = riscv_conv_partial_opt_q15(test_conv_input_q15_A, ARRAYA_SIZE_Q15, test_conv_input_q15_B, ARRAYB_SIZE_Q15,
                             conv_q15_output, firstIndex, numPoints, pScratch1, pScratch2);
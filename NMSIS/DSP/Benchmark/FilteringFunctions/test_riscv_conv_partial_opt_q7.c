@@ -14,6 +14,8 @@ void convPartial_riscv_conv_partial_opt_q7(void)
     generate_rand_q7(test_conv_input_q7_A, ARRAYA_SIZE_Q7);
     generate_rand_q7(test_conv_input_q7_B, ARRAYB_SIZE_Q7);
 
+    BENCH_SCRATCH(pScratch1, sizeof(pScratch1));
+    BENCH_SCRATCH(pScratch2, sizeof(pScratch2));
     BENCH_START(riscv_conv_partial_opt_q7);
     riscv_status result = riscv_conv_partial_opt_q7(test_conv_input_q7_A, ARRAYA_SIZE_Q7, test_conv_input_q7_B, ARRAYB_SIZE_Q7,
                             conv_q7_output, firstIndex, numPoints, pScratch1, pScratch2);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/conv_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,7 +15,7 @@ void conv_riscv_conv_q15(void)
     generate_rand_q15(test_conv_input_q15_B, ARRAYB_SIZE_Q15);
 
     BENCH_START(riscv_conv_q15);
-    riscv_conv_q15(test_conv_input_q15_A, ARRAYA_SIZE_Q15, test_conv_input_q15_B, ARRAYB_SIZE_Q15, conv_q15_output);
+    BENCH_STMT_riscv_conv_q15(test_conv_input_q15_A, ARRAYA_SIZE_Q15, test_conv_input_q15_B, ARRAYB_SIZE_Q15, conv_q15_output);
     BENCH_END(riscv_conv_q15);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/conv_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,7 +15,7 @@ void conv_riscv_conv_q31(void)
     generate_rand_q31(test_conv_input_q31_B, ARRAYB_SIZE_Q31);
 
     BENCH_START(riscv_conv_q31);
-    riscv_conv_q31(test_conv_input_q31_A, ARRAYA_SIZE_Q31, test_conv_input_q31_B, ARRAYB_SIZE_Q31, conv_q31_output);
+    BENCH_STMT_riscv_conv_q31(test_conv_input_q31_A, ARRAYA_SIZE_Q31, test_conv_input_q31_B, ARRAYB_SIZE_Q31, conv_q31_output);
     BENCH_END(riscv_conv_q31);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/conv_q7/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,7 +15,7 @@ void conv_riscv_conv_q7(void)
     generate_rand_q7(test_conv_input_q7_B, ARRAYB_SIZE_Q7);
 
     BENCH_START(riscv_conv_q7);
-    riscv_conv_q7(test_conv_input_q7_A, ARRAYA_SIZE_Q7, test_conv_input_q7_B, ARRAYB_SIZE_Q7, conv_q7_output);
+    BENCH_STMT_riscv_conv_q7(test_conv_input_q7_A, ARRAYA_SIZE_Q7, test_conv_input_q7_B, ARRAYB_SIZE_Q7, conv_q7_output);
     BENCH_END(riscv_conv_q7);
 
     return;
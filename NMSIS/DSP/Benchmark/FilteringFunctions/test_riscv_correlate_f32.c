@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/correlate_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,8 +15,8 @@ void correlate_riscv_correlate_f32(void)
     generate_rand_f32(correlate_input_f32_B, ARRAYB_SIZE_F32);
 
     BENCH_START(riscv_correlate_f32);
-    riscv_correlate_f32(correlate_input_f32_A, ARRAYA_SIZE_F32, correlate_input_f32_B, ARRAYB_SIZE_F32,
-                      correlate_f32_output);
+    BENCH_STMT_riscv_correlate_f32(correlate_input_f32_A, ARRAYA_SIZE_F32, correlate_input_f32_B, ARRAYB_SIZE_F32,
+                                 correlate_f32_output);
     BENCH_END(riscv_correlate_f32);
     return;
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ void correlate_riscv_correlate_fast_opt_q15(void)
     generate_rand_q15(correlate_input_q15_A, ARRAYA_SIZE_Q15);
     generate_rand_q15(correlate_input_q15_B, ARRAYB_SIZE_Q15);
 
+    BENCH_SCRATCH(q15_pScratch1, sizeof(q15_pScratch1));
     BENCH_START(riscv_correlate_fast_opt_q15);
     riscv_correlate_fast_opt_q15(correlate_input_q15_A, ARRAYA_SIZE_Q15,
                                correlate_input_q15_B, ARRAYB_SIZE_Q15, correlate_q15_output,
@@ -13,6 +13,8 @@ void correlate_riscv_correlate_opt_q7(void)
     generate_rand_q7(correlate_input_q7_A, ARRAYA_SIZE_Q7);
     generate_rand_q7(correlate_input_q7_B, ARRAYB_SIZE_Q7);
 
+    BENCH_SCRATCH(q15_pScratch1, sizeof(q15_pScratch1));
+    BENCH_SCRATCH(q15_pScratch2, sizeof(q15_pScratch2));
     BENCH_START(riscv_correlate_opt_q7);
     riscv_correlate_opt_q7(correlate_input_q7_A, ARRAYA_SIZE_Q7, correlate_input_q7_B, ARRAYB_SIZE_Q7,
                           correlate_q7_output, q15_pScratch1, q15_pScratch2);
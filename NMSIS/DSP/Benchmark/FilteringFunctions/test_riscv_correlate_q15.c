@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/correlate_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,8 +15,8 @@ void correlate_riscv_correlate_q15(void)
     generate_rand_q15(correlate_input_q15_B, ARRAYB_SIZE_Q15);
 
     BENCH_START(riscv_correlate_q15);
-    riscv_correlate_q15(correlate_input_q15_A, ARRAYA_SIZE_Q15, correlate_input_q15_B, ARRAYB_SIZE_Q15,
-                      correlate_q15_output);
+    BENCH_STMT_riscv_correlate_q15(correlate_input_q15_A, ARRAYA_SIZE_Q15, correlate_input_q15_B, ARRAYB_SIZE_Q15,
+                                 correlate_q15_output);
     BENCH_END(riscv_correlate_q15);
     return;
 }
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/correlate_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,8 +15,8 @@ void correlate_riscv_correlate_q31(void)
     generate_rand_q31(correlate_input_q31_B, ARRAYB_SIZE_Q31);
 
     BENCH_START(riscv_correlate_q31);
-    riscv_correlate_q31(correlate_input_q31_A, ARRAYA_SIZE_Q31, correlate_input_q31_B, ARRAYB_SIZE_Q31,
-                      correlate_q31_output);
+    BENCH_STMT_riscv_correlate_q31(correlate_input_q31_A, ARRAYA_SIZE_Q31, correlate_input_q31_B, ARRAYB_SIZE_Q31,
+                                 correlate_q31_output);
     BENCH_END(riscv_correlate_q31);
 
     return;
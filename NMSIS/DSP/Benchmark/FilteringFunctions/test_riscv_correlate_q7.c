@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/ConvolutionFunctions/correlate_q7/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,8 +15,8 @@ void correlate_riscv_correlate_q7(void)
     generate_rand_q7(correlate_input_q7_B, ARRAYB_SIZE_Q7);
 
     BENCH_START(riscv_correlate_q7);
-    riscv_correlate_q7(correlate_input_q7_A, ARRAYA_SIZE_Q7, correlate_input_q7_B, ARRAYB_SIZE_Q7,
-                      correlate_q7_output);
+    BENCH_STMT_riscv_correlate_q7(correlate_input_q7_A, ARRAYA_SIZE_Q7, correlate_input_q7_B, ARRAYB_SIZE_Q7,
+                                 correlate_q7_output);
     BENCH_END(riscv_correlate_q7);
     return;
 }
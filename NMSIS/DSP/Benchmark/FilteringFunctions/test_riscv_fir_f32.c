@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/FilteringFunctions/fir_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -18,7 +19,7 @@ void fir_riscv_fir_f32(void)
     /* clang-format on */
     riscv_fir_init_f32(&S, NUM_TAPS, firCoeffs32LP, firStatef32, TEST_LENGTH_SAMPLES);
     BENCH_START(riscv_fir_f32);
-    riscv_fir_f32(&S, testInput_f32_50Hz_200Hz, fir_f32_output, TEST_LENGTH_SAMPLES);
+    BENCH_STMT_riscv_fir_f32(&S, testInput_f32_50Hz_200Hz, fir_f32_output, TEST_LENGTH_SAMPLES);
     BENCH_END(riscv_fir_f32);
 
     return;
@@ -0,0 +1,34 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/FilteringFunctions/fir_fft_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void fir_riscv_fir_fft_f32(void)
+{
+    riscv_fir_fft_instance_f32 S;
+    riscv_status result;
+
+    generate_rand_f32(fir_fft_input_f32, TEST_LENGTH_SAMPLES);
+    generate_rand_f32(fir_fft_coeffs_f32, NUM_TAPS);
+
+    /* Uniform partitioning */
+    TEST_ASSERT_TRUE(riscv_fir_fft_buffer_size_f32(NUM_TAPS, FIR_FFT_BLOCK, NULL, NULL, 0) <= FIR_FFT_BUFFER_SIZE);
+    result = riscv_fir_fft_init_f32(&S, NUM_TAPS, fir_fft_coeffs_f32, FIR_FFT_BLOCK, NULL, NULL, 0, fir_fft_buffer_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+    BENCH_START(riscv_fir_fft_f32);
+    riscv_fir_fft_f32(&S, fir_fft_input_f32, fir_fft_output_f32, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_fir_fft_f32);
+
+    /* Non-uniform partitioning */
+    TEST_ASSERT_TRUE(riscv_fir_fft_buffer_size_f32(NUM_TAPS, FIR_FFT_BLOCK, fir_fft_part_lens, fir_fft_num_parts, 2) <= FIR_FFT_BUFFER_SIZE);
+    result = riscv_fir_fft_init_f32(&S, NUM_TAPS, fir_fft_coeffs_f32, FIR_FFT_BLOCK, fir_fft_part_lens, fir_fft_num_parts, 2, fir_fft_buffer_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+    BENCH_START(riscv_fir_fft_nonuniform_f32);
+    riscv_fir_fft_f32(&S, fir_fft_input_f32, fir_fft_output_f32, TEST_LENGTH_SAMPLES);
+    BENCH_END(riscv_fir_fft_nonuniform_f32);
+
+    return;
+}
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/FilteringFunctions/fir_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -19,7 +20,7 @@ void fir_riscv_fir_q15(void)
     /* clang-format on */
     riscv_fir_init_q15(&S, NUM_TAPS_Q15, firCoeffLP_q15, firStateq15, TEST_LENGTH_SAMPLES_Q15);
     BENCH_START(riscv_fir_q15);
-    riscv_fir_q15(&S, testInput_q15_50Hz_200Hz, fir_q15_output, TEST_LENGTH_SAMPLES_Q15);
+    BENCH_STMT_riscv_fir_q15(&S, testInput_q15_50Hz_200Hz, fir_q15_output, TEST_LENGTH_SAMPLES_Q15);
     BENCH_END(riscv_fir_q15);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/FilteringFunctions/fir_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -19,7 +20,7 @@ void fir_riscv_fir_q31(void)
     /* clang-format on */
     riscv_fir_init_q31(&S, NUM_TAPS_Q31, firCoeffLP_q31, firStateq31, TEST_LENGTH_SAMPLES_Q31);
     BENCH_START(riscv_fir_q31);
-    riscv_fir_q31(&S, testInput_q31_50Hz_200Hz, fir_q31_output, TEST_LENGTH_SAMPLES_Q31);
+    BENCH_STMT_riscv_fir_q31(&S, testInput_q31_50Hz_200Hz, fir_q31_output, TEST_LENGTH_SAMPLES_Q31);
     BENCH_END(riscv_fir_q31);
 
     return;
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "FilteringFunctions/bench_stmts.h"
 #include "TestData/FilteringFunctions/fir_q7/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -19,7 +20,7 @@ void fir_riscv_fir_q7(void)
     /* clang-format on */
     riscv_fir_init_q7(&S, NUM_TAPS_Q7, firCoeffLP_q7, firStateq7, TEST_LENGTH_SAMPLES_Q7);
     BENCH_START(riscv_fir_q7);
-    riscv_fir_q7(&S, testInput_q7_50Hz_200Hz, fir_q7_output, TEST_LENGTH_SAMPLES_Q7);
+    BENCH_STMT_riscv_fir_q7(&S, testInput_q7_50Hz_200Hz, fir_q7_output, TEST_LENGTH_SAMPLES_Q7);
     BENCH_END(riscv_fir_q7);
 
     return;
@@ -0,0 +1,32 @@
+#ifndef __MATRIX_BENCH_STMTS__
+#define __MATRIX_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the MatrixFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_mat_add_f32(pSrcA, pSrcB, pDst) \
+    riscv_mat_add_f32(pSrcA, pSrcB, pDst)
+#define BENCH_STMT_riscv_mat_add_q31(pSrcA, pSrcB, pDst) \
+    riscv_mat_add_q31(pSrcA, pSrcB, pDst)
+#define BENCH_STMT_riscv_mat_add_q15(pSrcA, pSrcB, pDst) \
+    riscv_mat_add_q15(pSrcA, pSrcB, pDst)
+#define BENCH_STMT_riscv_mat_mult_f32(pSrcA, pSrcB, pDst) \
+    riscv_mat_mult_f32(pSrcA, pSrcB, pDst)
+#define BENCH_STMT_riscv_mat_mult_q31(pSrcA, pSrcB, pDst) \
+    riscv_mat_mult_q31(pSrcA, pSrcB, pDst)
+#define BENCH_STMT_riscv_mat_trans_f32(pSrc, pDst) \
+    riscv_mat_trans_f32(pSrc, pDst)
+#define BENCH_STMT_riscv_mat_trans_q31(pSrc, pDst) \
+    riscv_mat_trans_q31(pSrc, pDst)
+#define BENCH_STMT_riscv_mat_trans_q15(pSrc, pDst) \
+    riscv_mat_trans_q15(pSrc, pDst)
+#define BENCH_STMT_riscv_mat_vec_mult_f32(pSrcMat, pVec, pDst) \
+    riscv_mat_vec_mult_f32(pSrcMat, pVec, pDst)
+#define BENCH_STMT_riscv_mat_vec_mult_q31(pSrcMat, pVec, pDst) \
+    riscv_mat_vec_mult_q31(pSrcMat, pVec, pDst)
+#define BENCH_STMT_riscv_mat_vec_mult_q15(pSrcMat, pVec, pDst) \
+    riscv_mat_vec_mult_q15(pSrcMat, pVec, pDst)
+
+#endif /* __MATRIX_BENCH_STMTS__ */
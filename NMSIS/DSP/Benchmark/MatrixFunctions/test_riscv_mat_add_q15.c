@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_add_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -21,7 +22,7 @@ void matAdd_riscv_mat_add_q15(void)
     generate_rand_q15(mat_add_q15_arrayB, M * N);
 
     BENCH_START(riscv_mat_add_q15);
-    riscv_status result = riscv_mat_add_q15(&q15_A, &q15_B, &q15_des);
+    riscv_status result = BENCH_STMT_riscv_mat_add_q15(&q15_A, &q15_B, &q15_des);
     BENCH_END(riscv_mat_add_q15);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_add_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -21,7 +22,7 @@ void matAdd_riscv_mat_add_q31(void)
     generate_rand_q31(mat_add_q31_arrayB, M * N);
 
     BENCH_START(riscv_mat_add_q31);
-    riscv_status result = riscv_mat_add_q31(&q31_A, &q31_B, &q31_des);
+    riscv_status result = BENCH_STMT_riscv_mat_add_q31(&q31_A, &q31_B, &q31_des);
     BENCH_END(riscv_mat_add_q31);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
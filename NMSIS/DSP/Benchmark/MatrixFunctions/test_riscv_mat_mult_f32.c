@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_mult_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -21,7 +22,7 @@ void matMult_riscv_mat_mult_f32(void)
     generate_rand_f32(mat_mult_f32_arrayB, K * N);
 
     BENCH_START(riscv_mat_mult_f32);
-    riscv_status result = riscv_mat_mult_f32(&f32_A, &f32_B, &f32_des);
+    riscv_status result = BENCH_STMT_riscv_mat_mult_f32(&f32_A, &f32_B, &f32_des);
     BENCH_END(riscv_mat_mult_f32);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
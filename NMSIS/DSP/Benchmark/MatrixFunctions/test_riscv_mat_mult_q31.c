@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_mult_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -22,7 +23,7 @@ void matMult_riscv_mat_mult_q31(void)
     generate_rand_q31(mat_mult_q31_arrayB, K * N);
 
     BENCH_START(riscv_mat_mult_q31);
-    riscv_status result = riscv_mat_mult_q31(&q31_A, &q31_B, &q31_des);
+    riscv_status result = BENCH_STMT_riscv_mat_mult_q31(&q31_A, &q31_B, &q31_des);
     BENCH_END(riscv_mat_mult_q31);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_trans_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -17,7 +18,7 @@ void matTrans_riscv_mat_trans_f32(void)
     generate_rand_f32(mat_trans_f32_array, M * N);
 
     BENCH_START(riscv_mat_trans_f32);
-    riscv_status result = riscv_mat_trans_f32(&f32_A, &f32_des);
+    riscv_status result = BENCH_STMT_riscv_mat_trans_f32(&f32_A, &f32_des);
     BENCH_END(riscv_mat_trans_f32);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_trans_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -18,7 +19,7 @@ void matTrans_riscv_mat_trans_q15(void)
     generate_rand_q15(mat_trans_q15_array, M * N);
 
     BENCH_START(riscv_mat_trans_q15);
-    riscv_status result = riscv_mat_trans_q15(&q15_A, &q15_des);
+    riscv_status result = BENCH_STMT_riscv_mat_trans_q15(&q15_A, &q15_des);
     BENCH_END(riscv_mat_trans_q15);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_vec_mult_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -17,7 +18,7 @@ void matVecMult_riscv_mat_vec_mult_f32(void)
     generate_rand_f32(mat_f32_vec, N);
 
     BENCH_START(riscv_mat_vec_mult_f32);
-    riscv_mat_vec_mult_f32(&f32_A, mat_f32_vec, f32_output);
+    BENCH_STMT_riscv_mat_vec_mult_f32(&f32_A, mat_f32_vec, f32_output);
     BENCH_END(riscv_mat_vec_mult_f32);
 
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_vec_mult_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -17,6 +18,6 @@ void matVecMult_riscv_mat_vec_mult_q15(void)
     generate_rand_q15(mat_q15_vec, N);
 
     BENCH_START(riscv_mat_vec_mult_q15);
-    riscv_mat_vec_mult_q15(&q15_A, mat_q15_vec, q15_output);
+    BENCH_STMT_riscv_mat_vec_mult_q15(&q15_A, mat_q15_vec, q15_output);
     BENCH_END(riscv_mat_vec_mult_q15);
 }
\ No newline at end of file
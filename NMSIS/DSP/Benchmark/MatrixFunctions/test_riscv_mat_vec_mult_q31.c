@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "MatrixFunctions/bench_stmts.h"
 #include "TestData/MatrixFunctions/mat_vec_mult_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -17,6 +18,6 @@ void matVecMult_riscv_mat_vec_mult_q31(void)
     generate_rand_q31(mat_q31_vec, N);
 
     BENCH_START(riscv_mat_vec_mult_q31);
-    riscv_mat_vec_mult_q31(&q31_A, mat_q31_vec, q31_output);
+    BENCH_STMT_riscv_mat_vec_mult_q31(&q31_A, mat_q31_vec, q31_output);
     BENCH_END(riscv_mat_vec_mult_q31);
 }
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef __FUNCS_DEF__
+#define __FUNCS_DEF__
+
+extern void sweep_basic_math();
+extern void sweep_complex_math();
+extern void sweep_fast_math();
+extern void sweep_statistics();
+extern void sweep_support();
+extern void sweep_filtering();
+extern void sweep_transform();
+extern void sweep_matrix();
+
+#endif
@@ -0,0 +1,27 @@
+#include <stdio.h>
+#include "riscv_math.h"
+#include "sweep.h"
+#include "funcs_def.h"
+
+/* Buffers shared by the kernels of the sweep, aligned for the vector loads */
+uint32_t sweep_src1[SWEEP_BUF_WORDS] __ALIGNED(64);
+uint32_t sweep_src2[SWEEP_BUF_WORDS] __ALIGNED(64);
+uint32_t sweep_dst[SWEEP_BUF_WORDS] __ALIGNED(64);
+
+int main()
+{
+    printf("Start DSP size sweep benchmark test, max size %lu, misalign %lu:\n",
+           (unsigned long)SWEEP_MAX_SIZE, (unsigned long)SWEEP_MISALIGN);
+
+    sweep_basic_math();
+    sweep_complex_math();
+    sweep_fast_math();
+    sweep_statistics();
+    sweep_support();
+    sweep_filtering();
+    sweep_transform();
+    sweep_matrix();
+
+    printf("All tests are passed.\n");
+    printf("\ntest for SizeSweep benchmark finished.\n");
+}
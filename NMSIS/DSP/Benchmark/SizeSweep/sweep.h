@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SWEEP_H__
+#define __SWEEP_H__
+
+/*
+ * Size sweep of the DSP kernels: the benchmark statement of a kernel, the BENCH_STMT_<kernel>
+ * macro of <group>/bench_stmts.h also used by the per-function benchmarks, is run for the
+ * sizes 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, ... up to SWEEP_MAX_SIZE, i.e. every power of
+ * two and its two neighbours, with the buffers aligned and then offset by SWEEP_MISALIGN
+ * elements. SWEEP_MAX_SIZE is 4096 by default so that the buffers fit the usual data memory,
+ * build with SWEEP_MAX_SIZE=65536 and a large enough DOWNLOAD mode for the full 1..64K sweep.
+ * The FFTs only run the power of two lengths they support and the matrix kernels sweep the
+ * dimension n of n x n matrices while n * n <= SWEEP_MAX_SIZE. Each run prints
+ *
+ *   SWEEP, proc, N, offset
+ *
+ * followed by the BENCHRUN line of BENCH_RUN for this size, which Scripts/Build/nlsweep.py
+ * gathers into a cycles-vs-N table per kernel.
+ */
+
+#include "riscv_math.h"
+#include <stdio.h>
+#include "nmsis_bench.h"
+
+/* Largest size of the sweep, 65536 for 1..64K, the three buffers take 24 * SWEEP_MAX_SIZE bytes */
+#ifndef SWEEP_MAX_SIZE
+#define SWEEP_MAX_SIZE      4096
+#endif
+
+#ifndef SWEEP_MISALIGN
+#define SWEEP_MISALIGN      1
+#endif
+
+#ifndef SWEEP_ITERS
+#define SWEEP_ITERS         8
+#endif
+
+#ifndef SWEEP_WARMUP
+#define SWEEP_WARMUP        1
+#endif
+
+/* Number of taps of the FIR filters and length of the second conv/correlate sequence */
+#define SWEEP_NUM_TAPS      32
+
+/* Number of stages of the biquad filters */
+#define SWEEP_NUM_STAGES    4
+
+/*
+ * Words of each buffer: complex kernels read 2 * N values and the correlations write up to
+ * 2 * max(N, SWEEP_NUM_TAPS) values, plus the misaligned offset
+ */
+#define SWEEP_BUF_WORDS     (2 * SWEEP_MAX_SIZE + 2 * SWEEP_NUM_TAPS + 16)
+
+extern uint32_t sweep_src1[SWEEP_BUF_WORDS];
+extern uint32_t sweep_src2[SWEEP_BUF_WORDS];
+extern uint32_t sweep_dst[SWEEP_BUF_WORDS];
+
+/* Size following n in the sweep: 2^k - 1, 2^k, 2^k + 1, 2^(k+1) - 1, ... */
+static inline uint32_t sweep_next_size(uint32_t n)
+{
+    if (((n & (n - 1U)) == 0U) || (((n + 1U) & n) == 0U)) {
+        return n + 1U;
+    }
+    return 2U * (n - 1U) - 1U;
+}
+
+/*
+ * Run stmt for the sizes n = first, next, ... while cond holds, and all the offsets of the
+ * sweep. setup is evaluated before each run and is not measured, nsamples is the number of
+ * elements processed by stmt. In setup and stmt, n is the size and pSrcA, pSrcB and pDst
+ * point to the buffers of elements of the given type.
+ */
+#define SWEEP_SIZES(proc, type, first, cond, next, nsamples, setup, ...)                        \
+    do {                                                                                        \
+        uint32_t n, off;                                                                        \
+        type *pSrcA, *pSrcB, *pDst;                                                             \
+        for (n = (first); (cond); n = (next)) {                                                 \
+            for (off = 0U; off <= SWEEP_MISALIGN; off += ((SWEEP_MISALIGN) ? (SWEEP_MISALIGN) : 1U)) { \
+                pSrcA = (type *)sweep_src1 + off;                                               \
+                pSrcB = (type *)sweep_src2 + off;                                               \
+                pDst = (type *)sweep_dst + off;                                                 \
+                setup;                                                                          \
+                printf("SWEEP, %s, %lu, %lu\n", #proc, (unsigned long)n, (unsigned long)off);   \
+                BENCH_RUN(proc, SWEEP_ITERS, SWEEP_WARMUP, (nsamples), __VA_ARGS__);            \
+            }                                                                                   \
+        }                                                                                       \
+        (void)pSrcA; (void)pSrcB; (void)pDst;                                                   \
+    } while (0)
+
+/* Run stmt for all the sizes and offsets of the sweep */
+#define SWEEP(proc, type, ...)                                                                  \
+    SWEEP_SIZES(proc, type, 1U, n <= SWEEP_MAX_SIZE, sweep_next_size(n), n, (void)0, __VA_ARGS__)
+
+/* Run stmt for the power of two sizes from nmin to nmax, setup initializes the instance for n */
+#define SWEEP_POW2(proc, type, nmin, nmax, setup, ...)                                          \
+    SWEEP_SIZES(proc, type, (nmin), (n <= (nmax)) && (n <= SWEEP_MAX_SIZE), 2U * n, n, setup, __VA_ARGS__)
+
+/* Run stmt for the n x n matrices with n * n <= SWEEP_MAX_SIZE, setup initializes the matrices */
+#define SWEEP_MAT(proc, type, setup, ...)                                                       \
+    SWEEP_SIZES(proc, type, 1U, n * n <= SWEEP_MAX_SIZE, sweep_next_size(n), n * n, setup, __VA_ARGS__)
+
+#endif /* __SWEEP_H__ */
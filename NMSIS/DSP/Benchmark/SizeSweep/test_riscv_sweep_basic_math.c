@@ -0,0 +1,48 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "BasicMathFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+void sweep_basic_math(void)
+{
+    q63_t result_q63;
+    q31_t result_q31;
+    float32_t result_f32;
+
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_f32((float32_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_add_f32, float32_t, BENCH_STMT_riscv_add_f32(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_sub_f32, float32_t, BENCH_STMT_riscv_sub_f32(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_mult_f32, float32_t, BENCH_STMT_riscv_mult_f32(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_abs_f32, float32_t, BENCH_STMT_riscv_abs_f32(pSrcA, pDst, n));
+    SWEEP(riscv_offset_f32, float32_t, BENCH_STMT_riscv_offset_f32(pSrcA, 0.5f, pDst, n));
+    SWEEP(riscv_scale_f32, float32_t, BENCH_STMT_riscv_scale_f32(pSrcA, 0.5f, pDst, n));
+    SWEEP(riscv_dot_prod_f32, float32_t, BENCH_STMT_riscv_dot_prod_f32(pSrcA, pSrcB, n, &result_f32));
+
+    generate_rand_q31((q31_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_q31((q31_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_add_q31, q31_t, BENCH_STMT_riscv_add_q31(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_mult_q31, q31_t, BENCH_STMT_riscv_mult_q31(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_scale_q31, q31_t, BENCH_STMT_riscv_scale_q31(pSrcA, 0x40000000, 1, pDst, n));
+    SWEEP(riscv_dot_prod_q31, q31_t, BENCH_STMT_riscv_dot_prod_q31(pSrcA, pSrcB, n, &result_q63));
+
+    generate_rand_q15((q15_t *)sweep_src1, 2 * SWEEP_BUF_WORDS);
+    generate_rand_q15((q15_t *)sweep_src2, 2 * SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_add_q15, q15_t, BENCH_STMT_riscv_add_q15(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_mult_q15, q15_t, BENCH_STMT_riscv_mult_q15(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_abs_q15, q15_t, BENCH_STMT_riscv_abs_q15(pSrcA, pDst, n));
+    SWEEP(riscv_dot_prod_q15, q15_t, BENCH_STMT_riscv_dot_prod_q15(pSrcA, pSrcB, n, &result_q63));
+
+    generate_rand_q7((q7_t *)sweep_src1, 4 * SWEEP_BUF_WORDS);
+    generate_rand_q7((q7_t *)sweep_src2, 4 * SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_add_q7, q7_t, BENCH_STMT_riscv_add_q7(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_mult_q7, q7_t, BENCH_STMT_riscv_mult_q7(pSrcA, pSrcB, pDst, n));
+    SWEEP(riscv_dot_prod_q7, q7_t, BENCH_STMT_riscv_dot_prod_q7(pSrcA, pSrcB, n, &result_q31));
+}
@@ -0,0 +1,17 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "ComplexMathFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+void sweep_complex_math(void)
+{
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_f32((float32_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    /* n complex samples, 2 * n values */
+    SWEEP(riscv_cmplx_mag_f32, float32_t, BENCH_STMT_riscv_cmplx_mag_f32(pSrcA, pDst, n));
+    SWEEP(riscv_cmplx_mult_cmplx_f32, float32_t, BENCH_STMT_riscv_cmplx_mult_cmplx_f32(pSrcA, pSrcB, pDst, n));
+}
@@ -0,0 +1,14 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "FastMathFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+void sweep_fast_math(void)
+{
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_vexp_f32, float32_t, BENCH_STMT_riscv_vexp_f32(pSrcA, pDst, n));
+}
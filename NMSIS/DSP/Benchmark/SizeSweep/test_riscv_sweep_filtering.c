@@ -0,0 +1,95 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "FilteringFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+/*
+ * The FIR and biquad filters process blocks of n samples, the state of the FIR filters is
+ * kept in pSrcB, and the conv/correlate kernels take n samples in pSrcA and SWEEP_NUM_TAPS
+ * samples in pSrcB.
+ */
+void sweep_filtering(void)
+{
+    float32_t taps_f32[SWEEP_NUM_TAPS];
+    q31_t taps_q31[SWEEP_NUM_TAPS];
+    q15_t taps_q15[SWEEP_NUM_TAPS];
+    q7_t taps_q7[SWEEP_NUM_TAPS];
+    float32_t coeffs_f32[5 * SWEEP_NUM_STAGES];
+    q31_t coeffs_q31[5 * SWEEP_NUM_STAGES];
+    q15_t coeffs_q15[6 * SWEEP_NUM_STAGES];
+    float32_t iir_state_f32[4 * SWEEP_NUM_STAGES];
+    q31_t iir_state_q31[4 * SWEEP_NUM_STAGES];
+    q15_t iir_state_q15[4 * SWEEP_NUM_STAGES];
+    riscv_fir_instance_f32 fir_f32;
+    riscv_fir_instance_q31 fir_q31;
+    riscv_fir_instance_q15 fir_q15;
+    riscv_fir_instance_q7 fir_q7;
+    riscv_biquad_casd_df1_inst_f32 df1_f32;
+    riscv_biquad_casd_df1_inst_q31 df1_q31;
+    riscv_biquad_casd_df1_inst_q15 df1_q15;
+    riscv_biquad_cascade_df2T_instance_f32 df2T_f32;
+
+    for (int i = 0; i < 5 * SWEEP_NUM_STAGES; i++) {
+        coeffs_f32[i] = (float32_t)rand() / RAND_MAX * 2 - 1;
+    }
+    riscv_float_to_q31(coeffs_f32, coeffs_q31, 5 * SWEEP_NUM_STAGES);
+    generate_rand_q15(coeffs_q15, 6 * SWEEP_NUM_STAGES);
+    generate_rand_f32(taps_f32, SWEEP_NUM_TAPS);
+    riscv_float_to_q31(taps_f32, taps_q31, SWEEP_NUM_TAPS);
+    riscv_float_to_q15(taps_f32, taps_q15, SWEEP_NUM_TAPS);
+    riscv_float_to_q7(taps_f32, taps_q7, SWEEP_NUM_TAPS);
+
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_f32((float32_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    SWEEP_SIZES(riscv_fir_f32, float32_t, 1U, n <= SWEEP_MAX_SIZE, sweep_next_size(n), n,
+                riscv_fir_init_f32(&fir_f32, SWEEP_NUM_TAPS, taps_f32, pSrcB, n),
+                BENCH_STMT_riscv_fir_f32(&fir_f32, pSrcA, pDst, n));
+
+    riscv_biquad_cascade_df1_init_f32(&df1_f32, SWEEP_NUM_STAGES, coeffs_f32, iir_state_f32);
+    SWEEP(riscv_biquad_cascade_df1_f32, float32_t, BENCH_STMT_riscv_biquad_cascade_df1_f32(&df1_f32, pSrcA, pDst, n));
+    riscv_biquad_cascade_df2T_init_f32(&df2T_f32, SWEEP_NUM_STAGES, coeffs_f32, iir_state_f32);
+    SWEEP(riscv_biquad_cascade_df2T_f32, float32_t, BENCH_STMT_riscv_biquad_cascade_df2T_f32(&df2T_f32, pSrcA, pDst, n));
+
+    SWEEP(riscv_conv_f32, float32_t, BENCH_STMT_riscv_conv_f32(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+    SWEEP(riscv_correlate_f32, float32_t, BENCH_STMT_riscv_correlate_f32(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+
+    generate_rand_q31((q31_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_q31((q31_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    SWEEP_SIZES(riscv_fir_q31, q31_t, 1U, n <= SWEEP_MAX_SIZE, sweep_next_size(n), n,
+                riscv_fir_init_q31(&fir_q31, SWEEP_NUM_TAPS, taps_q31, pSrcB, n),
+                BENCH_STMT_riscv_fir_q31(&fir_q31, pSrcA, pDst, n));
+
+    riscv_biquad_cascade_df1_init_q31(&df1_q31, SWEEP_NUM_STAGES, coeffs_q31, iir_state_q31, 1);
+    SWEEP(riscv_biquad_cascade_df1_q31, q31_t, BENCH_STMT_riscv_biquad_cascade_df1_q31(&df1_q31, pSrcA, pDst, n));
+
+    SWEEP(riscv_conv_q31, q31_t, BENCH_STMT_riscv_conv_q31(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+    SWEEP(riscv_correlate_q31, q31_t, BENCH_STMT_riscv_correlate_q31(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+
+    generate_rand_q15((q15_t *)sweep_src1, 2 * SWEEP_BUF_WORDS);
+    generate_rand_q15((q15_t *)sweep_src2, 2 * SWEEP_BUF_WORDS);
+
+    SWEEP_SIZES(riscv_fir_q15, q15_t, 1U, n <= SWEEP_MAX_SIZE, sweep_next_size(n), n,
+                riscv_fir_init_q15(&fir_q15, SWEEP_NUM_TAPS, taps_q15, pSrcB, n),
+                BENCH_STMT_riscv_fir_q15(&fir_q15, pSrcA, pDst, n));
+
+    riscv_biquad_cascade_df1_init_q15(&df1_q15, SWEEP_NUM_STAGES, coeffs_q15, iir_state_q15, 1);
+    SWEEP(riscv_biquad_cascade_df1_q15, q15_t, BENCH_STMT_riscv_biquad_cascade_df1_q15(&df1_q15, pSrcA, pDst, n));
+
+    SWEEP(riscv_conv_q15, q15_t, BENCH_STMT_riscv_conv_q15(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+    SWEEP(riscv_correlate_q15, q15_t, BENCH_STMT_riscv_correlate_q15(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+
+    generate_rand_q7((q7_t *)sweep_src1, 4 * SWEEP_BUF_WORDS);
+    generate_rand_q7((q7_t *)sweep_src2, 4 * SWEEP_BUF_WORDS);
+
+    SWEEP_SIZES(riscv_fir_q7, q7_t, 1U, n <= SWEEP_MAX_SIZE, sweep_next_size(n), n,
+                riscv_fir_init_q7(&fir_q7, SWEEP_NUM_TAPS, taps_q7, pSrcB, n),
+                BENCH_STMT_riscv_fir_q7(&fir_q7, pSrcA, pDst, n));
+
+    SWEEP(riscv_conv_q7, q7_t, BENCH_STMT_riscv_conv_q7(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+    SWEEP(riscv_correlate_q7, q7_t, BENCH_STMT_riscv_correlate_q7(pSrcA, n, pSrcB, SWEEP_NUM_TAPS, pDst));
+}
@@ -0,0 +1,70 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "MatrixFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+static riscv_matrix_instance_f32 mat_a_f32, mat_b_f32, mat_d_f32;
+static riscv_matrix_instance_q31 mat_a_q31, mat_b_q31, mat_d_q31;
+static riscv_matrix_instance_q15 mat_a_q15, mat_b_q15, mat_d_q15;
+
+/* n x n matrices on the buffers of the sweep */
+static void sweep_mat_init_f32(uint32_t n, float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst)
+{
+    riscv_mat_init_f32(&mat_a_f32, n, n, pSrcA);
+    riscv_mat_init_f32(&mat_b_f32, n, n, pSrcB);
+    riscv_mat_init_f32(&mat_d_f32, n, n, pDst);
+}
+
+static void sweep_mat_init_q31(uint32_t n, q31_t *pSrcA, q31_t *pSrcB, q31_t *pDst)
+{
+    riscv_mat_init_q31(&mat_a_q31, n, n, pSrcA);
+    riscv_mat_init_q31(&mat_b_q31, n, n, pSrcB);
+    riscv_mat_init_q31(&mat_d_q31, n, n, pDst);
+}
+
+static void sweep_mat_init_q15(uint32_t n, q15_t *pSrcA, q15_t *pSrcB, q15_t *pDst)
+{
+    riscv_mat_init_q15(&mat_a_q15, n, n, pSrcA);
+    riscv_mat_init_q15(&mat_b_q15, n, n, pSrcB);
+    riscv_mat_init_q15(&mat_d_q15, n, n, pDst);
+}
+
+void sweep_matrix(void)
+{
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_f32((float32_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    SWEEP_MAT(riscv_mat_add_f32, float32_t, sweep_mat_init_f32(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_add_f32(&mat_a_f32, &mat_b_f32, &mat_d_f32));
+    SWEEP_MAT(riscv_mat_mult_f32, float32_t, sweep_mat_init_f32(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_mult_f32(&mat_a_f32, &mat_b_f32, &mat_d_f32));
+    SWEEP_MAT(riscv_mat_trans_f32, float32_t, sweep_mat_init_f32(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_trans_f32(&mat_a_f32, &mat_d_f32));
+    SWEEP_MAT(riscv_mat_vec_mult_f32, float32_t, sweep_mat_init_f32(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_vec_mult_f32(&mat_a_f32, pSrcB, pDst));
+
+    generate_rand_q31((q31_t *)sweep_src1, SWEEP_BUF_WORDS);
+    generate_rand_q31((q31_t *)sweep_src2, SWEEP_BUF_WORDS);
+
+    SWEEP_MAT(riscv_mat_add_q31, q31_t, sweep_mat_init_q31(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_add_q31(&mat_a_q31, &mat_b_q31, &mat_d_q31));
+    SWEEP_MAT(riscv_mat_mult_q31, q31_t, sweep_mat_init_q31(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_mult_q31(&mat_a_q31, &mat_b_q31, &mat_d_q31));
+    SWEEP_MAT(riscv_mat_trans_q31, q31_t, sweep_mat_init_q31(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_trans_q31(&mat_a_q31, &mat_d_q31));
+    SWEEP_MAT(riscv_mat_vec_mult_q31, q31_t, sweep_mat_init_q31(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_vec_mult_q31(&mat_a_q31, pSrcB, pDst));
+
+    generate_rand_q15((q15_t *)sweep_src1, 2 * SWEEP_BUF_WORDS);
+    generate_rand_q15((q15_t *)sweep_src2, 2 * SWEEP_BUF_WORDS);
+
+    SWEEP_MAT(riscv_mat_add_q15, q15_t, sweep_mat_init_q15(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_add_q15(&mat_a_q15, &mat_b_q15, &mat_d_q15));
+    SWEEP_MAT(riscv_mat_trans_q15, q15_t, sweep_mat_init_q15(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_trans_q15(&mat_a_q15, &mat_d_q15));
+    SWEEP_MAT(riscv_mat_vec_mult_q15, q15_t, sweep_mat_init_q15(n, pSrcA, pSrcB, pDst),
+              BENCH_STMT_riscv_mat_vec_mult_q15(&mat_a_q15, pSrcB, pDst));
+}
@@ -0,0 +1,33 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "StatisticsFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+void sweep_statistics(void)
+{
+    float32_t result_f32;
+    uint32_t index;
+    q31_t result_q31;
+    q15_t result_q15;
+    q63_t power_q63;
+
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_max_f32, float32_t, BENCH_STMT_riscv_max_f32(pSrcA, n, &result_f32, &index));
+    SWEEP(riscv_min_f32, float32_t, BENCH_STMT_riscv_min_f32(pSrcA, n, &result_f32, &index));
+    SWEEP(riscv_mean_f32, float32_t, BENCH_STMT_riscv_mean_f32(pSrcA, n, &result_f32));
+    SWEEP(riscv_var_f32, float32_t, BENCH_STMT_riscv_var_f32(pSrcA, n, &result_f32));
+
+    generate_rand_q31((q31_t *)sweep_src1, SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_power_q31, q31_t, BENCH_STMT_riscv_power_q31(pSrcA, n, &power_q63));
+    SWEEP(riscv_max_q31, q31_t, BENCH_STMT_riscv_max_q31(pSrcA, n, &result_q31, &index));
+
+    generate_rand_q15((q15_t *)sweep_src1, 2 * SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_mean_q15, q15_t, BENCH_STMT_riscv_mean_q15(pSrcA, n, &result_q15));
+    SWEEP(riscv_max_q15, q15_t, BENCH_STMT_riscv_max_q15(pSrcA, n, &result_q15, &index));
+}
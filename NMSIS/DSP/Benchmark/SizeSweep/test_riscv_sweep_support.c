@@ -0,0 +1,16 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "SupportFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+void sweep_support(void)
+{
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+
+    SWEEP(riscv_copy_f32, float32_t, BENCH_STMT_riscv_copy_f32(pSrcA, pDst, n));
+    SWEEP(riscv_float_to_q15, float32_t, BENCH_STMT_riscv_float_to_q15(pSrcA, (q15_t *)pDst, n));
+    SWEEP(riscv_fill_q15, q15_t, BENCH_STMT_riscv_fill_q15(0x1234, pDst, n));
+}
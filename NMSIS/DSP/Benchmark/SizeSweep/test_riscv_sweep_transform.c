@@ -0,0 +1,49 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "sweep.h"
+#include "TransformFunctions/bench_stmts.h"
+
+BENCH_DECLARE_VAR();
+
+/*
+ * All the lengths supported by the init functions, the CFFTs run in place on pSrcA holding n complex samples.
+ */
+void sweep_transform(void)
+{
+    riscv_cfft_instance_f32 cfft_f32;
+#if !defined(RISCV_MATH_VECTOR_ZVE32F)
+    riscv_rfft_fast_instance_f32 rfft_fast_f32;
+#endif
+#if !defined(RISCV_MATH_VECTOR_ZVE32X)
+    riscv_cfft_instance_q31 cfft_q31;
+    riscv_cfft_instance_q15 cfft_q15;
+    riscv_rfft_instance_q31 rfft_q31;
+    riscv_rfft_instance_q15 rfft_q15;
+#endif
+
+    generate_rand_f32((float32_t *)sweep_src1, SWEEP_BUF_WORDS);
+
+    SWEEP_POW2(riscv_cfft_f32, float32_t, 16U, 4096U, riscv_cfft_init_f32(&cfft_f32, n),
+               BENCH_STMT_riscv_cfft_f32(&cfft_f32, pSrcA, 0, 1));
+#if !defined(RISCV_MATH_VECTOR_ZVE32F)
+    SWEEP_POW2(riscv_rfft_fast_f32, float32_t, 32U, 4096U, riscv_rfft_fast_init_f32(&rfft_fast_f32, n),
+               BENCH_STMT_riscv_rfft_fast_f32(&rfft_fast_f32, pSrcA, pDst, 0));
+#endif
+
+#if !defined(RISCV_MATH_VECTOR_ZVE32X)
+    generate_rand_q31((q31_t *)sweep_src1, SWEEP_BUF_WORDS);
+
+    SWEEP_POW2(riscv_cfft_q31, q31_t, 16U, 4096U, riscv_cfft_init_q31(&cfft_q31, n),
+               BENCH_STMT_riscv_cfft_q31(&cfft_q31, pSrcA, 0, 1));
+    SWEEP_POW2(riscv_rfft_q31, q31_t, 32U, 8192U, riscv_rfft_init_q31(&rfft_q31, n, 0, 1),
+               BENCH_STMT_riscv_rfft_q31(&rfft_q31, pSrcA, pDst));
+
+    generate_rand_q15((q15_t *)sweep_src1, 2 * SWEEP_BUF_WORDS);
+
+    SWEEP_POW2(riscv_cfft_q15, q15_t, 16U, 4096U, riscv_cfft_init_q15(&cfft_q15, n),
+               BENCH_STMT_riscv_cfft_q15(&cfft_q15, pSrcA, 0, 1));
+    SWEEP_POW2(riscv_rfft_q15, q15_t, 32U, 8192U, riscv_rfft_init_q15(&rfft_q15, n, 0, 1),
+               BENCH_STMT_riscv_rfft_q15(&rfft_q15, pSrcA, pDst));
+#endif
+}
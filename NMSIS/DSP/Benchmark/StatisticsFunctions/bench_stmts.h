@@ -0,0 +1,26 @@
+#ifndef __STATISTICS_BENCH_STMTS__
+#define __STATISTICS_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the StatisticsFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_max_f32(pSrc, n, pResult, pIndex) \
+    riscv_max_f32(pSrc, n, pResult, pIndex)
+#define BENCH_STMT_riscv_min_f32(pSrc, n, pResult, pIndex) \
+    riscv_min_f32(pSrc, n, pResult, pIndex)
+#define BENCH_STMT_riscv_max_q31(pSrc, n, pResult, pIndex) \
+    riscv_max_q31(pSrc, n, pResult, pIndex)
+#define BENCH_STMT_riscv_max_q15(pSrc, n, pResult, pIndex) \
+    riscv_max_q15(pSrc, n, pResult, pIndex)
+#define BENCH_STMT_riscv_mean_f32(pSrc, n, pResult) \
+    riscv_mean_f32(pSrc, n, pResult)
+#define BENCH_STMT_riscv_var_f32(pSrc, n, pResult) \
+    riscv_var_f32(pSrc, n, pResult)
+#define BENCH_STMT_riscv_power_q31(pSrc, n, pResult) \
+    riscv_power_q31(pSrc, n, pResult)
+#define BENCH_STMT_riscv_mean_q15(pSrc, n, pResult) \
+    riscv_mean_q15(pSrc, n, pResult)
+
+#endif /* __STATISTICS_BENCH_STMTS__ */
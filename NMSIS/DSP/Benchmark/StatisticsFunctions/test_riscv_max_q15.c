@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "StatisticsFunctions/bench_stmts.h"
 #include "TestData/StatisticsFunctions/max_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,6 +15,6 @@ void max_riscv_max_q15(void)
     generate_rand_q15(max_q15_input, ARRAY_SIZE);
 
     BENCH_START(riscv_max_q15);
-    riscv_max_q15(max_q15_input, ARRAY_SIZE, &q15_output, &index);
+    BENCH_STMT_riscv_max_q15(max_q15_input, ARRAY_SIZE, &q15_output, &index);
     BENCH_END(riscv_max_q15);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "StatisticsFunctions/bench_stmts.h"
 #include "TestData/StatisticsFunctions/mean_q15/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,6 +14,6 @@ void mean_riscv_mean_q15(void)
     generate_rand_q15(mean_q15_input, ARRAY_SIZE);
 
     BENCH_START(riscv_mean_q15);
-    riscv_mean_q15(mean_q15_input, ARRAY_SIZE, &q15_output);
+    BENCH_STMT_riscv_mean_q15(mean_q15_input, ARRAY_SIZE, &q15_output);
     BENCH_END(riscv_mean_q15);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "StatisticsFunctions/bench_stmts.h"
 #include "TestData/StatisticsFunctions/min_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -14,6 +15,6 @@ void min_riscv_min_f32(void)
     generate_rand_f32(min_f32_input, ARRAY_SIZE);
 
     BENCH_START(riscv_min_f32);
-    riscv_min_f32(min_f32_input, ARRAY_SIZE, &f32_output, &index);
+    BENCH_STMT_riscv_min_f32(min_f32_input, ARRAY_SIZE, &f32_output, &index);
     BENCH_END(riscv_min_f32);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "StatisticsFunctions/bench_stmts.h"
 #include "TestData/StatisticsFunctions/power_q31/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,6 +14,6 @@ void power_riscv_power_q31(void)
     generate_rand_q31(power_q31_input, ARRAY_SIZE);
 
     BENCH_START(riscv_power_q31);
-    riscv_power_q31(power_q31_input, ARRAY_SIZE, &q63_output);
+    BENCH_STMT_riscv_power_q31(power_q31_input, ARRAY_SIZE, &q63_output);
     BENCH_END(riscv_power_q31);
 }
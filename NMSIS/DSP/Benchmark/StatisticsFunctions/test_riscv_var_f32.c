@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "StatisticsFunctions/bench_stmts.h"
 #include "TestData/StatisticsFunctions/var_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,6 +14,6 @@ void var_riscv_var_f32(void)
     generate_rand_f32(var_f32_input, ARRAY_SIZE);
 
     BENCH_START(riscv_var_f32);
-    riscv_var_f32(var_f32_input, ARRAY_SIZE, &f32_output);
+    BENCH_STMT_riscv_var_f32(var_f32_input, ARRAY_SIZE, &f32_output);
     BENCH_END(riscv_var_f32);
 }
\ No newline at end of file
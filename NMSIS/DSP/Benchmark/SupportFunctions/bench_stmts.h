@@ -0,0 +1,16 @@
+#ifndef __SUPPORT_BENCH_STMTS__
+#define __SUPPORT_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the SupportFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_copy_f32(pSrc, pDst, n) \
+    riscv_copy_f32(pSrc, pDst, n)
+#define BENCH_STMT_riscv_float_to_q15(pSrc, pDst, n) \
+    riscv_float_to_q15(pSrc, pDst, n)
+#define BENCH_STMT_riscv_fill_q15(value, pDst, n) \
+    riscv_fill_q15(value, pDst, n)
+
+#endif /* __SUPPORT_BENCH_STMTS__ */
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "SupportFunctions/bench_stmts.h"
 #include "TestData/SupportFunctions/copy_f32/test_data.h"
 
 BENCH_DECLARE_VAR();
@@ -13,6 +14,6 @@ void copy_riscv_copy_f32(void)
     generate_rand_f32(copy_f32_input, ARRAY_SIZE);
 
     BENCH_START(riscv_copy_f32);
-    riscv_copy_f32(copy_f32_input, f32_output, ARRAY_SIZE);
+    BENCH_STMT_riscv_copy_f32(copy_f32_input, f32_output, ARRAY_SIZE);
     BENCH_END(riscv_copy_f32);
 }
\ No newline at end of file
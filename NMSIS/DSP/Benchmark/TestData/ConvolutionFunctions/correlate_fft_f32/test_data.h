@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+
+
+#define ARRAYA_SIZE_F32 1024
+#define ARRAYB_SIZE_F32 512
+/* riscv_conv_fft_scratch_size_f32(ARRAYA_SIZE_F32, ARRAYB_SIZE_F32) with RVV */
+#define CORRELATE_FFT_SCRATCH_SIZE 8704
+
+static float32_t correlate_fft_input_f32_A[ARRAYA_SIZE_F32] = {};
+static float32_t correlate_fft_input_f32_B[ARRAYB_SIZE_F32] = {};
+static float32_t correlate_fft_f32_scratch[CORRELATE_FFT_SCRATCH_SIZE] __attribute__((aligned(16)));
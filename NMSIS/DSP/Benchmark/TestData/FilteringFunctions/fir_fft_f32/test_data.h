@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+
+
+#define TEST_LENGTH_SAMPLES 1024
+#define NUM_TAPS 1024
+#define FIR_FFT_BLOCK 128
+/* riscv_fir_fft_buffer_size_f32() of the uniform and the non-uniform partitionings, with RVV */
+#define FIR_FFT_BUFFER_SIZE 10752
+
+/* 4 partitions of 128 taps followed by one of 512 taps */
+static const uint16_t fir_fft_part_lens[2] = {128, 512};
+static const uint16_t fir_fft_num_parts[2] = {4, 0};
+
+static float32_t fir_fft_input_f32[TEST_LENGTH_SAMPLES] = {};
+static float32_t fir_fft_output_f32[TEST_LENGTH_SAMPLES] = {};
+static float32_t fir_fft_coeffs_f32[NUM_TAPS] = {};
+static float32_t fir_fft_buffer_f32[FIR_FFT_BUFFER_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,17 @@
+#pragma once
+#include <stdint.h>
+
+
+/* FFT lengths 16, 32 and 64, batch sizes 1, 2, 4 ... 256 */
+#define CFFT_MAX_LEN 64
+#define CFFT_MAX_BATCH 256
+#define CFFT_BATCH_SAMPLES (CFFT_MAX_LEN * CFFT_MAX_BATCH)
+/* riscv_cfft_batch_twiddle_buffer_size() of CFFT_MAX_LEN */
+#define CFFT_TWIDDLE_SIZE CFFT_MAX_LEN
+/* Measured and warmup calls of BENCH_RUN, each call transforms the output of the previous one */
+#define CFFT_BATCH_ITERS 4
+#define CFFT_BATCH_WARMUP 1
+
+static uint8_t ifftFlag = 0;
+static q31_t cfft_batch_q31_data[2 * CFFT_BATCH_SAMPLES] __attribute__((aligned(16)));
+static q31_t cfft_batch_q31_twiddle[CFFT_TWIDDLE_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,36 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * Largest length benchmarked, the lengths 8192, 16384, 65536 and 262144 up to it are run.
+ * The input and output take 16 * CFFT_LARGE_MAX_SIZE bytes: 128KB for the default 8192,
+ * which fits the default DOWNLOAD modes, 256KB for 16384, 1MB for 65536 and 4MB for 262144,
+ * which need a DOWNLOAD mode with enough data memory such as ddr.
+ */
+#ifndef CFFT_LARGE_MAX_SIZE
+#define CFFT_LARGE_MAX_SIZE 8192
+#endif
+
+/* Row length of the four-step split of CFFT_LARGE_MAX_SIZE, the column length is at most the row length */
+#if CFFT_LARGE_MAX_SIZE == 8192
+#define CFFT_LARGE_MAX_ROW 128
+#elif CFFT_LARGE_MAX_SIZE == 16384
+#define CFFT_LARGE_MAX_ROW 128
+#elif CFFT_LARGE_MAX_SIZE == 65536
+#define CFFT_LARGE_MAX_ROW 256
+#elif CFFT_LARGE_MAX_SIZE == 262144
+#define CFFT_LARGE_MAX_ROW 512
+#else
+#error "CFFT_LARGE_MAX_SIZE must be 8192, 16384, 65536 or 262144"
+#endif
+
+/* riscv_cfft_large_twiddle_buffer_size() of CFFT_LARGE_MAX_SIZE */
+#define CFFT_TWIDDLE_SIZE (2 * 2 * CFFT_LARGE_MAX_ROW)
+/* riscv_cfft_large_tmp_buffer_size() of CFFT_LARGE_MAX_SIZE for tiles of at most 16 rows */
+#define CFFT_BUFFER_SIZE (16 * 2 * CFFT_LARGE_MAX_ROW + 6 * CFFT_LARGE_MAX_ROW)
+
+static uint8_t ifftFlag = 0;
+static float32_t cfft_large_f32_input[2 * CFFT_LARGE_MAX_SIZE] __attribute__((aligned(16)));
+static float32_t cfft_large_f32_output[2 * CFFT_LARGE_MAX_SIZE] __attribute__((aligned(16)));
+static float32_t cfft_large_f32_buffer[CFFT_BUFFER_SIZE] __attribute__((aligned(16)));
+static float32_t cfft_large_f32_twiddle[CFFT_TWIDDLE_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+
+
+#define CFFTSIZE 480
+/* riscv_cfft_mixed_twiddle_buffer_size() of CFFTSIZE */
+#define CFFT_TWIDDLE_SIZE (2 * (CFFTSIZE - 1))
+
+static uint8_t ifftFlag = 0;
+static q15_t cfft_testinput_q15_mixed[2 * CFFTSIZE] __attribute__((aligned(16)));
+static q15_t cfft_mixed_q15_output[2 * CFFTSIZE] __attribute__((aligned(16)));
+static q15_t cfft_mixed_q15_buffer[2 * CFFTSIZE] __attribute__((aligned(16)));
+static q15_t cfft_mixed_q15_twiddle[CFFT_TWIDDLE_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+
+
+#define CFFTSIZE 480
+/* riscv_cfft_mixed_twiddle_buffer_size() of CFFTSIZE */
+#define CFFT_TWIDDLE_SIZE (2 * (CFFTSIZE - 1))
+
+static uint8_t ifftFlag = 0;
+static q31_t cfft_testinput_q31_mixed[2 * CFFTSIZE] __attribute__((aligned(16)));
+static q31_t cfft_mixed_q31_output[2 * CFFTSIZE] __attribute__((aligned(16)));
+static q31_t cfft_mixed_q31_buffer[2 * CFFTSIZE] __attribute__((aligned(16)));
+static q31_t cfft_mixed_q31_twiddle[CFFT_TWIDDLE_SIZE] __attribute__((aligned(16)));
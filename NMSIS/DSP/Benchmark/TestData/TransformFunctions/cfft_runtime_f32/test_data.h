@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+
+
+#define CFFTSIZE 512
+/* riscv_cfft_runtime_buffer_size() of CFFTSIZE */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#define CFFT_TABLE_SIZE (CFFTSIZE * 8 + CFFTSIZE / 2)
+#else
+#define CFFT_TABLE_SIZE (CFFTSIZE * 3)
+#endif
+
+static uint8_t ifftFlag = 0;
+static uint8_t doBitReverse = 1;
+static float32_t cfft_testinput_f32_runtime[2 * CFFTSIZE] __attribute__((aligned(16)));
+static float32_t cfft_runtime_f32_output[2 * CFFTSIZE] __attribute__((aligned(16)));
+static float32_t cfft_runtime_f32_buffer[4 * CFFTSIZE] __attribute__((aligned(16)));
+static float32_t cfft_runtime_f32_table[CFFT_TABLE_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+
+
+#define CZT_SRC_LEN 1000
+/* 64 bins from 0.1 with the resolution of a 8192 points FFT */
+#define CZT_ZOOM_BINS 64
+#define CZT_ZOOM_START 0.1f
+#define CZT_ZOOM_STEP (1.0f / 8192)
+/* riscv_czt_buffer_size_f32() of the DFT of CZT_SRC_LEN points, fftLen 2048 */
+#define CZT_BUFFER_SIZE (2 * (CZT_SRC_LEN + CZT_SRC_LEN + 2048))
+/* riscv_czt_scratch_size_f32() for a fftLen of 2048 */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#define CZT_SCRATCH_SIZE (8 * 2048)
+#else
+#define CZT_SCRATCH_SIZE (2 * 2048)
+#endif
+
+static float32_t czt_testinput_f32[2 * CZT_SRC_LEN] __attribute__((aligned(16)));
+static float32_t czt_f32_output[2 * CZT_SRC_LEN] __attribute__((aligned(16)));
+static float32_t czt_f32_buffer[CZT_BUFFER_SIZE] __attribute__((aligned(16)));
+static float32_t czt_f32_scratch[CZT_SCRATCH_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+
+
+#define GOERTZEL_BINS 8
+#define GOERTZEL_BLOCK 256
+/* riscv_rfft_fast_tmp_buffer_size() of GOERTZEL_BLOCK with RVV */
+#define GOERTZEL_FFT_TMP_SIZE (2 * GOERTZEL_BLOCK)
+
+/* DTMF frequencies divided by a 8 kHz sampling rate */
+static const float32_t goertzel_f32_freqs[GOERTZEL_BINS] = {
+    0.087125f, 0.096250f, 0.106500f, 0.117625f, 0.151125f, 0.167000f, 0.184625f, 0.204125f
+};
+static float32_t goertzel_testinput_f32[GOERTZEL_BLOCK] __attribute__((aligned(16)));
+static float32_t goertzel_f32_coeffs[GOERTZEL_BINS] __attribute__((aligned(16)));
+static float32_t goertzel_f32_output[GOERTZEL_BINS] __attribute__((aligned(16)));
+static float32_t goertzel_f32_fft_input[GOERTZEL_BLOCK] __attribute__((aligned(16)));
+static float32_t goertzel_f32_fft_output[GOERTZEL_BLOCK] __attribute__((aligned(16)));
+static float32_t goertzel_f32_fft_mag[GOERTZEL_BLOCK / 2] __attribute__((aligned(16)));
+static float32_t goertzel_f32_fft_tmp[GOERTZEL_FFT_TMP_SIZE] __attribute__((aligned(16)));
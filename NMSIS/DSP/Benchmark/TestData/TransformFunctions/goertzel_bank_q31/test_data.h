@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+
+
+#define GOERTZEL_BINS 8
+#define GOERTZEL_BLOCK 256
+/* riscv_rfft_fast_tmp_buffer_size() of GOERTZEL_BLOCK with RVV */
+#define GOERTZEL_FFT_TMP_SIZE (2 * GOERTZEL_BLOCK)
+
+/* DTMF frequencies divided by a 8 kHz sampling rate */
+static const q31_t goertzel_q31_freqs[GOERTZEL_BINS] = {
+    0x0B26E979, 0x0C51EB85, 0x0DA1CAC1, 0x0F0E5604, 0x13581062, 0x15604189, 0x17A1CAC1, 0x1A20C49C
+};
+static q31_t goertzel_testinput_q31[GOERTZEL_BLOCK] __attribute__((aligned(16)));
+static q31_t goertzel_q31_coeffs[GOERTZEL_BINS] __attribute__((aligned(16)));
+static q31_t goertzel_q31_output[GOERTZEL_BINS] __attribute__((aligned(16)));
+static q31_t goertzel_q31_fft_output[GOERTZEL_BLOCK] __attribute__((aligned(16)));
+static q31_t goertzel_q31_fft_mag[GOERTZEL_BLOCK / 2] __attribute__((aligned(16)));
+static q31_t goertzel_q31_fft_tmp[GOERTZEL_FFT_TMP_SIZE] __attribute__((aligned(16)));
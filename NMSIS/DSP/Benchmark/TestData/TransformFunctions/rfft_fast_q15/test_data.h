@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+
+
+#define RFFTSIZE 512
+/* riscv_rfft_fast_tmp_buffer_size() of RFFTSIZE with RVV */
+#define RFFT_TMP_SIZE (2 * RFFTSIZE)
+
+static uint8_t ifftFlag = 0;
+static q15_t rfft_testinput_q15_fast[RFFTSIZE] __attribute__((aligned(16)));
+static q15_t rfft_fast_q15_output[RFFTSIZE] __attribute__((aligned(16)));
+static q15_t rfft_fast_q15_tmp[RFFT_TMP_SIZE] __attribute__((aligned(16)));
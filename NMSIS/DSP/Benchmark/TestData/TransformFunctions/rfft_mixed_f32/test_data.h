@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+
+
+#define RFFTSIZE 960
+/* riscv_rfft_mixed_twiddle_buffer_size() of RFFTSIZE */
+#define RFFT_TWIDDLE_SIZE (2 * (RFFTSIZE - 1))
+
+static uint8_t ifftFlag = 0;
+static float32_t rfft_testinput_f32_mixed[RFFTSIZE] __attribute__((aligned(16)));
+static float32_t rfft_mixed_f32_output[RFFTSIZE] __attribute__((aligned(16)));
+static float32_t rfft_mixed_f32_buffer[2 * RFFTSIZE] __attribute__((aligned(16)));
+static float32_t rfft_mixed_f32_twiddle[RFFT_TWIDDLE_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+
+
+#define RFFTSIZE 960
+/* riscv_rfft_mixed_twiddle_buffer_size() of RFFTSIZE */
+#define RFFT_TWIDDLE_SIZE (2 * (RFFTSIZE - 1))
+
+static uint8_t ifftFlag = 0;
+static q31_t rfft_testinput_q31_mixed[RFFTSIZE] __attribute__((aligned(16)));
+static q31_t rfft_mixed_q31_output[RFFTSIZE] __attribute__((aligned(16)));
+static q31_t rfft_mixed_q31_buffer[2 * RFFTSIZE] __attribute__((aligned(16)));
+static q31_t rfft_mixed_q31_twiddle[RFFT_TWIDDLE_SIZE] __attribute__((aligned(16)));
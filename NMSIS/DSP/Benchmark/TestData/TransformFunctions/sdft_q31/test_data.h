@@ -0,0 +1,14 @@
+#pragma once
+#include <stdint.h>
+
+
+#define SDFT_LEN 256
+#define SDFT_BINS 8
+#define SDFT_BLOCK 512
+
+/* Bins of the DTMF frequencies with a 8 kHz sampling rate */
+static const uint16_t sdft_q31_bins[SDFT_BINS] = {22, 25, 27, 30, 39, 43, 47, 52};
+static q31_t sdft_testinput_q31[SDFT_BLOCK] __attribute__((aligned(16)));
+static q31_t sdft_q31_coeffs[2 * SDFT_BINS] __attribute__((aligned(16)));
+static q31_t sdft_q31_state[2 * SDFT_BINS + SDFT_LEN] __attribute__((aligned(16)));
+static q31_t sdft_q31_output[2 * SDFT_BINS] __attribute__((aligned(16)));
@@ -0,0 +1,21 @@
+#pragma once
+#include <stdint.h>
+
+
+#define STFT_FRAME 256
+#define STFT_HOP 128
+#define STFT_BLOCK 1024
+#define STFT_FRAMES (STFT_BLOCK / STFT_HOP)
+/* riscv_stft_tmp_buffer_size() of STFT_FRAME */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#define STFT_TMP_SIZE (STFT_FRAME * 5)
+#else
+#define STFT_TMP_SIZE (STFT_FRAME * 2)
+#endif
+
+static float32_t stft_testinput_f32[STFT_BLOCK] __attribute__((aligned(16)));
+static float32_t stft_f32_window[STFT_FRAME] __attribute__((aligned(16)));
+static float32_t stft_f32_state[STFT_FRAME] __attribute__((aligned(16)));
+static float32_t stft_f32_spectrum[STFT_FRAMES * STFT_FRAME] __attribute__((aligned(16)));
+static float32_t stft_f32_output[STFT_BLOCK] __attribute__((aligned(16)));
+static float32_t stft_f32_buffer[STFT_TMP_SIZE] __attribute__((aligned(16)));
@@ -0,0 +1,21 @@
+#pragma once
+#include <stdint.h>
+
+
+#define STFT_FRAME 256
+#define STFT_HOP 128
+#define STFT_BLOCK 1024
+#define STFT_FRAMES (STFT_BLOCK / STFT_HOP)
+/* riscv_stft_tmp_buffer_size() of STFT_FRAME, in q31_t values */
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+#define STFT_TMP_SIZE (STFT_FRAME * 5 + 2)
+#else
+#define STFT_TMP_SIZE (STFT_FRAME * 3)
+#endif
+
+static q15_t stft_testinput_q15[STFT_BLOCK] __attribute__((aligned(16)));
+static q15_t stft_q15_window[STFT_FRAME] __attribute__((aligned(16)));
+static q15_t stft_q15_state[STFT_FRAME] __attribute__((aligned(16)));
+static q15_t stft_q15_spectrum[STFT_FRAMES * (STFT_FRAME + 2)] __attribute__((aligned(16)));
+static q15_t stft_q15_output[STFT_BLOCK] __attribute__((aligned(16)));
+static q31_t stft_q15_buffer[STFT_TMP_SIZE] __attribute__((aligned(16)));
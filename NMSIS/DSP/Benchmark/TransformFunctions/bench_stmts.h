@@ -0,0 +1,22 @@
+#ifndef __TRANSFORM_BENCH_STMTS__
+#define __TRANSFORM_BENCH_STMTS__
+
+/*
+ * Benchmark statements of the TransformFunctions shared by the per-function benchmarks of this
+ * directory and by SizeSweep, which runs them with a runtime size n.
+ */
+
+#define BENCH_STMT_riscv_cfft_f32(S, pSrc, ifftFlag, bitReverseFlag) \
+    riscv_cfft_f32(S, pSrc, ifftFlag, bitReverseFlag)
+#define BENCH_STMT_riscv_cfft_q31(S, pSrc, ifftFlag, bitReverseFlag) \
+    riscv_cfft_q31(S, pSrc, ifftFlag, bitReverseFlag)
+#define BENCH_STMT_riscv_cfft_q15(S, pSrc, ifftFlag, bitReverseFlag) \
+    riscv_cfft_q15(S, pSrc, ifftFlag, bitReverseFlag)
+#define BENCH_STMT_riscv_rfft_fast_f32(S, pSrc, pDst, ifftFlag) \
+    riscv_rfft_fast_f32(S, pSrc, pDst, ifftFlag)
+#define BENCH_STMT_riscv_rfft_q31(S, pSrc, pDst) \
+    riscv_rfft_q31(S, pSrc, pDst)
+#define BENCH_STMT_riscv_rfft_q15(S, pSrc, pDst) \
+    riscv_rfft_q15(S, pSrc, pDst)
+
+#endif /* __TRANSFORM_BENCH_STMTS__ */
@@ -23,6 +23,17 @@ int main()
     cfft_riscv_cfft_radix4_q15();
     cfft_riscv_cfft_radix4_q31();
 
+    cfft_riscv_cfft_mixed_f32();
+    cfft_riscv_cfft_mixed_q15();
+    cfft_riscv_cfft_mixed_q31();
+
+    cfft_riscv_cfft_large_f32();
+    cfft_riscv_cfft_runtime_f32();
+    cfft_riscv_cfft_batch_f32();
+    cfft_riscv_cfft_batch_q31();
+    cfft_riscv_cfft_batch_q15();
+    cfft_riscv_czt_f32();
+
     printf("All tests are passed.\n");
     printf("test for TransformFunctions/cfft benchmark finished.\n");
 }
@@ -0,0 +1,30 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/cfft_batch_q15/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+/* Cycles of a whole batch of len points transforms, the gain over one transform per call shows in cycles / sample */
+#define BENCH_CFFT_BATCH(len, batch)                                                                    \
+    generate_rand_q15(cfft_batch_q15_data, 2 * len * batch);                                            \
+    BENCH_RUN(riscv_cfft_batch_q15_##len##_##batch, CFFT_BATCH_ITERS, CFFT_BATCH_WARMUP, len * batch,   \
+              riscv_cfft_batch_q15(&S, cfft_batch_q15_data, batch, len, ifftFlag));
+
+#define BENCH_CFFT_BATCH_LEN(len)                                                                       \
+    result = riscv_cfft_batch_init_q15(&S, len, cfft_batch_q15_twiddle);                                \
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);                                                      \
+    BENCH_CFFT_BATCH(len, 1) BENCH_CFFT_BATCH(len, 2) BENCH_CFFT_BATCH(len, 4)                          \
+    BENCH_CFFT_BATCH(len, 8) BENCH_CFFT_BATCH(len, 16) BENCH_CFFT_BATCH(len, 32)                        \
+    BENCH_CFFT_BATCH(len, 64) BENCH_CFFT_BATCH(len, 128) BENCH_CFFT_BATCH(len, 256)
+
+void cfft_riscv_cfft_batch_q15(void)
+{
+    riscv_cfft_batch_instance_q15 S;
+    riscv_status result;
+
+    BENCH_CFFT_BATCH_LEN(16)
+    BENCH_CFFT_BATCH_LEN(32)
+    BENCH_CFFT_BATCH_LEN(64)
+}
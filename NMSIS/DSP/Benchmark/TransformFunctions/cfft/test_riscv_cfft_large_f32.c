@@ -0,0 +1,45 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/cfft_large_f32/test_data.h"
+
+#define DCACHE_MISS_EVENT HPM_EVENT(EVENT_SEL_MEMORY_ACCESS, EVENT_MEMORY_ACCESS_DCACHE_MISS, MSU_EVENT_ENABLE)
+
+BENCH_DECLARE_VAR();
+HPM_DECLARE_VAR(3);
+
+/* Cache blocked with tiles of S.tileLen columns and rows, then the naive column by column four-step */
+#define BENCH_CFFT_LARGE(len, tiled, untiled)                                                                   \
+    result = riscv_cfft_large_init_f32(&S, len, cfft_large_f32_twiddle);                                        \
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);                                                              \
+    generate_rand_f32(cfft_large_f32_input, 2 * len);                                                           \
+    HPM_START(3, tiled, DCACHE_MISS_EVENT);                                                                     \
+    BENCH_START(tiled);                                                                                         \
+    riscv_cfft_large_f32(&S, cfft_large_f32_input, cfft_large_f32_output, cfft_large_f32_buffer, ifftFlag);     \
+    BENCH_END(tiled);                                                                                           \
+    HPM_END(3, tiled, DCACHE_MISS_EVENT);                                                                       \
+    S.tileLen = 1;                                                                                              \
+    generate_rand_f32(cfft_large_f32_input, 2 * len);                                                           \
+    HPM_START(3, untiled, DCACHE_MISS_EVENT);                                                                   \
+    BENCH_START(untiled);                                                                                       \
+    riscv_cfft_large_f32(&S, cfft_large_f32_input, cfft_large_f32_output, cfft_large_f32_buffer, ifftFlag);     \
+    BENCH_END(untiled);                                                                                         \
+    HPM_END(3, untiled, DCACHE_MISS_EVENT);
+
+void cfft_riscv_cfft_large_f32(void)
+{
+    riscv_cfft_large_instance_f32 S;
+    riscv_status result;
+
+    BENCH_CFFT_LARGE(8192, riscv_cfft_large_f32, riscv_cfft_large_f32_untiled);
+#if CFFT_LARGE_MAX_SIZE >= 16384
+    BENCH_CFFT_LARGE(16384, riscv_cfft_large_f32_16384, riscv_cfft_large_f32_16384_untiled);
+#endif
+#if CFFT_LARGE_MAX_SIZE >= 65536
+    BENCH_CFFT_LARGE(65536, riscv_cfft_large_f32_65536, riscv_cfft_large_f32_65536_untiled);
+#endif
+#if CFFT_LARGE_MAX_SIZE >= 262144
+    BENCH_CFFT_LARGE(262144, riscv_cfft_large_f32_262144, riscv_cfft_large_f32_262144_untiled);
+#endif
+}
@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/cfft_mixed_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void cfft_riscv_cfft_mixed_f32(void)
+{
+    riscv_cfft_mixed_instance_f32 S;
+
+    generate_rand_f32(cfft_testinput_f32_mixed, CFFTSIZE * 2);
+
+    riscv_status result = riscv_cfft_mixed_init_f32(&S, CFFTSIZE, cfft_mixed_f32_twiddle);
+    BENCH_START(riscv_cfft_mixed_f32);
+    riscv_cfft_mixed_f32(&S, cfft_testinput_f32_mixed, cfft_mixed_f32_output, cfft_mixed_f32_buffer, ifftFlag);
+    BENCH_END(riscv_cfft_mixed_f32);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
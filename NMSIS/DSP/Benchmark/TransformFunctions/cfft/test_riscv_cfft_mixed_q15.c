@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/cfft_mixed_q15/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void cfft_riscv_cfft_mixed_q15(void)
+{
+    riscv_cfft_mixed_instance_q15 S;
+
+    generate_rand_q15(cfft_testinput_q15_mixed, CFFTSIZE * 2);
+
+    riscv_status result = riscv_cfft_mixed_init_q15(&S, CFFTSIZE, cfft_mixed_q15_twiddle);
+    BENCH_START(riscv_cfft_mixed_q15);
+    riscv_cfft_mixed_q15(&S, cfft_testinput_q15_mixed, cfft_mixed_q15_output, cfft_mixed_q15_buffer, ifftFlag);
+    BENCH_END(riscv_cfft_mixed_q15);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/cfft_mixed_q31/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void cfft_riscv_cfft_mixed_q31(void)
+{
+    riscv_cfft_mixed_instance_q31 S;
+
+    generate_rand_q31(cfft_testinput_q31_mixed, CFFTSIZE * 2);
+
+    riscv_status result = riscv_cfft_mixed_init_q31(&S, CFFTSIZE, cfft_mixed_q31_twiddle);
+    BENCH_START(riscv_cfft_mixed_q31);
+    riscv_cfft_mixed_q31(&S, cfft_testinput_q31_mixed, cfft_mixed_q31_output, cfft_mixed_q31_buffer, ifftFlag);
+    BENCH_END(riscv_cfft_mixed_q31);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -0,0 +1,30 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/cfft_runtime_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void cfft_riscv_cfft_runtime_f32(void)
+{
+    riscv_cfft_instance_f32 S;
+
+    generate_rand_f32(cfft_testinput_f32_runtime, CFFTSIZE * 2);
+
+    BENCH_START(riscv_cfft_init_runtime_f32);
+    riscv_status result = riscv_cfft_init_runtime_f32(&S, CFFTSIZE, cfft_runtime_f32_table);
+    BENCH_END(riscv_cfft_init_runtime_f32);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    BENCH_START(riscv_cfft_runtime_f32);
+    riscv_cfft_f32(&S, cfft_testinput_f32_runtime, cfft_runtime_f32_output, cfft_runtime_f32_buffer, ifftFlag);
+    BENCH_END(riscv_cfft_runtime_f32);
+#else
+    BENCH_START(riscv_cfft_runtime_f32);
+    riscv_cfft_f32(&S, cfft_testinput_f32_runtime, ifftFlag, doBitReverse);
+    BENCH_END(riscv_cfft_runtime_f32);
+#endif
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
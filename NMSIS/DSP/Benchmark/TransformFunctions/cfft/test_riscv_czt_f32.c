@@ -0,0 +1,29 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/czt_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void cfft_riscv_czt_f32(void)
+{
+    riscv_czt_instance_f32 S;
+
+    generate_rand_f32(czt_testinput_f32, CZT_SRC_LEN * 2);
+
+    /* Zoom on a narrow band */
+    riscv_status result = riscv_czt_init_f32(&S, CZT_SRC_LEN, CZT_ZOOM_BINS, CZT_ZOOM_START, CZT_ZOOM_STEP,
+                                             czt_f32_buffer, czt_f32_scratch);
+    BENCH_START(riscv_czt_f32);
+    riscv_czt_f32(&S, czt_testinput_f32, czt_f32_output, czt_f32_scratch);
+    BENCH_END(riscv_czt_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    /* DFT of a length which is not a product of 2, 3 and 5 */
+    result = riscv_czt_init_f32(&S, CZT_SRC_LEN, CZT_SRC_LEN, 0.0f, 1.0f / CZT_SRC_LEN, czt_f32_buffer, czt_f32_scratch);
+    BENCH_START(riscv_czt_f32_dft);
+    riscv_czt_f32(&S, czt_testinput_f32, czt_f32_output, czt_f32_scratch);
+    BENCH_END(riscv_czt_f32_dft);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -16,6 +16,17 @@ extern void cfft_riscv_cfft_radix4_f32();
 extern void cfft_riscv_cfft_radix4_q15();
 extern void cfft_riscv_cfft_radix4_q31();
 
+extern void cfft_riscv_cfft_mixed_f32();
+extern void cfft_riscv_cfft_mixed_q15();
+extern void cfft_riscv_cfft_mixed_q31();
+
+extern void cfft_riscv_cfft_large_f32();
+extern void cfft_riscv_cfft_runtime_f32();
+extern void cfft_riscv_cfft_batch_f32();
+extern void cfft_riscv_cfft_batch_q31();
+extern void cfft_riscv_cfft_batch_q15();
+extern void cfft_riscv_czt_f32();
+
 extern void dct4_riscv_dct4_f32();
 extern void dct4_riscv_dct4_q15();
 extern void dct4_riscv_dct4_q31();
@@ -25,5 +36,17 @@ extern void rfft_riscv_rfft_q15();
 extern void rfft_riscv_rfft_q31();
 extern void rfft_riscv_rfft_fast_f16();
 extern void rfft_riscv_rfft_fast_f32();
+extern void rfft_riscv_rfft_fast_q31();
+extern void rfft_riscv_rfft_fast_q15();
+extern void rfft_riscv_rfft_mixed_f32();
+extern void rfft_riscv_rfft_mixed_q15();
+extern void rfft_riscv_rfft_mixed_q31();
+extern void rfft_riscv_stft_f32();
+extern void rfft_riscv_stft_q31();
+extern void rfft_riscv_stft_q15();
+extern void rfft_riscv_goertzel_bank_f32();
+extern void rfft_riscv_goertzel_bank_q31();
+extern void rfft_riscv_sdft_f32();
+extern void rfft_riscv_sdft_q31();
 
 #endif
@@ -15,6 +15,22 @@ int main()
     rfft_riscv_rfft_fast_f32();
 #endif
 
+    rfft_riscv_rfft_fast_q31();
+    rfft_riscv_rfft_fast_q15();
+
+    rfft_riscv_rfft_mixed_f32();
+    rfft_riscv_rfft_mixed_q15();
+    rfft_riscv_rfft_mixed_q31();
+
+    rfft_riscv_stft_f32();
+    rfft_riscv_stft_q31();
+    rfft_riscv_stft_q15();
+
+    rfft_riscv_goertzel_bank_f32();
+    rfft_riscv_goertzel_bank_q31();
+    rfft_riscv_sdft_f32();
+    rfft_riscv_sdft_q31();
+
     printf("All tests are passed.\n");
     printf("test for TransformFunctions/rfft benchmark finished.\n");
 }
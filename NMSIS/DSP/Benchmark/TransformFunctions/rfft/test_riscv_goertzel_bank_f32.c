@@ -0,0 +1,34 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/goertzel_bank_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_goertzel_bank_f32(void)
+{
+    riscv_goertzel_bank_instance_f32 S;
+    riscv_rfft_fast_instance_f32 SR;
+
+    generate_rand_f32(goertzel_testinput_f32, GOERTZEL_BLOCK);
+
+    riscv_status result = riscv_goertzel_bank_init_f32(&S, GOERTZEL_BINS, GOERTZEL_BLOCK, goertzel_f32_freqs, goertzel_f32_coeffs);
+    BENCH_START(riscv_goertzel_bank_f32);
+    riscv_goertzel_bank_f32(&S, goertzel_testinput_f32, goertzel_f32_output);
+    BENCH_END(riscv_goertzel_bank_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    /* Full spectrum of the same block for comparison */
+    riscv_copy_f32(goertzel_testinput_f32, goertzel_f32_fft_input, GOERTZEL_BLOCK);
+    result = riscv_rfft_fast_init_f32(&SR, GOERTZEL_BLOCK);
+    BENCH_START(riscv_goertzel_bank_fft_f32);
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    riscv_rfft_fast_f32(&SR, goertzel_f32_fft_input, goertzel_f32_fft_output, goertzel_f32_fft_tmp, 0);
+#else
+    riscv_rfft_fast_f32(&SR, goertzel_f32_fft_input, goertzel_f32_fft_output, 0);
+#endif
+    riscv_cmplx_mag_squared_f32(goertzel_f32_fft_output, goertzel_f32_fft_mag, GOERTZEL_BLOCK / 2);
+    BENCH_END(riscv_goertzel_bank_fft_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -0,0 +1,29 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/goertzel_bank_q31/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_goertzel_bank_q31(void)
+{
+    riscv_goertzel_bank_instance_q31 S;
+    riscv_rfft_fast_instance_q31 SR;
+
+    generate_rand_q31(goertzel_testinput_q31, GOERTZEL_BLOCK);
+
+    riscv_status result = riscv_goertzel_bank_init_q31(&S, GOERTZEL_BINS, GOERTZEL_BLOCK, goertzel_q31_freqs, goertzel_q31_coeffs);
+    BENCH_START(riscv_goertzel_bank_q31);
+    riscv_goertzel_bank_q31(&S, goertzel_testinput_q31, goertzel_q31_output);
+    BENCH_END(riscv_goertzel_bank_q31);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    /* Full spectrum of the same block for comparison */
+    result = riscv_rfft_fast_init_q31(&SR, GOERTZEL_BLOCK);
+    BENCH_START(riscv_goertzel_bank_fft_q31);
+    riscv_rfft_fast_q31(&SR, goertzel_testinput_q31, goertzel_q31_fft_output, goertzel_q31_fft_tmp, 0);
+    riscv_cmplx_mag_squared_q31(goertzel_q31_fft_output, goertzel_q31_fft_mag, GOERTZEL_BLOCK / 2);
+    BENCH_END(riscv_goertzel_bank_fft_q31);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "TransformFunctions/bench_stmts.h"
 #include "riscv_common_tables.h"
 #include "riscv_const_structs.h"
 #include "TestData/TransformFunctions/rfft_fast_f32/test_data.h"
@@ -18,7 +19,7 @@ void rfft_riscv_rfft_fast_f32(void)
 
     riscv_status result = riscv_rfft_fast_init_f32(&SS, RFFTSIZE);
     BENCH_START(riscv_rfft_fast_f32);
-    riscv_rfft_fast_f32(&SS, rfft_testinput_f32_50hz_200Hz_fast, rfft_fast_f32_output, ifftFlag);
+    BENCH_STMT_riscv_rfft_fast_f32(&SS, rfft_testinput_f32_50hz_200Hz_fast, rfft_fast_f32_output, ifftFlag);
     BENCH_END(riscv_rfft_fast_f32);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
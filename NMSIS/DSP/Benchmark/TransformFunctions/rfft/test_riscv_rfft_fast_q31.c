@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/rfft_fast_q31/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_rfft_fast_q31(void)
+{
+    riscv_rfft_fast_instance_q31 S;
+
+    generate_rand_q31(rfft_testinput_q31_fast, RFFTSIZE);
+
+    riscv_status result = riscv_rfft_fast_init_q31(&S, RFFTSIZE);
+    BENCH_START(riscv_rfft_fast_q31);
+    riscv_rfft_fast_q31(&S, rfft_testinput_q31_fast, rfft_fast_q31_output, rfft_fast_q31_tmp, ifftFlag);
+    BENCH_END(riscv_rfft_fast_q31);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/rfft_mixed_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_rfft_mixed_f32(void)
+{
+    riscv_rfft_mixed_instance_f32 S;
+
+    generate_rand_f32(rfft_testinput_f32_mixed, RFFTSIZE);
+
+    riscv_status result = riscv_rfft_mixed_init_f32(&S, RFFTSIZE, rfft_mixed_f32_twiddle);
+    BENCH_START(riscv_rfft_mixed_f32);
+    riscv_rfft_mixed_f32(&S, rfft_testinput_f32_mixed, rfft_mixed_f32_output, rfft_mixed_f32_buffer, ifftFlag);
+    BENCH_END(riscv_rfft_mixed_f32);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/rfft_mixed_q15/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_rfft_mixed_q15(void)
+{
+    riscv_rfft_mixed_instance_q15 S;
+
+    generate_rand_q15(rfft_testinput_q15_mixed, RFFTSIZE);
+
+    riscv_status result = riscv_rfft_mixed_init_q15(&S, RFFTSIZE, rfft_mixed_q15_twiddle);
+    BENCH_START(riscv_rfft_mixed_q15);
+    riscv_rfft_mixed_q15(&S, rfft_testinput_q15_mixed, rfft_mixed_q15_output, rfft_mixed_q15_buffer, ifftFlag);
+    BENCH_END(riscv_rfft_mixed_q15);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
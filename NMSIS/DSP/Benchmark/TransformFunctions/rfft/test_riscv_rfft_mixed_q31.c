@@ -0,0 +1,21 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/rfft_mixed_q31/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_rfft_mixed_q31(void)
+{
+    riscv_rfft_mixed_instance_q31 S;
+
+    generate_rand_q31(rfft_testinput_q31_mixed, RFFTSIZE);
+
+    riscv_status result = riscv_rfft_mixed_init_q31(&S, RFFTSIZE, rfft_mixed_q31_twiddle);
+    BENCH_START(riscv_rfft_mixed_q31);
+    riscv_rfft_mixed_q31(&S, rfft_testinput_q31_mixed, rfft_mixed_q31_output, rfft_mixed_q31_buffer, ifftFlag);
+    BENCH_END(riscv_rfft_mixed_q31);
+
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+}
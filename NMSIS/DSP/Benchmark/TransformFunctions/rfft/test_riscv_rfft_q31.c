@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "validate.h"
 #include "nmsis_bench.h"
+#include "TransformFunctions/bench_stmts.h"
 #include "riscv_common_tables.h"
 #include "riscv_const_structs.h"
 #include "TestData/TransformFunctions/rfft_q31/test_data.h"
@@ -17,7 +18,7 @@ void rfft_riscv_rfft_q31(void)
 
     riscv_status result = riscv_rfft_init_q31(&SS, RFFTSIZE, ifftFlag, doBitReverse);
     BENCH_START(riscv_rfft_q31);
-    riscv_rfft_q31(&SS, rfft_testinput_q31_50hz_200Hz, rfft_q31_output);
+    BENCH_STMT_riscv_rfft_q31(&SS, rfft_testinput_q31_50hz_200Hz, rfft_q31_output);
     BENCH_END(riscv_rfft_q31);
 
     TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
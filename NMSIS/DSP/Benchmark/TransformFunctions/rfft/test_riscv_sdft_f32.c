@@ -0,0 +1,25 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/sdft_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_sdft_f32(void)
+{
+    riscv_sdft_instance_f32 S;
+
+    generate_rand_f32(sdft_testinput_f32, SDFT_BLOCK);
+
+    riscv_status result = riscv_sdft_init_f32(&S, SDFT_LEN, SDFT_BINS, sdft_f32_bins, 0.9999f, sdft_f32_coeffs, sdft_f32_state);
+    BENCH_START(riscv_sdft_f32);
+    riscv_sdft_f32(&S, sdft_testinput_f32, SDFT_BLOCK, sdft_f32_output);
+    BENCH_END(riscv_sdft_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    /* Bins of the sliding window for a single new sample */
+    BENCH_START(riscv_sdft_sample_f32);
+    riscv_sdft_f32(&S, sdft_testinput_f32, 1, sdft_f32_output);
+    BENCH_END(riscv_sdft_sample_f32);
+}
@@ -0,0 +1,26 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/sdft_q31/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_sdft_q31(void)
+{
+    riscv_sdft_instance_q31 S;
+
+    generate_rand_q31(sdft_testinput_q31, SDFT_BLOCK);
+
+    /* Damping factor 0.9999 */
+    riscv_status result = riscv_sdft_init_q31(&S, SDFT_LEN, SDFT_BINS, sdft_q31_bins, 0x7FFCB924, sdft_q31_coeffs, sdft_q31_state);
+    BENCH_START(riscv_sdft_q31);
+    riscv_sdft_q31(&S, sdft_testinput_q31, SDFT_BLOCK, sdft_q31_output);
+    BENCH_END(riscv_sdft_q31);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    /* Bins of the sliding window for a single new sample */
+    BENCH_START(riscv_sdft_sample_q31);
+    riscv_sdft_q31(&S, sdft_testinput_q31, 1, sdft_q31_output);
+    BENCH_END(riscv_sdft_sample_q31);
+}
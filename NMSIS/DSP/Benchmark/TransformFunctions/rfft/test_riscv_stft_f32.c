@@ -0,0 +1,37 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/stft_f32/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_stft_f32(void)
+{
+    riscv_stft_instance_f32 S;
+    riscv_istft_instance_f32 SI;
+    uint32_t numFrames;
+
+    generate_rand_f32(stft_testinput_f32, STFT_BLOCK);
+    riscv_hanning_f32(stft_f32_window, STFT_FRAME);
+
+    riscv_status result = riscv_stft_init_f32(&S, STFT_FRAME, STFT_HOP, stft_f32_window, stft_f32_state);
+    BENCH_START(riscv_stft_f32);
+    numFrames = riscv_stft_f32(&S, stft_testinput_f32, STFT_BLOCK, stft_f32_spectrum, stft_f32_buffer);
+    BENCH_END(riscv_stft_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+    TEST_ASSERT_EQUAL(STFT_FRAMES, numFrames);
+
+    result = riscv_istft_init_f32(&SI, STFT_FRAME, STFT_HOP, stft_f32_window, stft_f32_state);
+    BENCH_START(riscv_istft_f32);
+    riscv_istft_f32(&SI, stft_f32_spectrum, numFrames, stft_f32_output, stft_f32_buffer);
+    BENCH_END(riscv_istft_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    result = riscv_stft_init_f32(&S, STFT_FRAME, STFT_HOP, stft_f32_window, stft_f32_state);
+    BENCH_START(riscv_stft_mag_f32);
+    numFrames = riscv_stft_mag_f32(&S, stft_testinput_f32, STFT_BLOCK, stft_f32_spectrum, stft_f32_buffer);
+    BENCH_END(riscv_stft_mag_f32);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+    TEST_ASSERT_EQUAL(STFT_FRAMES, numFrames);
+}
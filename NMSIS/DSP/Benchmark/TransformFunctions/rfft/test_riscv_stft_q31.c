@@ -0,0 +1,39 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "validate.h"
+#include "nmsis_bench.h"
+#include "TestData/TransformFunctions/stft_q31/test_data.h"
+
+BENCH_DECLARE_VAR();
+
+void rfft_riscv_stft_q31(void)
+{
+    riscv_stft_instance_q31 S;
+    riscv_istft_instance_q31 SI;
+    float32_t window_f32[STFT_FRAME];
+    uint32_t numFrames;
+
+    generate_rand_q31(stft_testinput_q31, STFT_BLOCK);
+    riscv_hanning_f32(window_f32, STFT_FRAME);
+    riscv_float_to_q31(window_f32, stft_q31_window, STFT_FRAME);
+
+    riscv_status result = riscv_stft_init_q31(&S, STFT_FRAME, STFT_HOP, stft_q31_window, stft_q31_state);
+    BENCH_START(riscv_stft_q31);
+    numFrames = riscv_stft_q31(&S, stft_testinput_q31, STFT_BLOCK, stft_q31_spectrum, stft_q31_buffer);
+    BENCH_END(riscv_stft_q31);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+    TEST_ASSERT_EQUAL(STFT_FRAMES, numFrames);
+
+    result = riscv_istft_init_q31(&SI, STFT_FRAME, STFT_HOP, stft_q31_window, stft_q31_state);
+    BENCH_START(riscv_istft_q31);
+    riscv_istft_q31(&SI, stft_q31_spectrum, numFrames, stft_q31_output, stft_q31_buffer);
+    BENCH_END(riscv_istft_q31);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+
+    result = riscv_stft_init_q31(&S, STFT_FRAME, STFT_HOP, stft_q31_window, stft_q31_state);
+    BENCH_START(riscv_stft_mag_q31);
+    numFrames = riscv_stft_mag_q31(&S, stft_testinput_q31, STFT_BLOCK, stft_q31_spectrum, stft_q31_buffer);
+    BENCH_END(riscv_stft_mag_q31);
+    TEST_ASSERT_EQUAL(RISCV_MATH_SUCCESS, result);
+    TEST_ASSERT_EQUAL(STFT_FRAMES, numFrames);
+}
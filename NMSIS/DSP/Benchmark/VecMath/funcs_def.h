@@ -0,0 +1,8 @@
+#ifndef __FUNCS_DEF__
+#define __FUNCS_DEF__
+
+extern void vecmath_throughput();
+extern void vecmath_accuracy();
+extern void vecmath_memory();
+
+#endif
@@ -0,0 +1,31 @@
+#include <stdio.h>
+#include "riscv_math.h"
+#include "vecmath.h"
+#include "funcs_def.h"
+
+/* Buffers shared by the functions, aligned for the vector loads */
+float32_t vecmath_src[VECMATH_BUF_WORDS] __ALIGNED(64);
+float32_t vecmath_dst[VECMATH_BUF_WORDS] __ALIGNED(64);
+float32_t vecmath_dst2[VECMATH_BUF_WORDS] __ALIGNED(64);
+
+uint32_t vecmath_errors = 0;
+
+int main()
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    printf("VECMATH_VLEN, %lu\n", (unsigned long)__riscv_vsetvlmax_e8m1() * 8);
+#endif
+    printf("Start DSP vector math and memory helper benchmark test, size %lu, ulp stride %lu, misalign %lu:\n",
+           (unsigned long)VECMATH_SIZE, (unsigned long)VECMATH_ULP_STRIDE, (unsigned long)VECMATH_MISALIGN);
+
+    vecmath_throughput();
+    vecmath_accuracy();
+    vecmath_memory();
+
+    if (vecmath_errors == 0) {
+        printf("All tests are passed.\n");
+    } else {
+        printf("%lu tests are failed.\n", (unsigned long)vecmath_errors);
+    }
+    printf("\ntest for VecMath benchmark finished.\n");
+}
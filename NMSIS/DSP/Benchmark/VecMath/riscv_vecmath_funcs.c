@@ -0,0 +1,69 @@
+#include "riscv_math.h"
+#include <math.h>
+#include <float.h>
+#include "vecmath.h"
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+
+#define VECMATH_UNARY_FN(func, LMUL)                                                                        \
+    static void vecmath_##func##_m##LMUL(const float32_t *pSrc, float32_t *pDst, float32_t *pDst2, uint32_t n) \
+    {                                                                                                       \
+        size_t vl;                                                                                          \
+        (void)pDst2;                                                                                        \
+        for (; n > 0; n -= vl, pSrc += vl, pDst += vl) {                                                    \
+            vl = __riscv_vsetvl_e32m##LMUL(n);                                                              \
+            __riscv_vse32_v_f32m##LMUL(pDst, func##_m##LMUL(__riscv_vle32_v_f32m##LMUL(pSrc, vl), vl), vl);  \
+        }                                                                                                   \
+    }
+
+#define VECMATH_SINCOS_FN(LMUL)                                                                             \
+    static void vecmath_sincos_ps_m##LMUL(const float32_t *pSrc, float32_t *pDst, float32_t *pDst2, uint32_t n) \
+    {                                                                                                       \
+        size_t vl;                                                                                          \
+        vfloat32m##LMUL##_t ysin, ycos;                                                                     \
+        for (; n > 0; n -= vl, pSrc += vl, pDst += vl, pDst2 += vl) {                                       \
+            vl = __riscv_vsetvl_e32m##LMUL(n);                                                              \
+            sincos_ps_m##LMUL(__riscv_vle32_v_f32m##LMUL(pSrc, vl), &ysin, &ycos, vl);                      \
+            __riscv_vse32_v_f32m##LMUL(pDst, ysin, vl);                                                     \
+            __riscv_vse32_v_f32m##LMUL(pDst2, ycos, vl);                                                    \
+        }                                                                                                   \
+    }
+
+#define VECMATH_UNARY_FNS(func)     \
+    VECMATH_UNARY_FN(func, 1)       \
+    VECMATH_UNARY_FN(func, 2)       \
+    VECMATH_UNARY_FN(func, 4)       \
+    VECMATH_UNARY_FN(func, 8)
+
+VECMATH_UNARY_FNS(exp_ps)
+VECMATH_UNARY_FNS(log_ps)
+VECMATH_UNARY_FNS(tanh_ps)
+VECMATH_UNARY_FNS(sigmoid_ps)
+VECMATH_SINCOS_FN(1)
+VECMATH_SINCOS_FN(2)
+VECMATH_SINCOS_FN(4)
+VECMATH_SINCOS_FN(8)
+
+#define VECMATH_FNS(func)   { vecmath_##func##_m1, vecmath_##func##_m2, vecmath_##func##_m4, vecmath_##func##_m8 }
+
+static double ref_sigmoid(double x)
+{
+    return 1.0 / (1.0 + exp(-x));
+}
+
+/*
+ * The ranges of exp_ps and sigmoid_ps stop where the result becomes denormal, which
+ * the functions do not handle, the one of sincos_ps is the one of its cephes range reduction.
+ */
+const vecmath_func_t vecmath_funcs[] = {
+    { "exp_ps",     VECMATH_FNS(exp_ps),     exp,         NULL, -87.33f,  88.37f },
+    { "log_ps",     VECMATH_FNS(log_ps),     log,         NULL, FLT_MIN,  FLT_MAX },
+    { "sincos_ps",  VECMATH_FNS(sincos_ps),  sin,         cos,  -8192.0f, 8192.0f },
+    { "tanh_ps",    VECMATH_FNS(tanh_ps),    tanh,        NULL, -10.0f,   10.0f },
+    { "sigmoid_ps", VECMATH_FNS(sigmoid_ps), ref_sigmoid, NULL, -87.0f,   87.0f },
+};
+
+const uint32_t vecmath_funcs_num = sizeof(vecmath_funcs) / sizeof(vecmath_funcs[0]);
+const uint32_t vecmath_lmuls[VECMATH_LMUL_NUM] = { 1, 2, 4, 8 };
+
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
@@ -0,0 +1,126 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "vecmath.h"
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+
+typedef struct {
+    double max_ulp;
+    float32_t worst;
+} vecmath_ulp_t;
+
+/* Map the float bit patterns to unsigned keys in the order of the values, and back */
+static uint32_t vecmath_key(float32_t x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, 4);
+    return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+}
+
+static float32_t vecmath_from_key(uint32_t key)
+{
+    uint32_t bits = (key & 0x80000000U) ? (key & 0x7FFFFFFFU) : ~key;
+    float32_t x;
+    memcpy(&x, &bits, 4);
+    return x;
+}
+
+/* Error of y in units in the last place of the float nearest to ref */
+static double vecmath_ulp_error(float32_t y, double ref)
+{
+    int exp;
+
+    if (isnan(y) || isinf(y)) {
+        return ((float32_t)ref == y) ? 0.0 : INFINITY;
+    }
+    if (ref == 0.0) {
+        return fabs((double)y) / ldexp(1.0, -149);
+    }
+    frexp(ref, &exp);
+    return fabs((double)y - ref) / ldexp(1.0, (exp - 24 < -149) ? -149 : exp - 24);
+}
+
+static void vecmath_check(const float32_t *pSrc, const float32_t *pDst, double *ref, uint32_t n, vecmath_ulp_t *ulp)
+{
+    uint32_t i;
+    double err;
+
+    for (i = 0; i < n; i++) {
+        err = vecmath_ulp_error(pDst[i], ref[i]);
+        if (err > ulp->max_ulp || isnan(err)) {
+            ulp->max_ulp = err;
+            ulp->worst = pSrc[i];
+        }
+    }
+}
+
+static void vecmath_report(const char *name, const char *output, uint32_t lmul, const vecmath_ulp_t *ulp, unsigned long samples)
+{
+    printf("ULP, %s%s, m%lu, %.2f, %.9g, %lu\n", name, output, (unsigned long)lmul, ulp->max_ulp,
+           (double)ulp->worst, samples);
+}
+
+static double vecmath_ref[VECMATH_BATCH];
+static double vecmath_ref2[VECMATH_BATCH];
+
+/*
+ * Every VECMATH_ULP_STRIDE float of [lo, hi] and hi are computed in batches by all the LMUL of the
+ * function, the double precision reference being computed once per batch.
+ */
+static void vecmath_sweep(const vecmath_func_t *func)
+{
+    vecmath_ulp_t ulp[VECMATH_LMUL_NUM] = {0}, ulp2[VECMATH_LMUL_NUM] = {0};
+    uint64_t key = vecmath_key(func->lo), last = vecmath_key(func->hi);
+    unsigned long samples = 0;
+    uint32_t i, l, n;
+
+    while (key <= last) {
+        for (n = 0; n < VECMATH_BATCH && key <= last; n++) {
+            vecmath_src[n] = vecmath_from_key((uint32_t)key);
+            key = (key < last && key + VECMATH_ULP_STRIDE > last) ? last : key + VECMATH_ULP_STRIDE;
+        }
+        for (i = 0; i < n; i++) {
+            vecmath_ref[i] = func->ref((double)vecmath_src[i]);
+            if (func->ref2) {
+                vecmath_ref2[i] = func->ref2((double)vecmath_src[i]);
+            }
+        }
+        for (l = 0; l < VECMATH_LMUL_NUM; l++) {
+            func->fn[l](vecmath_src, vecmath_dst, vecmath_dst2, n);
+            vecmath_check(vecmath_src, vecmath_dst, vecmath_ref, n, &ulp[l]);
+            if (func->ref2) {
+                vecmath_check(vecmath_src, vecmath_dst2, vecmath_ref2, n, &ulp2[l]);
+            }
+        }
+        samples += n;
+    }
+
+    for (l = 0; l < VECMATH_LMUL_NUM; l++) {
+        vecmath_report(func->name, func->ref2 ? "_sin" : "", vecmath_lmuls[l], &ulp[l], samples);
+        if (func->ref2) {
+            vecmath_report(func->name, "_cos", vecmath_lmuls[l], &ulp2[l], samples);
+        }
+        /* All the LMUL run the same code on different register groups */
+        if (ulp[l].max_ulp != ulp[0].max_ulp || ulp2[l].max_ulp != ulp2[0].max_ulp) {
+            printf("ERROR, %s m%lu differs from m1\n", func->name, (unsigned long)vecmath_lmuls[l]);
+            vecmath_errors++;
+        }
+    }
+}
+
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+void vecmath_accuracy(void)
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    uint32_t i;
+
+    for (i = 0; i < vecmath_funcs_num; i++) {
+        vecmath_sweep(&vecmath_funcs[i]);
+    }
+#else
+    printf("riscv_vec_math.h functions need a vector ARCH_EXT such as v or zve32f, accuracy skipped\n");
+#endif
+}
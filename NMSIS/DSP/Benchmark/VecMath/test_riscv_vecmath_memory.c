@@ -0,0 +1,102 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "vecmath.h"
+
+BENCH_DECLARE_VAR();
+
+/* Sum of the reads of the helpers, so the loops are not removed */
+static volatile q63_t vecmath_sink;
+
+/* n is the number of elements read, a multiple of the elements of one read */
+static q31_t vecmath_read_q15x2(q15_t *pSrc, uint32_t n)
+{
+    q31_t sum = 0;
+    for (n >>= 1; n > 0; n--) {
+        sum += read_q15x2_ia(&pSrc);
+    }
+    return sum;
+}
+
+static q63_t vecmath_read_q15x4(q15_t *pSrc, uint32_t n)
+{
+    q63_t sum = 0;
+    for (n >>= 2; n > 0; n--) {
+        sum += read_q15x4_ia(&pSrc);
+    }
+    return sum;
+}
+
+static q31_t vecmath_read_q7x4(q7_t *pSrc, uint32_t n)
+{
+    q31_t sum = 0;
+    for (n >>= 2; n > 0; n--) {
+        sum += read_q7x4_ia(&pSrc);
+    }
+    return sum;
+}
+
+static q63_t vecmath_read_q7x8(q7_t *pSrc, uint32_t n)
+{
+    q63_t sum = 0;
+    for (n >>= 3; n > 0; n--) {
+        sum += read_q7x8_ia(&pSrc);
+    }
+    return sum;
+}
+
+/* Little endian value of the bytes bytes at p */
+static uint64_t vecmath_bytes(const void *p, uint32_t bytes)
+{
+    const uint8_t *pb = (const uint8_t *)p;
+    uint64_t val = 0;
+    while (bytes-- > 0) {
+        val = (val << 8) | pb[bytes];
+    }
+    return val;
+}
+
+/* The helpers must read the same bits as byte loads, at every offset when VECMATH_MISALIGN is set */
+static void vecmath_check_memory(void)
+{
+    q15_t *pQ15 = (q15_t *)vecmath_src;
+    q7_t *pQ7 = (q7_t *)vecmath_src;
+    uint32_t i, errors = 0;
+
+    for (i = 0; i + 4 <= 2 * VECMATH_SIZE; i += (VECMATH_MISALIGN) ? 1 : 4) {
+        errors += (uint32_t)read_q15x2(pQ15 + i) != (uint32_t)vecmath_bytes(pQ15 + i, 4);
+        errors += (uint64_t)read_q15x4(pQ15 + i) != vecmath_bytes(pQ15 + i, 8);
+    }
+    for (i = 0; i + 8 <= 4 * VECMATH_SIZE; i += (VECMATH_MISALIGN) ? 1 : 8) {
+        errors += (uint32_t)read_q7x4(pQ7 + i) != (uint32_t)vecmath_bytes(pQ7 + i, 4);
+        errors += (uint64_t)read_q7x8(pQ7 + i) != vecmath_bytes(pQ7 + i, 8);
+    }
+    if (errors) {
+        printf("ERROR, %lu reads of the memory helpers differ from byte loads\n", (unsigned long)errors);
+        vecmath_errors += errors;
+    }
+}
+
+void vecmath_memory(void)
+{
+    q15_t *pQ15;
+    q7_t *pQ7;
+    uint32_t i, off;
+
+    for (i = 0; i < VECMATH_BUF_WORDS; i++) {
+        ((uint32_t *)vecmath_src)[i] = 0x9E3779B9U * (i + 1);
+    }
+    vecmath_check_memory();
+
+    for (off = 0U; off <= VECMATH_MISALIGN; off += ((VECMATH_MISALIGN) ? (VECMATH_MISALIGN) : 1U)) {
+        pQ15 = (q15_t *)vecmath_src + off;
+        pQ7 = (q7_t *)vecmath_src + off;
+        printf("VECMATH, read_q15x2, align%lu, %lu\n", (unsigned long)off, (unsigned long)VECMATH_SIZE);
+        BENCH_RUN(vecmath, VECMATH_ITERS, VECMATH_WARMUP, VECMATH_SIZE, vecmath_sink += vecmath_read_q15x2(pQ15, VECMATH_SIZE));
+        printf("VECMATH, read_q15x4, align%lu, %lu\n", (unsigned long)off, (unsigned long)VECMATH_SIZE);
+        BENCH_RUN(vecmath, VECMATH_ITERS, VECMATH_WARMUP, VECMATH_SIZE, vecmath_sink += vecmath_read_q15x4(pQ15, VECMATH_SIZE));
+        printf("VECMATH, read_q7x4, align%lu, %lu\n", (unsigned long)off, (unsigned long)VECMATH_SIZE);
+        BENCH_RUN(vecmath, VECMATH_ITERS, VECMATH_WARMUP, VECMATH_SIZE, vecmath_sink += vecmath_read_q7x4(pQ7, VECMATH_SIZE));
+        printf("VECMATH, read_q7x8, align%lu, %lu\n", (unsigned long)off, (unsigned long)VECMATH_SIZE);
+        BENCH_RUN(vecmath, VECMATH_ITERS, VECMATH_WARMUP, VECMATH_SIZE, vecmath_sink += vecmath_read_q7x8(pQ7, VECMATH_SIZE));
+    }
+}
@@ -0,0 +1,27 @@
+#include "riscv_math.h"
+#include <stdio.h>
+#include "vecmath.h"
+
+BENCH_DECLARE_VAR();
+
+void vecmath_throughput(void)
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    uint32_t i, j, l;
+
+    for (i = 0; i < vecmath_funcs_num; i++) {
+        const vecmath_func_t *func = &vecmath_funcs[i];
+        /* Inputs spread over the input range, the functions have no data dependent branches */
+        for (j = 0; j < VECMATH_SIZE; j++) {
+            vecmath_src[j] = func->lo + (func->hi - func->lo) * ((float32_t)j / VECMATH_SIZE);
+        }
+        for (l = 0; l < VECMATH_LMUL_NUM; l++) {
+            printf("VECMATH, %s, m%lu, %lu\n", func->name, (unsigned long)vecmath_lmuls[l], (unsigned long)VECMATH_SIZE);
+            BENCH_RUN(vecmath, VECMATH_ITERS, VECMATH_WARMUP, VECMATH_SIZE,
+                      func->fn[l](vecmath_src, vecmath_dst, vecmath_dst2, VECMATH_SIZE));
+        }
+    }
+#else
+    printf("riscv_vec_math.h functions need a vector ARCH_EXT such as v or zve32f, throughput skipped\n");
+#endif
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __VECMATH_H__
+#define __VECMATH_H__
+
+/*
+ * Microbenchmark of the building blocks shared by the kernels: the exp_ps, log_ps, sincos_ps,
+ * tanh_ps and sigmoid_ps functions of riscv_vec_math.h for each LMUL, and the read_q15x2,
+ * read_q15x4, read_q7x4 and read_q7x8 helpers of riscv_math_memory.h. The run prints
+ *
+ *   VECMATH_VLEN, vlen
+ *   VECMATH, func, variant, N
+ *
+ * where variant is m1, m2, m4 or m8 for the vector functions and align0 or align<VECMATH_MISALIGN>
+ * for the memory helpers, each VECMATH line being followed by the BENCHRUN line of BENCH_RUN, and
+ *
+ *   ULP, func, variant, max_ulp, worst_input, samples
+ *
+ * for the maximum error of the vector functions against the double precision libm over their
+ * input range. Scripts/Build/nlvecmath.py gathers them into a cycles per element and max ULP
+ * table per function and LMUL, and the fastest LMUL of each function for the VLEN of the core.
+ */
+
+#include "riscv_math.h"
+#include <stdio.h>
+#include "nmsis_bench.h"
+
+#ifndef VECMATH_SIZE
+#define VECMATH_SIZE        1024
+#endif
+
+#ifndef VECMATH_ITERS
+#define VECMATH_ITERS       8
+#endif
+
+#ifndef VECMATH_WARMUP
+#define VECMATH_WARMUP      1
+#endif
+
+#ifndef VECMATH_ULP_STRIDE
+#define VECMATH_ULP_STRIDE  4096
+#endif
+
+#ifndef VECMATH_MISALIGN
+#define VECMATH_MISALIGN    1
+#endif
+
+/* Inputs of the accuracy sweep computed by one call of each function */
+#ifndef VECMATH_BATCH
+#define VECMATH_BATCH       256
+#endif
+
+/* Words of each buffer, plus the misaligned offset of the memory helpers */
+#define VECMATH_BUF_WORDS   (VECMATH_SIZE + 16)
+
+extern float32_t vecmath_src[VECMATH_BUF_WORDS];
+extern float32_t vecmath_dst[VECMATH_BUF_WORDS];
+extern float32_t vecmath_dst2[VECMATH_BUF_WORDS];
+
+/* Number of failed checks, main reports the result */
+extern uint32_t vecmath_errors;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+
+#define VECMATH_LMUL_NUM    4
+
+/* Strip mined call of one LMUL of a function, sincos_ps writes the cosine into pDst2 */
+typedef void (*vecmath_fn_t)(const float32_t *pSrc, float32_t *pDst, float32_t *pDst2, uint32_t n);
+
+typedef struct {
+    const char *name;                   /* function of riscv_vec_math.h without the _m<LMUL> suffix */
+    vecmath_fn_t fn[VECMATH_LMUL_NUM];  /* m1, m2, m4 and m8 */
+    double (*ref)(double);              /* reference of pDst */
+    double (*ref2)(double);             /* reference of pDst2, NULL when there is a single output */
+    float32_t lo;                       /* input range of the accuracy sweep and throughput runs */
+    float32_t hi;
+} vecmath_func_t;
+
+extern const vecmath_func_t vecmath_funcs[];
+extern const uint32_t vecmath_funcs_num;
+extern const uint32_t vecmath_lmuls[VECMATH_LMUL_NUM];
+
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+#endif /* __VECMATH_H__ */
@@ -36,6 +36,7 @@
 
 #include "dsp/support_functions.h"
 #include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -2195,6 +2196,139 @@ void riscv_correlate_fast_q31(
         uint32_t blockSize);
 
 
+/**
+ * @brief Maximum number of partition lengths of a partitioned FFT FIR filter.
+ */
+#define RISCV_FIR_FFT_MAX_SEGMENTS 8
+
+  /**
+   * @brief Uniformly partitioned part of a floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t partLen;                    /**< length of the partitions, the real FFT length being 2*partLen. */
+          uint16_t numParts;                   /**< number of partitions. */
+          uint16_t lag;                        /**< age in the FDL of the input spectrum used by the first partition. */
+          uint16_t fdlLen;                     /**< number of spectra in the frequency-domain delay line (FDL). */
+          uint16_t fdlPos;                     /**< index in the FDL of the newest input spectrum. */
+          float32_t *pSpectra;                 /**< points to the numParts kernel spectra of 2*partLen values. */
+          float32_t *pFdl;                     /**< points to the fdlLen input spectra of 2*partLen values. */
+          float32_t *pOut;                     /**< points to the partLen outputs computed in advance. */
+          riscv_rfft_fast_instance_f32 rfft;   /**< real FFT instance. */
+  } riscv_fir_fft_segment_f32;
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+          uint32_t numTaps;                    /**< number of filter coefficients in the filter. */
+          uint16_t blockSize;                  /**< number of samples processed at a time, the length of the first partitions. */
+          uint16_t numSegments;                /**< number of partition lengths. */
+          uint32_t histLen;                    /**< length of the input history, twice the longest partition. */
+          uint32_t histPos;                    /**< position of the oldest sample in the input history. */
+          uint32_t blockCount;                 /**< number of blocks processed, modulo histLen / (2*blockSize). */
+          float32_t *pHist;                    /**< points to the input history. */
+          float32_t *pScratch;                 /**< points to the FFT working buffers. */
+          riscv_fir_fft_segment_f32 seg[RISCV_FIR_FFT_MAX_SEGMENTS]; /**< parts of the filter. */
+  } riscv_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of S->blockSize.
+   */
+  void riscv_fir_fft_f32(
+        riscv_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients, in the order of riscv_fir_f32.
+   * @param[in]     blockSize    number of samples processed at a time, a power of two in [16, 2048].
+   * @param[in]     pPartLens    points to the partition length of each segment.
+   * @param[in]     pNumParts    points to the number of partitions of each segment.
+   * @param[in]     numSegments  number of segments, 0 for a uniform partitioning.
+   * @param[in]     pBuffer      points to a buffer of riscv_fir_fft_buffer_size_f32() values.
+   * @return        execution status
+   */
+  riscv_status riscv_fir_fft_init_f32(
+        riscv_fir_fft_instance_f32 * S,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        uint16_t blockSize,
+  const uint16_t * pPartLens,
+  const uint16_t * pNumParts,
+        uint16_t numSegments,
+        float32_t * pBuffer);
+
+  /**
+   * @brief  Buffer length of the floating-point partitioned FFT FIR filter.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     blockSize    number of samples processed at a time.
+   * @param[in]     pPartLens    points to the partition length of each segment.
+   * @param[in]     pNumParts    points to the number of partitions of each segment.
+   * @param[in]     numSegments  number of segments, 0 for a uniform partitioning.
+   * @return        length of the buffer in float32_t values, 0 for unsupported arguments
+   */
+  uint32_t riscv_fir_fft_buffer_size_f32(
+        uint32_t numTaps,
+        uint16_t blockSize,
+  const uint16_t * pPartLens,
+  const uint16_t * pNumParts,
+        uint16_t numSegments);
+
+  /**
+   * @brief Convolution of long floating-point sequences with FFTs.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to a buffer of riscv_conv_fft_scratch_size_f32() values.
+   */
+  void riscv_conv_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief Correlation of long floating-point sequences with FFTs.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to a buffer of riscv_conv_fft_scratch_size_f32() values.
+   */
+  void riscv_correlate_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief Scratch length of the FFT convolution and correlation.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @return     length of the scratch buffer in float32_t values
+   */
+  uint32_t riscv_conv_fft_scratch_size_f32(
+        uint32_t srcALen,
+        uint32_t srcBLen);
+
+
 
 
 
@@ -400,6 +400,14 @@ riscv_status riscv_cfft_init_16_f32(riscv_cfft_instance_f32 * S);
   riscv_cfft_instance_f32 * S,
   uint16_t fftLen);
 
+/* Twiddle and bit reversal tables computed into pBuffer of
+   riscv_cfft_runtime_buffer_size() values instead of the const tables
+*/
+riscv_status riscv_cfft_init_runtime_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer);
+
 #if defined(RISCV_MATH_VECTOR_ZVE32F)
 
 riscv_cfft_instance_f32 *riscv_cfft_init_dynamic_f32(uint32_t fftLen);
@@ -808,6 +816,338 @@ void riscv_rfft_fast_f32(
         uint8_t ifftFlag);
 #endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
 
+  /**
+   * @brief Instance structure for the Q31 fast RFFT/RIFFT function.
+   */
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  typedef struct
+  {
+    riscv_cfft_instance_q31 Sint;           /**< Internal CFFT structure. */
+    uint32_t fftLenRFFT;                    /**< length of the real FFT. */
+    const q31_t *ptwd_re;                   /**< points to the real part of Twiddle factor table. */
+    const q31_t *ptwd_im;                   /**< points to the imag part of Twiddle factor table. */
+  } riscv_rfft_fast_instance_q31;
+#else
+  typedef struct
+  {
+          riscv_cfft_instance_q31 Sint;     /**< Internal CFFT structure. */
+          uint32_t fftLenRFFT;              /**< length of the real FFT. */
+          uint32_t twidCoefRModifier;       /**< twiddle coefficient modifier of the 8192 points table. */
+    const q31_t *pTwiddleAReal;             /**< points to the real twiddle factor table. */
+  } riscv_rfft_fast_instance_q31;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+riscv_status riscv_rfft_fast_init_32_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_64_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_128_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_256_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_512_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_1024_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_2048_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_4096_q31(riscv_rfft_fast_instance_q31 * S);
+riscv_status riscv_rfft_fast_init_8192_q31(riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_q31(
+        riscv_rfft_fast_instance_q31 * S,
+        uint16_t fftLen);
+
+void riscv_rfft_fast_q31(
+  const riscv_rfft_fast_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q15 fast RFFT/RIFFT function.
+   */
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  typedef struct
+  {
+    riscv_cfft_instance_q15 Sint;           /**< Internal CFFT structure. */
+    uint32_t fftLenRFFT;                    /**< length of the real FFT. */
+    const q15_t *ptwd_re;                   /**< points to the real part of Twiddle factor table. */
+    const q15_t *ptwd_im;                   /**< points to the imag part of Twiddle factor table. */
+  } riscv_rfft_fast_instance_q15;
+#else
+  typedef struct
+  {
+          riscv_cfft_instance_q15 Sint;     /**< Internal CFFT structure. */
+          uint32_t fftLenRFFT;              /**< length of the real FFT. */
+          uint32_t twidCoefRModifier;       /**< twiddle coefficient modifier of the 8192 points table. */
+    const q15_t *pTwiddleAReal;             /**< points to the real twiddle factor table. */
+  } riscv_rfft_fast_instance_q15;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+riscv_status riscv_rfft_fast_init_32_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_64_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_128_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_256_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_512_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_1024_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_2048_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_4096_q15(riscv_rfft_fast_instance_q15 * S);
+riscv_status riscv_rfft_fast_init_8192_q15(riscv_rfft_fast_instance_q15 * S);
+
+riscv_status riscv_rfft_fast_init_q15(
+        riscv_rfft_fast_instance_q15 * S,
+        uint16_t fftLen);
+
+void riscv_rfft_fast_q15(
+  const riscv_rfft_fast_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp,
+        uint8_t ifftFlag);
+
+/**
+ * @brief Maximum number of radix-2/3/4/5 stages of a mixed-radix FFT.
+ *        A 32-bit length which is a product of 2, 3 and 5 has at most 20 stages.
+ */
+#define RISCV_CFFT_MIXED_MAX_STAGES 20
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                                  /**< length of the FFT. */
+          uint16_t numStages;                               /**< number of radix stages. */
+          uint8_t factors[RISCV_CFFT_MIXED_MAX_STAGES];     /**< radix of each stage. */
+    const float32_t *pTwiddle;                              /**< points to the Twiddle factor table. */
+  } riscv_cfft_mixed_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                                  /**< length of the FFT. */
+          uint16_t numStages;                               /**< number of radix stages. */
+          uint8_t factors[RISCV_CFFT_MIXED_MAX_STAGES];     /**< radix of each stage. */
+    const q31_t *pTwiddle;                                  /**< points to the Twiddle factor table. */
+  } riscv_cfft_mixed_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                                  /**< length of the FFT. */
+          uint16_t numStages;                               /**< number of radix stages. */
+          uint8_t factors[RISCV_CFFT_MIXED_MAX_STAGES];     /**< radix of each stage. */
+    const q15_t *pTwiddle;                                  /**< points to the Twiddle factor table. */
+  } riscv_cfft_mixed_instance_q15;
+
+  riscv_status riscv_cfft_mixed_init_f32(
+        riscv_cfft_mixed_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle);
+
+  riscv_status riscv_cfft_mixed_init_q31(
+        riscv_cfft_mixed_instance_q31 * S,
+        uint32_t fftLen,
+        q31_t * pTwiddle);
+
+  riscv_status riscv_cfft_mixed_init_q15(
+        riscv_cfft_mixed_instance_q15 * S,
+        uint32_t fftLen,
+        q15_t * pTwiddle);
+
+/* `pIn`, `pOut` and `pBuffer` must be three different arrays of 2*fftLen values.
+   `pIn` is not modified.
+*/
+  void riscv_cfft_mixed_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pIn,
+        float32_t * pOut,
+        float32_t * pBuffer,
+        uint8_t ifftFlag);
+
+  void riscv_cfft_mixed_q31(
+  const riscv_cfft_mixed_instance_q31 * S,
+  const q31_t * pIn,
+        q31_t * pOut,
+        q31_t * pBuffer,
+        uint8_t ifftFlag);
+
+  void riscv_cfft_mixed_q15(
+  const riscv_cfft_mixed_instance_q15 * S,
+  const q15_t * pIn,
+        q15_t * pOut,
+        q15_t * pBuffer,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          riscv_cfft_mixed_instance_f32 Sint;   /**< Internal CFFT structure. */
+          uint32_t fftLenRFFT;                  /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;             /**< Twiddle factors real stage  */
+  } riscv_rfft_mixed_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          riscv_cfft_mixed_instance_q31 Sint;   /**< Internal CFFT structure. */
+          uint32_t fftLenRFFT;                  /**< length of the real sequence */
+    const q31_t * pTwiddleRFFT;                 /**< Twiddle factors real stage  */
+  } riscv_rfft_mixed_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          riscv_cfft_mixed_instance_q15 Sint;   /**< Internal CFFT structure. */
+          uint32_t fftLenRFFT;                  /**< length of the real sequence */
+    const q15_t * pTwiddleRFFT;                 /**< Twiddle factors real stage  */
+  } riscv_rfft_mixed_instance_q15;
+
+  riscv_status riscv_rfft_mixed_init_f32(
+        riscv_rfft_mixed_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle);
+
+  riscv_status riscv_rfft_mixed_init_q31(
+        riscv_rfft_mixed_instance_q31 * S,
+        uint32_t fftLen,
+        q31_t * pTwiddle);
+
+  riscv_status riscv_rfft_mixed_init_q15(
+        riscv_rfft_mixed_instance_q15 * S,
+        uint32_t fftLen,
+        q15_t * pTwiddle);
+
+/* `pBuffer` holds 2*fftLen values. `pIn` is not modified. */
+  void riscv_rfft_mixed_f32(
+  const riscv_rfft_mixed_instance_f32 * S,
+  const float32_t * pIn,
+        float32_t * pOut,
+        float32_t * pBuffer,
+        uint8_t ifftFlag);
+
+  void riscv_rfft_mixed_q31(
+  const riscv_rfft_mixed_instance_q31 * S,
+  const q31_t * pIn,
+        q31_t * pOut,
+        q31_t * pBuffer,
+        uint8_t ifftFlag);
+
+  void riscv_rfft_mixed_q15(
+  const riscv_rfft_mixed_instance_q15 * S,
+  const q15_t * pIn,
+        q15_t * pOut,
+        q15_t * pBuffer,
+        uint8_t ifftFlag);
+
+/**
+ * @brief Size in bytes of a tile of the large CFFT.
+ *        The tile, the sub-FFT tables and the twiddle factors should fit in the data cache.
+ */
+#ifndef RISCV_CFFT_LARGE_TILE_SIZE
+#define RISCV_CFFT_LARGE_TILE_SIZE 32768
+#endif
+
+  /**
+   * @brief Instance structure for the floating-point large CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                   /**< length of the FFT. */
+          uint16_t fftLenCol;                /**< length of the column FFTs. */
+          uint16_t fftLenRow;                /**< length of the row FFTs. */
+          uint16_t log2Row;                  /**< log2 of fftLenRow. */
+          uint16_t tileLen;                  /**< number of columns or rows processed per tile. */
+          riscv_cfft_instance_f32 Scol;      /**< column FFT instance. */
+          riscv_cfft_instance_f32 Srow;      /**< row FFT instance. */
+    const float32_t *pTwiddle;               /**< points to the twiddle factors of the transposition stage. */
+  } riscv_cfft_large_instance_f32;
+
+  riscv_status riscv_cfft_large_init_f32(
+        riscv_cfft_large_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle);
+
+/* `pSrc` content is modified by the function, it must be different from `pDst`. */
+  void riscv_cfft_large_f32(
+  const riscv_cfft_large_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pBuffer,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point batched CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                   /**< length of the FFT. */
+          uint16_t log2Len;                  /**< log2 of fftLen. */
+    const float32_t *pTwiddle;               /**< points to the fftLen/2 complex twiddle factors. */
+  } riscv_cfft_batch_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 batched CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                   /**< length of the FFT. */
+          uint16_t log2Len;                  /**< log2 of fftLen. */
+    const q31_t *pTwiddle;                   /**< points to the fftLen/2 complex twiddle factors. */
+  } riscv_cfft_batch_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 batched CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                   /**< length of the FFT. */
+          uint16_t log2Len;                  /**< log2 of fftLen. */
+    const q15_t *pTwiddle;                   /**< points to the fftLen/2 complex twiddle factors. */
+  } riscv_cfft_batch_instance_q15;
+
+  riscv_status riscv_cfft_batch_init_f32(
+        riscv_cfft_batch_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle);
+
+  riscv_status riscv_cfft_batch_init_q31(
+        riscv_cfft_batch_instance_q31 * S,
+        uint16_t fftLen,
+        q31_t * pTwiddle);
+
+  riscv_status riscv_cfft_batch_init_q15(
+        riscv_cfft_batch_instance_q15 * S,
+        uint16_t fftLen,
+        q15_t * pTwiddle);
+
+/* Transform t is computed in place at `pData + 2*t*stride`, `stride` is at least fftLen. */
+  void riscv_cfft_batch_f32(
+  const riscv_cfft_batch_instance_f32 * S,
+        float32_t * pData,
+        uint32_t nTransforms,
+        uint32_t stride,
+        uint8_t ifftFlag);
+
+  void riscv_cfft_batch_q31(
+  const riscv_cfft_batch_instance_q31 * S,
+        q31_t * pData,
+        uint32_t nTransforms,
+        uint32_t stride,
+        uint8_t ifftFlag);
+
+  void riscv_cfft_batch_q15(
+  const riscv_cfft_batch_instance_q15 * S,
+        q15_t * pData,
+        uint32_t nTransforms,
+        uint32_t stride,
+        uint8_t ifftFlag);
+
 /* DCT4 functions rely on rfft, but rfft functions with rvv extension has changed the interface. */
 #if !defined(RISCV_MATH_VECTOR_ZVE32F)
   /**
@@ -1394,6 +1734,342 @@ riscv_status riscv_mfcc_init_q15(
   );
 #endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 
+  /**
+   * @brief Instance structure for the floating-point STFT function.
+   */
+  typedef struct
+  {
+          uint16_t frameLen;                   /**< length of the frames and of the real FFT. */
+          uint16_t hopLen;                     /**< number of samples between the starts of two frames. */
+          uint16_t pos;                        /**< position of the oldest sample in the state buffer. */
+          uint16_t count;                      /**< number of samples received since the last frame. */
+    const float32_t *pWindow;                  /**< points to the analysis window of frameLen values. */
+          float32_t *pState;                   /**< points to the state buffer of frameLen values. */
+          riscv_rfft_fast_instance_f32 rfft;   /**< real FFT instance. */
+  } riscv_stft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 STFT function.
+   */
+  typedef struct
+  {
+          uint16_t frameLen;                   /**< length of the frames and of the real FFT. */
+          uint16_t hopLen;                     /**< number of samples between the starts of two frames. */
+          uint16_t pos;                        /**< position of the oldest sample in the state buffer. */
+          uint16_t count;                      /**< number of samples received since the last frame. */
+    const q31_t *pWindow;                      /**< points to the analysis window of frameLen values. */
+          q31_t *pState;                       /**< points to the state buffer of frameLen values. */
+          riscv_rfft_instance_q31 rfft;        /**< real FFT instance. */
+  } riscv_stft_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 STFT function.
+   */
+  typedef struct
+  {
+          uint16_t frameLen;                   /**< length of the frames and of the real FFT. */
+          uint16_t hopLen;                     /**< number of samples between the starts of two frames. */
+          uint16_t pos;                        /**< position of the oldest sample in the state buffer. */
+          uint16_t count;                      /**< number of samples received since the last frame. */
+    const q15_t *pWindow;                      /**< points to the analysis window of frameLen values. */
+          q15_t *pState;                       /**< points to the state buffer of frameLen values. */
+          riscv_rfft_instance_q31 rfft;        /**< Q31 real FFT instance. */
+  } riscv_stft_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point ISTFT function.
+   */
+  typedef struct
+  {
+          uint16_t frameLen;                   /**< length of the frames and of the real FFT. */
+          uint16_t hopLen;                     /**< number of samples between the starts of two frames. */
+          uint16_t pos;                        /**< position of the oldest sample in the overlap-add buffer. */
+          float32_t scale;                     /**< overlap-add normalization factor. */
+    const float32_t *pWindow;                  /**< points to the synthesis window of frameLen values. */
+          float32_t *pState;                   /**< points to the overlap-add buffer of frameLen values. */
+          riscv_rfft_fast_instance_f32 rfft;   /**< real FFT instance. */
+  } riscv_istft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 ISTFT function.
+   */
+  typedef struct
+  {
+          uint16_t frameLen;                   /**< length of the frames and of the real FFT. */
+          uint16_t hopLen;                     /**< number of samples between the starts of two frames. */
+          uint16_t pos;                        /**< position of the oldest sample in the overlap-add buffer. */
+          int8_t shift;                        /**< shift of the overlap-add normalization factor. */
+          q31_t scaleFract;                    /**< fractional part of the overlap-add normalization factor. */
+    const q31_t *pWindow;                      /**< points to the synthesis window of frameLen values. */
+          q31_t *pState;                       /**< points to the overlap-add buffer of frameLen values. */
+          riscv_rfft_instance_q31 rfft;        /**< real FFT instance. */
+  } riscv_istft_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 ISTFT function.
+   */
+  typedef struct
+  {
+          uint16_t frameLen;                   /**< length of the frames and of the real FFT. */
+          uint16_t hopLen;                     /**< number of samples between the starts of two frames. */
+          uint16_t pos;                        /**< position of the oldest sample in the overlap-add buffer. */
+          int8_t shift;                        /**< shift of the overlap-add normalization factor. */
+          q31_t scaleFract;                    /**< fractional part of the overlap-add normalization factor. */
+    const q15_t *pWindow;                      /**< points to the synthesis window of frameLen values. */
+          q15_t *pState;                       /**< points to the overlap-add buffer of frameLen values. */
+          riscv_rfft_instance_q31 rfft;        /**< Q31 real FFT instance. */
+  } riscv_istft_instance_q15;
+
+  riscv_status riscv_stft_init_f32(
+        riscv_stft_instance_f32 * S,
+        uint16_t frameLen,
+        uint16_t hopLen,
+  const float32_t * pWindow,
+        float32_t * pState);
+
+  riscv_status riscv_stft_init_q31(
+        riscv_stft_instance_q31 * S,
+        uint16_t frameLen,
+        uint16_t hopLen,
+  const q31_t * pWindow,
+        q31_t * pState);
+
+  riscv_status riscv_stft_init_q15(
+        riscv_stft_instance_q15 * S,
+        uint16_t frameLen,
+        uint16_t hopLen,
+  const q15_t * pWindow,
+        q15_t * pState);
+
+  riscv_status riscv_istft_init_f32(
+        riscv_istft_instance_f32 * S,
+        uint16_t frameLen,
+        uint16_t hopLen,
+  const float32_t * pWindow,
+        float32_t * pState);
+
+  riscv_status riscv_istft_init_q31(
+        riscv_istft_instance_q31 * S,
+        uint16_t frameLen,
+        uint16_t hopLen,
+  const q31_t * pWindow,
+        q31_t * pState);
+
+  riscv_status riscv_istft_init_q15(
+        riscv_istft_instance_q15 * S,
+        uint16_t frameLen,
+        uint16_t hopLen,
+  const q15_t * pWindow,
+        q15_t * pState);
+
+/* The STFT functions return the number of frames written to `pDst`,
+   at most (hopLen - 1 + blockSize) / hopLen.
+*/
+  uint32_t riscv_stft_f32(
+        riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  uint32_t riscv_stft_q31(
+        riscv_stft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  uint32_t riscv_stft_q15(
+        riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        q15_t * pDst,
+        q31_t * pTmp);
+
+  uint32_t riscv_stft_mag_f32(
+        riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  uint32_t riscv_stft_mag_q31(
+        riscv_stft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  uint32_t riscv_stft_mag_q15(
+        riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        q15_t * pDst,
+        q31_t * pTmp);
+
+/* The floating-point ISTFT may modify `pSrc` when RVV is not used. */
+  void riscv_istft_f32(
+        riscv_istft_instance_f32 * S,
+        float32_t * pSrc,
+        uint32_t numFrames,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  void riscv_istft_q31(
+        riscv_istft_instance_q31 * S,
+        q31_t * pSrc,
+        uint32_t numFrames,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  void riscv_istft_q15(
+        riscv_istft_instance_q15 * S,
+        q15_t * pSrc,
+        uint32_t numFrames,
+        q15_t * pDst,
+        q31_t * pTmp);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                    /**< number of frequencies of the bank. */
+          uint16_t blockLen;                   /**< number of samples of the analyzed blocks. */
+    const float32_t *pCoeffs;                  /**< points to 2*cos(2*pi*f) for each frequency f. */
+  } riscv_goertzel_bank_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                    /**< number of frequencies of the bank. */
+          uint16_t blockLen;                   /**< number of samples of the analyzed blocks. */
+          uint8_t shift;                       /**< right shift of the input samples which avoids overflows. */
+    const q31_t *pCoeffs;                      /**< points to cos(2*pi*f) in Q31 for each frequency f. */
+  } riscv_goertzel_bank_instance_q31;
+
+  riscv_status riscv_goertzel_bank_init_f32(
+        riscv_goertzel_bank_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs);
+
+  riscv_status riscv_goertzel_bank_init_q31(
+        riscv_goertzel_bank_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const q31_t * pFreqs,
+        q31_t * pCoeffs);
+
+  void riscv_goertzel_bank_f32(
+  const riscv_goertzel_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+  void riscv_goertzel_bank_q31(
+  const riscv_goertzel_bank_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                    /**< number of computed bins. */
+          uint16_t fftLen;                     /**< length of the DFT and of the sliding window. */
+          uint16_t pos;                        /**< position of the oldest sample in the history buffer. */
+          float32_t dampingN;                  /**< damping factor raised to the power fftLen. */
+    const float32_t *pCoeffs;                  /**< points to the complex twiddle r*exp(j*2*pi*k/fftLen) of each bin k. */
+          float32_t *pBins;                    /**< points to the complex value of each bin. */
+          float32_t *pHist;                    /**< points to the history buffer of fftLen samples. */
+  } riscv_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                    /**< number of computed bins. */
+          uint16_t fftLen;                     /**< length of the DFT and of the sliding window. */
+          uint16_t pos;                        /**< position of the oldest sample in the history buffer. */
+          uint8_t shift;                       /**< right shift of the input samples which avoids overflows. */
+          q31_t dampingN;                      /**< damping factor raised to the power fftLen. */
+    const q31_t *pCoeffs;                      /**< points to the complex twiddle r*exp(j*2*pi*k/fftLen) of each bin k. */
+          q31_t *pBins;                        /**< points to the complex value of each bin. */
+          q31_t *pHist;                        /**< points to the history buffer of fftLen samples. */
+  } riscv_sdft_instance_q31;
+
+  riscv_status riscv_sdft_init_f32(
+        riscv_sdft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBinIdx,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState);
+
+  riscv_status riscv_sdft_init_q31(
+        riscv_sdft_instance_q31 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBinIdx,
+        q31_t damping,
+        q31_t * pCoeffs,
+        q31_t * pState);
+
+  void riscv_sdft_f32(
+        riscv_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst);
+
+  void riscv_sdft_q31(
+        riscv_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point chirp-z transform.
+   */
+  typedef struct
+  {
+          uint16_t srcLen;                     /**< number of complex input samples. */
+          uint16_t numBins;                    /**< number of complex output bins. */
+          uint16_t fftLen;                     /**< length of the FFTs of the convolution. */
+          riscv_cfft_instance_f32 Scfft;       /**< FFT instance of length fftLen. */
+    const float32_t *pChirpIn;                 /**< points to the srcLen complex weights of the input. */
+    const float32_t *pChirpOut;                /**< points to the numBins complex weights of the output. */
+    const float32_t *pKernel;                  /**< points to the fftLen complex spectrum of the chirp. */
+  } riscv_czt_instance_f32;
+
+  riscv_status riscv_czt_init_f32(
+        riscv_czt_instance_f32 * S,
+        uint16_t srcLen,
+        uint16_t numBins,
+        float32_t fStart,
+        float32_t fStep,
+        float32_t * pBuffer,
+        float32_t * pScratch);
+
+  void riscv_czt_f32(
+  const riscv_czt_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  uint32_t riscv_czt_buffer_size_f32(
+        uint16_t srcLen,
+        uint16_t numBins);
+
+  uint32_t riscv_czt_scratch_size_f32(
+        uint16_t srcLen,
+        uint16_t numBins);
+
 /**
   @brief Calculate required length for the temporary buffer
   @param[in] dt Data type of the input data
@@ -1430,6 +2106,61 @@ extern int32_t riscv_cfft_output_buffer_size(riscv_math_datatype dt,
 extern int32_t riscv_cifft_output_buffer_size(riscv_math_datatype dt,
                                              uint32_t nb_samples);
 
+/**
+  @brief Calculate required length for the twiddle buffer of the mixed-radix CFFT
+  @param[in] dt Data type of the input data
+  @param[in] nb_samples Number of samples in the input data
+  @return Length in datatype elements (real numbers) for the twiddle buffer
+
+  @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_cfft_mixed_twiddle_buffer_size(riscv_math_datatype dt,
+                                                   uint32_t nb_samples);
+
+/**
+  @brief Calculate required length for the twiddle buffer of the large CFFT
+  @param[in] dt Data type of the input data
+  @param[in] nb_samples Number of samples in the input data
+  @return Length in datatype elements (real numbers) for the twiddle buffer
+
+  @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_cfft_large_twiddle_buffer_size(riscv_math_datatype dt,
+                                                   uint32_t nb_samples);
+
+/**
+  @brief Calculate required length for the temporary buffer of the large CFFT
+  @param[in] dt Data type of the input data
+  @param[in] nb_samples Number of samples in the input data
+  @return Length in datatype elements (real numbers) for the temporary buffer
+
+  @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_cfft_large_tmp_buffer_size(riscv_math_datatype dt,
+                                               uint32_t nb_samples);
+
+/**
+  @brief Calculate required length for the table buffer of riscv_cfft_init_runtime_f32
+  @param[in] dt Data type of the input data
+  @param[in] nb_samples Number of samples in the input data
+  @return Length in datatype elements (real numbers) for the table buffer
+
+  @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_cfft_runtime_buffer_size(riscv_math_datatype dt,
+                                             uint32_t nb_samples);
+
+/**
+  @brief Calculate required length for the twiddle buffer of the batched CFFT
+  @param[in] dt Data type of the input data
+  @param[in] nb_samples Number of samples in the input data
+  @return Length in datatype elements (real numbers) for the twiddle buffer
+
+  @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_cfft_batch_twiddle_buffer_size(riscv_math_datatype dt,
+                                                   uint32_t nb_samples);
+
 /**
    @brief Calculate required length for the temporary buffer for both RFFT and RIFFT
    @param[in] dt Data type of the input data
@@ -1442,6 +2173,29 @@ extern int32_t riscv_cifft_output_buffer_size(riscv_math_datatype dt,
 extern int32_t riscv_rfft_tmp_buffer_size(riscv_math_datatype dt,
                                          uint32_t nb_samples);
 
+/**
+   @brief Calculate required length for the temporary buffer of the fast RFFT and RIFFT
+   @param[in] dt Data type of the input data
+   @param[in] nb_samples Number of samples in the input data
+   @return Length in datatype elements (real numbers) for the temporary buffer
+
+   @note 0 means not applicable (temporary buffer not needed)
+   @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_rfft_fast_tmp_buffer_size(riscv_math_datatype dt,
+                                              uint32_t nb_samples);
+
+/**
+   @brief Calculate required length for the output buffer of the fast RFFT
+   @param[in] dt Data type of the input data
+   @param[in] nb_samples Number of samples in the input data
+   @return Length in datatype elements (real numbers) for the output buffer
+
+   @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_rfft_fast_output_buffer_size(riscv_math_datatype dt,
+                                                 uint32_t nb_samples);
+
 /**
    @brief Calculate required length for the output buffer
    @param[in] dt Data type of the input data
@@ -1454,6 +2208,17 @@ extern int32_t riscv_rfft_tmp_buffer_size(riscv_math_datatype dt,
 extern int32_t riscv_rfft_output_buffer_size(riscv_math_datatype dt,
                                             uint32_t nb_samples);
 
+/**
+   @brief Calculate required length for the twiddle buffer of the mixed-radix RFFT
+   @param[in] dt Data type of the input data
+   @param[in] nb_samples Number of samples in the input data
+   @return Length in datatype elements (real numbers) for the twiddle buffer
+
+   @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_rfft_mixed_twiddle_buffer_size(riscv_math_datatype dt,
+                                                   uint32_t nb_samples);
+
 
 /**
  * @brief Calculate required length for the input buffer
@@ -1483,6 +2248,18 @@ extern int32_t riscv_mfcc_tmp_buffer_size(riscv_math_datatype dt,
                                          uint32_t buf_id,
                                          uint32_t use_cfft);
 
+/**
+   @brief Calculate required length for the temporary buffer of the STFT and ISTFT
+   @param[in] dt Data type of the input data
+   @param[in] nb_samples Frame length
+   @return Length in datatype elements (real numbers) for the temporary buffer,
+           in q31_t elements for RISCV_MATH_Q15
+
+   @note -1 means error : configuration not supported
+*/
+extern int32_t riscv_stft_tmp_buffer_size(riscv_math_datatype dt,
+                                         uint32_t nb_samples);
+
 #ifdef   __cplusplus
 }
 #endif
@@ -230,7 +230,7 @@ _RVV_FLOAT32_EXP_OP(8, 4)
         y = __riscv_vfmul_vf_f32m##LMUL(x, c_cephes_FOPI, vl);                                                                                              \
                                                                                                                                                             \
         /* store the integer part of y in mm0 */                                                                                                            \
-        emm2 = __riscv_vfcvt_xu_f_v_u32m##LMUL(y, vl);                                                                                                      \
+        emm2 = __riscv_vfcvt_rtz_xu_f_v_u32m##LMUL(y, vl);                                                                                                  \
         /* j=(j+1) & (~1) (see the cephes sources) */                                                                                                       \
         emm2 = __riscv_vadd_vx_u32m##LMUL(emm2, 1, vl);                                                                                                     \
         emm2 = __riscv_vand_vx_u32m##LMUL(emm2, ~1, vl);                                                                                                    \
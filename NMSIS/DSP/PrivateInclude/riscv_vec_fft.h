@@ -33,7 +33,207 @@ extern "C"
 {
 #endif
 
+/* 2*pi in double precision, for the twiddle factors of the mixed-radix FFTs */
+#define RISCV_CFFT_MIXED_2PI (6.283185307179586476925286766559)
 
+/**
+  @brief         Split a mixed-radix FFT length into radix-4, 2, 3 and 5 stages
+  @param[in]     fftLen   length of the FFT
+  @param[out]    pFactors radix of each stage, RISCV_CFFT_MIXED_MAX_STAGES entries
+  @return        number of stages, 0 when fftLen is not a product of 2, 3 and 5
+ */
+__STATIC_INLINE uint16_t riscv_cfft_mixed_factorize(
+  uint32_t fftLen,
+  uint8_t * pFactors)
+{
+  const uint8_t radix[4] = {4U, 2U, 3U, 5U};
+  uint16_t numStages = 0U;
+
+  if (fftLen < 2U)
+  {
+    return 0U;
+  }
+
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    while ((fftLen % radix[i]) == 0U)
+    {
+      pFactors[numStages++] = radix[i];
+      fftLen /= radix[i];
+    }
+  }
+
+  return (fftLen == 1U) ? numStages : 0U;
+}
+
+/**
+  @brief         Number of complex twiddle factors used by a mixed-radix FFT
+  @param[in]     fftLen   length of the FFT
+  @return        number of complex twiddle factors, 0 when fftLen is not supported
+
+  @par           Stage k of radix r works on sub-transforms of length n = r * m and stores
+                 the (r - 1) * m twiddle factors w_n^(j*p), j = 1..r-1, p = 0..m-1, j-major.
+ */
+__STATIC_INLINE uint32_t riscv_cfft_mixed_twiddle_count(
+  uint32_t fftLen)
+{
+  uint8_t factors[RISCV_CFFT_MIXED_MAX_STAGES];
+  uint16_t numStages = riscv_cfft_mixed_factorize(fftLen, factors);
+  uint32_t count = 0U;
+  uint32_t n = fftLen;
+
+  for (uint16_t stage = 0U; stage < numStages; stage++)
+  {
+    n /= factors[stage];
+    count += (factors[stage] - 1U) * n;
+  }
+
+  return count;
+}
+
+/**
+  @brief         log2 of a large CFFT length
+  @param[in]     fftLen   length of the FFT
+  @return        log2(fftLen), 0 when fftLen is not a power of two in [256, 16777216]
+
+  @par           The FFT is split into fftLenCol = 2^(p/2) columns FFTs and fftLenRow = 2^(p - p/2)
+                 rows FFTs, both being supported by \ref riscv_cfft_f32.
+ */
+__STATIC_INLINE uint16_t riscv_cfft_large_log2(
+  uint32_t fftLen)
+{
+  uint16_t p = 0U;
+
+  if ((fftLen & (fftLen - 1U)) != 0U)
+  {
+    return 0U;
+  }
+  while ((1UL << p) < fftLen)
+  {
+    p++;
+  }
+
+  return ((p < 8U) || (p > 24U)) ? 0U : p;
+}
+
+/**
+  @brief         Number of columns or rows processed per tile by a large CFFT
+  @param[in]     fftLenRow   length of the row FFTs, the longest sub-FFT
+  @return        tile length, a power of two in [1, 16]
+ */
+__STATIC_INLINE uint16_t riscv_cfft_large_tile_len(
+  uint32_t fftLenRow)
+{
+  uint32_t tileLen = RISCV_CFFT_LARGE_TILE_SIZE / (2U * sizeof(float32_t) * fftLenRow);
+  uint16_t len = 1U;
+
+  while ((len < 16U) && ((2U * len) <= tileLen))
+  {
+    len *= 2U;
+  }
+
+  return len;
+}
+
+/**
+  @brief         Length of the tables computed by \ref riscv_cfft_init_runtime_f32
+  @param[in]     fftLen   length of the FFT
+  @return        length in float32_t values, 0 when fftLen is not a power of two in [16, 4096]
+
+  @par           The RVV CFFT has fftLen/2 * (log2(fftLen) - 1) real and imaginary twiddles and
+                 fftLen 16-bit output offsets, the other CFFT has fftLen complex twiddles and up to
+                 2 * (fftLen - 1) 16-bit bit reversal offsets.
+ */
+__STATIC_INLINE uint32_t riscv_cfft_runtime_table_len(
+  uint32_t fftLen)
+{
+  uint32_t p = 0U;
+
+  if ((fftLen < 16U) || (fftLen > 4096U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return 0U;
+  }
+  while ((1UL << p) < fftLen)
+  {
+    p++;
+  }
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  return fftLen * (p - 1U) + fftLen / 2U;
+#else
+  return fftLen * 3U;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+#ifndef RISCV_CFFT_RUNTIME_MAX_LEN
+/**
+  Largest CFFT length of riscv_cfft_init_f32 and largest RFFT length / 2 of riscv_rfft_fast_init_f32
+  when they compute their tables at runtime with RISCV_CFFT_RUNTIME_TABLES, a power of two in [16, 4096].
+  It sizes their static table pools; a smaller value saves RAM but the longer lengths are then rejected.
+ */
+#define RISCV_CFFT_RUNTIME_MAX_LEN 4096U
+#endif
+
+/** log2 of a power of two CFFT length in [16, 4096], for the static pool sizes */
+#define RISCV_CFFT_RUNTIME_LOG2(N) ((N) >= 4096U ? 12U : (N) >= 2048U ? 11U : (N) >= 1024U ? 10U : \
+                                    (N) >= 512U ? 9U : (N) >= 256U ? 8U : (N) >= 128U ? 7U : \
+                                    (N) >= 64U ? 6U : (N) >= 32U ? 5U : 4U)
+
+/** riscv_cfft_runtime_table_len() of a supported length N, as a constant expression */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#define RISCV_CFFT_RUNTIME_TABLE_LEN(N) ((N) * (RISCV_CFFT_RUNTIME_LOG2(N) - 1U) + (N) / 2U)
+#else
+#define RISCV_CFFT_RUNTIME_TABLE_LEN(N) ((N) * 3U)
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+/**
+  @brief         log2 of a batched CFFT length
+  @param[in]     fftLen   length of the FFT
+  @return        log2(fftLen), 0 when fftLen is not a power of two in [2, 32768]
+ */
+__STATIC_INLINE uint16_t riscv_cfft_batch_log2(
+  uint32_t fftLen)
+{
+  uint16_t p = 0U;
+
+  if ((fftLen < 2U) || (fftLen > 32768U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return 0U;
+  }
+  while ((1UL << p) < fftLen)
+  {
+    p++;
+  }
+
+  return p;
+}
+
+/**
+  @brief         FFT length of a chirp-z transform
+  @param[in]     srcLen   number of input samples
+  @param[in]     numBins  number of output bins
+  @return        smallest power of two in [16, 4096] not lower than srcLen + numBins - 1,
+                 0 when there is none
+
+  @par           The circular convolution of the FFTs must not wrap the outputs of the linear one.
+ */
+__STATIC_INLINE uint16_t riscv_czt_fft_len(
+  uint32_t srcLen,
+  uint32_t numBins)
+{
+  uint32_t fftLen = 16U;
+
+  if ((srcLen == 0U) || (numBins == 0U))
+  {
+    return 0U;
+  }
+  while (fftLen < srcLen + numBins - 1U)
+  {
+    fftLen *= 2U;
+  }
+
+  return (fftLen > 4096U) ? 0U : (uint16_t)fftLen;
+}
 
 #ifdef   __cplusplus
 }
@@ -33,7 +33,177 @@ extern "C"
 {
 #endif
 
+#if defined(RISCV_CONV_FFT)
+/* Shortest sequences convolved or correlated, and shortest FIR filters and blocks, computed with FFTs */
+#ifndef RISCV_CONV_FFT_THRESHOLD
+#define RISCV_CONV_FFT_THRESHOLD 128U
+#endif
+
+#ifndef RISCV_CONV_FFT_MAX_LEN
+/**
+  Longest shortest sequence of riscv_conv_f32 and riscv_correlate_f32, and longest filter of riscv_fir_f32,
+  computed with FFTs, a power of two in [16, 2048]. It sizes the static scratch buffer of the FFT path;
+  the longer ones are computed directly.
+ */
+#define RISCV_CONV_FFT_MAX_LEN 1024U
+#endif
+
+#if ((RISCV_CONV_FFT_MAX_LEN & (RISCV_CONV_FFT_MAX_LEN - 1U)) != 0U) || (RISCV_CONV_FFT_MAX_LEN < 16U) || (RISCV_CONV_FFT_MAX_LEN > 2048U)
+#error "RISCV_CONV_FFT_MAX_LEN must be a power of two in [16, 2048]"
+#endif
+
+/** riscv_conv_fft_scratch_size_f32() of RISCV_CONV_FFT_MAX_LEN samples, a single partition of the same length */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#define RISCV_CONV_FFT_SCRATCH_LEN (17U * RISCV_CONV_FFT_MAX_LEN)
+#else
+#define RISCV_CONV_FFT_SCRATCH_LEN (11U * RISCV_CONV_FFT_MAX_LEN)
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+/* Scratch buffer of the FFT path of riscv_conv_f32, riscv_correlate_f32 and riscv_fir_f32 */
+extern float32_t riscv_conv_fft_scratch_f32[RISCV_CONV_FFT_SCRATCH_LEN];
+#endif /* defined(RISCV_CONV_FFT) */
+
+/**
+  @brief         Partition lengths of a partitioned FFT FIR filter
+  @param[in]     numTaps      number of filter coefficients
+  @param[in]     blockSize    number of samples processed at a time
+  @param[in]     pPartLens    partition length of each segment
+  @param[in]     pNumParts    number of partitions of each segment, 0 for the last one to cover numTaps
+  @param[in]     numSegments  number of segments, 0 for a uniform partitioning of blockSize samples
+  @param[out]    pLens        partition length of each segment, RISCV_FIR_FFT_MAX_SEGMENTS entries
+  @param[out]    pParts       number of partitions of each segment, RISCV_FIR_FFT_MAX_SEGMENTS entries
+  @return        number of segments, 0 when the partitioning is not supported
+
+  @par           The partition lengths are powers of two in [blockSize, 2048], blockSize being the first
+                 one and the lengths never decreasing. A segment starts at an offset in the filter which
+                 is a multiple of its partition length, so that its outputs can be computed one partition
+                 in advance.
+ */
+__STATIC_INLINE uint16_t riscv_fir_fft_layout(
+        uint32_t numTaps,
+        uint16_t blockSize,
+  const uint16_t * pPartLens,
+  const uint16_t * pNumParts,
+        uint16_t numSegments,
+        uint16_t * pLens,
+        uint16_t * pParts)
+{
+  const uint16_t uniform = (numSegments == 0U);
+  uint32_t offset = 0U;
+  uint32_t P, K;
+
+  if ((numTaps == 0U) || (blockSize < 16U) || (blockSize > 2048U) || ((blockSize & (blockSize - 1U)) != 0U)
+   || (numSegments > RISCV_FIR_FFT_MAX_SEGMENTS))
+  {
+    return 0U;
+  }
+  if (uniform)
+  {
+    numSegments = 1U;
+  }
+
+  for (uint16_t s = 0U; s < numSegments; s++)
+  {
+    P = uniform ? blockSize : pPartLens[s];
+    K = uniform ? 0U : pNumParts[s];
+    if (((P & (P - 1U)) != 0U) || (P > 2048U) || (P < ((s == 0U) ? blockSize : pLens[s - 1U]))
+     || ((s == 0U) && (P != blockSize)) || ((offset % P) != 0U))
+    {
+      return 0U;
+    }
+    if ((K == 0U) && (s == numSegments - 1U) && (numTaps > offset))
+    {
+      K = (numTaps - offset + P - 1U) / P;
+    }
+    if ((K == 0U) || (K > 65535U))
+    {
+      return 0U;
+    }
+    pLens[s] = (uint16_t)P;
+    pParts[s] = (uint16_t)K;
+    offset += K * P;
+  }
 
+  return (offset >= numTaps) ? numSegments : 0U;
+}
+
+/**
+  @brief         Partition length used by the FFT convolution and correlation
+  @param[in]     kernelLen   length of the shortest sequence
+  @return        power of two in [16, 2048], at least kernelLen when possible
+ */
+__STATIC_INLINE uint16_t riscv_conv_fft_part_len(
+  uint32_t kernelLen)
+{
+  uint16_t P = 16U;
+
+  while ((P < kernelLen) && (P < 2048U))
+  {
+    P *= 2U;
+  }
+
+  return P;
+}
+
+/**
+  @brief         Filter a sequence followed by zeros with a uniform partitioned FFT FIR filter
+  @param[in,out] S          points to an instance of the partitioned FFT FIR filter
+  @param[in]     pSrc       points to the input sequence
+  @param[in]     srcLen     length of the input sequence
+  @param[out]    pDst       points to the output sequence
+  @param[in]     dstLen     length of the output sequence
+  @param[in]     skip       number of first outputs which are computed but not written
+  @param[in]     pBlock     points to a buffer of S->blockSize values for the partial blocks
+ */
+__STATIC_INLINE void riscv_conv_fft_run_f32(
+        riscv_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t srcLen,
+        float32_t * pDst,
+        uint32_t dstLen,
+        uint32_t skip,
+        float32_t * pBlock)
+{
+  const uint32_t B = S->blockSize;
+  const uint32_t endLen = skip + dstLen;
+  const float32_t *pIn;
+  uint32_t avail, first, last;
+
+  for (uint32_t n = 0U; n < endLen; n += B)
+  {
+    avail = (srcLen > n) ? (srcLen - n) : 0U;
+    if (avail >= B)
+    {
+      pIn = pSrc + n;
+    }
+    else
+    {
+      /* The last input samples are completed with zeros */
+      if (avail > 0U)
+      {
+        riscv_copy_f32(pSrc + n, pBlock, avail);
+      }
+      riscv_fill_f32(0.0f, pBlock + avail, B - avail);
+      pIn = pBlock;
+    }
+
+    if ((n >= skip) && ((endLen - n) >= B))
+    {
+      riscv_fir_fft_f32(S, pIn, pDst + (n - skip), B);
+    }
+    else
+    {
+      /* Only the outputs in [skip, skip + dstLen) are written */
+      riscv_fir_fft_f32(S, pIn, pBlock, B);
+      first = (n > skip) ? n : skip;
+      last = ((endLen - n) > B) ? (n + B) : endLen;
+      if (last > first)
+      {
+        riscv_copy_f32(pBlock + (first - n), pDst + (first - skip), last - first);
+      }
+    }
+  }
+}
 
 #ifdef   __cplusplus
 }
@@ -119,6 +119,10 @@ target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_lms_q15.c)
 target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_lms_q31.c)
 target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_levinson_durbin_f32.c)
 target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_levinson_durbin_q31.c)
+target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_fir_fft_f32.c)
+target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_fir_fft_init_f32.c)
+target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_conv_fft_f32.c)
+target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_correlate_fft_f32.c)
 
 if (NOT DISABLEFLOAT16)
 target_sources(NMSISDSP PRIVATE FilteringFunctions/riscv_fir_f16.c)
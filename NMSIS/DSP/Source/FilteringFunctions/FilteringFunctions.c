@@ -134,3 +134,8 @@
 
 #include "riscv_levinson_durbin_f32.c"
 #include "riscv_levinson_durbin_q31.c"
+
+#include "riscv_fir_fft_f32.c"
+#include "riscv_fir_fft_init_f32.c"
+#include "riscv_conv_fft_f32.c"
+#include "riscv_correlate_fft_f32.c"
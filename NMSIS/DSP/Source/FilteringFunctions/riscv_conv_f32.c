@@ -31,6 +31,10 @@
 
 #include "dsp/filtering_functions.h"
 
+#if defined(RISCV_CONV_FFT)
+#include "riscv_vec_filtering.h"
+#endif /* defined(RISCV_CONV_FFT) */
+
 /**
   @ingroup groupFilters
  */
@@ -87,7 +91,13 @@
   @par           Long versions:
                    For convolution of long vectors, those functions are
                    no more adapted and will be very slow.
-                   An implementation based upon FFTs should be used.
+                   An implementation based upon FFTs should be used:
+                   \ref riscv_conv_fft_f32 computes it with a partitioned overlap-save
+                   FFT filter and a scratch buffer provided by the caller. When the library is built
+                   with <code>RISCV_CONV_FFT</code> (cmake option <code>CONV_FFT</code>), the floating-point
+                   function uses it automatically when both sequences have at least
+                   <code>RISCV_CONV_FFT_THRESHOLD</code> (128 by default) samples and the shortest one at most
+                   <code>RISCV_CONV_FFT_MAX_LEN</code> (1024 by default), with a static scratch buffer.
 
  */
 
@@ -112,6 +122,16 @@ RISCV_DSP_ATTRIBUTE void riscv_conv_f32(
         float32_t * pDst)
 {
 
+#if defined(RISCV_CONV_FFT)
+  /* Long sequences are convolved with FFTs */
+  if ((srcALen >= RISCV_CONV_FFT_THRESHOLD) && (srcBLen >= RISCV_CONV_FFT_THRESHOLD)
+   && (riscv_conv_fft_scratch_size_f32(srcALen, srcBLen) <= RISCV_CONV_FFT_SCRATCH_LEN))
+  {
+    riscv_conv_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, riscv_conv_fft_scratch_f32);
+    return;
+  }
+#endif /* defined(RISCV_CONV_FFT) */
+
 #if defined(RISCV_MATH_VECTOR_ZVE32F)
   const float32_t *pIn1;                               /* InputA pointer */
   const float32_t *pIn2;                               /* InputB pointer */
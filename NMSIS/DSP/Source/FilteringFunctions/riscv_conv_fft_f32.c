@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_conv_fft_f32.c
+ * Description:  Convolution of long floating-point sequences with FFTs
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "riscv_vec_filtering.h"
+
+#if defined(RISCV_CONV_FFT)
+float32_t riscv_conv_fft_scratch_f32[RISCV_CONV_FFT_SCRATCH_LEN];
+#endif /* defined(RISCV_CONV_FFT) */
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Conv
+  @{
+ */
+
+/**
+  @brief         Scratch length of the FFT convolution and correlation.
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @return        length of the scratch buffer of \ref riscv_conv_fft_f32 and
+                 \ref riscv_correlate_fft_f32 in float32_t values
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_conv_fft_scratch_size_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  const uint32_t kernelLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+  const uint16_t P = riscv_conv_fft_part_len(kernelLen);
+
+  /* Uniform partitioned filter and one block for the partial blocks */
+  return riscv_fir_fft_buffer_size_f32((kernelLen == 0U) ? 1U : kernelLen, P, NULL, NULL, 0U) + P;
+}
+
+/**
+  @brief         Convolution of long floating-point sequences with FFTs.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the location where the output result is written.  Length srcALen+srcBLen-1.
+  @param[in]     pScratch   points to a buffer of \ref riscv_conv_fft_scratch_size_f32 values
+
+  @par
+                   The shortest sequence is the impulse response of a uniform partitioned FFT FIR filter
+                   (see \ref FIRFFT) which filters the other one, followed by zeros. The partitions are as
+                   long as the shortest sequence, up to 2048 samples. The cost grows with
+                   (srcALen + srcBLen) * log(min(srcALen, srcBLen)) instead of srcALen * srcBLen for
+                   \ref riscv_conv_f32, which is faster from about a hundred samples for both sequences.
+  @par
+                   When the library is built with <code>RISCV_CONV_FFT</code>, \ref riscv_conv_f32 calls
+                   this function when both sequences have at least <code>RISCV_CONV_FFT_THRESHOLD</code>
+                   samples and the shortest one at most <code>RISCV_CONV_FFT_MAX_LEN</code>, with a static
+                   scratch buffer.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_conv_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  riscv_fir_fft_instance_f32 S;
+  const float32_t *pIn = pSrcA;
+  const float32_t *pKernel = pSrcB;
+  uint32_t inLen = srcALen;
+  uint32_t kernelLen = srcBLen;
+  uint16_t P;
+
+  if ((srcALen == 0U) || (srcBLen == 0U))
+  {
+    return;
+  }
+
+  /* The convolution is commutative, the shortest sequence is the filter */
+  if (srcALen < srcBLen)
+  {
+    pIn = pSrcB;
+    pKernel = pSrcA;
+    inLen = srcBLen;
+    kernelLen = srcALen;
+  }
+  P = riscv_conv_fft_part_len(kernelLen);
+
+  /* The FIR coefficients are in time reversed order. They are only read by the
+     initialization function, so the output buffer holds them meanwhile. */
+  for (uint32_t i = 0U; i < kernelLen; i++)
+  {
+    pDst[i] = pKernel[kernelLen - 1U - i];
+  }
+  riscv_fir_fft_init_f32(&S, kernelLen, pDst, P, NULL, NULL, 0U, pScratch);
+
+  riscv_conv_fft_run_f32(&S, pIn, inLen, pDst, inLen + kernelLen - 1U, 0U,
+                         pScratch + riscv_fir_fft_buffer_size_f32(kernelLen, P, NULL, NULL, 0U));
+}
+
+/**
+  @} end of Conv group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_correlate_fft_f32.c
+ * Description:  Correlation of long floating-point sequences with FFTs
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "riscv_vec_filtering.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Corr
+  @{
+ */
+
+/**
+  @brief         Correlation of long floating-point sequences with FFTs.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+  @param[in]     pScratch   points to a buffer of \ref riscv_conv_fft_scratch_size_f32 values
+
+  @par
+                   The output is the same as the one of \ref riscv_correlate_f32, except that the outputs
+                   which are not written by \ref riscv_correlate_f32 are set to zero, so pDst does not need
+                   to be initialized.
+  @par
+                   The correlation with b is the convolution with b flipped in time, which is also the FIR
+                   filter whose coefficients in time reversed order are b. So the shortest sequence is
+                   directly the coefficients of a uniform partitioned FFT FIR filter (see \ref FIRFFT)
+                   which filters the other one. When A is the shortest one, the correlation of B with A
+                   is computed and written in reverse order, as \ref riscv_correlate_f32 does.
+  @par
+                   When the library is built with <code>RISCV_CONV_FFT</code>, \ref riscv_correlate_f32
+                   calls this function when both sequences have at least <code>RISCV_CONV_FFT_THRESHOLD</code>
+                   samples and the shortest one at most <code>RISCV_CONV_FFT_MAX_LEN</code>, with a static
+                   scratch buffer.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_correlate_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  riscv_fir_fft_instance_f32 S;
+  const uint32_t outLen = srcALen + srcBLen - 1U;
+  float32_t *pBlock;
+  float32_t tmp;
+  uint16_t P;
+
+  if ((srcALen == 0U) || (srcBLen == 0U))
+  {
+    return;
+  }
+
+  if (srcALen >= srcBLen)
+  {
+    /* c[srcALen - srcBLen + n] = sum(a[k] * b[k + srcBLen - 1 - n]) */
+    P = riscv_conv_fft_part_len(srcBLen);
+    pBlock = pScratch + riscv_fir_fft_buffer_size_f32(srcBLen, P, NULL, NULL, 0U);
+    riscv_fir_fft_init_f32(&S, srcBLen, pSrcB, P, NULL, NULL, 0U, pScratch);
+
+    riscv_fill_f32(0.0f, pDst, srcALen - srcBLen);
+    riscv_conv_fft_run_f32(&S, pSrcA, srcALen, pDst + (srcALen - srcBLen), outLen, 0U, pBlock);
+  }
+  else
+  {
+    /* Correlation of b with a, in reverse order */
+    P = riscv_conv_fft_part_len(srcALen);
+    pBlock = pScratch + riscv_fir_fft_buffer_size_f32(srcALen, P, NULL, NULL, 0U);
+    riscv_fir_fft_init_f32(&S, srcALen, pSrcA, P, NULL, NULL, 0U, pScratch);
+
+    riscv_conv_fft_run_f32(&S, pSrcB, srcBLen, pDst, outLen, 0U, pBlock);
+    for (uint32_t i = 0U; i < outLen / 2U; i++)
+    {
+      tmp = pDst[i];
+      pDst[i] = pDst[outLen - 1U - i];
+      pDst[outLen - 1U - i] = tmp;
+    }
+    riscv_fill_f32(0.0f, pDst + outLen, srcBLen - srcALen);
+  }
+}
+
+/**
+  @} end of Corr group
+ */
@@ -31,6 +31,10 @@
 
 #include "dsp/filtering_functions.h"
 
+#if defined(RISCV_CONV_FFT)
+#include "riscv_vec_filtering.h"
+#endif /* defined(RISCV_CONV_FFT) */
+
 /**
   @ingroup groupFilters
  */
@@ -120,6 +124,14 @@
   @param[in]     pSrc       points to the block of input data
   @param[out]    pDst       points to the block of output data
   @param[in]     blockSize  number of samples to process
+
+  @par           FFT filtering
+                   When the library is built with <code>RISCV_CONV_FFT</code> (cmake option <code>CONV_FFT</code>),
+                   filters and blocks of at least <code>RISCV_CONV_FFT_THRESHOLD</code> (128 by default) samples,
+                   the filter having at most <code>RISCV_CONV_FFT_MAX_LEN</code> (1024 by default) coefficients,
+                   are computed with a uniform partitioned FFT filter (see \ref FIRFFT) and a static scratch buffer.
+                   The spectra of the coefficients are computed again at each call, so \ref riscv_fir_fft_f32
+                   remains faster for a filter applied to many blocks.
  */
 
 RISCV_DSP_ATTRIBUTE void riscv_fir_f32(
@@ -143,6 +155,26 @@ RISCV_DSP_ATTRIBUTE void riscv_fir_f32(
         float32_t c0;                                           /* Temporary variable to hold coefficient value */
 #endif
 
+#if defined(RISCV_CONV_FFT)
+  /* Long filters and blocks are computed with FFTs */
+  if ((numTaps >= RISCV_CONV_FFT_THRESHOLD) && (blockSize >= RISCV_CONV_FFT_THRESHOLD)
+   && (riscv_conv_fft_scratch_size_f32(numTaps, numTaps) <= RISCV_CONV_FFT_SCRATCH_LEN))
+  {
+    riscv_fir_fft_instance_f32 F;
+    const uint16_t P = riscv_conv_fft_part_len(numTaps);
+
+    /* The outputs are the last blockSize ones of the filter applied to the state from zero */
+    riscv_copy_f32(pSrc, pState + (numTaps - 1U), blockSize);
+    riscv_fir_fft_init_f32(&F, numTaps, pCoeffs, P, NULL, NULL, 0U, riscv_conv_fft_scratch_f32);
+    riscv_conv_fft_run_f32(&F, pState, numTaps - 1U + blockSize, pDst, blockSize, numTaps - 1U,
+                           riscv_conv_fft_scratch_f32 + riscv_fir_fft_buffer_size_f32(numTaps, P, NULL, NULL, 0U));
+
+    /* Copy the last numTaps - 1 samples to the start of the state buffer */
+    riscv_copy_f32(pState + blockSize, pState, numTaps - 1U);
+    return;
+  }
+#endif /* defined(RISCV_CONV_FFT) */
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1U)]);
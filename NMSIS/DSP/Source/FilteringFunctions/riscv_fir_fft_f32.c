@@ -0,0 +1,242 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_fft_f32.c
+ * Description:  Floating-point partitioned FFT FIR filter processing function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/*
+ * pAcc += pX * pH for spectra of 2 * P values in the riscv_rfft_fast_f32 format:
+ * the real DC and Nyquist values, followed by P - 1 complex values.
+ */
+static void riscv_fir_fft_cmac_f32(
+  const float32_t * pX,
+  const float32_t * pH,
+        float32_t * pAcc,
+        uint32_t P)
+{
+  uint32_t blkCnt = P - 1U;
+
+  pAcc[0] += pX[0] * pH[0];
+  pAcc[1] += pX[1] * pH[1];
+  pX += 2;
+  pH += 2;
+  pAcc += 2;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  size_t vl;
+  vfloat32m2x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2(pX, vl);
+    vfloat32m2_t vx_re = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 0);
+    vfloat32m2_t vx_im = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2(pH, vl);
+    vfloat32m2_t vh_re = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 0);
+    vfloat32m2_t vh_im = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2(pAcc, vl);
+    vfloat32m2_t vacc_re = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 0);
+    vfloat32m2_t vacc_im = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 1);
+
+    vacc_re = __riscv_vfmacc_vv_f32m2(vacc_re, vx_re, vh_re, vl);
+    vacc_re = __riscv_vfnmsac_vv_f32m2(vacc_re, vx_im, vh_im, vl);
+    vacc_im = __riscv_vfmacc_vv_f32m2(vacc_im, vx_re, vh_im, vl);
+    vacc_im = __riscv_vfmacc_vv_f32m2(vacc_im, vx_im, vh_re, vl);
+
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2(v_tuple, 0, vacc_re);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2(v_tuple, 1, vacc_im);
+    __riscv_vsseg2e32_v_f32m2x2(pAcc, v_tuple, vl);
+
+    pX += 2U * vl;
+    pH += 2U * vl;
+    pAcc += 2U * vl;
+  }
+#else
+  float32_t xr, xi, hr, hi;
+
+  while (blkCnt > 0U)
+  {
+    xr = *pX++;
+    xi = *pX++;
+    hr = *pH++;
+    hi = *pH++;
+
+    *pAcc++ += xr * hr - xi * hi;
+    *pAcc++ += xr * hi + xi * hr;
+
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/*
+ * Overlap-save step of a segment: the spectrum of the last 2 * P input samples enters the
+ * FDL, and the last P samples of the inverse FFT of sum(X[k + lag] * H[k]) are written to pOut.
+ */
+static void riscv_fir_fft_step_f32(
+  const riscv_fir_fft_instance_f32 * S,
+        riscv_fir_fft_segment_f32 * pSeg,
+        float32_t * pOut)
+{
+  const uint32_t P = pSeg->partLen;
+  const uint32_t N = 2U * P;
+  float32_t *pTime = S->pScratch;
+  float32_t *pAcc = S->pScratch + S->histLen;
+  uint32_t start = (S->histPos + S->histLen - N) % S->histLen;
+  uint32_t first = S->histLen - start;
+  uint32_t idx;
+
+  if (first > N)
+  {
+    first = N;
+  }
+  riscv_copy_f32(S->pHist + start, pTime, first);
+  riscv_copy_f32(S->pHist, pTime + first, N - first);
+
+  pSeg->fdlPos = (uint16_t)((pSeg->fdlPos == 0U) ? (pSeg->fdlLen - 1U) : (pSeg->fdlPos - 1U));
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  riscv_rfft_fast_f32(&pSeg->rfft, pTime, pSeg->pFdl + N * pSeg->fdlPos, pAcc + S->histLen, 0U);
+#else
+  riscv_rfft_fast_f32(&pSeg->rfft, pTime, pSeg->pFdl + N * pSeg->fdlPos, 0U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  riscv_fill_f32(0.0f, pAcc, N);
+  for (uint32_t k = 0U; k < pSeg->numParts; k++)
+  {
+    idx = (pSeg->fdlPos + pSeg->lag + k) % pSeg->fdlLen;
+    riscv_fir_fft_cmac_f32(pSeg->pFdl + N * idx, pSeg->pSpectra + N * k, pAcc, P);
+  }
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  riscv_rfft_fast_f32(&pSeg->rfft, pAcc, pTime, pAcc + S->histLen, 1U);
+#else
+  riscv_rfft_fast_f32(&pSeg->rfft, pAcc, pTime, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  /* The first P samples are aliased by the circular convolution */
+  riscv_copy_f32(pTime + P, pOut, P);
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIRFFT Partitioned FFT FIR Filters
+
+  @par
+                   The partitioned FFT FIR filter computes the same outputs as \ref riscv_fir_f32 with a
+                   cost which grows with log(numTaps) instead of numTaps per sample, for the long filters
+                   such as room responses and matched filters.
+  @par           Algorithm
+                   The filter is split into partitions of P coefficients and the spectrum of each one,
+                   padded with P zeros, is computed once by the initialization function. For each block
+                   of P input samples, the real FFT of the last 2*P samples enters a frequency-domain
+                   delay line (FDL) and the spectrum of the output is the sum of the products of the last
+                   spectra with the kernel spectra. One inverse FFT then gives P new outputs (overlap-save).
+                   The cost per block is one FFT, one inverse FFT and one complex multiply-accumulate
+                   per partition, without any latency other than the block size.
+  @par
+                   With a uniform partitioning, P is the block size. The non-uniform partitioning uses
+                   short partitions for the start of the filter and longer ones afterwards: a segment of
+                   partitions of P samples only needs to be processed every P input samples, which
+                   divides the number of products of the long filters. The outputs of a segment are
+                   computed P samples in advance, so its first partition must start at a multiple of P.
+                   Segments of longer partitions are processed during the calls whose input starts at a
+                   multiple of their partition length.
+  @par           Usage
+                   The length of the buffer given to \ref riscv_fir_fft_init_f32 is returned by
+                   \ref riscv_fir_fft_buffer_size_f32. A common non-uniform partitioning of a 4096 taps
+                   filter processed by blocks of 64 samples is:
+  @code
+      const uint16_t partLens[3] = {64, 256, 1024};
+      const uint16_t numParts[3] = {4, 3, 0};
+  @endcode
+                   The 256 samples segment starts at 4*64 and the 1024 samples one at 256 + 3*256.
+ */
+
+/**
+  @addtogroup FIRFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, a multiple of S->blockSize
+
+  @par
+                   pSrc and pDst can be the same buffer.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_fir_fft_f32(
+        riscv_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t B = S->blockSize;
+  const uint32_t numBlocks = S->histLen / (2U * B);
+  riscv_fir_fft_segment_f32 *pSeg;
+  uint32_t phase;
+
+  while (blockSize >= B)
+  {
+    /* The segments of long partitions compute their next partLen outputs from the
+       input received so far */
+    for (uint16_t s = 1U; s < S->numSegments; s++)
+    {
+      pSeg = &S->seg[s];
+      if ((S->blockCount % (pSeg->partLen / B)) == 0U)
+      {
+        riscv_fir_fft_step_f32(S, pSeg, pSeg->pOut);
+      }
+    }
+
+    riscv_copy_f32(pSrc, S->pHist + S->histPos, B);
+    S->histPos = (S->histPos + B) % S->histLen;
+
+    riscv_fir_fft_step_f32(S, &S->seg[0], pDst);
+    for (uint16_t s = 1U; s < S->numSegments; s++)
+    {
+      pSeg = &S->seg[s];
+      phase = S->blockCount % (pSeg->partLen / B);
+      riscv_add_f32(pDst, pSeg->pOut + phase * B, pDst, B);
+    }
+
+    S->blockCount = (S->blockCount + 1U) % numBlocks;
+    pSrc += B;
+    pDst += B;
+    blockSize -= B;
+  }
+}
+
+/**
+  @} end of FIRFFT group
+ */
@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_fir_fft_init_f32.c
+ * Description:  Floating-point partitioned FFT FIR filter initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "riscv_vec_filtering.h"
+
+/* Working buffers shared by the segments, for a longest partition of maxLen samples */
+__STATIC_INLINE uint32_t riscv_fir_fft_scratch_len_f32(uint32_t maxLen)
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  /* Time samples, accumulated spectrum and the temporary buffer of the RVV real FFT */
+  return 2U * maxLen + 2U * maxLen + 6U * maxLen;
+#else
+  return 2U * maxLen + 2U * maxLen;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRFFT
+  @{
+ */
+
+/**
+  @brief         Buffer length of the floating-point partitioned FFT FIR filter.
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     blockSize    number of samples processed at a time
+  @param[in]     pPartLens    points to the partition length of each segment
+  @param[in]     pNumParts    points to the number of partitions of each segment
+  @param[in]     numSegments  number of segments, 0 for a uniform partitioning
+  @return        length of the buffer in float32_t values, 0 for unsupported arguments
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_fir_fft_buffer_size_f32(
+        uint32_t numTaps,
+        uint16_t blockSize,
+  const uint16_t * pPartLens,
+  const uint16_t * pNumParts,
+        uint16_t numSegments)
+{
+  uint16_t lens[RISCV_FIR_FFT_MAX_SEGMENTS];
+  uint16_t parts[RISCV_FIR_FFT_MAX_SEGMENTS];
+  uint32_t offset = 0U;
+  uint32_t len, lag, maxLen;
+
+  numSegments = riscv_fir_fft_layout(numTaps, blockSize, pPartLens, pNumParts, numSegments, lens, parts);
+  if (numSegments == 0U)
+  {
+    return 0U;
+  }
+  maxLen = lens[numSegments - 1U];
+
+  /* Input history and working buffers */
+  len = 2U * maxLen + riscv_fir_fft_scratch_len_f32(maxLen);
+
+  for (uint16_t s = 0U; s < numSegments; s++)
+  {
+    lag = (s == 0U) ? 0U : (offset / lens[s] - 1U);
+
+    /* Kernel spectra, input spectra and outputs computed in advance */
+    len += 2U * lens[s] * (2U * parts[s] + lag);
+    len += (s == 0U) ? 0U : lens[s];
+
+    offset += (uint32_t)parts[s] * lens[s];
+  }
+
+  return len;
+}
+
+/**
+  @brief         Initialization function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S            points to an instance of the floating-point partitioned FFT FIR structure
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pCoeffs      points to the filter coefficients, stored in time reversed order as for \ref riscv_fir_f32
+  @param[in]     blockSize    number of samples processed at a time, a power of two in [16, 2048]
+  @param[in]     pPartLens    points to the partition length of each segment
+  @param[in]     pNumParts    points to the number of partitions of each segment
+  @param[in]     numSegments  number of segments, 0 for a uniform partitioning
+  @param[in]     pBuffer      points to a buffer of \ref riscv_fir_fft_buffer_size_f32 values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+
+  @par           Details
+                   With <code>numSegments = 0</code> the filter is split into partitions of
+                   <code>blockSize</code> coefficients, and <code>pPartLens</code> and <code>pNumParts</code>
+                   are not used. Otherwise segment <code>s</code> has <code>pNumParts[s]</code> partitions of
+                   <code>pPartLens[s]</code> coefficients. The first partition length must be blockSize,
+                   the lengths are powers of two up to 2048 which never decrease, and each segment must start
+                   at a multiple of its partition length. The last entry of <code>pNumParts</code> can be 0,
+                   the last segment then covers the remaining coefficients.
+  @par
+                   The spectra of the partitions are computed by this function, so the coefficients are not
+                   used anymore afterwards. <code>pBuffer</code> holds the spectra, the state and the working
+                   buffers of the filter and must stay valid while the instance is used.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_fir_fft_init_f32(
+        riscv_fir_fft_instance_f32 * S,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        uint16_t blockSize,
+  const uint16_t * pPartLens,
+  const uint16_t * pNumParts,
+        uint16_t numSegments,
+        float32_t * pBuffer)
+{
+  uint16_t lens[RISCV_FIR_FFT_MAX_SEGMENTS];
+  uint16_t parts[RISCV_FIR_FFT_MAX_SEGMENTS];
+  riscv_fir_fft_segment_f32 *pSeg;
+  float32_t *pTime;
+  uint32_t offset = 0U;
+  uint32_t P, tap, n, j;
+
+  numSegments = riscv_fir_fft_layout(numTaps, blockSize, pPartLens, pNumParts, numSegments, lens, parts);
+  if (numSegments == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->numSegments = numSegments;
+  S->histLen = 2U * lens[numSegments - 1U];
+  S->histPos = 0U;
+  S->blockCount = 0U;
+  S->pHist = pBuffer;
+  S->pScratch = pBuffer + S->histLen;
+  pBuffer = S->pScratch + riscv_fir_fft_scratch_len_f32(S->histLen / 2U);
+  pTime = S->pScratch;
+
+  riscv_fill_f32(0.0f, S->pHist, S->histLen);
+
+  for (uint16_t s = 0U; s < numSegments; s++)
+  {
+    pSeg = &S->seg[s];
+    P = lens[s];
+
+    pSeg->partLen = (uint16_t)P;
+    pSeg->numParts = parts[s];
+    pSeg->lag = (uint16_t)((s == 0U) ? 0U : (offset / P - 1U));
+    pSeg->fdlLen = (uint16_t)(parts[s] + pSeg->lag);
+    pSeg->fdlPos = 0U;
+    pSeg->pSpectra = pBuffer;
+    pBuffer += 2U * P * parts[s];
+    pSeg->pFdl = pBuffer;
+    pBuffer += 2U * P * pSeg->fdlLen;
+    pSeg->pOut = (s == 0U) ? NULL : pBuffer;
+    pBuffer += (s == 0U) ? 0U : P;
+
+    if (riscv_rfft_fast_init_f32(&pSeg->rfft, (uint16_t)(2U * P)) != RISCV_MATH_SUCCESS)
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Spectrum of each partition of the impulse response, padded with P zeros.
+       The coefficients are in time reversed order, b[tap] being pCoeffs[numTaps - 1 - tap]. */
+    for (n = 0U; n < parts[s]; n++)
+    {
+      for (j = 0U; j < P; j++)
+      {
+        tap = offset + n * P + j;
+        pTime[j] = (tap < numTaps) ? pCoeffs[numTaps - 1U - tap] : 0.0f;
+      }
+      riscv_fill_f32(0.0f, pTime + P, P);
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+      riscv_rfft_fast_f32(&pSeg->rfft, pTime, pSeg->pSpectra + 2U * P * n, S->pScratch + 2U * S->histLen, 0U);
+#else
+      riscv_rfft_fast_f32(&pSeg->rfft, pTime, pSeg->pSpectra + 2U * P * n, 0U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+    }
+
+    riscv_fill_f32(0.0f, pSeg->pFdl, 2U * P * pSeg->fdlLen);
+    if (pSeg->pOut != NULL)
+    {
+      riscv_fill_f32(0.0f, pSeg->pOut, P);
+    }
+
+    offset += (uint32_t)parts[s] * P;
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIRFFT group
+ */
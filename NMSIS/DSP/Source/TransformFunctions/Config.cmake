@@ -78,10 +78,55 @@ target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_radix4_q15.c)
 
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_f32.c)
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_init_q15.c)
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_f32.c)
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_init_f32.c)
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_radix8_f32.c)
 
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_mixed_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_mixed_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_mixed_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_mixed_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_mixed_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_mixed_init_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_mixed_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_mixed_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_mixed_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_mixed_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_mixed_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_mixed_init_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_large_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_large_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_init_runtime_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_batch_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_batch_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_batch_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_batch_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_batch_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_cfft_batch_init_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_stft_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_stft_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_stft_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_istft_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_istft_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_istft_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_stft_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_stft_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_stft_init_q15.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_goertzel_bank_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_goertzel_bank_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_goertzel_bank_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_goertzel_bank_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_sdft_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_sdft_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_sdft_init_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_sdft_init_q31.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_czt_f32.c)
+target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_czt_init_f32.c)
+
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_f64.c)
 target_sources(NMSISDSP PRIVATE TransformFunctions/riscv_rfft_fast_init_f64.c)
 
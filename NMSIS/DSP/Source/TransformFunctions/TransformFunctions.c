@@ -48,6 +48,51 @@
 #include "riscv_rfft_fast_f64.c"
 #include "riscv_rfft_fast_init_f32.c"
 #include "riscv_rfft_fast_init_f64.c"
+#include "riscv_rfft_fast_q31.c"
+#include "riscv_rfft_fast_q15.c"
+#include "riscv_rfft_fast_init_q31.c"
+#include "riscv_rfft_fast_init_q15.c"
+
+#include "riscv_cfft_mixed_f32.c"
+#include "riscv_cfft_mixed_q15.c"
+#include "riscv_cfft_mixed_q31.c"
+#include "riscv_cfft_mixed_init_f32.c"
+#include "riscv_cfft_mixed_init_q15.c"
+#include "riscv_cfft_mixed_init_q31.c"
+#include "riscv_rfft_mixed_f32.c"
+#include "riscv_rfft_mixed_q15.c"
+#include "riscv_rfft_mixed_q31.c"
+#include "riscv_rfft_mixed_init_f32.c"
+#include "riscv_rfft_mixed_init_q15.c"
+#include "riscv_rfft_mixed_init_q31.c"
+#include "riscv_cfft_large_f32.c"
+#include "riscv_cfft_large_init_f32.c"
+#include "riscv_cfft_init_runtime_f32.c"
+#include "riscv_cfft_batch_f32.c"
+#include "riscv_cfft_batch_q31.c"
+#include "riscv_cfft_batch_q15.c"
+#include "riscv_cfft_batch_init_f32.c"
+#include "riscv_cfft_batch_init_q31.c"
+#include "riscv_cfft_batch_init_q15.c"
+#include "riscv_stft_f32.c"
+#include "riscv_stft_q31.c"
+#include "riscv_stft_q15.c"
+#include "riscv_istft_f32.c"
+#include "riscv_istft_q31.c"
+#include "riscv_istft_q15.c"
+#include "riscv_stft_init_f32.c"
+#include "riscv_stft_init_q31.c"
+#include "riscv_stft_init_q15.c"
+#include "riscv_goertzel_bank_f32.c"
+#include "riscv_goertzel_bank_q31.c"
+#include "riscv_goertzel_bank_init_f32.c"
+#include "riscv_goertzel_bank_init_q31.c"
+#include "riscv_sdft_f32.c"
+#include "riscv_sdft_q31.c"
+#include "riscv_sdft_init_f32.c"
+#include "riscv_sdft_init_q31.c"
+#include "riscv_czt_f32.c"
+#include "riscv_czt_init_f32.c"
 
 #include "riscv_mfcc_init_f32.c"
 #include "riscv_mfcc_f32.c"
@@ -30,6 +30,134 @@
 #include "dsp/transform_functions.h"
 #include "riscv_common_tables.h"
 
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * The swaps of the bit reversal loop below are disjoint, so vl iterations run at once with
+ * indexed loads and stores. Iteration m swaps the complex values i = 2 * m and j, and
+ * i + fftLen / 2 + 1 and j + fftLen / 2 + 1 when i < j, and then i + 1 and j + fftLen / 2,
+ * j being 0 for the first iteration and pBitRevTab[(m - 1) * bitRevFactor] afterwards.
+ * This version is used for the complex values of two 32-bit words.
+ */
+static void riscv_bitreversal_rvv_32x2(
+        uint32_t * pSrc,
+        uint32_t fftLen,
+        uint16_t bitRevFactor,
+  const uint16_t * pBitRevTab)
+{
+  const uint32_t fftLenBy2 = fftLen / 2U;
+  uint32_t blkCnt, m, in;
+  size_t vl;
+  vuint32m2x2_t v_a, v_b;
+  vuint32m2_t vi, vj;
+  vbool16_t mask;
+
+  if (fftLen < 4U)
+  {
+    return;
+  }
+
+  /* First iteration: i = j = 0 */
+  in = pSrc[2U];
+  pSrc[2U] = pSrc[2U * fftLenBy2];
+  pSrc[2U * fftLenBy2] = in;
+  in = pSrc[3U];
+  pSrc[3U] = pSrc[(2U * fftLenBy2) + 1U];
+  pSrc[(2U * fftLenBy2) + 1U] = in;
+
+  blkCnt = fftLen / 4U - 1U;
+  for (m = 1U; (vl = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    /* Byte offsets of the complex values i and j */
+    vi = __riscv_vsll_vx_u32m2(__riscv_vadd_vx_u32m2(__riscv_vid_v_u32m2(vl), m, vl), 4U, vl);
+    vj = __riscv_vzext_vf2_u32m2(__riscv_vlse16_v_u16m1(pBitRevTab, 2 * bitRevFactor, vl), vl);
+    vj = __riscv_vsll_vx_u32m2(vj, 3U, vl);
+    mask = __riscv_vmsltu_vv_u32m2_b16(vi, vj, vl);
+
+    v_a = __riscv_vluxseg2ei32_v_u32m2x2_m(mask, pSrc, vi, vl);
+    v_b = __riscv_vluxseg2ei32_v_u32m2x2_m(mask, pSrc, vj, vl);
+    __riscv_vsuxseg2ei32_v_u32m2x2_m(mask, pSrc, vi, v_b, vl);
+    __riscv_vsuxseg2ei32_v_u32m2x2_m(mask, pSrc, vj, v_a, vl);
+
+    vi = __riscv_vadd_vx_u32m2(vi, 8U * (fftLenBy2 + 1U), vl);
+    vj = __riscv_vadd_vx_u32m2(vj, 8U * (fftLenBy2 + 1U), vl);
+    v_a = __riscv_vluxseg2ei32_v_u32m2x2_m(mask, pSrc, vi, vl);
+    v_b = __riscv_vluxseg2ei32_v_u32m2x2_m(mask, pSrc, vj, vl);
+    __riscv_vsuxseg2ei32_v_u32m2x2_m(mask, pSrc, vi, v_b, vl);
+    __riscv_vsuxseg2ei32_v_u32m2x2_m(mask, pSrc, vj, v_a, vl);
+
+    /* i + 1 and j + fftLen / 2 */
+    vi = __riscv_vsub_vx_u32m2(vi, 8U * fftLenBy2, vl);
+    vj = __riscv_vsub_vx_u32m2(vj, 8U, vl);
+    v_a = __riscv_vluxseg2ei32_v_u32m2x2(pSrc, vi, vl);
+    v_b = __riscv_vluxseg2ei32_v_u32m2x2(pSrc, vj, vl);
+    __riscv_vsuxseg2ei32_v_u32m2x2(pSrc, vi, v_b, vl);
+    __riscv_vsuxseg2ei32_v_u32m2x2(pSrc, vj, v_a, vl);
+
+    pBitRevTab += vl * bitRevFactor;
+    m += vl;
+  }
+}
+
+/*
+ * Same as riscv_bitreversal_rvv_32x2 for the complex values of one 32-bit word.
+ */
+static void riscv_bitreversal_rvv_32x1(
+        uint32_t * pSrc,
+        uint32_t fftLen,
+        uint16_t bitRevFactor,
+  const uint16_t * pBitRevTab)
+{
+  const uint32_t fftLenBy2 = fftLen / 2U;
+  uint32_t blkCnt, m, in;
+  size_t vl;
+  vuint32m2_t v_a, v_b, vi, vj;
+  vbool16_t mask;
+
+  if (fftLen < 4U)
+  {
+    return;
+  }
+
+  /* First iteration: i = j = 0 */
+  in = pSrc[1U];
+  pSrc[1U] = pSrc[fftLenBy2];
+  pSrc[fftLenBy2] = in;
+
+  blkCnt = fftLen / 4U - 1U;
+  for (m = 1U; (vl = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    /* Byte offsets of the complex values i and j */
+    vi = __riscv_vsll_vx_u32m2(__riscv_vadd_vx_u32m2(__riscv_vid_v_u32m2(vl), m, vl), 3U, vl);
+    vj = __riscv_vzext_vf2_u32m2(__riscv_vlse16_v_u16m1(pBitRevTab, 2 * bitRevFactor, vl), vl);
+    vj = __riscv_vsll_vx_u32m2(vj, 2U, vl);
+    mask = __riscv_vmsltu_vv_u32m2_b16(vi, vj, vl);
+
+    v_a = __riscv_vluxei32_v_u32m2_m(mask, pSrc, vi, vl);
+    v_b = __riscv_vluxei32_v_u32m2_m(mask, pSrc, vj, vl);
+    __riscv_vsuxei32_v_u32m2_m(mask, pSrc, vi, v_b, vl);
+    __riscv_vsuxei32_v_u32m2_m(mask, pSrc, vj, v_a, vl);
+
+    vi = __riscv_vadd_vx_u32m2(vi, 4U * (fftLenBy2 + 1U), vl);
+    vj = __riscv_vadd_vx_u32m2(vj, 4U * (fftLenBy2 + 1U), vl);
+    v_a = __riscv_vluxei32_v_u32m2_m(mask, pSrc, vi, vl);
+    v_b = __riscv_vluxei32_v_u32m2_m(mask, pSrc, vj, vl);
+    __riscv_vsuxei32_v_u32m2_m(mask, pSrc, vi, v_b, vl);
+    __riscv_vsuxei32_v_u32m2_m(mask, pSrc, vj, v_a, vl);
+
+    /* i + 1 and j + fftLen / 2 */
+    vi = __riscv_vsub_vx_u32m2(vi, 4U * fftLenBy2, vl);
+    vj = __riscv_vsub_vx_u32m2(vj, 4U, vl);
+    v_a = __riscv_vluxei32_v_u32m2(pSrc, vi, vl);
+    v_b = __riscv_vluxei32_v_u32m2(pSrc, vj, vl);
+    __riscv_vsuxei32_v_u32m2(pSrc, vi, v_b, vl);
+    __riscv_vsuxei32_v_u32m2(pSrc, vj, v_a, vl);
+
+    pBitRevTab += vl * bitRevFactor;
+    m += vl;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
 void riscv_bitreversal_f32(
         float32_t * pSrc,
         uint16_t fftSize,
@@ -50,6 +178,9 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_f32(
         uint16_t bitRevFactor,
   const uint16_t * pBitRevTab)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+   riscv_bitreversal_rvv_32x2((uint32_t *)pSrc, fftSize, bitRevFactor, pBitRevTab);
+#else
    uint16_t fftLenBy2, fftLenBy2p1;
    uint16_t i, j;
    float32_t in;
@@ -103,6 +234,7 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_f32(
       /*  Updating the bit reversal index depending on the fft length  */
       pBitRevTab += bitRevFactor;
    }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
 
 void riscv_bitreversal_q31(
@@ -125,6 +257,9 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_q31(
         uint16_t bitRevFactor,
   const uint16_t * pBitRevTab)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+   riscv_bitreversal_rvv_32x2((uint32_t *)pSrc, fftLen, bitRevFactor, pBitRevTab);
+#else
    uint32_t fftLenBy2, fftLenBy2p1, i, j;
    q31_t in;
 
@@ -177,6 +312,7 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_q31(
       /*  Updating the bit reversal index depending on the fft length */
       pBitRevTab += bitRevFactor;
    }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
 
 void riscv_bitreversal_q15(
@@ -200,6 +336,9 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_q15(
         uint16_t bitRevFactor,
   const uint16_t * pBitRevTab)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+   riscv_bitreversal_rvv_32x1((uint32_t *)pSrc16, fftLen, bitRevFactor, pBitRevTab);
+#else
    q31_t *pSrc = (q31_t *) pSrc16;
    q31_t in;
    uint32_t fftLenBy2, fftLenBy2p1;
@@ -240,4 +379,5 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_q15(
       /*  Updating the bit reversal index depending on the fft length  */
       pBitRevTab += bitRevFactor;
    }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
@@ -48,6 +48,30 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_64(
   const uint16_t bitRevLen,
   const uint16_t *pBitRevTab)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE64X)
+  uint32_t blkCnt = bitRevLen / 2U;
+  size_t vl;
+  vuint16m1x2_t v_tab;
+  vuint64m4x2_t v_a, v_b;
+  vuint32m2_t va, vb;
+
+  /* The swaps are disjoint, so vl of them are done with indexed loads and stores */
+  for (; (vl = __riscv_vsetvl_e64m4(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tab = __riscv_vlseg2e16_v_u16m1x2(pBitRevTab, vl);
+    va = __riscv_vzext_vf2_u32m2(__riscv_vget_v_u16m1x2_u16m1(v_tab, 0), vl);
+    vb = __riscv_vzext_vf2_u32m2(__riscv_vget_v_u16m1x2_u16m1(v_tab, 1), vl);
+    /* Byte offsets of the complex values, whose indexes are the table values divided by 4 */
+    va = __riscv_vsll_vx_u32m2(__riscv_vsrl_vx_u32m2(va, 2U, vl), 3U, vl);
+    vb = __riscv_vsll_vx_u32m2(__riscv_vsrl_vx_u32m2(vb, 2U, vl), 3U, vl);
+    v_a = __riscv_vluxseg2ei32_v_u64m4x2(pSrc, va, vl);
+    v_b = __riscv_vluxseg2ei32_v_u64m4x2(pSrc, vb, vl);
+    __riscv_vsuxseg2ei32_v_u64m4x2(pSrc, va, v_b, vl);
+    __riscv_vsuxseg2ei32_v_u64m4x2(pSrc, vb, v_a, vl);
+
+    pBitRevTab += 2U * vl;
+  }
+#else
   uint64_t a, b, tmp;
   uint32_t i;
 
@@ -68,6 +92,7 @@ RISCV_DSP_ATTRIBUTE void riscv_bitreversal_64(
 
     i += 2;
   }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE64X) */
 }
 
 void riscv_bitreversal_32(
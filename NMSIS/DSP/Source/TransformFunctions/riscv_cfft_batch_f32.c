@@ -0,0 +1,266 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_batch_f32.c
+ * Description:  Batched CFFT & CIFFT Floating point process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/* Reverse the n lowest bits of x */
+static uint32_t riscv_cfft_batch_bitrev_f32(uint32_t x, uint32_t n)
+{
+  uint32_t r = 0U;
+
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    r = (r << 1U) | (x & 1U);
+    x >>= 1U;
+  }
+
+  return r;
+}
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+/*
+ * Radix-2 DIF FFT of vl transforms at once: lane l computes the transform at
+ * pData + l * bstride bytes, the twiddle factor of each butterfly is a scalar
+ * shared by all the lanes.
+ */
+static void riscv_cfft_batch_block_f32(
+  const riscv_cfft_batch_instance_f32 * S,
+        float32_t * pData,
+        ptrdiff_t bstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  const uint32_t N = S->fftLen;
+  const float32_t *pTw = S->pTwiddle;
+  const float32_t sign = ifftFlag ? -1.0f : 1.0f;
+  vfloat32m1x2_t v_tuple;
+  float32_t *pA, *pB;
+  float32_t wr, wi;
+  uint32_t L, twStep, g, j, i, r;
+
+  for (L = N / 2U, twStep = 1U; L > 0U; L >>= 1U, twStep <<= 1U)
+  {
+    for (g = 0U; g < N; g += 2U * L)
+    {
+      for (j = 0U; j < L; j++)
+      {
+        pA = pData + 2U * (g + j);
+        pB = pA + 2U * L;
+
+        v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pA, bstride, vl);
+        vfloat32m1_t va_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+        vfloat32m1_t va_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+        v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pB, bstride, vl);
+        vfloat32m1_t vb_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+        vfloat32m1_t vb_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+        v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, __riscv_vfadd_vv_f32m1(va_re, vb_re, vl));
+        v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, __riscv_vfadd_vv_f32m1(va_im, vb_im, vl));
+        __riscv_vssseg2e32_v_f32m1x2(pA, bstride, v_tuple, vl);
+
+        vfloat32m1_t vd_re = __riscv_vfsub_vv_f32m1(va_re, vb_re, vl);
+        vfloat32m1_t vd_im = __riscv_vfsub_vv_f32m1(va_im, vb_im, vl);
+        if (j != 0U)
+        {
+          /* w = exp(-+2*pi*i * j*twStep / N), conjugated for the inverse transform */
+          wr = pTw[2U * j * twStep];
+          wi = sign * pTw[2U * j * twStep + 1U];
+          vfloat32m1_t vre = __riscv_vfnmsac_vf_f32m1(__riscv_vfmul_vf_f32m1(vd_re, wr, vl), wi, vd_im, vl);
+          vfloat32m1_t vim = __riscv_vfmacc_vf_f32m1(__riscv_vfmul_vf_f32m1(vd_im, wr, vl), wi, vd_re, vl);
+          vd_re = vre;
+          vd_im = vim;
+        }
+        v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, vd_re);
+        v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, vd_im);
+        __riscv_vssseg2e32_v_f32m1x2(pB, bstride, v_tuple, vl);
+      }
+    }
+  }
+
+  /* Bit reversal, merged with the 1/N scaling of the inverse transform */
+  const float32_t scale = ifftFlag ? 1.0f / (float32_t)N : 1.0f;
+
+  for (i = 0U; i < N; i++)
+  {
+    r = riscv_cfft_batch_bitrev_f32(i, S->log2Len);
+    if ((r < i) || ((r == i) && (ifftFlag == 0U)))
+    {
+      continue;
+    }
+    pA = pData + 2U * i;
+    pB = pData + 2U * r;
+
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pA, bstride, vl);
+    vfloat32m1_t va_re = __riscv_vfmul_vf_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_tuple, 0), scale, vl);
+    vfloat32m1_t va_im = __riscv_vfmul_vf_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_tuple, 1), scale, vl);
+    if (r != i)
+    {
+      v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pB, bstride, vl);
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, __riscv_vfmul_vf_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_tuple, 0), scale, vl));
+      v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, __riscv_vfmul_vf_f32m1(__riscv_vget_v_f32m1x2_f32m1(v_tuple, 1), scale, vl));
+      __riscv_vssseg2e32_v_f32m1x2(pA, bstride, v_tuple, vl);
+    }
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, va_re);
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, va_im);
+    __riscv_vssseg2e32_v_f32m1x2(pB, bstride, v_tuple, vl);
+  }
+}
+#else
+/* Radix-2 DIF FFT of the transform at pData */
+static void riscv_cfft_batch_one_f32(
+  const riscv_cfft_batch_instance_f32 * S,
+        float32_t * pData,
+        uint8_t ifftFlag)
+{
+  const uint32_t N = S->fftLen;
+  const float32_t *pTw = S->pTwiddle;
+  const float32_t sign = ifftFlag ? -1.0f : 1.0f;
+  float32_t *pA, *pB;
+  float32_t dr, di, wr, wi, tr, ti;
+  uint32_t L, twStep, g, j, i, r;
+
+  for (L = N / 2U, twStep = 1U; L > 0U; L >>= 1U, twStep <<= 1U)
+  {
+    for (g = 0U; g < N; g += 2U * L)
+    {
+      for (j = 0U; j < L; j++)
+      {
+        pA = pData + 2U * (g + j);
+        pB = pA + 2U * L;
+
+        dr = pA[0] - pB[0];
+        di = pA[1] - pB[1];
+        pA[0] = pA[0] + pB[0];
+        pA[1] = pA[1] + pB[1];
+
+        wr = pTw[2U * j * twStep];
+        wi = sign * pTw[2U * j * twStep + 1U];
+        pB[0] = dr * wr - di * wi;
+        pB[1] = di * wr + dr * wi;
+      }
+    }
+  }
+
+  /* Bit reversal, merged with the 1/N scaling of the inverse transform */
+  const float32_t scale = ifftFlag ? 1.0f / (float32_t)N : 1.0f;
+
+  for (i = 0U; i < N; i++)
+  {
+    r = riscv_cfft_batch_bitrev_f32(i, S->log2Len);
+    if ((r < i) || ((r == i) && (ifftFlag == 0U)))
+    {
+      continue;
+    }
+    pA = pData + 2U * i;
+    pB = pData + 2U * r;
+
+    tr = pA[0] * scale;
+    ti = pA[1] * scale;
+    pA[0] = pB[0] * scale;
+    pA[1] = pB[1] * scale;
+    pB[0] = tr;
+    pB[1] = ti;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+/**
+  @defgroup BatchFFT Batched FFT Functions
+
+  @par
+                   The batched FFT functions compute many small complex FFTs of the same length in one
+                   call, as needed by channelizers, multi-antenna and multi-channel sensor workloads.
+                   All the transforms share one twiddle table and one instance, so the setup cost is
+                   paid once per batch instead of once per transform.
+  @par
+                   The transforms are computed in place with a radix-2 decimation in frequency algorithm
+                   followed by a bit reversal. With the RVV extension each vector lane computes a
+                   different transform: the butterflies load the same sample of vl transforms with
+                   strided segment loads and multiply it by a scalar twiddle factor. There is no
+                   shuffle at all, and the speedup grows with the number of transforms up to the
+                   number of lanes. For a single large transform \ref riscv_cfft_f32 remains faster.
+  @par
+                   Transform t uses the fftLen complex values at <code>pData + 2*t*stride</code>,
+                   stride being at least fftLen. It can be larger to transform the rows of a matrix
+                   of interleaved complex values.
+  @par
+                   The twiddle factors are not stored in flash. The initialization function computes the
+                   fftLen/2 twiddle factors into a buffer provided by the caller, which must stay valid
+                   while the instance is used. Its length is given by \ref riscv_cfft_batch_twiddle_buffer_size.
+  @par
+                   The forward floating-point transform is not scaled and the inverse one is scaled by 1/fftLen.
+                   The Q31 and Q15 transforms scale each stage by 1/2 to avoid overflows, so both
+                   the forward and the inverse transforms are scaled down by 1/fftLen.
+ */
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point batched complex FFT.
+  @param[in]     S              points to an instance of the floating-point batched CFFT structure
+  @param[in,out] pData          points to the complex data of the transforms, processed in place
+  @param[in]     nTransforms    number of transforms
+  @param[in]     stride         distance in complex values between the first samples of two transforms
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+RISCV_DSP_ATTRIBUTE void riscv_cfft_batch_f32(
+  const riscv_cfft_batch_instance_f32 * S,
+        float32_t * pData,
+        uint32_t nTransforms,
+        uint32_t stride,
+        uint8_t ifftFlag)
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  const ptrdiff_t bstride = 8 * (ptrdiff_t)stride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e32m1(nTransforms)) > 0; nTransforms -= vl)
+  {
+    riscv_cfft_batch_block_f32(S, pData, bstride, ifftFlag, vl);
+    pData += 2U * vl * stride;
+  }
+#else
+  while (nTransforms > 0U)
+  {
+    riscv_cfft_batch_one_f32(S, pData, ifftFlag);
+    pData += 2U * stride;
+    nTransforms--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/**
+  @} end of BatchFFT group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_batch_init_q15.c
+ * Description:  Initialization function for the batched cfft q15 instance
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+/* Round to Q15, saturated symmetrically */
+static q15_t riscv_cfft_batch_twiddle_q15(float64_t x)
+{
+  x = round(x * 32768.0);
+  if (x > 32767.0)
+  {
+    x = 32767.0;
+  }
+  else if (x < -32767.0)
+  {
+    x = -32767.0;
+  }
+  return (q15_t)x;
+}
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 batched complex FFT.
+  @param[in,out] S              points to an instance of the Q15 batched CFFT structure
+  @param[in]     fftLen         length of the FFT, a power of two in [2, 32768]
+  @param[out]    pTwiddle       points to the twiddle buffer filled by this function, of
+                                riscv_cfft_batch_twiddle_buffer_size(RISCV_MATH_Q15, fftLen) values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen is not supported
+
+  @par           The twiddle factors are computed in double precision and rounded to Q15.
+                 The twiddle buffer is shared by all the transforms of a batch and must stay valid
+                 while the instance is used.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_batch_init_q15(
+  riscv_cfft_batch_instance_q15 * S,
+  uint16_t fftLen,
+  q15_t * pTwiddle)
+{
+  float64_t angle;
+
+  S->fftLen = fftLen;
+  S->log2Len = riscv_cfft_batch_log2(fftLen);
+  S->pTwiddle = pTwiddle;
+  if (S->log2Len == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* w_N^k = exp(-2*pi*i * k / fftLen) for k < fftLen/2 */
+  for (uint32_t k = 0U; k < fftLen / 2U; k++)
+  {
+    angle = RISCV_CFFT_MIXED_2PI * (float64_t)k / (float64_t)fftLen;
+    *pTwiddle++ = riscv_cfft_batch_twiddle_q15(cos(angle));
+    *pTwiddle++ = riscv_cfft_batch_twiddle_q15(-sin(angle));
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of BatchFFT group
+ */
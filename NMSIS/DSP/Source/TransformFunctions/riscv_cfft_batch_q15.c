@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_batch_q15.c
+ * Description:  Batched CFFT & CIFFT Q15 process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/* Reverse the n lowest bits of x */
+static uint32_t riscv_cfft_batch_bitrev_q15(uint32_t x, uint32_t n)
+{
+  uint32_t r = 0U;
+
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    r = (r << 1U) | (x & 1U);
+    x >>= 1U;
+  }
+
+  return r;
+}
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * Radix-2 DIF FFT of vl transforms at once: lane l computes the transform at
+ * pData + l * bstride bytes, the twiddle factor of each butterfly is a scalar
+ * shared by all the lanes. The inputs of each stage are scaled by 1/2.
+ */
+static void riscv_cfft_batch_block_q15(
+  const riscv_cfft_batch_instance_q15 * S,
+        q15_t * pData,
+        ptrdiff_t bstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  const uint32_t N = S->fftLen;
+  const q15_t *pTw = S->pTwiddle;
+  vint16m1x2_t v_tuple;
+  q15_t *pA, *pB;
+  q15_t wr, wi;
+  uint32_t L, twStep, g, j, i, r;
+
+  for (L = N / 2U, twStep = 1U; L > 0U; L >>= 1U, twStep <<= 1U)
+  {
+    for (g = 0U; g < N; g += 2U * L)
+    {
+      for (j = 0U; j < L; j++)
+      {
+        pA = pData + 2U * (g + j);
+        pB = pA + 2U * L;
+
+        v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pA, bstride, vl);
+        vint16m1_t va_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 1, vl);
+        vint16m1_t va_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 1, vl);
+        v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pB, bstride, vl);
+        vint16m1_t vb_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 1, vl);
+        vint16m1_t vb_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 1, vl);
+
+        v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, __riscv_vadd_vv_i16m1(va_re, vb_re, vl));
+        v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, __riscv_vadd_vv_i16m1(va_im, vb_im, vl));
+        __riscv_vssseg2e16_v_i16m1x2(pA, bstride, v_tuple, vl);
+
+        vint16m1_t vd_re = __riscv_vsub_vv_i16m1(va_re, vb_re, vl);
+        vint16m1_t vd_im = __riscv_vsub_vv_i16m1(va_im, vb_im, vl);
+        if (j != 0U)
+        {
+          /* w = exp(-+2*pi*i * j*twStep / N), conjugated for the inverse transform */
+          wr = pTw[2U * j * twStep];
+          wi = ifftFlag ? -pTw[2U * j * twStep + 1U] : pTw[2U * j * twStep + 1U];
+          vint16m1_t vre = __riscv_vssub_vv_i16m1(__riscv_vsmul_vx_i16m1(vd_re, wr, __RISCV_VXRM_RNU, vl),
+                                                __riscv_vsmul_vx_i16m1(vd_im, wi, __RISCV_VXRM_RNU, vl), vl);
+          vint16m1_t vim = __riscv_vsadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vd_im, wr, __RISCV_VXRM_RNU, vl),
+                                                __riscv_vsmul_vx_i16m1(vd_re, wi, __RISCV_VXRM_RNU, vl), vl);
+          vd_re = vre;
+          vd_im = vim;
+        }
+        v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, vd_re);
+        v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, vd_im);
+        __riscv_vssseg2e16_v_i16m1x2(pB, bstride, v_tuple, vl);
+      }
+    }
+  }
+
+  /* Bit reversal */
+  for (i = 0U; i < N; i++)
+  {
+    r = riscv_cfft_batch_bitrev_q15(i, S->log2Len);
+    if (r <= i)
+    {
+      continue;
+    }
+    pA = pData + 2U * i;
+    pB = pData + 2U * r;
+
+    vint16m1x2_t va = __riscv_vlsseg2e16_v_i16m1x2(pA, bstride, vl);
+    vint16m1x2_t vb = __riscv_vlsseg2e16_v_i16m1x2(pB, bstride, vl);
+    __riscv_vssseg2e16_v_i16m1x2(pA, bstride, vb, vl);
+    __riscv_vssseg2e16_v_i16m1x2(pB, bstride, va, vl);
+  }
+}
+#else
+/* Radix-2 DIF FFT of the transform at pData, the inputs of each stage are scaled by 1/2 */
+static void riscv_cfft_batch_one_q15(
+  const riscv_cfft_batch_instance_q15 * S,
+        q15_t * pData,
+        uint8_t ifftFlag)
+{
+  const uint32_t N = S->fftLen;
+  const q15_t *pTw = S->pTwiddle;
+  q15_t *pA, *pB;
+  q15_t ar, ai, br, bi, dr, di, wr, wi;
+  uint32_t L, twStep, g, j, i, r;
+
+  for (L = N / 2U, twStep = 1U; L > 0U; L >>= 1U, twStep <<= 1U)
+  {
+    for (g = 0U; g < N; g += 2U * L)
+    {
+      for (j = 0U; j < L; j++)
+      {
+        pA = pData + 2U * (g + j);
+        pB = pA + 2U * L;
+
+        ar = pA[0] >> 1;
+        ai = pA[1] >> 1;
+        br = pB[0] >> 1;
+        bi = pB[1] >> 1;
+        pA[0] = ar + br;
+        pA[1] = ai + bi;
+        dr = ar - br;
+        di = ai - bi;
+
+        wr = pTw[2U * j * twStep];
+        wi = ifftFlag ? -pTw[2U * j * twStep + 1U] : pTw[2U * j * twStep + 1U];
+        pB[0] = clip_q31_to_q15(((q31_t)dr * wr - (q31_t)di * wi) >> 15);
+        pB[1] = clip_q31_to_q15(((q31_t)di * wr + (q31_t)dr * wi) >> 15);
+      }
+    }
+  }
+
+  /* Bit reversal */
+  for (i = 0U; i < N; i++)
+  {
+    r = riscv_cfft_batch_bitrev_q15(i, S->log2Len);
+    if (r <= i)
+    {
+      continue;
+    }
+    pA = pData + 2U * i;
+    pB = pData + 2U * r;
+
+    ar = pA[0];
+    ai = pA[1];
+    pA[0] = pB[0];
+    pA[1] = pB[1];
+    pB[0] = ar;
+    pB[1] = ai;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+/**
+  @addtogroup BatchFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 batched complex FFT.
+  @param[in]     S              points to an instance of the Q15 batched CFFT structure
+  @param[in,out] pData          points to the complex data of the transforms, processed in place
+  @param[in]     nTransforms    number of transforms
+  @param[in]     stride         distance in complex values between the first samples of two transforms
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+RISCV_DSP_ATTRIBUTE void riscv_cfft_batch_q15(
+  const riscv_cfft_batch_instance_q15 * S,
+        q15_t * pData,
+        uint32_t nTransforms,
+        uint32_t stride,
+        uint8_t ifftFlag)
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const ptrdiff_t bstride = 4 * (ptrdiff_t)stride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e16m1(nTransforms)) > 0; nTransforms -= vl)
+  {
+    riscv_cfft_batch_block_q15(S, pData, bstride, ifftFlag, vl);
+    pData += 2U * vl * stride;
+  }
+#else
+  while (nTransforms > 0U)
+  {
+    riscv_cfft_batch_one_q15(S, pData, ifftFlag);
+    pData += 2U * stride;
+    nTransforms--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/**
+  @} end of BatchFFT group
+ */
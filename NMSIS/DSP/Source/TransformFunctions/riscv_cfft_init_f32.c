@@ -50,6 +50,7 @@
 #include "dsp/transform_functions.h"
 #include "riscv_common_tables.h"
 #include "riscv_const_structs.h"
+#include "riscv_vec_fft.h"
 
 
 #if defined(RISCV_MATH_VECTOR_ZVE32F)
@@ -254,7 +255,72 @@ CFFTINIT_F32(16,16)
                 If you use NMSIS-DSP as a static library, and if you know the FFT sizes
                 that you need at build time, then it is better to use the initialization
                 functions defined for each FFT size.
+
+  @par
+                When the library is built with <code>RISCV_CFFT_RUNTIME_TABLES</code>, this function
+                does not use the const tables: it computes the tables of \ref riscv_cfft_init_runtime_f32
+                once per FFT length into a static pool of <code>RISCV_CFFT_RUNTIME_POOL_SIZE</code> words,
+                and later calls for the same length reuse them. The default pool holds the tables of all
+                the lengths up to <code>RISCV_CFFT_RUNTIME_MAX_LEN</code> (4096 by default, so every length
+                accepted without the option is accepted). Lowering it saves RAM, \ref RISCV_MATH_LENGTH_ERROR
+                is then returned for the longer lengths.
  */
+#if defined(RISCV_CFFT_RUNTIME_TABLES)
+
+#ifndef RISCV_CFFT_RUNTIME_POOL_SIZE
+/* The tables of the lengths 16 to N take less than twice the tables of length N */
+#define RISCV_CFFT_RUNTIME_POOL_SIZE (2U * RISCV_CFFT_RUNTIME_TABLE_LEN(RISCV_CFFT_RUNTIME_MAX_LEN))
+#endif /* RISCV_CFFT_RUNTIME_POOL_SIZE */
+
+/* Tables of the lengths 16 to 4096 computed so far, shared by all the instances of a length */
+static float32_t riscv_cfft_runtime_pool[RISCV_CFFT_RUNTIME_POOL_SIZE];
+static uint32_t riscv_cfft_runtime_pool_used = 0U;
+static riscv_cfft_instance_f32 riscv_cfft_runtime_instances[9];
+
+RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_init_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen)
+{
+        uint32_t len = riscv_cfft_runtime_table_len(fftLen);
+        riscv_cfft_instance_f32 *pCached;
+        riscv_status status;
+        uint32_t slot = 0U;
+
+        if (len == 0U)
+        {
+            return RISCV_MATH_ARGUMENT_ERROR;
+        }
+        if (fftLen > RISCV_CFFT_RUNTIME_MAX_LEN)
+        {
+            return RISCV_MATH_LENGTH_ERROR;
+        }
+
+        while ((16U << slot) < fftLen)
+        {
+            slot++;
+        }
+        pCached = &riscv_cfft_runtime_instances[slot];
+
+        if (pCached->fftLen != fftLen)
+        {
+            if (len > RISCV_CFFT_RUNTIME_POOL_SIZE - riscv_cfft_runtime_pool_used)
+            {
+                return RISCV_MATH_LENGTH_ERROR;
+            }
+
+            status = riscv_cfft_init_runtime_f32(pCached, fftLen, riscv_cfft_runtime_pool + riscv_cfft_runtime_pool_used);
+            if (status != RISCV_MATH_SUCCESS)
+            {
+                pCached->fftLen = 0U;
+                return status;
+            }
+            riscv_cfft_runtime_pool_used += len;
+        }
+
+        *S = *pCached;
+        return RISCV_MATH_SUCCESS;
+}
+#else
 RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_init_f32(
   riscv_cfft_instance_f32 * S,
   uint16_t fftLen)
@@ -319,6 +385,7 @@ RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_init_f32(
 
         return (status);
 }
+#endif /* defined(RISCV_CFFT_RUNTIME_TABLES) */
 
 /**
   @} end of ComplexFFTF32 group
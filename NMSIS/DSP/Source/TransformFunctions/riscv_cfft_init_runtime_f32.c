@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_init_runtime_f32.c
+ * Description:  Initialization function for cfft f32 instance with runtime tables
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#include "riscv_vec_math.h"
+
+/* Reverse the n lowest bits of x */
+static uint32_t riscv_cfft_runtime_bitrev(uint32_t x, uint32_t n)
+{
+  uint32_t r = 0U;
+
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    r = (r << 1U) | (x & 1U);
+    x >>= 1U;
+  }
+
+  return r;
+}
+#else
+/*
+ * Output order of riscv_cfft_f32 before the bit reversal: the radix-8 butterflies of
+ * length M = 8^k leave their result in base 8 digit reversed order, and the first
+ * radix-2 or radix-4 stage of the 8by2 and 8by4 variants interleaves the R = fftLen / M
+ * columns. Position h * M + q holds X[digitrev8(q) * R + h].
+ */
+static uint32_t riscv_cfft_runtime_position_f32(uint32_t p, uint32_t fftLen, uint32_t log2Len)
+{
+  uint32_t M = fftLen >> (log2Len % 3U);
+  uint32_t q = p % M;
+  uint32_t d = 0U;
+
+  for (uint32_t m = 1U; m < M; m *= 8U)
+  {
+    d = (d * 8U) + (q % 8U);
+    q /= 8U;
+  }
+
+  return d * (fftLen / M) + (p / M);
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+/**
+  @addtogroup ComplexFFTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the cfft f32 function with tables computed at runtime
+  @param[in,out] S              points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen         fft length (number of complex samples), a power of two in [16, 4096]
+  @param[out]    pBuffer        points to the table buffer filled by this function, of
+                                riscv_cfft_runtime_buffer_size(RISCV_MATH_F32, fftLen) values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+
+  @par
+                Same as \ref riscv_cfft_init_f32, but the twiddle factors and the bit reversal
+                (or RVV output index) tables are computed into the RAM buffer provided by the
+                caller instead of pointing to the const tables. The const tables are then not
+                linked and the flash footprint of the FFT is only its code, at the cost of
+                <code>riscv_cfft_runtime_buffer_size()</code> words of RAM and of the init time.
+                The RVV version computes the twiddle factors with the vector sincos.
+
+  @par
+                The buffer can be shared by instances of the same length and must stay valid
+                while they are used.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_init_runtime_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  uint32_t N = fftLen;
+  uint32_t log2Len = 0U;
+
+  if (riscv_cfft_runtime_table_len(N) == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+  while ((1UL << log2Len) < N)
+  {
+    log2Len++;
+  }
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  /*
+   * Stage s of the RVV CFFT multiplies the difference of butterfly j, j < N/2, by
+   * w_N^e with e = j with its s lowest bits cleared, for s = 0 .. log2(N) - 2.
+   */
+  const uint32_t half = N / 2U;
+  const uint32_t twdLen = half * (log2Len - 1U);
+  float32_t *pRe = pBuffer;
+  float32_t *pIm = pBuffer + twdLen;
+  uint16_t *pBitRev = (uint16_t *)(pBuffer + 2U * twdLen);
+  const float32_t step = -6.28318530717958647692f / (float32_t)N;
+  uint32_t blkCnt, j;
+  size_t vl;
+
+  for (uint32_t s = 0U; s < log2Len - 1U; s++)
+  {
+    const uint32_t mask = ~((1UL << s) - 1U);
+
+    for (j = 0U, blkCnt = half; (vl = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= vl)
+    {
+      vuint32m1_t ve = __riscv_vand_vx_u32m1(__riscv_vadd_vx_u32m1(__riscv_vid_v_u32m1(vl), j, vl), mask, vl);
+      vfloat32m1_t vangle = __riscv_vfmul_vf_f32m1(__riscv_vfcvt_f_xu_v_f32m1(ve, vl), step, vl);
+      vfloat32m1_t vsin, vcos;
+
+      /* w_N^e = cos(-2*pi*e/N) + i*sin(-2*pi*e/N) */
+      sincos_ps_m1(vangle, &vsin, &vcos, vl);
+      __riscv_vse32_v_f32m1(pRe, vcos, vl);
+      __riscv_vse32_v_f32m1(pIm, vsin, vl);
+
+      pRe += vl;
+      pIm += vl;
+      j += vl;
+    }
+  }
+
+  /*
+   * The last stage writes butterfly j to X[bitrev(2j)] and X[bitrev(2j + 1)],
+   * stored as byte offsets of complex values.
+   */
+  for (j = 0U; j < half; j++)
+  {
+    uint32_t r = riscv_cfft_runtime_bitrev(j, log2Len - 1U);
+
+    pBitRev[j] = (uint16_t)(r * 8U);
+    pBitRev[half + j] = (uint16_t)((r + half) * 8U);
+  }
+
+  S->fftLen = N;
+  S->ptwd_re = pBuffer;
+  S->ptwd_im = pBuffer + twdLen;
+  S->pBitRevTable = pBitRev;
+#else
+  uint16_t *pBitRev = (uint16_t *)(pBuffer + 2U * N);
+  uint32_t bitRevLen = 0U;
+  uint32_t p, q, first;
+  float64_t angle;
+
+  /* Same twiddle factors as twiddleCoef_N: cos(2*pi*i/N), sin(2*pi*i/N) */
+  for (uint32_t i = 0U; i < N; i++)
+  {
+    angle = RISCV_CFFT_MIXED_2PI * (float64_t)i / (float64_t)N;
+    pBuffer[2U * i] = (float32_t)cos(angle);
+    pBuffer[2U * i + 1U] = (float32_t)sin(angle);
+  }
+
+  /*
+   * Each cycle of the output permutation is undone by swapping its first position
+   * with the following ones, the first position being the smallest of the cycle.
+   */
+  for (p = 0U; p < N; p++)
+  {
+    first = 1U;
+    for (q = riscv_cfft_runtime_position_f32(p, N, log2Len); q != p; q = riscv_cfft_runtime_position_f32(q, N, log2Len))
+    {
+      if (q < p)
+      {
+        first = 0U;
+        break;
+      }
+    }
+    if (first == 0U)
+    {
+      continue;
+    }
+
+    for (q = riscv_cfft_runtime_position_f32(p, N, log2Len); q != p; q = riscv_cfft_runtime_position_f32(q, N, log2Len))
+    {
+      /* Offsets in bytes of the complex values, as in riscvBitRevIndexTable */
+      pBitRev[bitRevLen++] = (uint16_t)(p * 8U);
+      pBitRev[bitRevLen++] = (uint16_t)(q * 8U);
+    }
+  }
+
+  S->fftLen = (uint16_t)N;
+  S->pTwiddle = pBuffer;
+  S->pBitRevTable = pBitRev;
+  S->bitRevLength = (uint16_t)bitRevLen;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFTF32 group
+ */
@@ -0,0 +1,288 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_large_f32.c
+ * Description:  Four-step large Complex FFT Floating point process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/*
+ * Copy an outer x inner block of complex values:
+ * pDst[i * dstOuter + j * dstInner] = pSrc[i * srcOuter + j * srcInner], strides in complex units.
+ * The inner loop is the short tile dimension, so the large array is always accessed
+ * tileLen consecutive values at a time.
+ */
+static void riscv_cfft_large_copy_f32(
+  const float32_t * pSrc, uint32_t srcOuter, uint32_t srcInner,
+        float32_t * pDst, uint32_t dstOuter, uint32_t dstInner,
+        uint32_t outer, uint32_t inner)
+{
+  for (uint32_t i = 0U; i < outer; i++)
+  {
+    const float32_t *pIn = pSrc + 2U * i * srcOuter;
+    float32_t *pOut = pDst + 2U * i * dstOuter;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    size_t vl;
+    vfloat32m1x2_t v_tuple;
+
+    for (uint32_t blkCnt = inner; (vl = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= vl)
+    {
+      v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pIn, 8 * srcInner, vl);
+      __riscv_vssseg2e32_v_f32m1x2(pOut, 8 * dstInner, v_tuple, vl);
+      pIn += 2U * vl * srcInner;
+      pOut += 2U * vl * dstInner;
+    }
+#else
+    for (uint32_t j = 0U; j < inner; j++)
+    {
+      pOut[0] = pIn[0];
+      pOut[1] = pIn[1];
+      pIn += 2U * srcInner;
+      pOut += 2U * dstInner;
+    }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+  }
+}
+
+/*
+ * Multiply column col of the column FFTs output by w_N^(col * k), k = 0..fftLenCol-1.
+ * With e = col * k = a * fftLenRow + b, w_N^e = w_N^(a * fftLenRow) * w_N^b is built from
+ * the two short tables of the instance.
+ */
+static void riscv_cfft_large_twiddle_f32(
+  const riscv_cfft_large_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t col,
+        uint8_t ifftFlag)
+{
+  const float32_t *pFine = S->pTwiddle;
+  const float32_t *pCoarse = S->pTwiddle + 2U * S->fftLenRow;
+  const uint32_t mask = S->fftLenRow - 1U;
+  const uint32_t shift = S->log2Row;
+  const float32_t sign = ifftFlag ? -1.0f : 1.0f;
+  uint32_t blkCnt = S->fftLenCol;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  size_t vl;
+  uint32_t k = 0U;
+  vfloat32m1x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= vl)
+  {
+    vuint32m1_t ve = __riscv_vmul_vx_u32m1(__riscv_vadd_vx_u32m1(__riscv_vid_v_u32m1(vl), k, vl), col, vl);
+    vuint32m1_t voff_a = __riscv_vsll_vx_u32m1(__riscv_vsrl_vx_u32m1(ve, shift, vl), 3, vl);
+    vuint32m1_t voff_b = __riscv_vsll_vx_u32m1(__riscv_vand_vx_u32m1(ve, mask, vl), 3, vl);
+
+    v_tuple = __riscv_vluxseg2ei32_v_f32m1x2(pCoarse, voff_a, vl);
+    vfloat32m1_t vc_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vc_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vluxseg2ei32_v_f32m1x2(pFine, voff_b, vl);
+    vfloat32m1_t vf_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vf_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    /* w = c * f, conjugated for the inverse transform */
+    vfloat32m1_t vw_re = __riscv_vfnmsac_vv_f32m1(__riscv_vfmul_vv_f32m1(vc_re, vf_re, vl), vc_im, vf_im, vl);
+    vfloat32m1_t vw_im = __riscv_vfmul_vf_f32m1(__riscv_vfmacc_vv_f32m1(__riscv_vfmul_vv_f32m1(vc_re, vf_im, vl), vc_im, vf_re, vl), sign, vl);
+
+    v_tuple = __riscv_vlseg2e32_v_f32m1x2(pSrc, vl);
+    vfloat32m1_t vx_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vx_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    vfloat32m1_t vy_re = __riscv_vfnmsac_vv_f32m1(__riscv_vfmul_vv_f32m1(vx_re, vw_re, vl), vx_im, vw_im, vl);
+    vfloat32m1_t vy_im = __riscv_vfmacc_vv_f32m1(__riscv_vfmul_vv_f32m1(vx_re, vw_im, vl), vx_im, vw_re, vl);
+
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, vy_re);
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, vy_im);
+    __riscv_vsseg2e32_v_f32m1x2(pDst, v_tuple, vl);
+
+    pSrc += 2U * vl;
+    pDst += 2U * vl;
+    k += vl;
+  }
+#else
+  float32_t wr, wi, xr, xi;
+  const float32_t *pC, *pF;
+  uint32_t e = 0U;
+
+  while (blkCnt > 0U)
+  {
+    pC = pCoarse + 2U * (e >> shift);
+    pF = pFine + 2U * (e & mask);
+    wr = pC[0] * pF[0] - pC[1] * pF[1];
+    wi = (pC[0] * pF[1] + pC[1] * pF[0]) * sign;
+
+    xr = pSrc[0];
+    xi = pSrc[1];
+    pDst[0] = xr * wr - xi * wi;
+    pDst[1] = xr * wi + xi * wr;
+
+    pSrc += 2U;
+    pDst += 2U;
+    e += col;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/*
+ * Sub-FFT with the existing CFFT, returns where the result is.
+ * The RVV CFFT is out-of-place and uses a temporary buffer, the scalar one works in-place.
+ */
+static float32_t *riscv_cfft_large_sub_f32(
+  const riscv_cfft_instance_f32 * S,
+        float32_t * pIn,
+        float32_t * pOut,
+        float32_t * pTmp,
+        uint8_t ifftFlag)
+{
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  riscv_cfft_f32(S, pIn, pOut, pTmp, ifftFlag);
+  return pOut;
+#else
+  (void)pOut;
+  (void)pTmp;
+  riscv_cfft_f32(S, pIn, ifftFlag, 1U);
+  return pIn;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup LargeFFT Large Complex FFT Functions
+
+  @par
+                   The large complex FFT computes floating-point FFTs of 256 up to 16777216 points,
+                   beyond the 4096 points supported by the table driven \ref riscv_cfft_f32, such as
+                   the 16K to 256K points transforms used for spectral analysis.
+  @par
+                   It uses the four-step algorithm: the fftLen = fftLenCol * fftLenRow input is seen as a
+                   fftLenCol x fftLenRow matrix, the columns are transformed with fftLenCol points FFTs and
+                   multiplied by the twiddle factors w_N^(col*row), then the rows are transformed with
+                   fftLenRow points FFTs and the matrix is transposed into the output. The sub-FFTs are
+                   computed with \ref riscv_cfft_f32, and both use the RVV version when available.
+  @par
+                   Columns are gathered and rows are transposed by tiles of tileLen columns or rows,
+                   so that the large buffers are read and written by runs of consecutive values
+                   and each tile stays in the data cache while it is transformed. The tile size is set
+                   by <code>RISCV_CFFT_LARGE_TILE_SIZE</code> (in bytes, 32768 by default), which
+                   should be about the size of the data cache.
+  @par
+                   The twiddle factors are computed by the initialization function into a buffer
+                   provided by the caller, of only 2 * (fftLenCol + fftLenRow) values given by
+                   \ref riscv_cfft_large_twiddle_buffer_size. The temporary buffer length is given by
+                   \ref riscv_cfft_large_tmp_buffer_size.
+  @par
+                   As for \ref riscv_cfft_f32, the forward transform is not scaled and the inverse
+                   transform is scaled by 1/fftLen.
+ */
+
+/**
+  @addtogroup LargeFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point large complex FFT.
+  @param[in]     S              points to an instance of the floating-point large CFFT structure
+  @param[in,out] pSrc           points to the complex input buffer of size <code>2*fftLen</code>, modified by the function
+  @param[out]    pDst           points to the complex output buffer of size <code>2*fftLen</code>
+  @param[in]     pBuffer        points to a temporary buffer of riscv_cfft_large_tmp_buffer_size() values
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           pSrc and pDst must be different buffers.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_cfft_large_f32(
+  const riscv_cfft_large_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pBuffer,
+        uint8_t ifftFlag)
+{
+  const uint32_t fftLenCol = S->fftLenCol;
+  const uint32_t fftLenRow = S->fftLenRow;
+  const uint32_t tileLen = S->tileLen;
+  float32_t *pTile = pBuffer;
+  float32_t *pRes;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  /* Output column and double buffer of the RVV sub-FFTs */
+  float32_t *pCol = pTile + 2U * tileLen * fftLenRow;
+  float32_t *pTmp = pCol + 2U * fftLenRow;
+#else
+  float32_t *pCol = NULL;
+  float32_t *pTmp = NULL;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  /* Column FFTs and twiddle multiplication, written back in place */
+  for (uint32_t col = 0U; col < fftLenRow; col += tileLen)
+  {
+    riscv_cfft_large_copy_f32(pSrc + 2U * col, fftLenRow, 1U,
+                              pTile, 1U, fftLenCol,
+                              fftLenCol, tileLen);
+
+    for (uint32_t i = 0U; i < tileLen; i++)
+    {
+      float32_t *pColumn = pTile + 2U * i * fftLenCol;
+
+      pRes = riscv_cfft_large_sub_f32(&(S->Scol), pColumn, pCol, pTmp, ifftFlag);
+      riscv_cfft_large_twiddle_f32(S, pRes, pColumn, col + i, ifftFlag);
+    }
+
+    riscv_cfft_large_copy_f32(pTile, 1U, fftLenCol,
+                              pSrc + 2U * col, fftLenRow, 1U,
+                              fftLenCol, tileLen);
+  }
+
+  /* Row FFTs and transposition into the output */
+  for (uint32_t row = 0U; row < fftLenCol; row += tileLen)
+  {
+    float32_t *pFirst = NULL;
+
+    for (uint32_t i = 0U; i < tileLen; i++)
+    {
+      pRes = riscv_cfft_large_sub_f32(&(S->Srow), pSrc + 2U * (row + i) * fftLenRow,
+                                      pTile + 2U * i * fftLenRow, pTmp, ifftFlag);
+      if (i == 0U)
+      {
+        pFirst = pRes;
+      }
+    }
+
+    riscv_cfft_large_copy_f32(pFirst, 1U, fftLenRow,
+                              pDst + 2U * row, fftLenCol, 1U,
+                              fftLenRow, tileLen);
+  }
+}
+
+/**
+  @} end of LargeFFT group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_large_init_f32.c
+ * Description:  Initialization function for the large cfft f32 instance
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @addtogroup LargeFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point large complex FFT.
+  @param[in,out] S              points to an instance of the floating-point large CFFT structure
+  @param[in]     fftLen         length of the FFT, a power of two from 256 to 16777216
+  @param[out]    pTwiddle       points to the twiddle buffer filled by this function, of
+                                riscv_cfft_large_twiddle_buffer_size(RISCV_MATH_F32, fftLen) values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen is not a supported length
+
+  @par           The column and row FFTs use \ref riscv_cfft_init_f32, so their tables must
+                 be available in the library. The twiddle factors are computed in double precision.
+                 The tile length can be changed after the initialization, to a power of two up to 16
+                 if the temporary buffer is sized accordingly.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_large_init_f32(
+  riscv_cfft_large_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle)
+{
+  uint16_t p = riscv_cfft_large_log2(fftLen);
+  float64_t angle;
+
+  if (p == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLen = fftLen;
+  S->fftLenCol = (uint16_t)(1U << (p / 2U));
+  S->fftLenRow = (uint16_t)(1U << (p - p / 2U));
+  S->log2Row = p - p / 2U;
+  S->tileLen = riscv_cfft_large_tile_len(S->fftLenRow);
+  S->pTwiddle = pTwiddle;
+
+  if ((riscv_cfft_init_f32(&(S->Scol), S->fftLenCol) != RISCV_MATH_SUCCESS) ||
+      (riscv_cfft_init_f32(&(S->Srow), S->fftLenRow) != RISCV_MATH_SUCCESS))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  /* w_N^b, b = 0..fftLenRow-1 */
+  for (uint32_t b = 0U; b < S->fftLenRow; b++)
+  {
+    angle = RISCV_CFFT_MIXED_2PI * (float64_t)b / (float64_t)fftLen;
+    *pTwiddle++ = (float32_t)cos(angle);
+    *pTwiddle++ = (float32_t)-sin(angle);
+  }
+
+  /* w_N^(a * fftLenRow), a = 0..fftLenCol-1 */
+  for (uint32_t a = 0U; a < S->fftLenCol; a++)
+  {
+    angle = RISCV_CFFT_MIXED_2PI * (float64_t)a / (float64_t)S->fftLenCol;
+    *pTwiddle++ = (float32_t)cos(angle);
+    *pTwiddle++ = (float32_t)-sin(angle);
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of LargeFFT group
+ */
@@ -0,0 +1,606 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_mixed_f32.c
+ * Description:  Mixed-radix Complex FFT Floating point process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#define MIXED_SIN_PI_3_F32      (0.866025403784438647f)   /* sin(2*pi/3) */
+#define MIXED_COS_2PI_5_F32     (0.309016994374947424f)   /* cos(2*pi/5) */
+#define MIXED_COS_4PI_5_F32     (-0.809016994374947424f)  /* cos(4*pi/5) */
+#define MIXED_SIN_2PI_5_F32     (0.951056516295153572f)   /* sin(2*pi/5) */
+#define MIXED_SIN_4PI_5_F32     (0.587785252292473129f)   /* sin(4*pi/5) */
+
+/*
+ * All butterflies below compute `count` independent forward DFTs of size radix.
+ * Butterfly i reads input k at complex index i * srcStride + k * srcStep, writes output j
+ * at complex index i * dstStride + j * dstStep, after a multiplication by the twiddle factor
+ * at complex index i * twStride + (j - 1) * twStep. pTw is NULL when all twiddles are 1.
+ */
+typedef void (*riscv_cfft_mixed_butterfly_f32)(
+  const float32_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        float32_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const float32_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+/* Multiply (re, im) by the twiddle factors at pTw, stride 0 broadcasts a single twiddle */
+__STATIC_FORCEINLINE vfloat32m1x2_t riscv_cfft_mixed_twiddle_f32(
+  vfloat32m1_t re, vfloat32m1_t im,
+  const float32_t * pTw, ptrdiff_t bstride, size_t vl)
+{
+    vfloat32m1x2_t v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pTw, bstride, vl);
+    vfloat32m1_t vtwd_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vtwd_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    vfloat32m1_t vre = __riscv_vfnmsac_vv_f32m1(__riscv_vfmul_vv_f32m1(re, vtwd_re, vl), im, vtwd_im, vl);
+    vfloat32m1_t vim = __riscv_vfmacc_vv_f32m1(__riscv_vfmul_vv_f32m1(im, vtwd_re, vl), re, vtwd_im, vl);
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, vre);
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, vim);
+    return v_tuple;
+}
+
+/* Store (re, im) as output j, after the twiddle multiplication when there is one */
+__STATIC_FORCEINLINE void riscv_cfft_mixed_store_f32(
+  float32_t * pDst, ptrdiff_t bsDst,
+  vfloat32m1_t re, vfloat32m1_t im,
+  const float32_t * pTw, ptrdiff_t bsTw, size_t vl)
+{
+    vfloat32m1x2_t v_tuple;
+    if (pTw != NULL)
+    {
+        v_tuple = riscv_cfft_mixed_twiddle_f32(re, im, pTw, bsTw, vl);
+    }
+    else
+    {
+        v_tuple = __riscv_vset_v_f32m1_f32m1x2(__riscv_vundefined_f32m1x2(), 0, re);
+        v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, im);
+    }
+    __riscv_vssseg2e32_v_f32m1x2(pDst, bsDst, v_tuple, vl);
+}
+#else
+/* Store (re, im) as output j, after the twiddle multiplication when there is one */
+__STATIC_FORCEINLINE void riscv_cfft_mixed_store_f32(
+  float32_t * pDst,
+  float32_t re, float32_t im,
+  const float32_t * pTw)
+{
+  if (pTw != NULL)
+  {
+    pDst[0] = re * pTw[0] - im * pTw[1];
+    pDst[1] = im * pTw[0] + re * pTw[1];
+  }
+  else
+  {
+    pDst[0] = re;
+    pDst[1] = im;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+static void riscv_cfft_mixed_radix2_f32(
+  const float32_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        float32_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const float32_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  (void)twStep;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  const ptrdiff_t bsSrc = 8 * srcStride, bsDst = 8 * dstStride, bsTw = 8 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e32m1(count)) > 0; count -= vl)
+  {
+    vfloat32m1x2_t v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc, bsSrc, vl);
+    vfloat32m1_t va_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 2 * srcStep, bsSrc, vl);
+    vfloat32m1_t vb_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vb_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    riscv_cfft_mixed_store_f32(pDst, bsDst, __riscv_vfadd_vv_f32m1(va_re, vb_re, vl),
+                               __riscv_vfadd_vv_f32m1(va_im, vb_im, vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, bsDst, __riscv_vfsub_vv_f32m1(va_re, vb_re, vl),
+                               __riscv_vfsub_vv_f32m1(va_im, vb_im, vl), pTw, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+    }
+  }
+#else
+  float32_t ar, ai, br, bi;
+
+  while (count > 0U)
+  {
+    ar = pSrc[0];
+    ai = pSrc[1];
+    br = pSrc[2 * srcStep];
+    bi = pSrc[2 * srcStep + 1];
+
+    riscv_cfft_mixed_store_f32(pDst, ar + br, ai + bi, NULL);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, ar - br, ai - bi, pTw);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+static void riscv_cfft_mixed_radix3_f32(
+  const float32_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        float32_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const float32_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  const float32_t *pTw2 = (pTw != NULL) ? pTw + 2 * twStep : NULL;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  const ptrdiff_t bsSrc = 8 * srcStride, bsDst = 8 * dstStride, bsTw = 8 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e32m1(count)) > 0; count -= vl)
+  {
+    vfloat32m1x2_t v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc, bsSrc, vl);
+    vfloat32m1_t va0_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va0_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 2 * srcStep, bsSrc, vl);
+    vfloat32m1_t va1_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va1_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 4 * srcStep, bsSrc, vl);
+    vfloat32m1_t va2_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va2_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    /* t1 = a1 + a2, t2 = a0 - t1 / 2, t3 = sin(2*pi/3) * (a1 - a2) */
+    vfloat32m1_t vt1_re = __riscv_vfadd_vv_f32m1(va1_re, va2_re, vl);
+    vfloat32m1_t vt1_im = __riscv_vfadd_vv_f32m1(va1_im, va2_im, vl);
+    vfloat32m1_t vt2_re = __riscv_vfnmsac_vf_f32m1(va0_re, 0.5f, vt1_re, vl);
+    vfloat32m1_t vt2_im = __riscv_vfnmsac_vf_f32m1(va0_im, 0.5f, vt1_im, vl);
+    vfloat32m1_t vt3_re = __riscv_vfmul_vf_f32m1(__riscv_vfsub_vv_f32m1(va1_re, va2_re, vl), MIXED_SIN_PI_3_F32, vl);
+    vfloat32m1_t vt3_im = __riscv_vfmul_vf_f32m1(__riscv_vfsub_vv_f32m1(va1_im, va2_im, vl), MIXED_SIN_PI_3_F32, vl);
+
+    /* y0 = a0 + t1, y1 = t2 - i * t3, y2 = t2 + i * t3 */
+    riscv_cfft_mixed_store_f32(pDst, bsDst, __riscv_vfadd_vv_f32m1(va0_re, vt1_re, vl),
+                               __riscv_vfadd_vv_f32m1(va0_im, vt1_im, vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, bsDst, __riscv_vfadd_vv_f32m1(vt2_re, vt3_im, vl),
+                               __riscv_vfsub_vv_f32m1(vt2_im, vt3_re, vl), pTw, bsTw, vl);
+    riscv_cfft_mixed_store_f32(pDst + 4 * dstStep, bsDst, __riscv_vfsub_vv_f32m1(vt2_re, vt3_im, vl),
+                               __riscv_vfadd_vv_f32m1(vt2_im, vt3_re, vl), pTw2, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+      pTw2 += 2 * vl * twStride;
+    }
+  }
+#else
+  float32_t a0r, a0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+  while (count > 0U)
+  {
+    a0r = pSrc[0];
+    a0i = pSrc[1];
+    t1r = pSrc[2 * srcStep] + pSrc[4 * srcStep];
+    t1i = pSrc[2 * srcStep + 1] + pSrc[4 * srcStep + 1];
+    t2r = a0r - 0.5f * t1r;
+    t2i = a0i - 0.5f * t1i;
+    t3r = MIXED_SIN_PI_3_F32 * (pSrc[2 * srcStep] - pSrc[4 * srcStep]);
+    t3i = MIXED_SIN_PI_3_F32 * (pSrc[2 * srcStep + 1] - pSrc[4 * srcStep + 1]);
+
+    riscv_cfft_mixed_store_f32(pDst, a0r + t1r, a0i + t1i, NULL);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, t2r + t3i, t2i - t3r, pTw);
+    riscv_cfft_mixed_store_f32(pDst + 4 * dstStep, t2r - t3i, t2i + t3r, pTw2);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+      pTw2 += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+static void riscv_cfft_mixed_radix4_f32(
+  const float32_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        float32_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const float32_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  const float32_t *pTw2 = (pTw != NULL) ? pTw + 2 * twStep : NULL;
+  const float32_t *pTw3 = (pTw != NULL) ? pTw + 4 * twStep : NULL;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  const ptrdiff_t bsSrc = 8 * srcStride, bsDst = 8 * dstStride, bsTw = 8 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e32m1(count)) > 0; count -= vl)
+  {
+    vfloat32m1x2_t v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc, bsSrc, vl);
+    vfloat32m1_t va0_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va0_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 2 * srcStep, bsSrc, vl);
+    vfloat32m1_t va1_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va1_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 4 * srcStep, bsSrc, vl);
+    vfloat32m1_t va2_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va2_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 6 * srcStep, bsSrc, vl);
+    vfloat32m1_t va3_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va3_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    vfloat32m1_t vt0_re = __riscv_vfadd_vv_f32m1(va0_re, va2_re, vl);
+    vfloat32m1_t vt0_im = __riscv_vfadd_vv_f32m1(va0_im, va2_im, vl);
+    vfloat32m1_t vt1_re = __riscv_vfsub_vv_f32m1(va0_re, va2_re, vl);
+    vfloat32m1_t vt1_im = __riscv_vfsub_vv_f32m1(va0_im, va2_im, vl);
+    vfloat32m1_t vt2_re = __riscv_vfadd_vv_f32m1(va1_re, va3_re, vl);
+    vfloat32m1_t vt2_im = __riscv_vfadd_vv_f32m1(va1_im, va3_im, vl);
+    vfloat32m1_t vt3_re = __riscv_vfsub_vv_f32m1(va1_re, va3_re, vl);
+    vfloat32m1_t vt3_im = __riscv_vfsub_vv_f32m1(va1_im, va3_im, vl);
+
+    /* y0 = t0 + t2, y1 = t1 - i * t3, y2 = t0 - t2, y3 = t1 + i * t3 */
+    riscv_cfft_mixed_store_f32(pDst, bsDst, __riscv_vfadd_vv_f32m1(vt0_re, vt2_re, vl),
+                               __riscv_vfadd_vv_f32m1(vt0_im, vt2_im, vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, bsDst, __riscv_vfadd_vv_f32m1(vt1_re, vt3_im, vl),
+                               __riscv_vfsub_vv_f32m1(vt1_im, vt3_re, vl), pTw, bsTw, vl);
+    riscv_cfft_mixed_store_f32(pDst + 4 * dstStep, bsDst, __riscv_vfsub_vv_f32m1(vt0_re, vt2_re, vl),
+                               __riscv_vfsub_vv_f32m1(vt0_im, vt2_im, vl), pTw2, bsTw, vl);
+    riscv_cfft_mixed_store_f32(pDst + 6 * dstStep, bsDst, __riscv_vfsub_vv_f32m1(vt1_re, vt3_im, vl),
+                               __riscv_vfadd_vv_f32m1(vt1_im, vt3_re, vl), pTw3, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+      pTw2 += 2 * vl * twStride;
+      pTw3 += 2 * vl * twStride;
+    }
+  }
+#else
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+  while (count > 0U)
+  {
+    t0r = pSrc[0] + pSrc[4 * srcStep];
+    t0i = pSrc[1] + pSrc[4 * srcStep + 1];
+    t1r = pSrc[0] - pSrc[4 * srcStep];
+    t1i = pSrc[1] - pSrc[4 * srcStep + 1];
+    t2r = pSrc[2 * srcStep] + pSrc[6 * srcStep];
+    t2i = pSrc[2 * srcStep + 1] + pSrc[6 * srcStep + 1];
+    t3r = pSrc[2 * srcStep] - pSrc[6 * srcStep];
+    t3i = pSrc[2 * srcStep + 1] - pSrc[6 * srcStep + 1];
+
+    riscv_cfft_mixed_store_f32(pDst, t0r + t2r, t0i + t2i, NULL);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, t1r + t3i, t1i - t3r, pTw);
+    riscv_cfft_mixed_store_f32(pDst + 4 * dstStep, t0r - t2r, t0i - t2i, pTw2);
+    riscv_cfft_mixed_store_f32(pDst + 6 * dstStep, t1r - t3i, t1i + t3r, pTw3);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+      pTw2 += 2 * twStride;
+      pTw3 += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+static void riscv_cfft_mixed_radix5_f32(
+  const float32_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        float32_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const float32_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  const float32_t *pTw2 = (pTw != NULL) ? pTw + 2 * twStep : NULL;
+  const float32_t *pTw3 = (pTw != NULL) ? pTw + 4 * twStep : NULL;
+  const float32_t *pTw4 = (pTw != NULL) ? pTw + 6 * twStep : NULL;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  const ptrdiff_t bsSrc = 8 * srcStride, bsDst = 8 * dstStride, bsTw = 8 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e32m1(count)) > 0; count -= vl)
+  {
+    vfloat32m1x2_t v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc, bsSrc, vl);
+    vfloat32m1_t va0_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va0_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 2 * srcStep, bsSrc, vl);
+    vfloat32m1_t va1_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va1_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 8 * srcStep, bsSrc, vl);
+    vfloat32m1_t va4_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va4_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    /* t1 = a1 + a4, t3 = a1 - a4 */
+    vfloat32m1_t vt1_re = __riscv_vfadd_vv_f32m1(va1_re, va4_re, vl);
+    vfloat32m1_t vt1_im = __riscv_vfadd_vv_f32m1(va1_im, va4_im, vl);
+    vfloat32m1_t vt3_re = __riscv_vfsub_vv_f32m1(va1_re, va4_re, vl);
+    vfloat32m1_t vt3_im = __riscv_vfsub_vv_f32m1(va1_im, va4_im, vl);
+
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 4 * srcStep, bsSrc, vl);
+    vfloat32m1_t va2_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va2_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 6 * srcStep, bsSrc, vl);
+    vfloat32m1_t va3_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va3_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    /* t2 = a2 + a3, t4 = a2 - a3 */
+    vfloat32m1_t vt2_re = __riscv_vfadd_vv_f32m1(va2_re, va3_re, vl);
+    vfloat32m1_t vt2_im = __riscv_vfadd_vv_f32m1(va2_im, va3_im, vl);
+    vfloat32m1_t vt4_re = __riscv_vfsub_vv_f32m1(va2_re, va3_re, vl);
+    vfloat32m1_t vt4_im = __riscv_vfsub_vv_f32m1(va2_im, va3_im, vl);
+
+    /* b1 = a0 + c1 * t1 + c2 * t2, b2 = a0 + c2 * t1 + c1 * t2 */
+    vfloat32m1_t vb1_re = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(va0_re, MIXED_COS_2PI_5_F32, vt1_re, vl), MIXED_COS_4PI_5_F32, vt2_re, vl);
+    vfloat32m1_t vb1_im = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(va0_im, MIXED_COS_2PI_5_F32, vt1_im, vl), MIXED_COS_4PI_5_F32, vt2_im, vl);
+    vfloat32m1_t vb2_re = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(va0_re, MIXED_COS_4PI_5_F32, vt1_re, vl), MIXED_COS_2PI_5_F32, vt2_re, vl);
+    vfloat32m1_t vb2_im = __riscv_vfmacc_vf_f32m1(__riscv_vfmacc_vf_f32m1(va0_im, MIXED_COS_4PI_5_F32, vt1_im, vl), MIXED_COS_2PI_5_F32, vt2_im, vl);
+
+    /* d1 = s1 * t3 + s2 * t4, d2 = s2 * t3 - s1 * t4 */
+    vfloat32m1_t vd1_re = __riscv_vfmacc_vf_f32m1(__riscv_vfmul_vf_f32m1(vt3_re, MIXED_SIN_2PI_5_F32, vl), MIXED_SIN_4PI_5_F32, vt4_re, vl);
+    vfloat32m1_t vd1_im = __riscv_vfmacc_vf_f32m1(__riscv_vfmul_vf_f32m1(vt3_im, MIXED_SIN_2PI_5_F32, vl), MIXED_SIN_4PI_5_F32, vt4_im, vl);
+    vfloat32m1_t vd2_re = __riscv_vfnmsac_vf_f32m1(__riscv_vfmul_vf_f32m1(vt3_re, MIXED_SIN_4PI_5_F32, vl), MIXED_SIN_2PI_5_F32, vt4_re, vl);
+    vfloat32m1_t vd2_im = __riscv_vfnmsac_vf_f32m1(__riscv_vfmul_vf_f32m1(vt3_im, MIXED_SIN_4PI_5_F32, vl), MIXED_SIN_2PI_5_F32, vt4_im, vl);
+
+    /* y0 = a0 + t1 + t2, y1 = b1 - i * d1, y2 = b2 - i * d2, y3 = b2 + i * d2, y4 = b1 + i * d1 */
+    riscv_cfft_mixed_store_f32(pDst, bsDst, __riscv_vfadd_vv_f32m1(va0_re, __riscv_vfadd_vv_f32m1(vt1_re, vt2_re, vl), vl),
+                               __riscv_vfadd_vv_f32m1(va0_im, __riscv_vfadd_vv_f32m1(vt1_im, vt2_im, vl), vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, bsDst, __riscv_vfadd_vv_f32m1(vb1_re, vd1_im, vl),
+                               __riscv_vfsub_vv_f32m1(vb1_im, vd1_re, vl), pTw, bsTw, vl);
+    riscv_cfft_mixed_store_f32(pDst + 4 * dstStep, bsDst, __riscv_vfadd_vv_f32m1(vb2_re, vd2_im, vl),
+                               __riscv_vfsub_vv_f32m1(vb2_im, vd2_re, vl), pTw2, bsTw, vl);
+    riscv_cfft_mixed_store_f32(pDst + 6 * dstStep, bsDst, __riscv_vfsub_vv_f32m1(vb2_re, vd2_im, vl),
+                               __riscv_vfadd_vv_f32m1(vb2_im, vd2_re, vl), pTw3, bsTw, vl);
+    riscv_cfft_mixed_store_f32(pDst + 8 * dstStep, bsDst, __riscv_vfsub_vv_f32m1(vb1_re, vd1_im, vl),
+                               __riscv_vfadd_vv_f32m1(vb1_im, vd1_re, vl), pTw4, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+      pTw2 += 2 * vl * twStride;
+      pTw3 += 2 * vl * twStride;
+      pTw4 += 2 * vl * twStride;
+    }
+  }
+#else
+  float32_t a0r, a0i, t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  float32_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;
+
+  while (count > 0U)
+  {
+    a0r = pSrc[0];
+    a0i = pSrc[1];
+    t1r = pSrc[2 * srcStep] + pSrc[8 * srcStep];
+    t1i = pSrc[2 * srcStep + 1] + pSrc[8 * srcStep + 1];
+    t3r = pSrc[2 * srcStep] - pSrc[8 * srcStep];
+    t3i = pSrc[2 * srcStep + 1] - pSrc[8 * srcStep + 1];
+    t2r = pSrc[4 * srcStep] + pSrc[6 * srcStep];
+    t2i = pSrc[4 * srcStep + 1] + pSrc[6 * srcStep + 1];
+    t4r = pSrc[4 * srcStep] - pSrc[6 * srcStep];
+    t4i = pSrc[4 * srcStep + 1] - pSrc[6 * srcStep + 1];
+
+    b1r = a0r + MIXED_COS_2PI_5_F32 * t1r + MIXED_COS_4PI_5_F32 * t2r;
+    b1i = a0i + MIXED_COS_2PI_5_F32 * t1i + MIXED_COS_4PI_5_F32 * t2i;
+    b2r = a0r + MIXED_COS_4PI_5_F32 * t1r + MIXED_COS_2PI_5_F32 * t2r;
+    b2i = a0i + MIXED_COS_4PI_5_F32 * t1i + MIXED_COS_2PI_5_F32 * t2i;
+    d1r = MIXED_SIN_2PI_5_F32 * t3r + MIXED_SIN_4PI_5_F32 * t4r;
+    d1i = MIXED_SIN_2PI_5_F32 * t3i + MIXED_SIN_4PI_5_F32 * t4i;
+    d2r = MIXED_SIN_4PI_5_F32 * t3r - MIXED_SIN_2PI_5_F32 * t4r;
+    d2i = MIXED_SIN_4PI_5_F32 * t3i - MIXED_SIN_2PI_5_F32 * t4i;
+
+    riscv_cfft_mixed_store_f32(pDst, a0r + t1r + t2r, a0i + t1i + t2i, NULL);
+    riscv_cfft_mixed_store_f32(pDst + 2 * dstStep, b1r + d1i, b1i - d1r, pTw);
+    riscv_cfft_mixed_store_f32(pDst + 4 * dstStep, b2r + d2i, b2i - d2r, pTw2);
+    riscv_cfft_mixed_store_f32(pDst + 6 * dstStep, b2r - d2i, b2i + d2r, pTw3);
+    riscv_cfft_mixed_store_f32(pDst + 8 * dstStep, b1r - d1i, b1i + d1r, pTw4);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+      pTw2 += 2 * twStride;
+      pTw3 += 2 * twStride;
+      pTw4 += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/*
+ * One Stockham autosort stage: x holds s interleaved sub-transforms of length n = radix * m.
+ * y[q + s * (radix * p + j)] = w_n^(j * p) * sum_k x[q + s * (p + k * m)] * w_radix^(j * k)
+ * The butterflies are run along q when s >= m (unit stride, one twiddle per call),
+ * along p otherwise (strided, one twiddle per butterfly).
+ */
+static void riscv_cfft_mixed_stage_f32(
+        uint32_t radix,
+  const float32_t * pSrc,
+        float32_t * pDst,
+  const float32_t * pTw,
+        uint32_t m,
+        uint32_t s)
+{
+  riscv_cfft_mixed_butterfly_f32 butterfly;
+
+  switch (radix)
+  {
+    case 2U:
+      butterfly = riscv_cfft_mixed_radix2_f32;
+      break;
+    case 3U:
+      butterfly = riscv_cfft_mixed_radix3_f32;
+      break;
+    case 4U:
+      butterfly = riscv_cfft_mixed_radix4_f32;
+      break;
+    default:
+      butterfly = riscv_cfft_mixed_radix5_f32;
+      break;
+  }
+
+  if (s >= m)
+  {
+    for (uint32_t p = 0U; p < m; p++)
+    {
+      butterfly(pSrc + 2U * s * p, 1U, s * m,
+                pDst + 2U * s * radix * p, 1U, s,
+                (p == 0U) ? NULL : pTw + 2U * p, 0U, m,
+                s);
+    }
+  }
+  else
+  {
+    for (uint32_t q = 0U; q < s; q++)
+    {
+      butterfly(pSrc + 2U * q, s, s * m,
+                pDst + 2U * q, s * radix, s,
+                pTw, 1U, m,
+                m);
+    }
+  }
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MixedRadixFFT Mixed-Radix FFT Functions
+
+  @par
+                   The mixed-radix FFT functions compute complex and real FFTs of any length
+                   which is a product of 2, 3 and 5, such as the 12*2^k, 15*2^k and 30*2^k point
+                   transforms used by OFDM and LTE-style workloads. The power of two only
+                   \ref riscv_cfft_f32 remains the fastest choice for power of two lengths.
+  @par
+                   The length is split into radix-4, radix-2, radix-3 and radix-5 stages computed
+                   with a Stockham autosort algorithm: each stage reads one buffer and writes the other,
+                   so the output is in natural order without any bit reversal, and the input buffer is
+                   not modified. The same API and the same instance structures are used with and without
+                   the RVV extension; the RVV version vectorizes every butterfly stage.
+  @par
+                   The twiddle factors are not stored in flash. The initialization function computes them
+                   into a buffer provided by the caller, which must stay valid while the instance is used.
+                   Its length is given by \ref riscv_cfft_mixed_twiddle_buffer_size and
+                   \ref riscv_rfft_mixed_twiddle_buffer_size.
+  @par
+                   The forward floating-point transform is not scaled and the inverse one is scaled by 1/fftLen.
+                   The Q31 and Q15 transforms scale each stage by 1/radix to avoid overflows, so both
+                   the forward and the inverse transforms are scaled down by 1/fftLen.
+  @par
+                   The real transforms \ref riscv_rfft_mixed_f32, \ref riscv_rfft_mixed_q31 and
+                   \ref riscv_rfft_mixed_q15 use a fftLen/2 points mixed-radix CFFT, fftLen/2 must be a
+                   product of 2, 3 and 5. The output uses the same packed format as \ref riscv_rfft_fast_f32
+                   for all datatypes: fftLen real values, the Nyquist value being stored in the imaginary part of
+                   the DC value.
+ */
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix complex FFT.
+  @param[in]     S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     pIn            points to the complex input buffer of size <code>2*fftLen</code>, not modified
+  @param[out]    pOut           points to the complex output buffer of size <code>2*fftLen</code>
+  @param[in]     pBuffer        points to a temporary buffer of size <code>2*fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           pIn, pOut and pBuffer must be three different buffers.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_cfft_mixed_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pIn,
+        float32_t * pOut,
+        float32_t * pBuffer,
+        uint8_t ifftFlag)
+{
+  const uint32_t fftLen = S->fftLen;
+  const float32_t *pTw = S->pTwiddle;
+  const float32_t *pSrc = pIn;
+  float32_t *pDst;
+  uint32_t n = fftLen;
+  uint32_t s = 1U;
+  uint32_t radix, m;
+
+  /* The last stage must write pOut */
+  pDst = (S->numStages & 1U) ? pOut : pBuffer;
+
+  /* The inverse transform is computed as conj(FFT(conj(x))) / fftLen,
+     the input is conjugated into the buffer the first stage does not write */
+  if (ifftFlag)
+  {
+    float32_t *pConj = (pDst == pOut) ? pBuffer : pOut;
+    riscv_cmplx_conj_f32(pIn, pConj, fftLen);
+    pSrc = pConj;
+  }
+
+  for (uint16_t stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->factors[stage];
+    m = n / radix;
+
+    riscv_cfft_mixed_stage_f32(radix, pSrc, pDst, pTw, m, s);
+
+    pTw += 2U * (radix - 1U) * m;
+    n = m;
+    s *= radix;
+    pSrc = pDst;
+    pDst = (pDst == pOut) ? pBuffer : pOut;
+  }
+
+  if (ifftFlag)
+  {
+    riscv_cmplx_conj_f32(pOut, pOut, fftLen);
+    riscv_scale_f32(pOut, 1.0f / (float32_t)fftLen, pOut, 2U * fftLen);
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
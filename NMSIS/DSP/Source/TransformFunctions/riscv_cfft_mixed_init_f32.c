@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix cfft f32 instance
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix complex FFT.
+  @param[in,out] S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen         length of the FFT, a product of 2, 3 and 5 (at least 2)
+  @param[out]    pTwiddle       points to the twiddle buffer filled by this function, of
+                                riscv_cfft_mixed_twiddle_buffer_size(RISCV_MATH_F32, fftLen) values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen is not a product of 2, 3 and 5
+
+  @par           The twiddle factors are computed in double precision. The twiddle buffer can be
+                 shared by instances of the same length and must stay valid while they are used.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_cfft_mixed_init_f32(
+  riscv_cfft_mixed_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle)
+{
+  uint32_t n = fftLen;
+  uint32_t s = 1U;
+  uint32_t radix, m;
+  float64_t angle;
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->numStages = riscv_cfft_mixed_factorize(fftLen, S->factors);
+  if (S->numStages == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint16_t stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->factors[stage];
+    m = n / radix;
+
+    /* w_n^(j*p) = exp(-2*pi*i * j*p*s / fftLen) with n = fftLen / s */
+    for (uint32_t j = 1U; j < radix; j++)
+    {
+      for (uint32_t p = 0U; p < m; p++)
+      {
+        angle = RISCV_CFFT_MIXED_2PI * (float64_t)(j * p * s) / (float64_t)fftLen;
+        *pTwiddle++ = (float32_t)cos(angle);
+        *pTwiddle++ = (float32_t)-sin(angle);
+      }
+    }
+
+    n = m;
+    s *= radix;
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
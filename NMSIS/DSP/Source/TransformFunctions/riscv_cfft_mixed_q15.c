@@ -0,0 +1,599 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_cfft_mixed_q15.c
+ * Description:  Mixed-radix Complex FFT Q15 process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#define MIXED_ONE_THIRD_Q15     ((q15_t)0x2AAB)    /* 1/3 */
+#define MIXED_ONE_FIFTH_Q15     ((q15_t)0x199A)    /* 1/5 */
+#define MIXED_SIN_PI_3_Q15      ((q15_t)0x6EDA)    /* sin(2*pi/3) */
+#define MIXED_COS_2PI_5_Q15     ((q15_t)0x278E)    /* cos(2*pi/5) */
+#define MIXED_COS_4PI_5_Q15     ((q15_t)0x9872)    /* cos(4*pi/5) */
+#define MIXED_SIN_2PI_5_Q15     ((q15_t)0x79BC)    /* sin(2*pi/5) */
+#define MIXED_SIN_4PI_5_Q15     ((q15_t)0x4B3D)    /* sin(4*pi/5) */
+
+/*
+ * All butterflies below compute `count` independent forward DFTs of size radix, with the
+ * inputs scaled by 1/radix. Butterfly i reads input k at complex index i * srcStride + k * srcStep,
+ * writes output j at complex index i * dstStride + j * dstStep, after a multiplication by the
+ * twiddle factor at complex index i * twStride + (j - 1) * twStep. pTw is NULL when all twiddles are 1.
+ */
+typedef void (*riscv_cfft_mixed_butterfly_q15)(
+  const q15_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        q15_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const q15_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/* Load input k of the butterflies */
+__STATIC_FORCEINLINE vint16m1x2_t riscv_cfft_mixed_load_q15(
+  const q15_t * pSrc, ptrdiff_t bsSrc, size_t vl)
+{
+    return __riscv_vlsseg2e16_v_i16m1x2(pSrc, bsSrc, vl);
+}
+
+/* Store (re, im) as output j, after the twiddle multiplication when there is one */
+__STATIC_FORCEINLINE void riscv_cfft_mixed_store_q15(
+  q15_t * pDst, ptrdiff_t bsDst,
+  vint16m1_t re, vint16m1_t im,
+  const q15_t * pTw, ptrdiff_t bsTw, size_t vl)
+{
+    vint16m1x2_t v_tuple;
+    if (pTw != NULL)
+    {
+        /* stride 0 broadcasts a single twiddle */
+        v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pTw, bsTw, vl);
+        vint16m1_t vtwd_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+        vint16m1_t vtwd_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+        vint16m1_t vre = __riscv_vssub_vv_i16m1(__riscv_vsmul_vv_i16m1(re, vtwd_re, __RISCV_VXRM_RNU, vl),
+                                                __riscv_vsmul_vv_i16m1(im, vtwd_im, __RISCV_VXRM_RNU, vl), vl);
+        vint16m1_t vim = __riscv_vsadd_vv_i16m1(__riscv_vsmul_vv_i16m1(im, vtwd_re, __RISCV_VXRM_RNU, vl),
+                                                __riscv_vsmul_vv_i16m1(re, vtwd_im, __RISCV_VXRM_RNU, vl), vl);
+        re = vre;
+        im = vim;
+    }
+    v_tuple = __riscv_vset_v_i16m1_i16m1x2(__riscv_vundefined_i16m1x2(), 0, re);
+    v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, im);
+    __riscv_vssseg2e16_v_i16m1x2(pDst, bsDst, v_tuple, vl);
+}
+#else
+__STATIC_FORCEINLINE q15_t riscv_cfft_mixed_mult_q15(q15_t a, q15_t b)
+{
+  return (q15_t)(((q31_t)a * b) >> 15);
+}
+
+/* Store (re, im) as output j, after the twiddle multiplication when there is one */
+__STATIC_FORCEINLINE void riscv_cfft_mixed_store_q15(
+  q15_t * pDst,
+  q31_t re, q31_t im,
+  const q15_t * pTw)
+{
+  q15_t out_re = clip_q31_to_q15(re);
+  q15_t out_im = clip_q31_to_q15(im);
+
+  if (pTw != NULL)
+  {
+    pDst[0] = clip_q31_to_q15(((q31_t)out_re * pTw[0] - (q31_t)out_im * pTw[1]) >> 15);
+    pDst[1] = clip_q31_to_q15(((q31_t)out_im * pTw[0] + (q31_t)out_re * pTw[1]) >> 15);
+  }
+  else
+  {
+    pDst[0] = out_re;
+    pDst[1] = out_im;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+static void riscv_cfft_mixed_radix2_q15(
+  const q15_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        q15_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const q15_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  (void)twStep;
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const ptrdiff_t bsSrc = 4 * srcStride, bsDst = 4 * dstStride, bsTw = 4 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e16m1(count)) > 0; count -= vl)
+  {
+    vint16m1x2_t v_tuple = riscv_cfft_mixed_load_q15(pSrc, bsSrc, vl);
+    vint16m1_t va_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 1, vl);
+    vint16m1_t va_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 1, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 2 * srcStep, bsSrc, vl);
+    vint16m1_t vb_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 1, vl);
+    vint16m1_t vb_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 1, vl);
+
+    riscv_cfft_mixed_store_q15(pDst, bsDst, __riscv_vadd_vv_i16m1(va_re, vb_re, vl),
+                               __riscv_vadd_vv_i16m1(va_im, vb_im, vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, bsDst, __riscv_vsub_vv_i16m1(va_re, vb_re, vl),
+                               __riscv_vsub_vv_i16m1(va_im, vb_im, vl), pTw, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+    }
+  }
+#else
+  q15_t ar, ai, br, bi;
+
+  while (count > 0U)
+  {
+    ar = pSrc[0] >> 1;
+    ai = pSrc[1] >> 1;
+    br = pSrc[2 * srcStep] >> 1;
+    bi = pSrc[2 * srcStep + 1] >> 1;
+
+    riscv_cfft_mixed_store_q15(pDst, (q31_t)ar + br, (q31_t)ai + bi, NULL);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, (q31_t)ar - br, (q31_t)ai - bi, pTw);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+static void riscv_cfft_mixed_radix3_q15(
+  const q15_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        q15_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const q15_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  const q15_t *pTw2 = (pTw != NULL) ? pTw + 2 * twStep : NULL;
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const ptrdiff_t bsSrc = 4 * srcStride, bsDst = 4 * dstStride, bsTw = 4 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e16m1(count)) > 0; count -= vl)
+  {
+    vint16m1x2_t v_tuple = riscv_cfft_mixed_load_q15(pSrc, bsSrc, vl);
+    vint16m1_t va0_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_THIRD_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va0_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_THIRD_Q15, __RISCV_VXRM_RNU, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 2 * srcStep, bsSrc, vl);
+    vint16m1_t va1_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_THIRD_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va1_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_THIRD_Q15, __RISCV_VXRM_RNU, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 4 * srcStep, bsSrc, vl);
+    vint16m1_t va2_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_THIRD_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va2_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_THIRD_Q15, __RISCV_VXRM_RNU, vl);
+
+    /* t1 = a1 + a2, t2 = a0 - t1 / 2, t3 = sin(2*pi/3) * (a1 - a2) */
+    vint16m1_t vt1_re = __riscv_vadd_vv_i16m1(va1_re, va2_re, vl);
+    vint16m1_t vt1_im = __riscv_vadd_vv_i16m1(va1_im, va2_im, vl);
+    vint16m1_t vt2_re = __riscv_vsub_vv_i16m1(va0_re, __riscv_vsra_vx_i16m1(vt1_re, 1, vl), vl);
+    vint16m1_t vt2_im = __riscv_vsub_vv_i16m1(va0_im, __riscv_vsra_vx_i16m1(vt1_im, 1, vl), vl);
+    vint16m1_t vt3_re = __riscv_vsmul_vx_i16m1(__riscv_vsub_vv_i16m1(va1_re, va2_re, vl), MIXED_SIN_PI_3_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t vt3_im = __riscv_vsmul_vx_i16m1(__riscv_vsub_vv_i16m1(va1_im, va2_im, vl), MIXED_SIN_PI_3_Q15, __RISCV_VXRM_RNU, vl);
+
+    /* y0 = a0 + t1, y1 = t2 - i * t3, y2 = t2 + i * t3 */
+    riscv_cfft_mixed_store_q15(pDst, bsDst, __riscv_vsadd_vv_i16m1(va0_re, vt1_re, vl),
+                               __riscv_vsadd_vv_i16m1(va0_im, vt1_im, vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, bsDst, __riscv_vsadd_vv_i16m1(vt2_re, vt3_im, vl),
+                               __riscv_vssub_vv_i16m1(vt2_im, vt3_re, vl), pTw, bsTw, vl);
+    riscv_cfft_mixed_store_q15(pDst + 4 * dstStep, bsDst, __riscv_vssub_vv_i16m1(vt2_re, vt3_im, vl),
+                               __riscv_vsadd_vv_i16m1(vt2_im, vt3_re, vl), pTw2, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+      pTw2 += 2 * vl * twStride;
+    }
+  }
+#else
+  q15_t a0r, a0i, a1r, a1i, a2r, a2i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+  while (count > 0U)
+  {
+    a0r = riscv_cfft_mixed_mult_q15(pSrc[0], MIXED_ONE_THIRD_Q15);
+    a0i = riscv_cfft_mixed_mult_q15(pSrc[1], MIXED_ONE_THIRD_Q15);
+    a1r = riscv_cfft_mixed_mult_q15(pSrc[2 * srcStep], MIXED_ONE_THIRD_Q15);
+    a1i = riscv_cfft_mixed_mult_q15(pSrc[2 * srcStep + 1], MIXED_ONE_THIRD_Q15);
+    a2r = riscv_cfft_mixed_mult_q15(pSrc[4 * srcStep], MIXED_ONE_THIRD_Q15);
+    a2i = riscv_cfft_mixed_mult_q15(pSrc[4 * srcStep + 1], MIXED_ONE_THIRD_Q15);
+
+    t1r = a1r + a2r;
+    t1i = a1i + a2i;
+    t2r = a0r - (t1r >> 1);
+    t2i = a0i - (t1i >> 1);
+    t3r = riscv_cfft_mixed_mult_q15(a1r - a2r, MIXED_SIN_PI_3_Q15);
+    t3i = riscv_cfft_mixed_mult_q15(a1i - a2i, MIXED_SIN_PI_3_Q15);
+
+    riscv_cfft_mixed_store_q15(pDst, (q31_t)a0r + t1r, (q31_t)a0i + t1i, NULL);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, (q31_t)t2r + t3i, (q31_t)t2i - t3r, pTw);
+    riscv_cfft_mixed_store_q15(pDst + 4 * dstStep, (q31_t)t2r - t3i, (q31_t)t2i + t3r, pTw2);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+      pTw2 += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+static void riscv_cfft_mixed_radix4_q15(
+  const q15_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        q15_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const q15_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  const q15_t *pTw2 = (pTw != NULL) ? pTw + 2 * twStep : NULL;
+  const q15_t *pTw3 = (pTw != NULL) ? pTw + 4 * twStep : NULL;
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const ptrdiff_t bsSrc = 4 * srcStride, bsDst = 4 * dstStride, bsTw = 4 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e16m1(count)) > 0; count -= vl)
+  {
+    vint16m1x2_t v_tuple = riscv_cfft_mixed_load_q15(pSrc, bsSrc, vl);
+    vint16m1_t va0_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 2, vl);
+    vint16m1_t va0_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 2, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 2 * srcStep, bsSrc, vl);
+    vint16m1_t va1_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 2, vl);
+    vint16m1_t va1_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 2, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 4 * srcStep, bsSrc, vl);
+    vint16m1_t va2_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 2, vl);
+    vint16m1_t va2_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 2, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 6 * srcStep, bsSrc, vl);
+    vint16m1_t va3_re = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), 2, vl);
+    vint16m1_t va3_im = __riscv_vsra_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), 2, vl);
+
+    vint16m1_t vt0_re = __riscv_vadd_vv_i16m1(va0_re, va2_re, vl);
+    vint16m1_t vt0_im = __riscv_vadd_vv_i16m1(va0_im, va2_im, vl);
+    vint16m1_t vt1_re = __riscv_vsub_vv_i16m1(va0_re, va2_re, vl);
+    vint16m1_t vt1_im = __riscv_vsub_vv_i16m1(va0_im, va2_im, vl);
+    vint16m1_t vt2_re = __riscv_vadd_vv_i16m1(va1_re, va3_re, vl);
+    vint16m1_t vt2_im = __riscv_vadd_vv_i16m1(va1_im, va3_im, vl);
+    vint16m1_t vt3_re = __riscv_vsub_vv_i16m1(va1_re, va3_re, vl);
+    vint16m1_t vt3_im = __riscv_vsub_vv_i16m1(va1_im, va3_im, vl);
+
+    /* y0 = t0 + t2, y1 = t1 - i * t3, y2 = t0 - t2, y3 = t1 + i * t3 */
+    riscv_cfft_mixed_store_q15(pDst, bsDst, __riscv_vsadd_vv_i16m1(vt0_re, vt2_re, vl),
+                               __riscv_vsadd_vv_i16m1(vt0_im, vt2_im, vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, bsDst, __riscv_vsadd_vv_i16m1(vt1_re, vt3_im, vl),
+                               __riscv_vssub_vv_i16m1(vt1_im, vt3_re, vl), pTw, bsTw, vl);
+    riscv_cfft_mixed_store_q15(pDst + 4 * dstStep, bsDst, __riscv_vssub_vv_i16m1(vt0_re, vt2_re, vl),
+                               __riscv_vssub_vv_i16m1(vt0_im, vt2_im, vl), pTw2, bsTw, vl);
+    riscv_cfft_mixed_store_q15(pDst + 6 * dstStep, bsDst, __riscv_vssub_vv_i16m1(vt1_re, vt3_im, vl),
+                               __riscv_vsadd_vv_i16m1(vt1_im, vt3_re, vl), pTw3, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+      pTw2 += 2 * vl * twStride;
+      pTw3 += 2 * vl * twStride;
+    }
+  }
+#else
+  q15_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+  while (count > 0U)
+  {
+    t0r = (pSrc[0] >> 2) + (pSrc[4 * srcStep] >> 2);
+    t0i = (pSrc[1] >> 2) + (pSrc[4 * srcStep + 1] >> 2);
+    t1r = (pSrc[0] >> 2) - (pSrc[4 * srcStep] >> 2);
+    t1i = (pSrc[1] >> 2) - (pSrc[4 * srcStep + 1] >> 2);
+    t2r = (pSrc[2 * srcStep] >> 2) + (pSrc[6 * srcStep] >> 2);
+    t2i = (pSrc[2 * srcStep + 1] >> 2) + (pSrc[6 * srcStep + 1] >> 2);
+    t3r = (pSrc[2 * srcStep] >> 2) - (pSrc[6 * srcStep] >> 2);
+    t3i = (pSrc[2 * srcStep + 1] >> 2) - (pSrc[6 * srcStep + 1] >> 2);
+
+    riscv_cfft_mixed_store_q15(pDst, (q31_t)t0r + t2r, (q31_t)t0i + t2i, NULL);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, (q31_t)t1r + t3i, (q31_t)t1i - t3r, pTw);
+    riscv_cfft_mixed_store_q15(pDst + 4 * dstStep, (q31_t)t0r - t2r, (q31_t)t0i - t2i, pTw2);
+    riscv_cfft_mixed_store_q15(pDst + 6 * dstStep, (q31_t)t1r - t3i, (q31_t)t1i + t3r, pTw3);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+      pTw2 += 2 * twStride;
+      pTw3 += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+static void riscv_cfft_mixed_radix5_q15(
+  const q15_t * pSrc, uint32_t srcStride, uint32_t srcStep,
+        q15_t * pDst, uint32_t dstStride, uint32_t dstStep,
+  const q15_t * pTw, uint32_t twStride, uint32_t twStep,
+        uint32_t count)
+{
+  const q15_t *pTw2 = (pTw != NULL) ? pTw + 2 * twStep : NULL;
+  const q15_t *pTw3 = (pTw != NULL) ? pTw + 4 * twStep : NULL;
+  const q15_t *pTw4 = (pTw != NULL) ? pTw + 6 * twStep : NULL;
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const ptrdiff_t bsSrc = 4 * srcStride, bsDst = 4 * dstStride, bsTw = 4 * twStride;
+  size_t vl;
+
+  for (; (vl = __riscv_vsetvl_e16m1(count)) > 0; count -= vl)
+  {
+    vint16m1x2_t v_tuple = riscv_cfft_mixed_load_q15(pSrc, bsSrc, vl);
+    vint16m1_t va0_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va0_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 2 * srcStep, bsSrc, vl);
+    vint16m1_t va1_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va1_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 8 * srcStep, bsSrc, vl);
+    vint16m1_t va4_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va4_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+
+    /* t1 = a1 + a4, t3 = a1 - a4 */
+    vint16m1_t vt1_re = __riscv_vadd_vv_i16m1(va1_re, va4_re, vl);
+    vint16m1_t vt1_im = __riscv_vadd_vv_i16m1(va1_im, va4_im, vl);
+    vint16m1_t vt3_re = __riscv_vsub_vv_i16m1(va1_re, va4_re, vl);
+    vint16m1_t vt3_im = __riscv_vsub_vv_i16m1(va1_im, va4_im, vl);
+
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 4 * srcStep, bsSrc, vl);
+    vint16m1_t va2_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va2_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    v_tuple = riscv_cfft_mixed_load_q15(pSrc + 6 * srcStep, bsSrc, vl);
+    vint16m1_t va3_re = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 0), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+    vint16m1_t va3_im = __riscv_vsmul_vx_i16m1(__riscv_vget_v_i16m1x2_i16m1(v_tuple, 1), MIXED_ONE_FIFTH_Q15, __RISCV_VXRM_RNU, vl);
+
+    /* t2 = a2 + a3, t4 = a2 - a3 */
+    vint16m1_t vt2_re = __riscv_vadd_vv_i16m1(va2_re, va3_re, vl);
+    vint16m1_t vt2_im = __riscv_vadd_vv_i16m1(va2_im, va3_im, vl);
+    vint16m1_t vt4_re = __riscv_vsub_vv_i16m1(va2_re, va3_re, vl);
+    vint16m1_t vt4_im = __riscv_vsub_vv_i16m1(va2_im, va3_im, vl);
+
+    /* b1 = a0 + c1 * t1 + c2 * t2, b2 = a0 + c2 * t1 + c1 * t2 */
+    vint16m1_t vb1_re = __riscv_vadd_vv_i16m1(va0_re, __riscv_vadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vt1_re, MIXED_COS_2PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                                                            __riscv_vsmul_vx_i16m1(vt2_re, MIXED_COS_4PI_5_Q15, __RISCV_VXRM_RNU, vl), vl), vl);
+    vint16m1_t vb1_im = __riscv_vadd_vv_i16m1(va0_im, __riscv_vadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vt1_im, MIXED_COS_2PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                                                            __riscv_vsmul_vx_i16m1(vt2_im, MIXED_COS_4PI_5_Q15, __RISCV_VXRM_RNU, vl), vl), vl);
+    vint16m1_t vb2_re = __riscv_vadd_vv_i16m1(va0_re, __riscv_vadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vt1_re, MIXED_COS_4PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                                                            __riscv_vsmul_vx_i16m1(vt2_re, MIXED_COS_2PI_5_Q15, __RISCV_VXRM_RNU, vl), vl), vl);
+    vint16m1_t vb2_im = __riscv_vadd_vv_i16m1(va0_im, __riscv_vadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vt1_im, MIXED_COS_4PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                                                            __riscv_vsmul_vx_i16m1(vt2_im, MIXED_COS_2PI_5_Q15, __RISCV_VXRM_RNU, vl), vl), vl);
+
+    /* d1 = s1 * t3 + s2 * t4, d2 = s2 * t3 - s1 * t4 */
+    vint16m1_t vd1_re = __riscv_vadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vt3_re, MIXED_SIN_2PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                              __riscv_vsmul_vx_i16m1(vt4_re, MIXED_SIN_4PI_5_Q15, __RISCV_VXRM_RNU, vl), vl);
+    vint16m1_t vd1_im = __riscv_vadd_vv_i16m1(__riscv_vsmul_vx_i16m1(vt3_im, MIXED_SIN_2PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                              __riscv_vsmul_vx_i16m1(vt4_im, MIXED_SIN_4PI_5_Q15, __RISCV_VXRM_RNU, vl), vl);
+    vint16m1_t vd2_re = __riscv_vsub_vv_i16m1(__riscv_vsmul_vx_i16m1(vt3_re, MIXED_SIN_4PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                              __riscv_vsmul_vx_i16m1(vt4_re, MIXED_SIN_2PI_5_Q15, __RISCV_VXRM_RNU, vl), vl);
+    vint16m1_t vd2_im = __riscv_vsub_vv_i16m1(__riscv_vsmul_vx_i16m1(vt3_im, MIXED_SIN_4PI_5_Q15, __RISCV_VXRM_RNU, vl),
+                                              __riscv_vsmul_vx_i16m1(vt4_im, MIXED_SIN_2PI_5_Q15, __RISCV_VXRM_RNU, vl), vl);
+
+    /* y0 = a0 + t1 + t2, y1 = b1 - i * d1, y2 = b2 - i * d2, y3 = b2 + i * d2, y4 = b1 + i * d1 */
+    riscv_cfft_mixed_store_q15(pDst, bsDst, __riscv_vsadd_vv_i16m1(va0_re, __riscv_vadd_vv_i16m1(vt1_re, vt2_re, vl), vl),
+                               __riscv_vsadd_vv_i16m1(va0_im, __riscv_vadd_vv_i16m1(vt1_im, vt2_im, vl), vl), NULL, 0, vl);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, bsDst, __riscv_vsadd_vv_i16m1(vb1_re, vd1_im, vl),
+                               __riscv_vssub_vv_i16m1(vb1_im, vd1_re, vl), pTw, bsTw, vl);
+    riscv_cfft_mixed_store_q15(pDst + 4 * dstStep, bsDst, __riscv_vsadd_vv_i16m1(vb2_re, vd2_im, vl),
+                               __riscv_vssub_vv_i16m1(vb2_im, vd2_re, vl), pTw2, bsTw, vl);
+    riscv_cfft_mixed_store_q15(pDst + 6 * dstStep, bsDst, __riscv_vssub_vv_i16m1(vb2_re, vd2_im, vl),
+                               __riscv_vsadd_vv_i16m1(vb2_im, vd2_re, vl), pTw3, bsTw, vl);
+    riscv_cfft_mixed_store_q15(pDst + 8 * dstStep, bsDst, __riscv_vssub_vv_i16m1(vb1_re, vd1_im, vl),
+                               __riscv_vsadd_vv_i16m1(vb1_im, vd1_re, vl), pTw4, bsTw, vl);
+
+    pSrc += 2 * vl * srcStride;
+    pDst += 2 * vl * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * vl * twStride;
+      pTw2 += 2 * vl * twStride;
+      pTw3 += 2 * vl * twStride;
+      pTw4 += 2 * vl * twStride;
+    }
+  }
+#else
+  q15_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;
+  q15_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  q15_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;
+
+  while (count > 0U)
+  {
+    a0r = riscv_cfft_mixed_mult_q15(pSrc[0], MIXED_ONE_FIFTH_Q15);
+    a0i = riscv_cfft_mixed_mult_q15(pSrc[1], MIXED_ONE_FIFTH_Q15);
+    a1r = riscv_cfft_mixed_mult_q15(pSrc[2 * srcStep], MIXED_ONE_FIFTH_Q15);
+    a1i = riscv_cfft_mixed_mult_q15(pSrc[2 * srcStep + 1], MIXED_ONE_FIFTH_Q15);
+    a2r = riscv_cfft_mixed_mult_q15(pSrc[4 * srcStep], MIXED_ONE_FIFTH_Q15);
+    a2i = riscv_cfft_mixed_mult_q15(pSrc[4 * srcStep + 1], MIXED_ONE_FIFTH_Q15);
+    a3r = riscv_cfft_mixed_mult_q15(pSrc[6 * srcStep], MIXED_ONE_FIFTH_Q15);
+    a3i = riscv_cfft_mixed_mult_q15(pSrc[6 * srcStep + 1], MIXED_ONE_FIFTH_Q15);
+    a4r = riscv_cfft_mixed_mult_q15(pSrc[8 * srcStep], MIXED_ONE_FIFTH_Q15);
+    a4i = riscv_cfft_mixed_mult_q15(pSrc[8 * srcStep + 1], MIXED_ONE_FIFTH_Q15);
+
+    t1r = a1r + a4r;
+    t1i = a1i + a4i;
+    t3r = a1r - a4r;
+    t3i = a1i - a4i;
+    t2r = a2r + a3r;
+    t2i = a2i + a3i;
+    t4r = a2r - a3r;
+    t4i = a2i - a3i;
+
+    b1r = a0r + riscv_cfft_mixed_mult_q15(t1r, MIXED_COS_2PI_5_Q15) + riscv_cfft_mixed_mult_q15(t2r, MIXED_COS_4PI_5_Q15);
+    b1i = a0i + riscv_cfft_mixed_mult_q15(t1i, MIXED_COS_2PI_5_Q15) + riscv_cfft_mixed_mult_q15(t2i, MIXED_COS_4PI_5_Q15);
+    b2r = a0r + riscv_cfft_mixed_mult_q15(t1r, MIXED_COS_4PI_5_Q15) + riscv_cfft_mixed_mult_q15(t2r, MIXED_COS_2PI_5_Q15);
+    b2i = a0i + riscv_cfft_mixed_mult_q15(t1i, MIXED_COS_4PI_5_Q15) + riscv_cfft_mixed_mult_q15(t2i, MIXED_COS_2PI_5_Q15);
+    d1r = riscv_cfft_mixed_mult_q15(t3r, MIXED_SIN_2PI_5_Q15) + riscv_cfft_mixed_mult_q15(t4r, MIXED_SIN_4PI_5_Q15);
+    d1i = riscv_cfft_mixed_mult_q15(t3i, MIXED_SIN_2PI_5_Q15) + riscv_cfft_mixed_mult_q15(t4i, MIXED_SIN_4PI_5_Q15);
+    d2r = riscv_cfft_mixed_mult_q15(t3r, MIXED_SIN_4PI_5_Q15) - riscv_cfft_mixed_mult_q15(t4r, MIXED_SIN_2PI_5_Q15);
+    d2i = riscv_cfft_mixed_mult_q15(t3i, MIXED_SIN_4PI_5_Q15) - riscv_cfft_mixed_mult_q15(t4i, MIXED_SIN_2PI_5_Q15);
+
+    riscv_cfft_mixed_store_q15(pDst, (q31_t)a0r + t1r + t2r, (q31_t)a0i + t1i + t2i, NULL);
+    riscv_cfft_mixed_store_q15(pDst + 2 * dstStep, (q31_t)b1r + d1i, (q31_t)b1i - d1r, pTw);
+    riscv_cfft_mixed_store_q15(pDst + 4 * dstStep, (q31_t)b2r + d2i, (q31_t)b2i - d2r, pTw2);
+    riscv_cfft_mixed_store_q15(pDst + 6 * dstStep, (q31_t)b2r - d2i, (q31_t)b2i + d2r, pTw3);
+    riscv_cfft_mixed_store_q15(pDst + 8 * dstStep, (q31_t)b1r - d1i, (q31_t)b1i + d1r, pTw4);
+
+    pSrc += 2 * srcStride;
+    pDst += 2 * dstStride;
+    if (pTw != NULL)
+    {
+      pTw += 2 * twStride;
+      pTw2 += 2 * twStride;
+      pTw3 += 2 * twStride;
+      pTw4 += 2 * twStride;
+    }
+    count--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/*
+ * One Stockham autosort stage, see riscv_cfft_mixed_f32.c
+ */
+static void riscv_cfft_mixed_stage_q15(
+        uint32_t radix,
+  const q15_t * pSrc,
+        q15_t * pDst,
+  const q15_t * pTw,
+        uint32_t m,
+        uint32_t s)
+{
+  riscv_cfft_mixed_butterfly_q15 butterfly;
+
+  switch (radix)
+  {
+    case 2U:
+      butterfly = riscv_cfft_mixed_radix2_q15;
+      break;
+    case 3U:
+      butterfly = riscv_cfft_mixed_radix3_q15;
+      break;
+    case 4U:
+      butterfly = riscv_cfft_mixed_radix4_q15;
+      break;
+    default:
+      butterfly = riscv_cfft_mixed_radix5_q15;
+      break;
+  }
+
+  if (s >= m)
+  {
+    for (uint32_t p = 0U; p < m; p++)
+    {
+      butterfly(pSrc + 2U * s * p, 1U, s * m,
+                pDst + 2U * s * radix * p, 1U, s,
+                (p == 0U) ? NULL : pTw + 2U * p, 0U, m,
+                s);
+    }
+  }
+  else
+  {
+    for (uint32_t q = 0U; q < s; q++)
+    {
+      butterfly(pSrc + 2U * q, s, s * m,
+                pDst + 2U * q, s * radix, s,
+                pTw, 1U, m,
+                m);
+    }
+  }
+}
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 mixed-radix complex FFT.
+  @param[in]     S              points to an instance of the Q15 mixed-radix CFFT structure
+  @param[in]     pIn            points to the complex input buffer of size <code>2*fftLen</code>, not modified
+  @param[out]    pOut           points to the complex output buffer of size <code>2*fftLen</code>
+  @param[in]     pBuffer        points to a temporary buffer of size <code>2*fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           pIn, pOut and pBuffer must be three different buffers.
+  @par           Each stage scales its input down by its radix, so the forward and the inverse
+                 transforms are both scaled down by 1/fftLen.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_cfft_mixed_q15(
+  const riscv_cfft_mixed_instance_q15 * S,
+  const q15_t * pIn,
+        q15_t * pOut,
+        q15_t * pBuffer,
+        uint8_t ifftFlag)
+{
+  const uint32_t fftLen = S->fftLen;
+  const q15_t *pTw = S->pTwiddle;
+  const q15_t *pSrc = pIn;
+  q15_t *pDst;
+  uint32_t n = fftLen;
+  uint32_t s = 1U;
+  uint32_t radix, m;
+
+  /* The last stage must write pOut */
+  pDst = (S->numStages & 1U) ? pOut : pBuffer;
+
+  /* The inverse transform is computed as conj(FFT(conj(x))),
+     the input is conjugated into the buffer the first stage does not write */
+  if (ifftFlag)
+  {
+    q15_t *pConj = (pDst == pOut) ? pBuffer : pOut;
+    riscv_cmplx_conj_q15(pIn, pConj, fftLen);
+    pSrc = pConj;
+  }
+
+  for (uint16_t stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->factors[stage];
+    m = n / radix;
+
+    riscv_cfft_mixed_stage_q15(radix, pSrc, pDst, pTw, m, s);
+
+    pTw += 2U * (radix - 1U) * m;
+    n = m;
+    s *= radix;
+    pSrc = pDst;
+    pDst = (pDst == pOut) ? pBuffer : pOut;
+  }
+
+  if (ifftFlag)
+  {
+    riscv_cmplx_conj_q15(pOut, pOut, fftLen);
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
@@ -83,12 +83,144 @@ RISCV_DSP_ATTRIBUTE void riscv_cfft_radix2_q15(
   @} end of ComplexFFTDeprecated group
  */
 
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * vl radix-2 butterflies whose first legs are bstride bytes apart, the legs being n2 complex
+ * values apart. The twiddle of a butterfly is read from pCoef + 2 * ia, the twiddles of
+ * consecutive butterflies being wstride bytes apart. As in the scalar implementation, the first
+ * stage scales down by 4, the middle stages by 2 and the last stage, which has no twiddles,
+ * does not scale.
+ */
+static void riscv_radix2_rvv_kernel_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint32_t n2,
+        ptrdiff_t bstride,
+  const q15_t * pCoef,
+        uint32_t ia,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  q15_t *pB = pSrc + 2U * n2;
+  vint16m1x2_t v_tuple;
+  vint16m1_t va_re, va_im, vb_re, vb_im, vxt, vyt, vco, vsi;
+
+  v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pSrc, bstride, vl);
+  va_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+  va_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pB, bstride, vl);
+  vb_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+  vb_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+
+  if (2U * n2 == fftLen)
+  {
+    va_re = __riscv_vsra_vx_i16m1(va_re, 1U, vl);
+    va_im = __riscv_vsra_vx_i16m1(va_im, 1U, vl);
+    vb_re = __riscv_vsra_vx_i16m1(vb_re, 1U, vl);
+    vb_im = __riscv_vsra_vx_i16m1(vb_im, 1U, vl);
+  }
+
+  vxt = __riscv_vsub_vv_i16m1(va_re, vb_re, vl);
+  vyt = __riscv_vsub_vv_i16m1(va_im, vb_im, vl);
+
+  if (n2 > 1U)
+  {
+    /* a' = (a + b) / 2, b' = (a - b) * W / 2 */
+    va_re = __riscv_vaadd_vv_i16m1(va_re, vb_re, __RISCV_VXRM_RDN, vl);
+    va_im = __riscv_vaadd_vv_i16m1(va_im, vb_im, __RISCV_VXRM_RDN, vl);
+
+    v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pCoef + 2U * ia, wstride, vl);
+    vco = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vsi = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+    vb_re = __riscv_vmulh_vv_i16m1(vxt, vco, vl);
+    vb_im = __riscv_vmulh_vv_i16m1(vyt, vco, vl);
+    if (ifftFlag == 0U)
+    {
+      vb_re = __riscv_vadd_vv_i16m1(vb_re, __riscv_vmulh_vv_i16m1(vyt, vsi, vl), vl);
+      vb_im = __riscv_vsub_vv_i16m1(vb_im, __riscv_vmulh_vv_i16m1(vxt, vsi, vl), vl);
+    }
+    else
+    {
+      vb_re = __riscv_vsub_vv_i16m1(vb_re, __riscv_vmulh_vv_i16m1(vyt, vsi, vl), vl);
+      vb_im = __riscv_vadd_vv_i16m1(vb_im, __riscv_vmulh_vv_i16m1(vxt, vsi, vl), vl);
+    }
+  }
+  else
+  {
+    va_re = __riscv_vadd_vv_i16m1(va_re, vb_re, vl);
+    va_im = __riscv_vadd_vv_i16m1(va_im, vb_im, vl);
+    vb_re = vxt;
+    vb_im = vyt;
+  }
+
+  v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, va_re);
+  v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, va_im);
+  __riscv_vssseg2e16_v_i16m1x2(pSrc, bstride, v_tuple, vl);
+  v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, vb_re);
+  v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, vb_im);
+  __riscv_vssseg2e16_v_i16m1x2(pB, bstride, v_tuple, vl);
+}
+
+/*
+ * Radix-2 decimation in frequency stages. The butterflies of a stage are vectorized within
+ * the groups while a group has more butterflies than there are groups, and across the groups
+ * afterwards, so the last stages do not run with short vectors.
+ */
+static void riscv_radix2_rvv_butterfly_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef,
+        uint32_t twidCoefModifier,
+        uint8_t ifftFlag)
+{
+  uint32_t n1, n2, numGroups, g, j;
+  size_t vl;
+
+  for (n1 = fftLen; n1 > 1U; n1 >>= 1U)
+  {
+    n2 = n1 >> 1U;
+    numGroups = fftLen / n1;
+
+    if (n2 >= numGroups)
+    {
+      for (g = 0U; g < fftLen; g += n1)
+      {
+        for (j = 0U; j < n2; j += vl)
+        {
+          vl = __riscv_vsetvl_e16m1(n2 - j);
+          riscv_radix2_rvv_kernel_q15(pSrc + 2U * (g + j), fftLen, n2, 4, pCoef, j * twidCoefModifier,
+                                      (ptrdiff_t)(4U * twidCoefModifier), ifftFlag, vl);
+        }
+      }
+    }
+    else
+    {
+      for (j = 0U; j < n2; j++)
+      {
+        for (g = 0U; g < numGroups; g += vl)
+        {
+          vl = __riscv_vsetvl_e16m1(numGroups - g);
+          riscv_radix2_rvv_kernel_q15(pSrc + 2U * (g * n1 + j), fftLen, n2, (ptrdiff_t)(4U * n1), pCoef,
+                                      j * twidCoefModifier, 0, ifftFlag, vl);
+        }
+      }
+    }
+
+    twidCoefModifier <<= 1U;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
 RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_q15(
         q15_t * pSrc,
         uint32_t fftLen,
   const q15_t * pCoef,
         uint16_t twidCoefModifier)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix2_rvv_butterfly_q15(pSrc, fftLen, pCoef, twidCoefModifier, 0U);
+#else
 #if defined (RISCV_MATH_DSP)
 
   uint32_t i, j, k, l;
@@ -485,6 +617,7 @@ RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_q15(
 
 #endif /* #if defined (RISCV_MATH_DSP) */
 
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
 
 
@@ -494,6 +627,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_inverse_q15(
   const q15_t * pCoef,
         uint16_t twidCoefModifier)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix2_rvv_butterfly_q15(pSrc, fftLen, pCoef, twidCoefModifier, 1U);
+#else
 #if defined (RISCV_MATH_DSP)
 
         uint32_t i, j, k, l;
@@ -787,4 +923,5 @@ RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_inverse_q15(
 
 #endif /* #if defined (RISCV_MATH_DSP) */
 
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
@@ -85,13 +85,153 @@ RISCV_DSP_ATTRIBUTE void riscv_cfft_radix2_q31(
   @} end of ComplexFFTDeprecated group
  */
 
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * (x * y + 2^31) >> 32 as mult_32x32_keep32_R: vsmul rounding down gives floor(x * y / 2^31),
+ * adding one and halving it rounding down gives the scalar rounding at bit 32
+ */
+static inline vint32m2_t riscv_radix2_rvv_mul_q31(vint32m2_t x, vint32m2_t y, size_t vl)
+{
+  return __riscv_vaadd_vx_i32m2(__riscv_vsmul_vv_i32m2(x, y, __RISCV_VXRM_RDN, vl), 1, __RISCV_VXRM_RDN, vl);
+}
+
+/*
+ * vl radix-2 butterflies whose first legs are bstride bytes apart, the legs being n2 complex
+ * values apart. The twiddle of a butterfly is read from pCoef + 2 * ia, the twiddles of
+ * consecutive butterflies being wstride bytes apart. As in the scalar implementation, the first
+ * stage scales down by 4, the middle stages by 2 and the last stage, which has no twiddles,
+ * does not scale.
+ */
+static void riscv_radix2_rvv_kernel_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+        uint32_t n2,
+        ptrdiff_t bstride,
+  const q31_t * pCoef,
+        uint32_t ia,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  q31_t *pB = pSrc + 2U * n2;
+  vint32m2x2_t v_tuple;
+  vint32m2_t va_re, va_im, vb_re, vb_im, vxt, vyt, vco, vsi;
+
+  v_tuple = __riscv_vlsseg2e32_v_i32m2x2(pSrc, bstride, vl);
+  va_re = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 0);
+  va_im = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_i32m2x2(pB, bstride, vl);
+  vb_re = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 0);
+  vb_im = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 1);
+
+  if (2U * n2 == fftLen)
+  {
+    va_re = __riscv_vsra_vx_i32m2(va_re, 1U, vl);
+    va_im = __riscv_vsra_vx_i32m2(va_im, 1U, vl);
+    vb_re = __riscv_vsra_vx_i32m2(vb_re, 1U, vl);
+    vb_im = __riscv_vsra_vx_i32m2(vb_im, 1U, vl);
+  }
+
+  vxt = __riscv_vsub_vv_i32m2(va_re, vb_re, vl);
+  vyt = __riscv_vsub_vv_i32m2(va_im, vb_im, vl);
+
+  if (n2 > 1U)
+  {
+    /* a' = (a + b) / 2, b' = (a - b) * W / 2, the sum wrapping as in the scalar code */
+    va_re = __riscv_vsra_vx_i32m2(__riscv_vadd_vv_i32m2(va_re, vb_re, vl), 1U, vl);
+    va_im = __riscv_vsra_vx_i32m2(__riscv_vadd_vv_i32m2(va_im, vb_im, vl), 1U, vl);
+
+    v_tuple = __riscv_vlsseg2e32_v_i32m2x2(pCoef + 2U * ia, wstride, vl);
+    vco = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 0);
+    vsi = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 1);
+    vb_re = riscv_radix2_rvv_mul_q31(vxt, vco, vl);
+    vb_im = riscv_radix2_rvv_mul_q31(vyt, vco, vl);
+    if (ifftFlag == 0U)
+    {
+      vb_re = __riscv_vadd_vv_i32m2(vb_re, riscv_radix2_rvv_mul_q31(vyt, vsi, vl), vl);
+      vb_im = __riscv_vsub_vv_i32m2(vb_im, riscv_radix2_rvv_mul_q31(vxt, vsi, vl), vl);
+    }
+    else
+    {
+      vb_re = __riscv_vsub_vv_i32m2(vb_re, riscv_radix2_rvv_mul_q31(vyt, vsi, vl), vl);
+      vb_im = __riscv_vadd_vv_i32m2(vb_im, riscv_radix2_rvv_mul_q31(vxt, vsi, vl), vl);
+    }
+  }
+  else
+  {
+    va_re = __riscv_vadd_vv_i32m2(va_re, vb_re, vl);
+    va_im = __riscv_vadd_vv_i32m2(va_im, vb_im, vl);
+    vb_re = vxt;
+    vb_im = vyt;
+  }
+
+  v_tuple = __riscv_vset_v_i32m2_i32m2x2(v_tuple, 0, va_re);
+  v_tuple = __riscv_vset_v_i32m2_i32m2x2(v_tuple, 1, va_im);
+  __riscv_vssseg2e32_v_i32m2x2(pSrc, bstride, v_tuple, vl);
+  v_tuple = __riscv_vset_v_i32m2_i32m2x2(v_tuple, 0, vb_re);
+  v_tuple = __riscv_vset_v_i32m2_i32m2x2(v_tuple, 1, vb_im);
+  __riscv_vssseg2e32_v_i32m2x2(pB, bstride, v_tuple, vl);
+}
+
+/*
+ * Radix-2 decimation in frequency stages. The butterflies of a stage are vectorized within
+ * the groups while a group has more butterflies than there are groups, and across the groups
+ * afterwards, so the last stages do not run with short vectors.
+ */
+static void riscv_radix2_rvv_butterfly_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pCoef,
+        uint32_t twidCoefModifier,
+        uint8_t ifftFlag)
+{
+  uint32_t n1, n2, numGroups, g, j;
+  size_t vl;
+
+  for (n1 = fftLen; n1 > 1U; n1 >>= 1U)
+  {
+    n2 = n1 >> 1U;
+    numGroups = fftLen / n1;
+
+    if (n2 >= numGroups)
+    {
+      for (g = 0U; g < fftLen; g += n1)
+      {
+        for (j = 0U; j < n2; j += vl)
+        {
+          vl = __riscv_vsetvl_e32m2(n2 - j);
+          riscv_radix2_rvv_kernel_q31(pSrc + 2U * (g + j), fftLen, n2, 8, pCoef, j * twidCoefModifier,
+                                      (ptrdiff_t)(8U * twidCoefModifier), ifftFlag, vl);
+        }
+      }
+    }
+    else
+    {
+      for (j = 0U; j < n2; j++)
+      {
+        for (g = 0U; g < numGroups; g += vl)
+        {
+          vl = __riscv_vsetvl_e32m2(numGroups - g);
+          riscv_radix2_rvv_kernel_q31(pSrc + 2U * (g * n1 + j), fftLen, n2, (ptrdiff_t)(8U * n1), pCoef,
+                                      j * twidCoefModifier, 0, ifftFlag, vl);
+        }
+      }
+    }
+
+    twidCoefModifier <<= 1U;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
 RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_q31(
         q31_t * pSrc,
         uint32_t fftLen,
   const q31_t * pCoef,
         uint16_t twidCoefModifier)
 {
-
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix2_rvv_butterfly_q31(pSrc, fftLen, pCoef, twidCoefModifier, 0U);
+#else
    unsigned i, j, k, l, m;
    unsigned n1, n2, ia;
    q31_t xt, yt, cosVal, sinVal;
@@ -293,6 +433,7 @@ RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_q31(
 #endif /* defined (RISCV_MATH_DSP) && (defined NUCLEI_DSP_N3 || __RISCV_XLEN == 64) */
    }                             // butterfly loop end
 
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
 
 
@@ -302,7 +443,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_inverse_q31(
   const q31_t * pCoef,
         uint16_t twidCoefModifier)
 {
-
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix2_rvv_butterfly_q31(pSrc, fftLen, pCoef, twidCoefModifier, 1U);
+#else
    unsigned i, j, k, l;
    unsigned n1, n2, ia;
    q31_t xt, yt, cosVal, sinVal;
@@ -495,4 +638,5 @@ RISCV_DSP_ATTRIBUTE void riscv_radix2_butterfly_inverse_q31(
 #endif /* defined (RISCV_MATH_DSP) && (defined NUCLEI_DSP_N3 || __RISCV_XLEN == 64) */
    }                             // butterfly loop end
 
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
@@ -93,6 +93,178 @@ RISCV_DSP_ATTRIBUTE void riscv_cfft_radix4_f32(
   @} end of ComplexFFTDeprecated group
  */
 
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+/*
+ * Stores the outputs (vx, vy) of vl butterflies, multiplied by the twiddles read wstride bytes
+ * apart from pW when pW is not NULL, or scaled otherwise.
+ */
+static void riscv_radix4_rvv_store_f32(
+        float32_t * pDst,
+        ptrdiff_t bstride,
+        vfloat32m1_t vx,
+        vfloat32m1_t vy,
+  const float32_t * pW,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        float32_t scale,
+        size_t vl)
+{
+  vfloat32m1x2_t v_tuple;
+  vfloat32m1_t vco, vsi, vtmp;
+
+  if (pW != NULL)
+  {
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pW, wstride, vl);
+    vco = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vsi = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    if (ifftFlag != 0U)
+    {
+      vsi = __riscv_vfneg_v_f32m1(vsi, vl);
+    }
+    /* x' = x * co + y * si, y' = y * co - x * si */
+    vtmp = __riscv_vfmul_vv_f32m1(vx, vco, vl);
+    vtmp = __riscv_vfmacc_vv_f32m1(vtmp, vy, vsi, vl);
+    vy = __riscv_vfmul_vv_f32m1(vy, vco, vl);
+    vy = __riscv_vfnmsac_vv_f32m1(vy, vx, vsi, vl);
+    vx = vtmp;
+  }
+  else if (scale != 1.0f)
+  {
+    vx = __riscv_vfmul_vf_f32m1(vx, scale, vl);
+    vy = __riscv_vfmul_vf_f32m1(vy, scale, vl);
+  }
+
+  v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, vx);
+  v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, vy);
+  __riscv_vssseg2e32_v_f32m1x2(pDst, bstride, v_tuple, vl);
+}
+
+/*
+ * vl radix-4 butterflies whose first legs are bstride bytes apart, the legs being n2 complex
+ * values apart. The twiddle Wk of a butterfly is read from pCoef + 2 * k * ia, the twiddles
+ * of consecutive butterflies being k * wstride bytes apart. The last stage has no twiddles.
+ */
+static void riscv_radix4_rvv_kernel_f32(
+        float32_t * pSrc,
+        uint32_t n2,
+        ptrdiff_t bstride,
+  const float32_t * pCoef,
+        uint32_t ia,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        float32_t scale,
+        size_t vl)
+{
+  float32_t *pB = pSrc + 2U * n2;
+  float32_t *pC = pB + 2U * n2;
+  float32_t *pD = pC + 2U * n2;
+  const float32_t *pW1 = (n2 > 1U) ? (pCoef + 2U * ia) : NULL;
+  const float32_t *pW2 = (n2 > 1U) ? (pCoef + 4U * ia) : NULL;
+  const float32_t *pW3 = (n2 > 1U) ? (pCoef + 6U * ia) : NULL;
+  vfloat32m1x2_t v_tuple;
+  vfloat32m1_t va_re, va_im, vb_re, vb_im, vc_re, vc_im, vd_re, vd_im;
+  vfloat32m1_t vr1, vr2, vs1, vs2, vt1, vt2, vu1, vu2;
+
+  /* Only the last stage is scaled */
+  scale = (n2 > 1U) ? 1.0f : scale;
+
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc, bstride, vl);
+  va_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+  va_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pB, bstride, vl);
+  vb_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+  vb_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pC, bstride, vl);
+  vc_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+  vc_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pD, bstride, vl);
+  vd_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+  vd_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+  /* (xa + xc), (xa - xc), (ya + yc), (ya - yc), (xb + xd), (yb + yd), (yb - yd), (xb - xd) */
+  vr1 = __riscv_vfadd_vv_f32m1(va_re, vc_re, vl);
+  vr2 = __riscv_vfsub_vv_f32m1(va_re, vc_re, vl);
+  vs1 = __riscv_vfadd_vv_f32m1(va_im, vc_im, vl);
+  vs2 = __riscv_vfsub_vv_f32m1(va_im, vc_im, vl);
+  vt1 = __riscv_vfadd_vv_f32m1(vb_re, vd_re, vl);
+  vt2 = __riscv_vfadd_vv_f32m1(vb_im, vd_im, vl);
+  vu1 = __riscv_vfsub_vv_f32m1(vb_im, vd_im, vl);
+  vu2 = __riscv_vfsub_vv_f32m1(vb_re, vd_re, vl);
+
+  /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+  riscv_radix4_rvv_store_f32(pSrc, bstride, __riscv_vfadd_vv_f32m1(vr1, vt1, vl),
+                             __riscv_vfadd_vv_f32m1(vs1, vt2, vl), NULL, 0, ifftFlag, scale, vl);
+
+  /* The second leg gets the output of the twiddle W2, the third one the output of W1 */
+  riscv_radix4_rvv_store_f32(pB, bstride, __riscv_vfsub_vv_f32m1(vr1, vt1, vl),
+                             __riscv_vfsub_vv_f32m1(vs1, vt2, vl), pW2, 2 * wstride, ifftFlag, scale, vl);
+  if (ifftFlag == 0U)
+  {
+    riscv_radix4_rvv_store_f32(pC, bstride, __riscv_vfadd_vv_f32m1(vr2, vu1, vl),
+                               __riscv_vfsub_vv_f32m1(vs2, vu2, vl), pW1, wstride, ifftFlag, scale, vl);
+    riscv_radix4_rvv_store_f32(pD, bstride, __riscv_vfsub_vv_f32m1(vr2, vu1, vl),
+                               __riscv_vfadd_vv_f32m1(vs2, vu2, vl), pW3, 3 * wstride, ifftFlag, scale, vl);
+  }
+  else
+  {
+    riscv_radix4_rvv_store_f32(pC, bstride, __riscv_vfsub_vv_f32m1(vr2, vu1, vl),
+                               __riscv_vfadd_vv_f32m1(vs2, vu2, vl), pW1, wstride, ifftFlag, scale, vl);
+    riscv_radix4_rvv_store_f32(pD, bstride, __riscv_vfadd_vv_f32m1(vr2, vu1, vl),
+                               __riscv_vfsub_vv_f32m1(vs2, vu2, vl), pW3, 3 * wstride, ifftFlag, scale, vl);
+  }
+}
+
+/*
+ * Radix-4 decimation in frequency stages. The butterflies of a stage are vectorized within
+ * the groups while a group has more butterflies than there are groups, and across the groups
+ * afterwards, so the last stages do not run with short vectors.
+ */
+static void riscv_radix4_rvv_butterfly_f32(
+        float32_t * pSrc,
+        uint32_t fftLen,
+  const float32_t * pCoef,
+        uint32_t twidCoefModifier,
+        uint8_t ifftFlag,
+        float32_t onebyfftLen)
+{
+  uint32_t n1, n2, numGroups, g, j;
+  size_t vl;
+
+  for (n1 = fftLen; n1 > 1U; n1 >>= 2U)
+  {
+    n2 = n1 >> 2U;
+    numGroups = fftLen / n1;
+
+    if (n2 >= numGroups)
+    {
+      for (g = 0U; g < fftLen; g += n1)
+      {
+        for (j = 0U; j < n2; j += vl)
+        {
+          vl = __riscv_vsetvl_e32m1(n2 - j);
+          riscv_radix4_rvv_kernel_f32(pSrc + 2U * (g + j), n2, 8, pCoef, j * twidCoefModifier,
+                                      (ptrdiff_t)(8U * twidCoefModifier), ifftFlag, onebyfftLen, vl);
+        }
+      }
+    }
+    else
+    {
+      for (j = 0U; j < n2; j++)
+      {
+        for (g = 0U; g < numGroups; g += vl)
+        {
+          vl = __riscv_vsetvl_e32m1(numGroups - g);
+          riscv_radix4_rvv_kernel_f32(pSrc + 2U * (g * n1 + j), n2, (ptrdiff_t)(8U * n1), pCoef,
+                                      j * twidCoefModifier, 0, ifftFlag, onebyfftLen, vl);
+        }
+      }
+    }
+
+    twidCoefModifier <<= 2U;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
 /* ----------------------------------------------------------------------
  * Internal helper function used by the FFTs
  * ---------------------------------------------------------------------- */
@@ -112,6 +284,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_f32(
   const float32_t * pCoef,
         uint16_t twidCoefModifier)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  riscv_radix4_rvv_butterfly_f32(pSrc, fftLen, pCoef, twidCoefModifier, 0U, 1.0f);
+#else
         float32_t co1, co2, co3, si1, si2, si3;
         uint32_t ia1, ia2, ia3;
         uint32_t i0, i1, i2, i3;
@@ -592,7 +767,7 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_f32(
    }
 
 #endif /* #if defined (RISCV_MATH_LOOPUNROLL) */
-
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
 }
 
 /**
@@ -612,6 +787,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_inverse_f32(
         uint16_t twidCoefModifier,
         float32_t onebyfftLen)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  riscv_radix4_rvv_butterfly_f32(pSrc, fftLen, pCoef, twidCoefModifier, 1U, onebyfftLen);
+#else
         float32_t co1, co2, co3, si1, si2, si3;
         uint32_t ia1, ia2, ia3;
         uint32_t i0, i1, i2, i3;
@@ -1196,6 +1374,7 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_inverse_f32(
    }
 
 #endif /* #if defined (RISCV_MATH_LOOPUNROLL) */
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
 }
 
 
@@ -112,6 +112,231 @@ RISCV_DSP_ATTRIBUTE void riscv_cfft_radix4_q15(
   @} end of ComplexFFTDeprecated group
  */
 
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * Stores the outputs (vx, vy) of vl butterflies, multiplied by the twiddles read wstride bytes
+ * apart from pW when pW is not NULL.
+ */
+static void riscv_radix4_rvv_store_q15(
+        q15_t * pDst,
+        ptrdiff_t bstride,
+        vint16m1_t vx,
+        vint16m1_t vy,
+  const q15_t * pW,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  vint16m1x2_t v_tuple;
+  vint16m1_t vco, vsi;
+  vint32m2_t vacc_x, vacc_y;
+
+  if (pW != NULL)
+  {
+    v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pW, wstride, vl);
+    vco = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vsi = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+    vacc_x = __riscv_vwmul_vv_i32m2(vx, vco, vl);
+    vacc_y = __riscv_vwmul_vv_i32m2(vy, vco, vl);
+    if (ifftFlag == 0U)
+    {
+      /* x' = (x * co + y * si) >> 16, y' = (y * co - x * si) >> 16 */
+      vacc_x = __riscv_vwmacc_vv_i32m2(vacc_x, vy, vsi, vl);
+      vacc_y = __riscv_vsub_vv_i32m2(vacc_y, __riscv_vwmul_vv_i32m2(vx, vsi, vl), vl);
+    }
+    else
+    {
+      /* x' = (x * co - y * si) >> 16, y' = (y * co + x * si) >> 16 */
+      vacc_x = __riscv_vsub_vv_i32m2(vacc_x, __riscv_vwmul_vv_i32m2(vy, vsi, vl), vl);
+      vacc_y = __riscv_vwmacc_vv_i32m2(vacc_y, vx, vsi, vl);
+    }
+    vx = __riscv_vnsra_wx_i16m1(vacc_x, 16U, vl);
+    vy = __riscv_vnsra_wx_i16m1(vacc_y, 16U, vl);
+  }
+
+  v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, vx);
+  v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, vy);
+  __riscv_vssseg2e16_v_i16m1x2(pDst, bstride, v_tuple, vl);
+}
+
+/*
+ * vl radix-4 butterflies whose first legs are bstride bytes apart, the legs being n2 complex
+ * values apart. The twiddle Wk of a butterfly is read from pCoef + 2 * k * ia, the twiddles
+ * of consecutive butterflies being k * wstride bytes apart. The scaling of each stage is the
+ * one of the scalar implementation: the first stage scales down by 8, the middle stages by 4
+ * and the last stage, which has no twiddles, by 2.
+ */
+static void riscv_radix4_rvv_kernel_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint32_t n2,
+        ptrdiff_t bstride,
+  const q15_t * pCoef,
+        uint32_t ia,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  q15_t *pB = pSrc + 2U * n2;
+  q15_t *pC = pB + 2U * n2;
+  q15_t *pD = pC + 2U * n2;
+  const q15_t *pW1 = (n2 > 1U) ? (pCoef + 2U * ia) : NULL;
+  const q15_t *pW2 = (n2 > 1U) ? (pCoef + 4U * ia) : NULL;
+  const q15_t *pW3 = (n2 > 1U) ? (pCoef + 6U * ia) : NULL;
+  vint16m1x2_t v_tuple;
+  vint16m1_t va_re, va_im, vb_re, vb_im, vc_re, vc_im, vd_re, vd_im;
+  vint16m1_t vr0, vr1, vs0, vs1, vt0, vt1, vu0, vu1;
+
+  v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pSrc, bstride, vl);
+  va_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+  va_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pB, bstride, vl);
+  vb_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+  vb_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pC, bstride, vl);
+  vc_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+  vc_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pD, bstride, vl);
+  vd_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+  vd_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+
+  if (4U * n2 == fftLen)
+  {
+    /* Input is in 1.15(q15) format, scaled down by 4 to avoid overflows */
+    va_re = __riscv_vsra_vx_i16m1(va_re, 2U, vl);
+    va_im = __riscv_vsra_vx_i16m1(va_im, 2U, vl);
+    vb_re = __riscv_vsra_vx_i16m1(vb_re, 2U, vl);
+    vb_im = __riscv_vsra_vx_i16m1(vb_im, 2U, vl);
+    vc_re = __riscv_vsra_vx_i16m1(vc_re, 2U, vl);
+    vc_im = __riscv_vsra_vx_i16m1(vc_im, 2U, vl);
+    vd_re = __riscv_vsra_vx_i16m1(vd_re, 2U, vl);
+    vd_im = __riscv_vsra_vx_i16m1(vd_im, 2U, vl);
+  }
+
+  /* R = a + c, S = a - c, T = b + d, U = b - d */
+  vr0 = __riscv_vsadd_vv_i16m1(va_re, vc_re, vl);
+  vr1 = __riscv_vsadd_vv_i16m1(va_im, vc_im, vl);
+  vs0 = __riscv_vssub_vv_i16m1(va_re, vc_re, vl);
+  vs1 = __riscv_vssub_vv_i16m1(va_im, vc_im, vl);
+  vt0 = __riscv_vsadd_vv_i16m1(vb_re, vd_re, vl);
+  vt1 = __riscv_vsadd_vv_i16m1(vb_im, vd_im, vl);
+  vu0 = __riscv_vssub_vv_i16m1(vb_re, vd_re, vl);
+  vu1 = __riscv_vssub_vv_i16m1(vb_im, vd_im, vl);
+
+  /* xa' = (R + T) / 2, halved again by the middle stages */
+  va_re = __riscv_vadd_vv_i16m1(__riscv_vsra_vx_i16m1(vr0, 1U, vl), __riscv_vsra_vx_i16m1(vt0, 1U, vl), vl);
+  va_im = __riscv_vadd_vv_i16m1(__riscv_vsra_vx_i16m1(vr1, 1U, vl), __riscv_vsra_vx_i16m1(vt1, 1U, vl), vl);
+  if ((4U * n2 != fftLen) && (n2 > 1U))
+  {
+    va_re = __riscv_vsra_vx_i16m1(va_re, 1U, vl);
+    va_im = __riscv_vsra_vx_i16m1(va_im, 1U, vl);
+  }
+  riscv_radix4_rvv_store_q15(pSrc, bstride, va_re, va_im, NULL, 0, ifftFlag, vl);
+
+  if (4U * n2 == fftLen)
+  {
+    /* The first stage saturates the sums, the next ones halve their terms */
+    vb_re = __riscv_vssub_vv_i16m1(vr0, vt0, vl);
+    vb_im = __riscv_vssub_vv_i16m1(vr1, vt1, vl);
+    if (ifftFlag == 0U)
+    {
+      vc_re = __riscv_vsadd_vv_i16m1(vs0, vu1, vl);
+      vc_im = __riscv_vssub_vv_i16m1(vs1, vu0, vl);
+      vd_re = __riscv_vssub_vv_i16m1(vs0, vu1, vl);
+      vd_im = __riscv_vsadd_vv_i16m1(vs1, vu0, vl);
+    }
+    else
+    {
+      vc_re = __riscv_vssub_vv_i16m1(vs0, vu1, vl);
+      vc_im = __riscv_vsadd_vv_i16m1(vs1, vu0, vl);
+      vd_re = __riscv_vsadd_vv_i16m1(vs0, vu1, vl);
+      vd_im = __riscv_vssub_vv_i16m1(vs1, vu0, vl);
+    }
+  }
+  else
+  {
+    vr0 = __riscv_vsra_vx_i16m1(vr0, 1U, vl);
+    vr1 = __riscv_vsra_vx_i16m1(vr1, 1U, vl);
+    vs0 = __riscv_vsra_vx_i16m1(vs0, 1U, vl);
+    vs1 = __riscv_vsra_vx_i16m1(vs1, 1U, vl);
+    vt0 = __riscv_vsra_vx_i16m1(vt0, 1U, vl);
+    vt1 = __riscv_vsra_vx_i16m1(vt1, 1U, vl);
+    vu0 = __riscv_vsra_vx_i16m1(vu0, 1U, vl);
+    vu1 = __riscv_vsra_vx_i16m1(vu1, 1U, vl);
+    vb_re = __riscv_vsub_vv_i16m1(vr0, vt0, vl);
+    vb_im = __riscv_vsub_vv_i16m1(vr1, vt1, vl);
+    if (ifftFlag == 0U)
+    {
+      vc_re = __riscv_vadd_vv_i16m1(vs0, vu1, vl);
+      vc_im = __riscv_vsub_vv_i16m1(vs1, vu0, vl);
+      vd_re = __riscv_vsub_vv_i16m1(vs0, vu1, vl);
+      vd_im = __riscv_vadd_vv_i16m1(vs1, vu0, vl);
+    }
+    else
+    {
+      vc_re = __riscv_vsub_vv_i16m1(vs0, vu1, vl);
+      vc_im = __riscv_vadd_vv_i16m1(vs1, vu0, vl);
+      vd_re = __riscv_vadd_vv_i16m1(vs0, vu1, vl);
+      vd_im = __riscv_vsub_vv_i16m1(vs1, vu0, vl);
+    }
+  }
+
+  /* The second leg gets the output of the twiddle W2, the third one the output of W1 */
+  riscv_radix4_rvv_store_q15(pB, bstride, vb_re, vb_im, pW2, 2 * wstride, ifftFlag, vl);
+  riscv_radix4_rvv_store_q15(pC, bstride, vc_re, vc_im, pW1, wstride, ifftFlag, vl);
+  riscv_radix4_rvv_store_q15(pD, bstride, vd_re, vd_im, pW3, 3 * wstride, ifftFlag, vl);
+}
+
+/*
+ * Radix-4 decimation in frequency stages. The butterflies of a stage are vectorized within
+ * the groups while a group has more butterflies than there are groups, and across the groups
+ * afterwards, so the last stages do not run with short vectors.
+ */
+static void riscv_radix4_rvv_butterfly_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef,
+        uint32_t twidCoefModifier,
+        uint8_t ifftFlag)
+{
+  uint32_t n1, n2, numGroups, g, j;
+  size_t vl;
+
+  for (n1 = fftLen; n1 > 1U; n1 >>= 2U)
+  {
+    n2 = n1 >> 2U;
+    numGroups = fftLen / n1;
+
+    if (n2 >= numGroups)
+    {
+      for (g = 0U; g < fftLen; g += n1)
+      {
+        for (j = 0U; j < n2; j += vl)
+        {
+          vl = __riscv_vsetvl_e16m1(n2 - j);
+          riscv_radix4_rvv_kernel_q15(pSrc + 2U * (g + j), fftLen, n2, 4, pCoef, j * twidCoefModifier,
+                                      (ptrdiff_t)(4U * twidCoefModifier), ifftFlag, vl);
+        }
+      }
+    }
+    else
+    {
+      for (j = 0U; j < n2; j++)
+      {
+        for (g = 0U; g < numGroups; g += vl)
+        {
+          vl = __riscv_vsetvl_e16m1(numGroups - g);
+          riscv_radix4_rvv_kernel_q15(pSrc + 2U * (g * n1 + j), fftLen, n2, (ptrdiff_t)(4U * n1), pCoef,
+                                      j * twidCoefModifier, 0, ifftFlag, vl);
+        }
+      }
+    }
+
+    twidCoefModifier <<= 2U;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
 /*
  * Radix-4 FFT algorithm used is :
  *
@@ -161,7 +386,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_q15(
         uint32_t twidCoefModifier)
 {
 
-#if defined (RISCV_MATH_DSP)
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix4_rvv_butterfly_q15(pSrc16, fftLen, pCoef16, twidCoefModifier, 0U);
+#elif defined (RISCV_MATH_DSP)
 
         q31_t R, S, T, U;
         q31_t C1, C2, C3, out1, out2;
@@ -1359,7 +1586,9 @@ void riscv_radix4_butterfly_inverse_q15(
         uint32_t twidCoefModifier)
 {
 
-#if defined (RISCV_MATH_DSP)
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix4_rvv_butterfly_q15(pSrc16, fftLen, pCoef16, twidCoefModifier, 1U);
+#elif defined (RISCV_MATH_DSP)
 
         q31_t R, S, T, U;
         q31_t C1, C2, C3, out1, out2;
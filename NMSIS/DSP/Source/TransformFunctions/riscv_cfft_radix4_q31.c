@@ -111,6 +111,202 @@ RISCV_DSP_ATTRIBUTE void riscv_cfft_radix4_q31(
   @} end of ComplexFFTDeprecated group
  */
 
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * Stores the outputs (vx, vy) of vl butterflies, multiplied by the twiddles read wstride bytes
+ * apart from pW when pW is not NULL, and shifted left by shift bits (right for a negative shift).
+ */
+static void riscv_radix4_rvv_store_q31(
+        q31_t * pDst,
+        ptrdiff_t bstride,
+        vint32m1_t vx,
+        vint32m1_t vy,
+  const q31_t * pW,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        int32_t shift,
+        size_t vl)
+{
+  vint32m1x2_t v_tuple;
+  vint32m1_t vco, vsi, vtmp;
+
+  if (pW != NULL)
+  {
+    v_tuple = __riscv_vlsseg2e32_v_i32m1x2(pW, wstride, vl);
+    vco = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 0);
+    vsi = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 1);
+    vtmp = __riscv_vmulh_vv_i32m1(vx, vco, vl);
+    if (ifftFlag == 0U)
+    {
+      /* x' = x * co + y * si, y' = y * co - x * si */
+      vtmp = __riscv_vadd_vv_i32m1(vtmp, __riscv_vmulh_vv_i32m1(vy, vsi, vl), vl);
+      vy = __riscv_vsub_vv_i32m1(__riscv_vmulh_vv_i32m1(vy, vco, vl), __riscv_vmulh_vv_i32m1(vx, vsi, vl), vl);
+    }
+    else
+    {
+      /* x' = x * co - y * si, y' = y * co + x * si */
+      vtmp = __riscv_vsub_vv_i32m1(vtmp, __riscv_vmulh_vv_i32m1(vy, vsi, vl), vl);
+      vy = __riscv_vadd_vv_i32m1(__riscv_vmulh_vv_i32m1(vy, vco, vl), __riscv_vmulh_vv_i32m1(vx, vsi, vl), vl);
+    }
+    vx = vtmp;
+  }
+
+  if (shift > 0)
+  {
+    vx = __riscv_vsll_vx_i32m1(vx, (size_t)shift, vl);
+    vy = __riscv_vsll_vx_i32m1(vy, (size_t)shift, vl);
+  }
+  else if (shift < 0)
+  {
+    vx = __riscv_vsra_vx_i32m1(vx, (size_t)(-shift), vl);
+    vy = __riscv_vsra_vx_i32m1(vy, (size_t)(-shift), vl);
+  }
+
+  v_tuple = __riscv_vset_v_i32m1_i32m1x2(v_tuple, 0, vx);
+  v_tuple = __riscv_vset_v_i32m1_i32m1x2(v_tuple, 1, vy);
+  __riscv_vssseg2e32_v_i32m1x2(pDst, bstride, v_tuple, vl);
+}
+
+/*
+ * vl radix-4 butterflies whose first legs are bstride bytes apart, the legs being n2 complex
+ * values apart. The twiddle Wk of a butterfly is read from pCoef + 2 * k * ia, the twiddles
+ * of consecutive butterflies being k * wstride bytes apart. The scaling of each stage is the
+ * one of the scalar implementation: the inputs of the first stage are scaled down by 16, the
+ * middle stages scale down by 4, and the last stage has no twiddles and does not scale.
+ */
+static void riscv_radix4_rvv_kernel_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+        uint32_t n2,
+        ptrdiff_t bstride,
+  const q31_t * pCoef,
+        uint32_t ia,
+        ptrdiff_t wstride,
+        uint8_t ifftFlag,
+        size_t vl)
+{
+  q31_t *pB = pSrc + 2U * n2;
+  q31_t *pC = pB + 2U * n2;
+  q31_t *pD = pC + 2U * n2;
+  const q31_t *pW1 = (n2 > 1U) ? (pCoef + 2U * ia) : NULL;
+  const q31_t *pW2 = (n2 > 1U) ? (pCoef + 4U * ia) : NULL;
+  const q31_t *pW3 = (n2 > 1U) ? (pCoef + 6U * ia) : NULL;
+  const uint8_t first = (4U * n2 == fftLen) ? 1U : 0U;
+  const int32_t shift = (n2 == 1U) ? 0 : (first ? 1 : -1);
+  vint32m1x2_t v_tuple;
+  vint32m1_t va_re, va_im, vb_re, vb_im, vc_re, vc_im, vd_re, vd_im;
+  vint32m1_t vr1, vr2, vs1, vs2, vt1, vt2, vu1, vu2;
+
+  v_tuple = __riscv_vlsseg2e32_v_i32m1x2(pSrc, bstride, vl);
+  va_re = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 0);
+  va_im = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_i32m1x2(pB, bstride, vl);
+  vb_re = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 0);
+  vb_im = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_i32m1x2(pC, bstride, vl);
+  vc_re = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 0);
+  vc_im = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 1);
+  v_tuple = __riscv_vlsseg2e32_v_i32m1x2(pD, bstride, vl);
+  vd_re = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 0);
+  vd_im = __riscv_vget_v_i32m1x2_i32m1(v_tuple, 1);
+
+  if (first)
+  {
+    /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+    va_re = __riscv_vsra_vx_i32m1(va_re, 4U, vl);
+    va_im = __riscv_vsra_vx_i32m1(va_im, 4U, vl);
+    vb_re = __riscv_vsra_vx_i32m1(vb_re, 4U, vl);
+    vb_im = __riscv_vsra_vx_i32m1(vb_im, 4U, vl);
+    vc_re = __riscv_vsra_vx_i32m1(vc_re, 4U, vl);
+    vc_im = __riscv_vsra_vx_i32m1(vc_im, 4U, vl);
+    vd_re = __riscv_vsra_vx_i32m1(vd_re, 4U, vl);
+    vd_im = __riscv_vsra_vx_i32m1(vd_im, 4U, vl);
+  }
+
+  /* (xa + xc), (xa - xc), (ya + yc), (ya - yc), (xb + xd), (yb + yd), (yb - yd), (xb - xd) */
+  vr1 = __riscv_vadd_vv_i32m1(va_re, vc_re, vl);
+  vr2 = __riscv_vsub_vv_i32m1(va_re, vc_re, vl);
+  vs1 = __riscv_vadd_vv_i32m1(va_im, vc_im, vl);
+  vs2 = __riscv_vsub_vv_i32m1(va_im, vc_im, vl);
+  vt1 = __riscv_vadd_vv_i32m1(vb_re, vd_re, vl);
+  vt2 = __riscv_vadd_vv_i32m1(vb_im, vd_im, vl);
+  vu1 = __riscv_vsub_vv_i32m1(vb_im, vd_im, vl);
+  vu2 = __riscv_vsub_vv_i32m1(vb_re, vd_re, vl);
+
+  /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+  riscv_radix4_rvv_store_q31(pSrc, bstride, __riscv_vadd_vv_i32m1(vr1, vt1, vl),
+                             __riscv_vadd_vv_i32m1(vs1, vt2, vl), NULL, 0, ifftFlag,
+                             (shift < 0) ? -2 : 0, vl);
+
+  /* The second leg gets the output of the twiddle W2, the third one the output of W1 */
+  riscv_radix4_rvv_store_q31(pB, bstride, __riscv_vsub_vv_i32m1(vr1, vt1, vl),
+                             __riscv_vsub_vv_i32m1(vs1, vt2, vl), pW2, 2 * wstride, ifftFlag, shift, vl);
+  if (ifftFlag == 0U)
+  {
+    riscv_radix4_rvv_store_q31(pC, bstride, __riscv_vadd_vv_i32m1(vr2, vu1, vl),
+                               __riscv_vsub_vv_i32m1(vs2, vu2, vl), pW1, wstride, ifftFlag, shift, vl);
+    riscv_radix4_rvv_store_q31(pD, bstride, __riscv_vsub_vv_i32m1(vr2, vu1, vl),
+                               __riscv_vadd_vv_i32m1(vs2, vu2, vl), pW3, 3 * wstride, ifftFlag, shift, vl);
+  }
+  else
+  {
+    riscv_radix4_rvv_store_q31(pC, bstride, __riscv_vsub_vv_i32m1(vr2, vu1, vl),
+                               __riscv_vadd_vv_i32m1(vs2, vu2, vl), pW1, wstride, ifftFlag, shift, vl);
+    riscv_radix4_rvv_store_q31(pD, bstride, __riscv_vadd_vv_i32m1(vr2, vu1, vl),
+                               __riscv_vsub_vv_i32m1(vs2, vu2, vl), pW3, 3 * wstride, ifftFlag, shift, vl);
+  }
+}
+
+/*
+ * Radix-4 decimation in frequency stages. The butterflies of a stage are vectorized within
+ * the groups while a group has more butterflies than there are groups, and across the groups
+ * afterwards, so the last stages do not run with short vectors.
+ */
+static void riscv_radix4_rvv_butterfly_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pCoef,
+        uint32_t twidCoefModifier,
+        uint8_t ifftFlag)
+{
+  uint32_t n1, n2, numGroups, g, j;
+  size_t vl;
+
+  for (n1 = fftLen; n1 > 1U; n1 >>= 2U)
+  {
+    n2 = n1 >> 2U;
+    numGroups = fftLen / n1;
+
+    if (n2 >= numGroups)
+    {
+      for (g = 0U; g < fftLen; g += n1)
+      {
+        for (j = 0U; j < n2; j += vl)
+        {
+          vl = __riscv_vsetvl_e32m1(n2 - j);
+          riscv_radix4_rvv_kernel_q31(pSrc + 2U * (g + j), fftLen, n2, 8, pCoef, j * twidCoefModifier,
+                                      (ptrdiff_t)(8U * twidCoefModifier), ifftFlag, vl);
+        }
+      }
+    }
+    else
+    {
+      for (j = 0U; j < n2; j++)
+      {
+        for (g = 0U; g < numGroups; g += vl)
+        {
+          vl = __riscv_vsetvl_e32m1(numGroups - g);
+          riscv_radix4_rvv_kernel_q31(pSrc + 2U * (g * n1 + j), fftLen, n2, (ptrdiff_t)(8U * n1), pCoef,
+                                      j * twidCoefModifier, 0, ifftFlag, vl);
+        }
+      }
+    }
+
+    twidCoefModifier <<= 2U;
+  }
+}
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
 /*
  * Radix-4 FFT algorithm used is :
  *
@@ -159,6 +355,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_q31(
   const q31_t * pCoef,
         uint32_t twidCoefModifier)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix4_rvv_butterfly_q31(pSrc, fftLen, pCoef, twidCoefModifier, 0U);
+#else
         unsigned long n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
         q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
         
@@ -732,7 +931,7 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_q31(
   /* output is in 5.27(q27) format for the 16 point */
 
   /* End of last stage process */
-
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
 
 
@@ -790,6 +989,9 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_inverse_q31(
   const q31_t * pCoef,
         uint32_t twidCoefModifier)
 {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  riscv_radix4_rvv_butterfly_q31(pSrc, fftLen, pCoef, twidCoefModifier, 1U);
+#else
         uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
         q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
         q31_t xa, xb, xc, xd;
@@ -1130,4 +1332,5 @@ RISCV_DSP_ATTRIBUTE void riscv_radix4_butterfly_inverse_q31(
   /* output is in 5.27(q27) format for the 16 point */
 
   /* End of last stage process */
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
 }
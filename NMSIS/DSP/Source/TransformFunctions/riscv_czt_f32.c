@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_czt_f32.c
+ * Description:  Floating-point chirp-z transform
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup CZT Chirp-Z Transform
+
+  @par
+                   The chirp-z transform computes numBins bins of the DTFT of srcLen complex samples
+                   at the frequencies fStart + k * fStep, normalized by the sampling rate:
+  <pre>
+      X[k] = sum(x[n] * exp(-j * 2 * pi * (fStart + k * fStep) * n)), 0 <= n < srcLen
+  </pre>
+                   It zooms on a narrow band with a resolution which does not depend on srcLen, where a
+                   CFFT would need a length of 1 / fStep. With fStart = 0, fStep = 1 / srcLen and
+                   numBins = srcLen, it is the DFT of any length, including the lengths which are not
+                   products of 2, 3 and 5 (see \ref riscv_cfft_mixed_f32).
+  @par           Algorithm
+                   With n * k = (n^2 + k^2 - (k - n)^2) / 2, the sum is a convolution (Bluestein):
+  <pre>
+      X[k] = w[k] * sum((x[n] * a[n]) * h[k - n])
+      a[n] = exp(-j * 2 * pi * (fStart * n + fStep * n^2 / 2))
+      w[k] = exp(-j * 2 * pi * fStep * k^2 / 2)
+      h[m] = exp(j * 2 * pi * fStep * m^2 / 2)
+  </pre>
+                   which is computed with \ref riscv_cfft_f32 of fftLen >= srcLen + numBins - 1 points,
+                   a power of two up to 4096. The weights a and w and the spectrum of h are computed by
+                   \ref riscv_czt_init_f32, so that a transform costs two FFTs and three complex
+                   multiplications by \ref riscv_cmplx_mult_cmplx_f32.
+ */
+
+/**
+  @addtogroup CZT
+  @{
+ */
+
+/**
+  @brief         Scratch length of the floating-point chirp-z transform.
+  @param[in]     srcLen     number of complex input samples
+  @param[in]     numBins    number of complex output bins
+  @return        length of the scratch buffer of \ref riscv_czt_init_f32 and \ref riscv_czt_f32
+                 in float32_t values, 0 for unsupported arguments
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_czt_scratch_size_f32(
+  uint16_t srcLen,
+  uint16_t numBins)
+{
+  const uint32_t fftLen = riscv_czt_fft_len(srcLen, numBins);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  /* Input and output of the FFTs, and riscv_cfft_tmp_buffer_size() */
+  return fftLen * 8U;
+#else
+  return fftLen * 2U;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/**
+  @brief         Processing function for the floating-point chirp-z transform.
+  @param[in]     S          points to an instance of the floating-point chirp-z transform structure
+  @param[in]     pSrc       points to the S->srcLen complex input samples
+  @param[out]    pDst       points to the S->numBins complex output bins
+  @param[in]     pScratch   points to a buffer of \ref riscv_czt_scratch_size_f32 values
+ */
+RISCV_DSP_ATTRIBUTE void riscv_czt_f32(
+  const riscv_czt_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  const uint32_t L = S->fftLen;
+  float32_t *pWork = pScratch;
+
+  riscv_cmplx_mult_cmplx_f32(pSrc, S->pChirpIn, pWork, S->srcLen);
+  riscv_fill_f32(0.0f, pWork + 2U * S->srcLen, 2U * (L - S->srcLen));
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  float32_t *pFreq = pScratch + 2U * L;
+
+  riscv_cfft_f32(&S->Scfft, pWork, pFreq, pScratch + 4U * L, 0U);
+  riscv_cmplx_mult_cmplx_f32(pFreq, S->pKernel, pFreq, L);
+  riscv_cfft_f32(&S->Scfft, pFreq, pWork, pScratch + 4U * L, 1U);
+#else
+  riscv_cfft_f32(&S->Scfft, pWork, 0U, 1U);
+  riscv_cmplx_mult_cmplx_f32(pWork, S->pKernel, pWork, L);
+  riscv_cfft_f32(&S->Scfft, pWork, 1U, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  riscv_cmplx_mult_cmplx_f32(pWork, S->pChirpOut, pDst, S->numBins);
+}
+
+/**
+  @} end of CZT group
+ */
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_czt_init_f32.c
+ * Description:  Floating-point chirp-z transform initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup CZT
+  @{
+ */
+
+/* exp(j * 2 * pi * phase) with the phase reduced to [0, 1) in double precision */
+static void riscv_czt_expj_f32(
+  double phase,
+  float32_t * pOut)
+{
+  phase -= floor(phase);
+  pOut[0] = (float32_t) cos(RISCV_CFFT_MIXED_2PI * phase);
+  pOut[1] = (float32_t) sin(RISCV_CFFT_MIXED_2PI * phase);
+}
+
+/**
+  @brief         Buffer length of the floating-point chirp-z transform.
+  @param[in]     srcLen     number of complex input samples
+  @param[in]     numBins    number of complex output bins
+  @return        length of the buffer of \ref riscv_czt_init_f32 in float32_t values,
+                 0 for unsupported arguments
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_czt_buffer_size_f32(
+  uint16_t srcLen,
+  uint16_t numBins)
+{
+  const uint32_t fftLen = riscv_czt_fft_len(srcLen, numBins);
+
+  if (fftLen == 0U)
+  {
+    return 0U;
+  }
+
+  return 2U * ((uint32_t)srcLen + numBins + fftLen);
+}
+
+/**
+  @brief         Initialization function for the floating-point chirp-z transform.
+  @param[in,out] S          points to an instance of the floating-point chirp-z transform structure
+  @param[in]     srcLen     number of complex input samples
+  @param[in]     numBins    number of complex output bins
+  @param[in]     fStart     frequency of the first bin, divided by the sampling rate
+  @param[in]     fStep      frequency step between the bins, divided by the sampling rate
+  @param[out]    pBuffer    points to a buffer of \ref riscv_czt_buffer_size_f32 values for the tables
+  @param[in]     pScratch   points to a buffer of \ref riscv_czt_scratch_size_f32 values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : srcLen + numBins - 1 is larger than 4096
+
+  @par
+                   fStep can be negative and fStart + k * fStep can go beyond 0.5, the bins being
+                   periodic with a period of 1.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_czt_init_f32(
+        riscv_czt_instance_f32 * S,
+        uint16_t srcLen,
+        uint16_t numBins,
+        float32_t fStart,
+        float32_t fStep,
+        float32_t * pBuffer,
+        float32_t * pScratch)
+{
+  const uint16_t L = riscv_czt_fft_len(srcLen, numBins);
+  const double f0 = fStart;
+  const double df = fStep;
+  float32_t *pChirpIn = pBuffer;
+  float32_t *pChirpOut = pChirpIn + 2U * srcLen;
+  float32_t *pKernel = pChirpOut + 2U * numBins;
+  float32_t *pChirp;
+  riscv_status status;
+  double m;
+
+  if (L == 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  status = riscv_cfft_init_f32(&S->Scfft, L);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  for (uint32_t n = 0U; n < srcLen; n++)
+  {
+    m = (double) n;
+    riscv_czt_expj_f32(-(f0 * m + 0.5 * df * m * m), pChirpIn + 2U * n);
+  }
+  for (uint32_t k = 0U; k < numBins; k++)
+  {
+    m = (double) k;
+    riscv_czt_expj_f32(-0.5 * df * m * m, pChirpOut + 2U * k);
+  }
+
+  /* h[m] for 0 <= m < numBins, h[m - L] for L - srcLen < m < L and zeros between them */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  pChirp = pScratch;
+#else
+  (void)pScratch;
+  pChirp = pKernel;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+  for (uint32_t i = 0U; i < L; i++)
+  {
+    if (i < numBins)
+    {
+      m = (double) i;
+    }
+    else if (i > (uint32_t)L - srcLen)
+    {
+      m = (double) i - (double) L;
+    }
+    else
+    {
+      pChirp[2U * i] = 0.0f;
+      pChirp[2U * i + 1U] = 0.0f;
+      continue;
+    }
+    riscv_czt_expj_f32(0.5 * df * m * m, pChirp + 2U * i);
+  }
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  riscv_cfft_f32(&S->Scfft, pChirp, pKernel, pScratch + 4U * L, 0U);
+#else
+  riscv_cfft_f32(&S->Scfft, pChirp, 0U, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  S->srcLen = srcLen;
+  S->numBins = numBins;
+  S->fftLen = L;
+  S->pChirpIn = pChirpIn;
+  S->pChirpOut = pChirpOut;
+  S->pKernel = pKernel;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of CZT group
+ */
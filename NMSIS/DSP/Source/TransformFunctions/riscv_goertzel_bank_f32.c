@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_bank_f32.c
+ * Description:  Floating-point Goertzel filter bank
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Filter Bank
+
+  @par
+                   The Goertzel filter bank computes the power of the DFT of a block of samples at a
+                   few frequencies, for example for DTMF or pilot tone detection, where a full FFT would
+                   mostly compute bins which are not used. The frequencies are arbitrary and do not need
+                   to be multiples of the sampling rate divided by the block length.
+  @par           Algorithm
+                   For a normalized frequency f (the frequency divided by the sampling rate) and
+                   c = 2 * cos(2 * pi * f), the Goertzel recurrence filters the N samples of the block:
+  <pre>
+      s[n] = x[n] + c * s[n-1] - s[n-2]
+  </pre>
+                   and the power is computed from its last two outputs:
+  <pre>
+      P = s[N-1]^2 + s[N-2]^2 - c * s[N-1] * s[N-2] = | sum(x[n] * exp(-j * 2 * pi * f * n)) |^2
+  </pre>
+                   The cost is one multiplication and two additions per sample and per frequency, so
+                   the bank needs fewer operations than a real FFT of the block up to about 2 * log2(N)
+                   frequencies, without any table and without constraint on N.
+  @par
+                   The RVV versions compute vl frequencies at once, each input sample being shared by
+                   all of them.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point Goertzel filter bank.
+  @param[in]     S          points to an instance of the floating-point Goertzel filter bank structure
+  @param[in]     pSrc       points to the block of S->blockLen input samples
+  @param[out]    pDst       points to the power of each frequency, S->numBins values
+ */
+RISCV_DSP_ATTRIBUTE void riscv_goertzel_bank_f32(
+  const riscv_goertzel_bank_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+  const float32_t *pCoeffs = S->pCoeffs;
+  uint32_t blkCnt = S->numBins;
+  uint32_t n;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  size_t vl;
+  vfloat32m4_t vc, vs0, vs1, vs2;
+
+  for (; (vl = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= vl)
+  {
+    vc = __riscv_vle32_v_f32m4(pCoeffs, vl);
+    vs1 = __riscv_vfmv_v_f_f32m4(0.0f, vl);
+    vs2 = vs1;
+
+    for (n = 0U; n < S->blockLen; n++)
+    {
+      /* s0 = x[n] + c * s1 - s2 */
+      vs0 = __riscv_vfmsac_vv_f32m4(vs2, vc, vs1, vl);
+      vs0 = __riscv_vfadd_vf_f32m4(vs0, pSrc[n], vl);
+      vs2 = vs1;
+      vs1 = vs0;
+    }
+
+    /* P = s1 * s1 + s2 * s2 - c * s1 * s2 */
+    vs0 = __riscv_vfmul_vv_f32m4(vs1, vs1, vl);
+    vs0 = __riscv_vfmacc_vv_f32m4(vs0, vs2, vs2, vl);
+    vs0 = __riscv_vfnmsac_vv_f32m4(vs0, __riscv_vfmul_vv_f32m4(vc, vs1, vl), vs2, vl);
+    __riscv_vse32_v_f32m4(pDst, vs0, vl);
+
+    pCoeffs += vl;
+    pDst += vl;
+  }
+#else
+  float32_t c, s0, s1, s2;
+
+  while (blkCnt > 0U)
+  {
+    c = *pCoeffs++;
+    s1 = 0.0f;
+    s2 = 0.0f;
+
+    for (n = 0U; n < S->blockLen; n++)
+    {
+      s0 = pSrc[n] + c * s1 - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+
+    *pDst++ = s1 * s1 + s2 * s2 - c * s1 * s2;
+
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/**
+  @} end of Goertzel group
+ */
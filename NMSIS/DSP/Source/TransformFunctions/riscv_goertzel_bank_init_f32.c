@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_bank_init_f32.c
+ * Description:  Floating-point Goertzel filter bank initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Goertzel filter bank.
+  @param[in,out] S          points to an instance of the floating-point Goertzel filter bank structure
+  @param[in]     numBins    number of frequencies
+  @param[in]     blockLen   number of samples of the blocks, at least 2
+  @param[in]     pFreqs     points to the normalized frequencies in [0, 0.5], frequencies divided by the sampling rate
+  @param[out]    pCoeffs    points to a buffer of numBins coefficients
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an argument is not supported
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_goertzel_bank_init_f32(
+        riscv_goertzel_bank_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs)
+{
+  if ((numBins == 0U) || (blockLen < 2U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint32_t k = 0U; k < numBins; k++)
+  {
+    if (!((pFreqs[k] >= 0.0f) && (pFreqs[k] <= 0.5f)))
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+    pCoeffs[k] = (float32_t)(2.0 * cos(RISCV_CFFT_MIXED_2PI * (float64_t)pFreqs[k]));
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->pCoeffs = pCoeffs;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_bank_init_q31.c
+ * Description:  Q31 Goertzel filter bank initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/fast_math_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 Goertzel filter bank.
+  @param[in,out] S          points to an instance of the Q31 Goertzel filter bank structure
+  @param[in]     numBins    number of frequencies
+  @param[in]     blockLen   number of samples of the blocks, at least 2
+  @param[in]     pFreqs     points to the normalized frequencies in [0, 0.5], frequencies divided by the sampling rate
+  @param[out]    pCoeffs    points to a buffer of numBins coefficients
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an argument is not supported
+
+  @par
+                   The output of the recurrence for a frequency f is bounded by
+                   blockLen * min(1 / |sin(2 * pi * f)|, (blockLen + 1) / 2) times the largest input,
+                   so S->shift is the smallest shift of the input samples for which the bound of all the
+                   frequencies is 1. The frequencies close to 0 and 0.5 need the largest shifts.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_goertzel_bank_init_q31(
+        riscv_goertzel_bank_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t blockLen,
+  const q31_t * pFreqs,
+        q31_t * pCoeffs)
+{
+  const q63_t N = blockLen;
+  uint32_t shift = 0U;
+  q63_t sinVal;
+  q31_t cosVal;
+
+  if ((numBins == 0U) || (blockLen < 2U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint32_t k = 0U; k < numBins; k++)
+  {
+    if ((pFreqs[k] < 0) || (pFreqs[k] > 0x40000000))
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+
+    /* -1 is excluded so that the rounded products never saturate */
+    cosVal = riscv_cos_q31(pFreqs[k]);
+    pCoeffs[k] = (cosVal < -0x7FFFFFFF) ? -0x7FFFFFFF : cosVal;
+
+    sinVal = riscv_sin_q31(pFreqs[k]);
+    sinVal = (sinVal < 0) ? -sinVal : sinVal;
+    while ((shift < 31U) && ((sinVal << shift) < (N << 31)) && ((1LL << shift) < (N * (N + 1)) / 2))
+    {
+      shift++;
+    }
+  }
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->shift = (uint8_t)shift;
+  S->pCoeffs = pCoeffs;
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
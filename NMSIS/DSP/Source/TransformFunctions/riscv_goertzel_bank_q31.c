@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_goertzel_bank_q31.c
+ * Description:  Q31 Goertzel filter bank
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 Goertzel filter bank.
+  @param[in]     S          points to an instance of the Q31 Goertzel filter bank structure
+  @param[in]     pSrc       points to the block of S->blockLen input samples
+  @param[out]    pDst       points to the power of each frequency, S->numBins values
+
+  @par           Scaling and Overflow Behavior
+                   The input samples are shifted right by S->shift bits, computed by
+                   \ref riscv_goertzel_bank_init_q31 so that the recurrence cannot overflow.
+                   The powers are in 3.29 format and are the powers of the DFT of the input divided
+                   by 2^(2 * S->shift).
+ */
+RISCV_DSP_ATTRIBUTE void riscv_goertzel_bank_q31(
+  const riscv_goertzel_bank_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst)
+{
+  const q31_t *pCoeffs = S->pCoeffs;
+  const uint32_t shift = S->shift;
+  uint32_t blkCnt = S->numBins;
+  uint32_t n;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  size_t vl;
+  vint32m4_t vc, vm, vs0, vs1, vs2;
+
+  for (; (vl = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= vl)
+  {
+    vc = __riscv_vle32_v_i32m4(pCoeffs, vl);
+    vs1 = __riscv_vmv_v_x_i32m4(0, vl);
+    vs2 = vs1;
+
+    for (n = 0U; n < S->blockLen; n++)
+    {
+      /* s0 = x[n] + 2 * cos * s1 - s2, the intermediate sums can wrap around */
+      vm = __riscv_vsmul_vv_i32m4(vc, vs1, __RISCV_VXRM_RNU, vl);
+      vs0 = __riscv_vsub_vv_i32m4(__riscv_vadd_vv_i32m4(vm, vm, vl), vs2, vl);
+      vs0 = __riscv_vadd_vx_i32m4(vs0, pSrc[n] >> shift, vl);
+      vs2 = vs1;
+      vs1 = vs0;
+    }
+
+    /* P = s1 * s1 + s2 * s2 - 2 * cos * s1 * s2 */
+    vm = __riscv_vsmul_vv_i32m4(vc, vs1, __RISCV_VXRM_RNU, vl);
+    vs0 = __riscv_vsra_vx_i32m4(__riscv_vmulh_vv_i32m4(vs1, vs1, vl), 1U, vl);
+    vs0 = __riscv_vadd_vv_i32m4(vs0, __riscv_vsra_vx_i32m4(__riscv_vmulh_vv_i32m4(vs2, vs2, vl), 1U, vl), vl);
+    vs0 = __riscv_vsub_vv_i32m4(vs0, __riscv_vmulh_vv_i32m4(vm, vs2, vl), vl);
+    __riscv_vse32_v_i32m4(pDst, vs0, vl);
+
+    pCoeffs += vl;
+    pDst += vl;
+  }
+#else
+  q31_t c, m, s0, s1, s2;
+
+  while (blkCnt > 0U)
+  {
+    c = *pCoeffs++;
+    s1 = 0;
+    s2 = 0;
+
+    for (n = 0U; n < S->blockLen; n++)
+    {
+      /* The result fits in 32 bits even when 2 * m does not */
+      m = (q31_t) (((q63_t) c * s1 + 0x40000000LL) >> 31);
+      s0 = (q31_t) ((q63_t) (pSrc[n] >> shift) + 2 * (q63_t) m - s2);
+      s2 = s1;
+      s1 = s0;
+    }
+
+    m = (q31_t) (((q63_t) c * s1 + 0x40000000LL) >> 31);
+    *pDst++ = (q31_t) (((q63_t) s1 * s1) >> 33) + (q31_t) (((q63_t) s2 * s2) >> 33)
+            - (q31_t) (((q63_t) m * s2) >> 32);
+
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_istft_f32.c
+ * Description:  Streaming ISTFT Floating point process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point ISTFT.
+  @param[in,out] S              points to an instance of the floating-point ISTFT structure
+  @param[in]     pSrc           points to the input spectra, frameLen values per frame, modified when RVV is not used
+  @param[in]     numFrames      number of input spectra
+  @param[out]    pDst           points to the output samples, hopLen values per frame
+  @param[in]     pTmp           points to a temporary buffer of riscv_stft_tmp_buffer_size() values
+  @return        none
+
+  @par           The frames are accumulated without scaling, the normalization factor is applied
+                 while the completed samples are copied to the output.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_istft_f32(
+  riscv_istft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t numFrames,
+  float32_t * pDst,
+  float32_t * pTmp)
+{
+  const uint32_t N = S->frameLen;
+  float32_t *pFrame = pTmp;
+  uint32_t first, n;
+
+  while (numFrames > 0U)
+  {
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    riscv_rfft_fast_f32(&S->rfft, pSrc, pFrame, pTmp + N, 1U);
+#else
+    riscv_rfft_fast_f32(&S->rfft, pSrc, pFrame, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+    /* Synthesis window, then overlap-add, the oldest sample being at pos */
+    riscv_mult_f32(pFrame, S->pWindow, pFrame, N);
+    first = N - S->pos;
+    riscv_add_f32(S->pState + S->pos, pFrame, S->pState + S->pos, first);
+    riscv_add_f32(S->pState, pFrame + first, S->pState, S->pos);
+
+    /* The hopLen oldest samples have received all their frames */
+    n = (S->hopLen < first) ? S->hopLen : first;
+    riscv_scale_f32(S->pState + S->pos, S->scale, pDst, n);
+    riscv_fill_f32(0.0f, S->pState + S->pos, n);
+    riscv_scale_f32(S->pState, S->scale, pDst + n, S->hopLen - n);
+    riscv_fill_f32(0.0f, S->pState, S->hopLen - n);
+    S->pos = (uint16_t)((S->pos + S->hopLen) % N);
+
+    pSrc += N;
+    pDst += S->hopLen;
+    numFrames--;
+  }
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_istft_q15.c
+ * Description:  Streaming ISTFT Q15 process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 ISTFT.
+  @param[in,out] S              points to an instance of the Q15 ISTFT structure
+  @param[in]     pSrc           points to the input spectra, frameLen + 2 values per frame
+  @param[in]     numFrames      number of input spectra
+  @param[out]    pDst           points to the output samples, hopLen values per frame
+  @param[in]     pTmp           points to a Q31 temporary buffer of riscv_stft_tmp_buffer_size() values
+  @return        none
+
+  @par           The frames are transformed, windowed and scaled by the normalization factor in Q31,
+                 then narrowed to Q15 and accumulated, so that the Q15 overlap-add buffer holds
+                 the output samples.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_istft_q15(
+  riscv_istft_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t numFrames,
+  q15_t * pDst,
+  q31_t * pTmp)
+{
+  const uint32_t N = S->frameLen;
+  q31_t *pFrame31 = pTmp;
+  q31_t *pSpec = pTmp + N;
+  q15_t *pFrame = (q15_t *)pSpec;
+  uint32_t first, n;
+
+  while (numFrames > 0U)
+  {
+    /* The spectrum is widened to Q31 for the inverse RFFT */
+    riscv_q15_to_q31(pSrc, pSpec, N + 2U);
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+    riscv_rfft_q31(&S->rfft, pSpec, pFrame31, pTmp + 2U * N + 2U, 1U);
+#else
+    riscv_rfft_q31(&S->rfft, pSpec, pFrame31);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+    /*
+     * Synthesis window and normalization before the narrowing, the frame being
+     * frameLen times smaller than the output samples
+     */
+    riscv_q15_to_q31(S->pWindow, pSpec, N);
+    riscv_mult_q31(pFrame31, pSpec, pFrame31, N);
+    riscv_scale_q31(pFrame31, S->scaleFract, S->shift, pFrame31, N);
+    riscv_q31_to_q15(pFrame31, pFrame, N);
+
+    /* Overlap-add, the oldest sample being at pos */
+    first = N - S->pos;
+    riscv_add_q15(S->pState + S->pos, pFrame, S->pState + S->pos, first);
+    riscv_add_q15(S->pState, pFrame + first, S->pState, S->pos);
+
+    /* The hopLen oldest samples have received all their frames */
+    n = (S->hopLen < first) ? S->hopLen : first;
+    riscv_copy_q15(S->pState + S->pos, pDst, n);
+    riscv_fill_q15(0, S->pState + S->pos, n);
+    riscv_copy_q15(S->pState, pDst + n, S->hopLen - n);
+    riscv_fill_q15(0, S->pState, S->hopLen - n);
+    S->pos = (uint16_t)((S->pos + S->hopLen) % N);
+
+    pSrc += N + 2U;
+    pDst += S->hopLen;
+    numFrames--;
+  }
+}
+
+/**
+  @} end of STFT group
+ */
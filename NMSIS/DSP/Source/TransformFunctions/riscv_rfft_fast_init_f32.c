@@ -29,9 +29,11 @@
  */
 
 #include <stdlib.h>
+#include <math.h>
 
 #include "dsp/transform_functions.h"
 #include "riscv_common_tables.h"
+#include "riscv_vec_fft.h"
 
 /**
   @ingroup RealFFT
@@ -338,8 +340,90 @@ RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_4096_f32( riscv_rfft_fast_
                  that you need at build time, then it is better to use the initialization
                  functions defined for each FFT size.
 
+  @par
+                 When the library is built with <code>RISCV_CFFT_RUNTIME_TABLES</code>, this function
+                 does not use the const tables either: the CFFT of fftLen/2 points is initialized by
+                 \ref riscv_cfft_init_f32 from its runtime table pool, and the real FFT twiddle factors
+                 are computed once per length into a static pool holding all the lengths up to
+                 2 * <code>RISCV_CFFT_RUNTIME_MAX_LEN</code>. \ref RISCV_MATH_LENGTH_ERROR is returned for
+                 the longer lengths.
  */
 
+#if defined(RISCV_CFFT_RUNTIME_TABLES)
+
+/* The real FFT twiddle factors take fftLen values, the lengths 32 to N take less than 2 * N */
+#if RISCV_CFFT_RUNTIME_MAX_LEN >= 2048U
+#define RISCV_RFFT_RUNTIME_MAX_LEN 4096U
+#else
+#define RISCV_RFFT_RUNTIME_MAX_LEN (2U * RISCV_CFFT_RUNTIME_MAX_LEN)
+#endif
+
+/* Twiddle factors of the lengths 32 to 4096 computed so far, slot i holding the length 32 << i */
+static float32_t riscv_rfft_runtime_pool[2U * RISCV_RFFT_RUNTIME_MAX_LEN];
+static uint32_t riscv_rfft_runtime_pool_used = 0U;
+static float32_t *riscv_rfft_runtime_twiddles[8];
+
+RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_f32(
+  riscv_rfft_fast_instance_f32 * S,
+  uint16_t fftLen)
+{
+  riscv_status status;
+  float32_t *pTwiddle;
+  float64_t angle;
+  uint32_t slot = 0U;
+
+  if ((S == NULL) || (fftLen < 32U) || (fftLen > 4096U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+  if (fftLen > RISCV_RFFT_RUNTIME_MAX_LEN)
+  {
+    return RISCV_MATH_LENGTH_ERROR;
+  }
+
+  status = riscv_cfft_init_f32(&(S->Sint), fftLen / 2U);
+  if (status != RISCV_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  while ((32U << slot) < fftLen)
+  {
+    slot++;
+  }
+  pTwiddle = riscv_rfft_runtime_twiddles[slot];
+
+  if (pTwiddle == NULL)
+  {
+    pTwiddle = riscv_rfft_runtime_pool + riscv_rfft_runtime_pool_used;
+    for (uint32_t k = 0U; k < fftLen / 2U; k++)
+    {
+      angle = RISCV_CFFT_MIXED_2PI * (float64_t)k / (float64_t)fftLen;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+      /* Same as riscv_rvv_rfft_twdre/twdim: cos(2*pi*k/N), then -sin(2*pi*k/N) */
+      pTwiddle[k] = (float32_t)cos(angle);
+      pTwiddle[fftLen / 2U + k] = (float32_t)-sin(angle);
+#else
+      /* Same as twiddleCoef_rfft_N: sin(2*pi*k/N), cos(2*pi*k/N) */
+      pTwiddle[2U * k] = (float32_t)sin(angle);
+      pTwiddle[2U * k + 1U] = (float32_t)cos(angle);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+    }
+    riscv_rfft_runtime_pool_used += fftLen;
+    riscv_rfft_runtime_twiddles[slot] = pTwiddle;
+  }
+
+  S->fftLenRFFT = fftLen;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  S->ptwd_re = pTwiddle;
+  S->ptwd_im = pTwiddle + fftLen / 2U;
+#else
+  S->pTwiddleRFFT = pTwiddle;
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  return RISCV_MATH_SUCCESS;
+}
+#else
 RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_f32(
   riscv_rfft_fast_instance_f32 * S,
   uint16_t fftLen)
@@ -381,6 +465,7 @@ RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_f32(
   return(status);
 
 }
+#endif /* defined(RISCV_CFFT_RUNTIME_TABLES) */
 
 #if defined(RFFT_INIT)
  #undef RFFT_INIT
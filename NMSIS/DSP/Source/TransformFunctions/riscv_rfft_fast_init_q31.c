@@ -0,0 +1,223 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_fast_init_q31.c
+ * Description:  Initialization function for the Q31 fast real FFT
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "riscv_common_tables.h"
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+#include "riscv_rvv_tables.h"
+#define RFFT_FAST_INIT_Q31(LEN, CFFTLEN, TWIDMOD)                              \
+    RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_##LEN##_q31(         \
+        riscv_rfft_fast_instance_q31 *S)                                       \
+    {                                                                          \
+        riscv_status status;                                                   \
+        if (!S)                                                                \
+            return RISCV_MATH_ARGUMENT_ERROR;                                  \
+        status = riscv_cfft_init_##CFFTLEN##_q31(&(S->Sint));                  \
+        if (status != RISCV_MATH_SUCCESS) {                                    \
+            return (status);                                                   \
+        }                                                                      \
+        S->fftLenRFFT = LEN;                                                   \
+        S->ptwd_re = riscv_rvv_rfft_twdre_##LEN##_q31;                         \
+        S->ptwd_im = riscv_rvv_rfft_twdim_##LEN##_q31;                         \
+        return RISCV_MATH_SUCCESS;                                             \
+    }
+#else
+#define RFFT_FAST_INIT_Q31(LEN, CFFTLEN, TWIDMOD)                              \
+    RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_##LEN##_q31(         \
+        riscv_rfft_fast_instance_q31 *S)                                       \
+    {                                                                          \
+        riscv_status status;                                                   \
+        if (!S)                                                                \
+            return RISCV_MATH_ARGUMENT_ERROR;                                  \
+        status = riscv_cfft_init_##CFFTLEN##_q31(&(S->Sint));                  \
+        if (status != RISCV_MATH_SUCCESS) {                                    \
+            return (status);                                                   \
+        }                                                                      \
+        S->fftLenRFFT = LEN;                                                   \
+        S->twidCoefRModifier = TWIDMOD;                                        \
+        S->pTwiddleAReal = realCoefAQ31;                                       \
+        return RISCV_MATH_SUCCESS;                                             \
+    }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+/**
+  @addtogroup RealFFTQ31
+  @{
+ */
+
+/**
+  @brief         Initialization function for the 32pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(32, 16, 256)
+
+/**
+  @brief         Initialization function for the 64pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(64, 32, 128)
+
+/**
+  @brief         Initialization function for the 128pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(128, 64, 64)
+
+/**
+  @brief         Initialization function for the 256pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(256, 128, 32)
+
+/**
+  @brief         Initialization function for the 512pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(512, 256, 16)
+
+/**
+  @brief         Initialization function for the 1024pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(1024, 512, 8)
+
+/**
+  @brief         Initialization function for the 2048pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(2048, 1024, 4)
+
+/**
+  @brief         Initialization function for the 4096pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(4096, 2048, 2)
+
+/**
+  @brief         Initialization function for the 8192pt Q31 fast real FFT.
+  @param[in,out] S  points to an riscv_rfft_fast_instance_q31 structure
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an error is detected
+ */
+RFFT_FAST_INIT_Q31(8192, 4096, 1)
+
+/**
+  @brief         Generic initialization function for the Q31 fast real FFT.
+  @param[in,out] S       points to an riscv_rfft_fast_instance_q31 structure
+  @param[in]     fftLen  length of the Real Sequence
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Description
+                   The parameter <code>fftLen</code> specifies the length of RFFT/RIFFT process.
+                   Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192.
+                   The instance is shared by the RFFT and the RIFFT, the direction is selected
+                   when calling \ref riscv_rfft_fast_q31.
+
+  @par
+                 This function should be used only if you don't know the FFT sizes that
+                 you'll need at build time. The use of this function will prevent the
+                 linker from removing the FFT tables that are not needed and the library
+                 code size will be bigger than needed.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_fast_init_q31(
+  riscv_rfft_fast_instance_q31 * S,
+  uint16_t fftLen)
+{
+  riscv_status status;
+
+  switch (fftLen)
+  {
+  case 8192U:
+    status = riscv_rfft_fast_init_8192_q31(S);
+    break;
+  case 4096U:
+    status = riscv_rfft_fast_init_4096_q31(S);
+    break;
+  case 2048U:
+    status = riscv_rfft_fast_init_2048_q31(S);
+    break;
+  case 1024U:
+    status = riscv_rfft_fast_init_1024_q31(S);
+    break;
+  case 512U:
+    status = riscv_rfft_fast_init_512_q31(S);
+    break;
+  case 256U:
+    status = riscv_rfft_fast_init_256_q31(S);
+    break;
+  case 128U:
+    status = riscv_rfft_fast_init_128_q31(S);
+    break;
+  case 64U:
+    status = riscv_rfft_fast_init_64_q31(S);
+    break;
+  case 32U:
+    status = riscv_rfft_fast_init_32_q31(S);
+    break;
+  default:
+    status = RISCV_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+#undef RFFT_FAST_INIT_Q31
+
+/**
+  @} end of RealFFTQ31 group
+ */
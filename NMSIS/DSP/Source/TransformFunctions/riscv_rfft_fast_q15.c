@@ -0,0 +1,287 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_fast_q15.c
+ * Description:  Q15 fast real FFT with a half length complex FFT
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/*
+ * Split the L = fftLen/2 points complex FFT Z of the packed real sequence into the
+ * first half of its real FFT X, scaled down by 2 so that X = DFT / fftLen:
+ *   E = (Z[k] + conj(Z[L-k])) / 4, D = (Z[k] - conj(Z[L-k])) / 4, T = -i * w^k * D
+ *   X[k] = E + T, X[L-k] = conj(E - T)
+ * X[k] and X[L-k] are computed together from the same inputs, so pSrc and pDst can
+ * be the same buffer.
+ */
+static void riscv_rfft_fast_split_q15(
+  const riscv_rfft_fast_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst)
+{
+  const uint32_t L = S->fftLenRFFT >> 1U;
+  uint32_t k = 1U;
+  uint32_t blkCnt = (L >> 1U) - 1U;
+  q15_t re = pSrc[0], im = pSrc[1];
+
+  /* X[0] and X[L] are real, X[L] is packed in the imaginary part of X[0] */
+  pDst[0] = (q15_t)(((q31_t)re + im) >> 1);
+  pDst[1] = (q15_t)(((q31_t)re - im) >> 1);
+
+  /* w^(L/2) = -i, so X[L/2] = conj(Z[L/2]) / 2 */
+  re = pSrc[L];
+  im = pSrc[L + 1U];
+  pDst[L] = (q15_t)(re >> 1);
+  pDst[L + 1U] = (q15_t)(-(im >> 1));
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const q15_t *pTwRe = S->ptwd_re + 1;
+  const q15_t *pTwIm = S->ptwd_im + 1;
+  size_t vl;
+  vint16m2x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e16m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e16_v_i16m2x2(pSrc + 2 * k, vl);
+    vint16m2_t va_re = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 0);
+    vint16m2_t va_im = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 1);
+    /* Z[L-k] is read and X[L-k] written backwards */
+    v_tuple = __riscv_vlsseg2e16_v_i16m2x2(pSrc + 2 * (L - k), -4, vl);
+    vint16m2_t vb_re = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 0);
+    vint16m2_t vb_im = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 1);
+    vint16m2_t vtw_re = __riscv_vle16_v_i16m2(pTwRe, vl);
+    vint16m2_t vtw_im = __riscv_vle16_v_i16m2(pTwIm, vl);
+    pTwRe += vl;
+    pTwIm += vl;
+
+    vint16m2_t ve_re = __riscv_vsra_vx_i16m2(__riscv_vaadd_vv_i16m2(va_re, vb_re, __RISCV_VXRM_RDN, vl), 1, vl);
+    vint16m2_t ve_im = __riscv_vsra_vx_i16m2(__riscv_vasub_vv_i16m2(va_im, vb_im, __RISCV_VXRM_RDN, vl), 1, vl);
+    vint16m2_t vd_re = __riscv_vsra_vx_i16m2(__riscv_vasub_vv_i16m2(va_re, vb_re, __RISCV_VXRM_RDN, vl), 1, vl);
+    vint16m2_t vd_im = __riscv_vsra_vx_i16m2(__riscv_vaadd_vv_i16m2(va_im, vb_im, __RISCV_VXRM_RDN, vl), 1, vl);
+
+    /* T.re = w.re * D.im + w.im * D.re, T.im = w.im * D.im - w.re * D.re */
+    vint16m2_t vt_re = __riscv_vadd_vv_i16m2(__riscv_vsmul_vv_i16m2(vtw_re, vd_im, __RISCV_VXRM_RNU, vl),
+                                             __riscv_vsmul_vv_i16m2(vtw_im, vd_re, __RISCV_VXRM_RNU, vl), vl);
+    vint16m2_t vt_im = __riscv_vsub_vv_i16m2(__riscv_vsmul_vv_i16m2(vtw_im, vd_im, __RISCV_VXRM_RNU, vl),
+                                             __riscv_vsmul_vv_i16m2(vtw_re, vd_re, __RISCV_VXRM_RNU, vl), vl);
+
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 0, __riscv_vsadd_vv_i16m2(ve_re, vt_re, vl));
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 1, __riscv_vsadd_vv_i16m2(ve_im, vt_im, vl));
+    __riscv_vsseg2e16_v_i16m2x2(pDst + 2 * k, v_tuple, vl);
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 0, __riscv_vssub_vv_i16m2(ve_re, vt_re, vl));
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 1, __riscv_vssub_vv_i16m2(vt_im, ve_im, vl));
+    __riscv_vssseg2e16_v_i16m2x2(pDst + 2 * (L - k), -4, v_tuple, vl);
+
+    k += vl;
+  }
+#else
+  const q15_t *pCoefA = S->pTwiddleAReal;
+  const uint32_t modifier = S->twidCoefRModifier;
+  q15_t er, ei, dr, di, wr, wi, tr, ti;
+
+  while (blkCnt > 0U)
+  {
+    er = (q15_t)(((q31_t)pSrc[2 * k] + pSrc[2 * (L - k)]) >> 2);
+    ei = (q15_t)(((q31_t)pSrc[2 * k + 1] - pSrc[2 * (L - k) + 1]) >> 2);
+    dr = (q15_t)(((q31_t)pSrc[2 * k] - pSrc[2 * (L - k)]) >> 2);
+    di = (q15_t)(((q31_t)pSrc[2 * k + 1] + pSrc[2 * (L - k) + 1]) >> 2);
+
+    /* pATable[2 * i] = (1 - sin) / 2 and pATable[2 * i + 1] = -cos / 2, so w / 2 is read from it */
+    wr = (q15_t)(-pCoefA[2 * k * modifier + 1]);
+    wi = (q15_t)(pCoefA[2 * k * modifier] - 0x4000);
+
+    tr = (q15_t)(((q31_t)wr * di + (q31_t)wi * dr) >> 14);
+    ti = (q15_t)(((q31_t)wi * di - (q31_t)wr * dr) >> 14);
+
+    pDst[2 * k]           = clip_q31_to_q15((q31_t)er + tr);
+    pDst[2 * k + 1]       = clip_q31_to_q15((q31_t)ei + ti);
+    pDst[2 * (L - k)]     = clip_q31_to_q15((q31_t)er - tr);
+    pDst[2 * (L - k) + 1] = clip_q31_to_q15((q31_t)ti - ei);
+
+    k++;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/*
+ * Merge the first half of a real FFT X into the L = fftLen/2 points complex FFT Z
+ * of the packed real sequence:
+ *   E = (X[k] + conj(X[L-k])) / 2, D = (X[k] - conj(X[L-k])) / 2, U = i * conj(w^k) * D
+ *   Z[k] = E + U, Z[L-k] = conj(E - U)
+ * pSrc and pDst can be the same buffer.
+ */
+static void riscv_rfft_fast_merge_q15(
+  const riscv_rfft_fast_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst)
+{
+  const uint32_t L = S->fftLenRFFT >> 1U;
+  uint32_t k = 1U;
+  uint32_t blkCnt = (L >> 1U) - 1U;
+  q15_t re = pSrc[0], im = pSrc[1];
+
+  pDst[0] = (q15_t)(((q31_t)re + im) >> 1);
+  pDst[1] = (q15_t)(((q31_t)re - im) >> 1);
+
+  /* Z[L/2] = conj(X[L/2]) */
+  pDst[L] = pSrc[L];
+  pDst[L + 1U] = (pSrc[L + 1U] == (q15_t)0x8000) ? 0x7FFF : (q15_t)(-pSrc[L + 1U]);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  const q15_t *pTwRe = S->ptwd_re + 1;
+  const q15_t *pTwIm = S->ptwd_im + 1;
+  size_t vl;
+  vint16m2x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e16m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e16_v_i16m2x2(pSrc + 2 * k, vl);
+    vint16m2_t va_re = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 0);
+    vint16m2_t va_im = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 1);
+    /* X[L-k] is read and Z[L-k] written backwards */
+    v_tuple = __riscv_vlsseg2e16_v_i16m2x2(pSrc + 2 * (L - k), -4, vl);
+    vint16m2_t vb_re = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 0);
+    vint16m2_t vb_im = __riscv_vget_v_i16m2x2_i16m2(v_tuple, 1);
+    vint16m2_t vtw_re = __riscv_vle16_v_i16m2(pTwRe, vl);
+    vint16m2_t vtw_im = __riscv_vle16_v_i16m2(pTwIm, vl);
+    pTwRe += vl;
+    pTwIm += vl;
+
+    vint16m2_t ve_re = __riscv_vaadd_vv_i16m2(va_re, vb_re, __RISCV_VXRM_RDN, vl);
+    vint16m2_t ve_im = __riscv_vasub_vv_i16m2(va_im, vb_im, __RISCV_VXRM_RDN, vl);
+    vint16m2_t vd_re = __riscv_vasub_vv_i16m2(va_re, vb_re, __RISCV_VXRM_RDN, vl);
+    vint16m2_t vd_im = __riscv_vaadd_vv_i16m2(va_im, vb_im, __RISCV_VXRM_RDN, vl);
+
+    /* U.re = w.im * D.re - w.re * D.im, U.im = w.re * D.re + w.im * D.im */
+    vint16m2_t vu_re = __riscv_vssub_vv_i16m2(__riscv_vsmul_vv_i16m2(vtw_im, vd_re, __RISCV_VXRM_RNU, vl),
+                                              __riscv_vsmul_vv_i16m2(vtw_re, vd_im, __RISCV_VXRM_RNU, vl), vl);
+    vint16m2_t vu_im = __riscv_vsadd_vv_i16m2(__riscv_vsmul_vv_i16m2(vtw_re, vd_re, __RISCV_VXRM_RNU, vl),
+                                              __riscv_vsmul_vv_i16m2(vtw_im, vd_im, __RISCV_VXRM_RNU, vl), vl);
+
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 0, __riscv_vsadd_vv_i16m2(ve_re, vu_re, vl));
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 1, __riscv_vsadd_vv_i16m2(ve_im, vu_im, vl));
+    __riscv_vsseg2e16_v_i16m2x2(pDst + 2 * k, v_tuple, vl);
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 0, __riscv_vssub_vv_i16m2(ve_re, vu_re, vl));
+    v_tuple = __riscv_vset_v_i16m2_i16m2x2(v_tuple, 1, __riscv_vssub_vv_i16m2(vu_im, ve_im, vl));
+    __riscv_vssseg2e16_v_i16m2x2(pDst + 2 * (L - k), -4, v_tuple, vl);
+
+    k += vl;
+  }
+#else
+  const q15_t *pCoefA = S->pTwiddleAReal;
+  const uint32_t modifier = S->twidCoefRModifier;
+  q15_t er, ei, dr, di, wr, wi, ur, ui;
+
+  while (blkCnt > 0U)
+  {
+    er = (q15_t)(((q31_t)pSrc[2 * k] + pSrc[2 * (L - k)]) >> 1);
+    ei = (q15_t)(((q31_t)pSrc[2 * k + 1] - pSrc[2 * (L - k) + 1]) >> 1);
+    dr = (q15_t)(((q31_t)pSrc[2 * k] - pSrc[2 * (L - k)]) >> 1);
+    di = (q15_t)(((q31_t)pSrc[2 * k + 1] + pSrc[2 * (L - k) + 1]) >> 1);
+
+    wr = (q15_t)(-pCoefA[2 * k * modifier + 1]);
+    wi = (q15_t)(pCoefA[2 * k * modifier] - 0x4000);
+
+    ur = clip_q31_to_q15(((q31_t)wi * dr - (q31_t)wr * di) >> 14);
+    ui = clip_q31_to_q15(((q31_t)wr * dr + (q31_t)wi * di) >> 14);
+
+    pDst[2 * k]           = clip_q31_to_q15((q31_t)er + ur);
+    pDst[2 * k + 1]       = clip_q31_to_q15((q31_t)ei + ui);
+    pDst[2 * (L - k)]     = clip_q31_to_q15((q31_t)er - ur);
+    pDst[2 * (L - k) + 1] = clip_q31_to_q15((q31_t)ui - ei);
+
+    k++;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/**
+  @addtogroup RealFFTQ15
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 fast RFFT/RIFFT.
+  @param[in]     S         points to an instance of the Q15 fast RFFT/RIFFT structure
+  @param[in]     pSrc      points to the input buffer of <code>fftLen</code> values, not modified
+  @param[out]    pDst      points to the output buffer of <code>fftLen</code> values
+  @param[in]     pTmp      points to a temporary buffer of \ref riscv_rfft_fast_tmp_buffer_size values,
+                           not used (and can be NULL) without RVV
+  @param[in]     ifftFlag  flag that selects transform direction
+                   - value = 0: RFFT, real input and packed complex output
+                   - value = 1: RIFFT, packed complex input and real output
+
+  @par           Description
+                   The real sequence of fftLen values is seen as a complex sequence of fftLen/2 values,
+                   whose complex FFT is split into the real FFT (or merged from it for the RIFFT) with
+                   one pass over the data which computes the bins k and fftLen/2 - k together.
+                   The output uses the packed format of \ref riscv_rfft_fast_f32: the real DC and Nyquist
+                   values, followed by the fftLen/2 - 1 complex values of the first half of the spectrum.
+                   Compared to \ref riscv_rfft_q15, the input is not modified, the output is only fftLen
+                   values long and pSrc and pDst can be the same buffer.
+  @par           Scaling
+                   The RFFT output is scaled down by 1/fftLen, as the one of \ref riscv_rfft_q15.
+                   The RIFFT is not scaled further, so the RIFFT of the RFFT of x is x/fftLen.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_rfft_fast_q15(
+  const riscv_rfft_fast_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pTmp,
+        uint8_t ifftFlag)
+{
+  if (ifftFlag)
+  {
+    riscv_rfft_fast_merge_q15(S, pSrc, pDst);
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+    riscv_cfft_q15(&(S->Sint), pDst, pDst, pTmp, 1U);
+#else
+    (void)pTmp;
+    riscv_cfft_q15(&(S->Sint), pDst, 1U, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+  }
+  else
+  {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+    riscv_cfft_q15(&(S->Sint), pSrc, pDst, pTmp, 0U);
+#else
+    (void)pTmp;
+    if (pDst != pSrc)
+    {
+      riscv_copy_q15(pSrc, pDst, S->fftLenRFFT);
+    }
+    riscv_cfft_q15(&(S->Sint), pDst, 0U, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+    riscv_rfft_fast_split_q15(S, pDst, pDst);
+  }
+}
+
+/**
+  @} end of RealFFTQ15 group
+ */
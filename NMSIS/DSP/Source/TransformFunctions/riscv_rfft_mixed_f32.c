@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_mixed_f32.c
+ * Description:  Mixed-radix RFFT & RIFFT Floating point process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/*
+ * Split the L = fftLen/2 points complex FFT Z of the packed real sequence into the
+ * first half of its real FFT X:
+ *   E = (Z[k] + conj(Z[L-k])) / 2, D = (Z[k] - conj(Z[L-k])) / 2
+ *   X[k] = E - i * w^k * D
+ */
+static void riscv_rfft_mixed_split_f32(
+  const float32_t * pSrc,
+  const float32_t * pTw,
+        float32_t * pDst,
+        uint32_t L)
+{
+  uint32_t k = 1U;
+  uint32_t blkCnt = L - 1U;
+
+  /* X[0] and X[L] are real, X[L] is packed in the imaginary part of X[0] */
+  pDst[0] = pSrc[0] + pSrc[1];
+  pDst[1] = pSrc[0] - pSrc[1];
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  size_t vl;
+  vfloat32m1x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e32_v_f32m1x2(pSrc + 2 * k, vl);
+    vfloat32m1_t va_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    /* Z[L-k] is read backwards */
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 2 * (L - k), -8, vl);
+    vfloat32m1_t vb_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vb_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m1x2(pTw + 2 * k, vl);
+    vfloat32m1_t vtw_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vtw_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    vfloat32m1_t ve_re = __riscv_vfmul_vf_f32m1(__riscv_vfadd_vv_f32m1(va_re, vb_re, vl), 0.5f, vl);
+    vfloat32m1_t ve_im = __riscv_vfmul_vf_f32m1(__riscv_vfsub_vv_f32m1(va_im, vb_im, vl), 0.5f, vl);
+    vfloat32m1_t vd_re = __riscv_vfmul_vf_f32m1(__riscv_vfsub_vv_f32m1(va_re, vb_re, vl), 0.5f, vl);
+    vfloat32m1_t vd_im = __riscv_vfmul_vf_f32m1(__riscv_vfadd_vv_f32m1(va_im, vb_im, vl), 0.5f, vl);
+
+    /* X.re = E.re + (w.re * D.im + w.im * D.re), X.im = E.im - (w.re * D.re - w.im * D.im) */
+    ve_re = __riscv_vfmacc_vv_f32m1(ve_re, vtw_re, vd_im, vl);
+    ve_re = __riscv_vfmacc_vv_f32m1(ve_re, vtw_im, vd_re, vl);
+    ve_im = __riscv_vfnmsac_vv_f32m1(ve_im, vtw_re, vd_re, vl);
+    ve_im = __riscv_vfmacc_vv_f32m1(ve_im, vtw_im, vd_im, vl);
+
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, ve_re);
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, ve_im);
+    __riscv_vsseg2e32_v_f32m1x2(pDst + 2 * k, v_tuple, vl);
+
+    k += vl;
+  }
+#else
+  float32_t er, ei, dr, di, wr, wi;
+
+  while (blkCnt > 0U)
+  {
+    er = 0.5f * (pSrc[2 * k] + pSrc[2 * (L - k)]);
+    ei = 0.5f * (pSrc[2 * k + 1] - pSrc[2 * (L - k) + 1]);
+    dr = 0.5f * (pSrc[2 * k] - pSrc[2 * (L - k)]);
+    di = 0.5f * (pSrc[2 * k + 1] + pSrc[2 * (L - k) + 1]);
+    wr = pTw[2 * k];
+    wi = pTw[2 * k + 1];
+
+    pDst[2 * k]     = er + (wr * di + wi * dr);
+    pDst[2 * k + 1] = ei - (wr * dr - wi * di);
+
+    k++;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/*
+ * Merge the first half of a real FFT X into the L = fftLen/2 points complex FFT Z
+ * of the packed real sequence:
+ *   E = (X[k] + conj(X[L-k])) / 2, D = (X[k] - conj(X[L-k])) / 2
+ *   Z[k] = E + i * conj(w^k) * D
+ */
+static void riscv_rfft_mixed_merge_f32(
+  const float32_t * pSrc,
+  const float32_t * pTw,
+        float32_t * pDst,
+        uint32_t L)
+{
+  uint32_t k = 1U;
+  uint32_t blkCnt = L - 1U;
+
+  pDst[0] = 0.5f * (pSrc[0] + pSrc[1]);
+  pDst[1] = 0.5f * (pSrc[0] - pSrc[1]);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  size_t vl;
+  vfloat32m1x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e32m1(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e32_v_f32m1x2(pSrc + 2 * k, vl);
+    vfloat32m1_t va_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t va_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    /* X[L-k] is read backwards */
+    v_tuple = __riscv_vlsseg2e32_v_f32m1x2(pSrc + 2 * (L - k), -8, vl);
+    vfloat32m1_t vb_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vb_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m1x2(pTw + 2 * k, vl);
+    vfloat32m1_t vtw_re = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 0);
+    vfloat32m1_t vtw_im = __riscv_vget_v_f32m1x2_f32m1(v_tuple, 1);
+
+    vfloat32m1_t ve_re = __riscv_vfmul_vf_f32m1(__riscv_vfadd_vv_f32m1(va_re, vb_re, vl), 0.5f, vl);
+    vfloat32m1_t ve_im = __riscv_vfmul_vf_f32m1(__riscv_vfsub_vv_f32m1(va_im, vb_im, vl), 0.5f, vl);
+    vfloat32m1_t vd_re = __riscv_vfmul_vf_f32m1(__riscv_vfsub_vv_f32m1(va_re, vb_re, vl), 0.5f, vl);
+    vfloat32m1_t vd_im = __riscv_vfmul_vf_f32m1(__riscv_vfadd_vv_f32m1(va_im, vb_im, vl), 0.5f, vl);
+
+    /* Z.re = E.re - (w.re * D.im - w.im * D.re), Z.im = E.im + (w.re * D.re + w.im * D.im) */
+    ve_re = __riscv_vfnmsac_vv_f32m1(ve_re, vtw_re, vd_im, vl);
+    ve_re = __riscv_vfmacc_vv_f32m1(ve_re, vtw_im, vd_re, vl);
+    ve_im = __riscv_vfmacc_vv_f32m1(ve_im, vtw_re, vd_re, vl);
+    ve_im = __riscv_vfmacc_vv_f32m1(ve_im, vtw_im, vd_im, vl);
+
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 0, ve_re);
+    v_tuple = __riscv_vset_v_f32m1_f32m1x2(v_tuple, 1, ve_im);
+    __riscv_vsseg2e32_v_f32m1x2(pDst + 2 * k, v_tuple, vl);
+
+    k += vl;
+  }
+#else
+  float32_t er, ei, dr, di, wr, wi;
+
+  while (blkCnt > 0U)
+  {
+    er = 0.5f * (pSrc[2 * k] + pSrc[2 * (L - k)]);
+    ei = 0.5f * (pSrc[2 * k + 1] - pSrc[2 * (L - k) + 1]);
+    dr = 0.5f * (pSrc[2 * k] - pSrc[2 * (L - k)]);
+    di = 0.5f * (pSrc[2 * k + 1] + pSrc[2 * (L - k) + 1]);
+    wr = pTw[2 * k];
+    wi = pTw[2 * k + 1];
+
+    pDst[2 * k]     = er - (wr * di - wi * dr);
+    pDst[2 * k + 1] = ei + (wr * dr + wi * di);
+
+    k++;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+}
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix real FFT.
+  @param[in]     S              points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     pIn            points to the input buffer of <code>fftLen</code> values, not modified
+  @param[out]    pOut           points to the output buffer of <code>fftLen</code> values
+  @param[in]     pBuffer        points to a temporary buffer of size <code>2*fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: RFFT, real input and packed complex output
+                   - value = 1: RIFFT, packed complex input and real output
+  @return        none
+
+  @par           The RFFT is not scaled and the RIFFT is scaled by 1/fftLen.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_rfft_mixed_f32(
+  const riscv_rfft_mixed_instance_f32 * S,
+  const float32_t * pIn,
+        float32_t * pOut,
+        float32_t * pBuffer,
+        uint8_t ifftFlag)
+{
+  const riscv_cfft_mixed_instance_f32 *Sint = &(S->Sint);
+  float32_t *pTmp = pBuffer + S->fftLenRFFT;
+
+  if (ifftFlag)
+  {
+    riscv_rfft_mixed_merge_f32(pIn, S->pTwiddleRFFT, pTmp, Sint->fftLen);
+    riscv_cfft_mixed_f32(Sint, pTmp, pOut, pBuffer, 1U);
+  }
+  else
+  {
+    riscv_cfft_mixed_f32(Sint, pIn, pTmp, pBuffer, 0U);
+    riscv_rfft_mixed_split_f32(pTmp, S->pTwiddleRFFT, pOut, Sint->fftLen);
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
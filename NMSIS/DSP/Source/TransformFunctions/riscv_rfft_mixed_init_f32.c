@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix rfft f32 instance
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix real FFT.
+  @param[in,out] S              points to an instance of the floating-point mixed-radix RFFT structure
+  @param[in]     fftLen         length of the real sequence, twice a product of 2, 3 and 5 (at least 4)
+  @param[out]    pTwiddle       points to the twiddle buffer filled by this function, of
+                                riscv_rfft_mixed_twiddle_buffer_size(RISCV_MATH_F32, fftLen) values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : fftLen/2 is not a product of 2, 3 and 5
+
+  @par           The twiddle buffer holds the twiddle factors of the fftLen/2 points CFFT
+                 followed by the fftLen/2 twiddle factors of the real stage.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_rfft_mixed_init_f32(
+  riscv_rfft_mixed_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle)
+{
+  uint32_t L = fftLen / 2U;
+  float64_t angle;
+
+  if ((fftLen & 1U) != 0U)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  if (riscv_cfft_mixed_init_f32(&(S->Sint), L, pTwiddle) != RISCV_MATH_SUCCESS)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLenRFFT = fftLen;
+
+  /* Real stage twiddles w^k = exp(-2*pi*i * k / fftLen) */
+  pTwiddle += 2U * riscv_cfft_mixed_twiddle_count(L);
+  S->pTwiddleRFFT = pTwiddle;
+  for (uint32_t k = 0U; k < L; k++)
+  {
+    angle = RISCV_CFFT_MIXED_2PI * (float64_t)k / (float64_t)fftLen;
+    *pTwiddle++ = (float32_t)cos(angle);
+    *pTwiddle++ = (float32_t)-sin(angle);
+  }
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
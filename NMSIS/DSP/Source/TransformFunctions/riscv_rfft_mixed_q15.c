@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_rfft_mixed_q15.c
+ * Description:  Mixed-radix RFFT & RIFFT Q15 process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/*
+ * Split the L = fftLen/2 points complex FFT Z of the packed real sequence into the
+ * first half of its real FFT X, scaled down by 2 so that X = DFT / fftLen:
+ *   E = (Z[k] + conj(Z[L-k])) / 4, D = (Z[k] - conj(Z[L-k])) / 4
+ *   X[k] = E - i * w^k * D
+ */
+static void riscv_rfft_mixed_split_q15(
+  const q15_t * pSrc,
+  const q15_t * pTw,
+        q15_t * pDst,
+        uint32_t L)
+{
+  uint32_t k = 1U;
+  uint32_t blkCnt = L - 1U;
+
+  /* X[0] and X[L] are real, X[L] is packed in the imaginary part of X[0] */
+  pDst[0] = (q15_t)(((q31_t)pSrc[0] + pSrc[1]) >> 1);
+  pDst[1] = (q15_t)(((q31_t)pSrc[0] - pSrc[1]) >> 1);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  size_t vl;
+  vint16m1x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e16m1(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e16_v_i16m1x2(pSrc + 2 * k, vl);
+    vint16m1_t va_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vint16m1_t va_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+    /* Z[L-k] is read backwards */
+    v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pSrc + 2 * (L - k), -4, vl);
+    vint16m1_t vb_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vint16m1_t vb_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e16_v_i16m1x2(pTw + 2 * k, vl);
+    vint16m1_t vtw_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vint16m1_t vtw_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+
+    vint16m1_t ve_re = __riscv_vsra_vx_i16m1(__riscv_vaadd_vv_i16m1(va_re, vb_re, __RISCV_VXRM_RDN, vl), 1, vl);
+    vint16m1_t ve_im = __riscv_vsra_vx_i16m1(__riscv_vasub_vv_i16m1(va_im, vb_im, __RISCV_VXRM_RDN, vl), 1, vl);
+    vint16m1_t vd_re = __riscv_vsra_vx_i16m1(__riscv_vasub_vv_i16m1(va_re, vb_re, __RISCV_VXRM_RDN, vl), 1, vl);
+    vint16m1_t vd_im = __riscv_vsra_vx_i16m1(__riscv_vaadd_vv_i16m1(va_im, vb_im, __RISCV_VXRM_RDN, vl), 1, vl);
+
+    /* X.re = E.re + (w.re * D.im + w.im * D.re), X.im = E.im - (w.re * D.re - w.im * D.im) */
+    ve_re = __riscv_vsadd_vv_i16m1(ve_re, __riscv_vadd_vv_i16m1(__riscv_vsmul_vv_i16m1(vtw_re, vd_im, __RISCV_VXRM_RNU, vl),
+                                                                __riscv_vsmul_vv_i16m1(vtw_im, vd_re, __RISCV_VXRM_RNU, vl), vl), vl);
+    ve_im = __riscv_vssub_vv_i16m1(ve_im, __riscv_vsub_vv_i16m1(__riscv_vsmul_vv_i16m1(vtw_re, vd_re, __RISCV_VXRM_RNU, vl),
+                                                                __riscv_vsmul_vv_i16m1(vtw_im, vd_im, __RISCV_VXRM_RNU, vl), vl), vl);
+
+    v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, ve_re);
+    v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, ve_im);
+    __riscv_vsseg2e16_v_i16m1x2(pDst + 2 * k, v_tuple, vl);
+
+    k += vl;
+  }
+#else
+  q15_t er, ei, dr, di, wr, wi;
+
+  while (blkCnt > 0U)
+  {
+    er = (q15_t)(((q31_t)pSrc[2 * k] + pSrc[2 * (L - k)]) >> 2);
+    ei = (q15_t)(((q31_t)pSrc[2 * k + 1] - pSrc[2 * (L - k) + 1]) >> 2);
+    dr = (q15_t)(((q31_t)pSrc[2 * k] - pSrc[2 * (L - k)]) >> 2);
+    di = (q15_t)(((q31_t)pSrc[2 * k + 1] + pSrc[2 * (L - k) + 1]) >> 2);
+    wr = pTw[2 * k];
+    wi = pTw[2 * k + 1];
+
+    pDst[2 * k]     = clip_q31_to_q15((q31_t)er + (((q31_t)wr * di + (q31_t)wi * dr) >> 15));
+    pDst[2 * k + 1] = clip_q31_to_q15((q31_t)ei - (((q31_t)wr * dr - (q31_t)wi * di) >> 15));
+
+    k++;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/*
+ * Merge the first half of a real FFT X into the L = fftLen/2 points complex FFT Z
+ * of the packed real sequence:
+ *   E = (X[k] + conj(X[L-k])) / 2, D = (X[k] - conj(X[L-k])) / 2
+ *   Z[k] = E + i * conj(w^k) * D
+ */
+static void riscv_rfft_mixed_merge_q15(
+  const q15_t * pSrc,
+  const q15_t * pTw,
+        q15_t * pDst,
+        uint32_t L)
+{
+  uint32_t k = 1U;
+  uint32_t blkCnt = L - 1U;
+
+  pDst[0] = (q15_t)(((q31_t)pSrc[0] + pSrc[1]) >> 1);
+  pDst[1] = (q15_t)(((q31_t)pSrc[0] - pSrc[1]) >> 1);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  size_t vl;
+  vint16m1x2_t v_tuple;
+
+  for (; (vl = __riscv_vsetvl_e16m1(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e16_v_i16m1x2(pSrc + 2 * k, vl);
+    vint16m1_t va_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vint16m1_t va_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+    /* X[L-k] is read backwards */
+    v_tuple = __riscv_vlsseg2e16_v_i16m1x2(pSrc + 2 * (L - k), -4, vl);
+    vint16m1_t vb_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vint16m1_t vb_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e16_v_i16m1x2(pTw + 2 * k, vl);
+    vint16m1_t vtw_re = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 0);
+    vint16m1_t vtw_im = __riscv_vget_v_i16m1x2_i16m1(v_tuple, 1);
+
+    vint16m1_t ve_re = __riscv_vaadd_vv_i16m1(va_re, vb_re, __RISCV_VXRM_RDN, vl);
+    vint16m1_t ve_im = __riscv_vasub_vv_i16m1(va_im, vb_im, __RISCV_VXRM_RDN, vl);
+    vint16m1_t vd_re = __riscv_vasub_vv_i16m1(va_re, vb_re, __RISCV_VXRM_RDN, vl);
+    vint16m1_t vd_im = __riscv_vaadd_vv_i16m1(va_im, vb_im, __RISCV_VXRM_RDN, vl);
+
+    /* Z.re = E.re - (w.re * D.im - w.im * D.re), Z.im = E.im + (w.re * D.re + w.im * D.im) */
+    ve_re = __riscv_vssub_vv_i16m1(ve_re, __riscv_vssub_vv_i16m1(__riscv_vsmul_vv_i16m1(vtw_re, vd_im, __RISCV_VXRM_RNU, vl),
+                                                                 __riscv_vsmul_vv_i16m1(vtw_im, vd_re, __RISCV_VXRM_RNU, vl), vl), vl);
+    ve_im = __riscv_vsadd_vv_i16m1(ve_im, __riscv_vsadd_vv_i16m1(__riscv_vsmul_vv_i16m1(vtw_re, vd_re, __RISCV_VXRM_RNU, vl),
+                                                                 __riscv_vsmul_vv_i16m1(vtw_im, vd_im, __RISCV_VXRM_RNU, vl), vl), vl);
+
+    v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 0, ve_re);
+    v_tuple = __riscv_vset_v_i16m1_i16m1x2(v_tuple, 1, ve_im);
+    __riscv_vsseg2e16_v_i16m1x2(pDst + 2 * k, v_tuple, vl);
+
+    k += vl;
+  }
+#else
+  q15_t er, ei, dr, di, wr, wi;
+
+  while (blkCnt > 0U)
+  {
+    er = (q15_t)(((q31_t)pSrc[2 * k] + pSrc[2 * (L - k)]) >> 1);
+    ei = (q15_t)(((q31_t)pSrc[2 * k + 1] - pSrc[2 * (L - k) + 1]) >> 1);
+    dr = (q15_t)(((q31_t)pSrc[2 * k] - pSrc[2 * (L - k)]) >> 1);
+    di = (q15_t)(((q31_t)pSrc[2 * k + 1] + pSrc[2 * (L - k) + 1]) >> 1);
+    wr = pTw[2 * k];
+    wi = pTw[2 * k + 1];
+
+    pDst[2 * k]     = clip_q31_to_q15((q31_t)er - (((q31_t)wr * di - (q31_t)wi * dr) >> 15));
+    pDst[2 * k + 1] = clip_q31_to_q15((q31_t)ei + (((q31_t)wr * dr + (q31_t)wi * di) >> 15));
+
+    k++;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/**
+  @addtogroup MixedRadixFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 mixed-radix real FFT.
+  @param[in]     S              points to an instance of the Q15 mixed-radix RFFT structure
+  @param[in]     pIn            points to the input buffer of <code>fftLen</code> values, not modified
+  @param[out]    pOut           points to the output buffer of <code>fftLen</code> values
+  @param[in]     pBuffer        points to a temporary buffer of size <code>2*fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: RFFT, real input and packed complex output
+                   - value = 1: RIFFT, packed complex input and real output
+  @return        none
+
+  @par           The RFFT output is scaled down by 1/fftLen. The RIFFT is not scaled further,
+                 so the RIFFT of the RFFT of x is x/fftLen.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_rfft_mixed_q15(
+  const riscv_rfft_mixed_instance_q15 * S,
+  const q15_t * pIn,
+        q15_t * pOut,
+        q15_t * pBuffer,
+        uint8_t ifftFlag)
+{
+  const riscv_cfft_mixed_instance_q15 *Sint = &(S->Sint);
+  q15_t *pTmp = pBuffer + S->fftLenRFFT;
+
+  if (ifftFlag)
+  {
+    riscv_rfft_mixed_merge_q15(pIn, S->pTwiddleRFFT, pTmp, Sint->fftLen);
+    riscv_cfft_mixed_q15(Sint, pTmp, pOut, pBuffer, 1U);
+  }
+  else
+  {
+    riscv_cfft_mixed_q15(Sint, pIn, pTmp, pBuffer, 0U);
+    riscv_rfft_mixed_split_q15(pTmp, S->pTwiddleRFFT, pOut, Sint->fftLen);
+  }
+}
+
+/**
+  @} end of MixedRadixFFT group
+ */
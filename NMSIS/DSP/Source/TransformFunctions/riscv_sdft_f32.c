@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SDFT Sliding DFT
+
+  @par
+                   The sliding DFT updates a few bins of the DFT of the last fftLen samples of a
+                   stream for each new sample, with a cost of one complex multiplication per bin
+                   and per sample instead of a full FFT each time the window moves.
+  @par           Algorithm
+                   For a bin k and w = 2 * pi * k / fftLen, the bin after the sample x[n] is:
+  <pre>
+      X[n] = r * exp(j * w) * (X[n-1] + x[n] - r^fftLen * x[n-fftLen])
+  </pre>
+                   With r = 1, X[n] is the DFT of x[n-fftLen+1] ... x[n]. The recurrence has its poles
+                   on the unit circle, so the rounding errors never decay: the damping factor r,
+                   slightly below 1 (0.9999 for example), keeps it stable at the cost of weighting the
+                   sample x[n-m] by r^(m+1).
+  @par
+                   The processing functions accept any number of samples and output the bins after
+                   the last one, so a block of one sample gives the bins for every sample. The RVV
+                   versions update vl bins at once, the comb input x[n] - r^fftLen * x[n-fftLen]
+                   being shared by all of them.
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples to process
+  @param[out]    pDst       points to the complex bins after the last sample, 2 * S->numBins values
+ */
+RISCV_DSP_ATTRIBUTE void riscv_sdft_f32(
+        riscv_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+  const uint32_t N = S->fftLen;
+  const float32_t dampingN = S->dampingN;
+  const float32_t *pCoeffs = S->pCoeffs;
+  float32_t *pBins = S->pBins;
+  uint32_t blkCnt = S->numBins;
+  uint32_t n, idx;
+  float32_t old;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+  size_t vl;
+  vfloat32m2x2_t v_tuple;
+  vfloat32m2_t vcr, vci, vre, vim, va;
+
+  for (; (vl = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2(pCoeffs, vl);
+    vcr = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 0);
+    vci = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_f32m2x2(pBins, vl);
+    vre = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 0);
+    vim = __riscv_vget_v_f32m2x2_f32m2(v_tuple, 1);
+
+    idx = S->pos;
+    for (n = 0U; n < blockSize; n++)
+    {
+      old = (n < N) ? S->pHist[idx] : pSrc[n - N];
+      idx = (idx + 1U == N) ? 0U : (idx + 1U);
+
+      /* (re + d + j * im) * (cr + j * ci) */
+      va = __riscv_vfadd_vf_f32m2(vre, pSrc[n] - dampingN * old, vl);
+      vre = __riscv_vfmul_vv_f32m2(va, vcr, vl);
+      vre = __riscv_vfnmsac_vv_f32m2(vre, vci, vim, vl);
+      vim = __riscv_vfmul_vv_f32m2(vim, vcr, vl);
+      vim = __riscv_vfmacc_vv_f32m2(vim, vci, va, vl);
+    }
+
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2(v_tuple, 0, vre);
+    v_tuple = __riscv_vset_v_f32m2_f32m2x2(v_tuple, 1, vim);
+    __riscv_vsseg2e32_v_f32m2x2(pBins, v_tuple, vl);
+
+    pCoeffs += 2U * vl;
+    pBins += 2U * vl;
+  }
+#else
+  float32_t cr, ci, re, im, a;
+
+  while (blkCnt > 0U)
+  {
+    cr = pCoeffs[0];
+    ci = pCoeffs[1];
+    re = pBins[0];
+    im = pBins[1];
+
+    idx = S->pos;
+    for (n = 0U; n < blockSize; n++)
+    {
+      old = (n < N) ? S->pHist[idx] : pSrc[n - N];
+      idx = (idx + 1U == N) ? 0U : (idx + 1U);
+
+      a = re + (pSrc[n] - dampingN * old);
+      re = a * cr - im * ci;
+      im = im * cr + a * ci;
+    }
+
+    pBins[0] = re;
+    pBins[1] = im;
+
+    pCoeffs += 2U;
+    pBins += 2U;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+  /* The history buffer keeps the last fftLen samples */
+  for (n = 0U; n < blockSize; n++)
+  {
+    S->pHist[S->pos] = pSrc[n];
+    S->pos = (uint16_t)((S->pos + 1U == N) ? 0U : (S->pos + 1U));
+  }
+
+  riscv_copy_f32(S->pBins, pDst, 2U * S->numBins);
+}
+
+/**
+  @} end of SDFT group
+ */
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_init_f32.c
+ * Description:  Floating-point sliding DFT initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+#include "riscv_vec_fft.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     fftLen     length of the DFT and of the sliding window
+  @param[in]     numBins    number of computed bins
+  @param[in]     pBinIdx    points to the indexes of the bins, lower than fftLen
+  @param[in]     damping    damping factor r in ]0, 1]
+  @param[out]    pCoeffs    points to a buffer of 2 * numBins coefficients
+  @param[out]    pState     points to a state buffer of 2 * numBins + fftLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an argument is not supported
+
+  @par
+                   The bins and the history are cleared: the bins are the DFT of a window of zeros
+                   followed by the samples processed since the initialization.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_sdft_init_f32(
+        riscv_sdft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBinIdx,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState)
+{
+  double w, rN = 1.0;
+
+  if ((fftLen == 0U) || (numBins == 0U) || !(damping > 0.0f) || (damping > 1.0f))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint32_t k = 0U; k < numBins; k++)
+  {
+    if (pBinIdx[k] >= fftLen)
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+
+    w = RISCV_CFFT_MIXED_2PI * (double) pBinIdx[k] / (double) fftLen;
+    pCoeffs[2U * k]      = (float32_t) ((double) damping * cos(w));
+    pCoeffs[2U * k + 1U] = (float32_t) ((double) damping * sin(w));
+  }
+
+  for (uint32_t n = 0U; n < fftLen; n++)
+  {
+    rN *= (double) damping;
+  }
+
+  S->numBins = numBins;
+  S->fftLen = fftLen;
+  S->pos = 0U;
+  S->dampingN = (float32_t) rN;
+  S->pCoeffs = pCoeffs;
+  S->pBins = pState;
+  S->pHist = pState + 2U * numBins;
+
+  riscv_fill_f32(0.0f, pState, 2U * numBins + fftLen);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of SDFT group
+ */
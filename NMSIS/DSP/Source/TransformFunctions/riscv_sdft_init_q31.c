@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_init_q31.c
+ * Description:  Q31 sliding DFT initialization function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     fftLen     length of the DFT and of the sliding window
+  @param[in]     numBins    number of computed bins
+  @param[in]     pBinIdx    points to the indexes of the bins, lower than fftLen
+  @param[in]     damping    damping factor r in ]0, 1[ in Q31 format
+  @param[out]    pCoeffs    points to a buffer of 2 * numBins coefficients
+  @param[out]    pState     points to a state buffer of 2 * numBins + fftLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : an argument is not supported
+
+  @par
+                   The bins and the history are cleared: the bins are the DFT of a window of zeros
+                   followed by the samples processed since the initialization.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_sdft_init_q31(
+        riscv_sdft_instance_q31 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBinIdx,
+        q31_t damping,
+        q31_t * pCoeffs,
+        q31_t * pState)
+{
+  uint32_t shift = 1U;
+  q31_t angle, val;
+  q31_t rN = 0x7FFFFFFF;
+
+  if ((fftLen == 0U) || (numBins == 0U) || (damping <= 0))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint32_t k = 0U; k < numBins; k++)
+  {
+    if (pBinIdx[k] >= fftLen)
+    {
+      return RISCV_MATH_ARGUMENT_ERROR;
+    }
+
+    /* The angles of riscv_cos_q31 and riscv_sin_q31 are normalized to [0, 1) */
+    angle = (q31_t) (((q63_t) pBinIdx[k] << 31) / fftLen);
+    /* -1 is excluded so that the rounded products never saturate */
+    val = riscv_cos_q31(angle);
+    val = (val < -0x7FFFFFFF) ? -0x7FFFFFFF : val;
+    pCoeffs[2U * k] = (q31_t) (((q63_t) damping * val + 0x40000000LL) >> 31);
+    val = riscv_sin_q31(angle);
+    val = (val < -0x7FFFFFFF) ? -0x7FFFFFFF : val;
+    pCoeffs[2U * k + 1U] = (q31_t) (((q63_t) damping * val + 0x40000000LL) >> 31);
+  }
+
+  for (uint32_t n = 0U; n < fftLen; n++)
+  {
+    rN = (q31_t) (((q63_t) rN * damping + 0x40000000LL) >> 31);
+  }
+
+  /* The bins are bounded by fftLen times the shifted samples */
+  while ((1UL << (shift - 1U)) < fftLen)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->fftLen = fftLen;
+  S->pos = 0U;
+  S->shift = (uint8_t)shift;
+  S->dampingN = rN;
+  S->pCoeffs = pCoeffs;
+  S->pBins = pState;
+  S->pHist = pState + 2U * numBins;
+
+  riscv_fill_q31(0, pState, 2U * numBins + fftLen);
+
+  return RISCV_MATH_SUCCESS;
+}
+
+/**
+  @} end of SDFT group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_sdft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples to process
+  @param[out]    pDst       points to the complex bins after the last sample, 2 * S->numBins values
+
+  @par           Scaling and Overflow Behavior
+                   The input samples are shifted right by S->shift = log2(fftLen) + 1 bits, so the bins
+                   are the DFT of the input divided by 2^S->shift and cannot overflow.
+ */
+RISCV_DSP_ATTRIBUTE void riscv_sdft_q31(
+        riscv_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst)
+{
+  const uint32_t N = S->fftLen;
+  const uint32_t shift = S->shift;
+  const q31_t dampingN = S->dampingN;
+  const q31_t *pCoeffs = S->pCoeffs;
+  q31_t *pBins = S->pBins;
+  uint32_t blkCnt = S->numBins;
+  uint32_t n, idx;
+  q31_t old, d;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  size_t vl;
+  vint32m2x2_t v_tuple;
+  vint32m2_t vcr, vci, vre, vim, va;
+
+  for (; (vl = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= vl)
+  {
+    v_tuple = __riscv_vlseg2e32_v_i32m2x2(pCoeffs, vl);
+    vcr = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 0);
+    vci = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 1);
+    v_tuple = __riscv_vlseg2e32_v_i32m2x2(pBins, vl);
+    vre = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 0);
+    vim = __riscv_vget_v_i32m2x2_i32m2(v_tuple, 1);
+
+    idx = S->pos;
+    for (n = 0U; n < blockSize; n++)
+    {
+      old = (n < N) ? S->pHist[idx] : pSrc[n - N];
+      idx = (idx + 1U == N) ? 0U : (idx + 1U);
+      d = (pSrc[n] >> shift) - (q31_t) (((q63_t) dampingN * (old >> shift) + 0x40000000LL) >> 31);
+
+      /* (re + d + j * im) * (cr + j * ci) */
+      va = __riscv_vadd_vx_i32m2(vre, d, vl);
+      vre = __riscv_vsub_vv_i32m2(__riscv_vsmul_vv_i32m2(va, vcr, __RISCV_VXRM_RNU, vl),
+                                  __riscv_vsmul_vv_i32m2(vim, vci, __RISCV_VXRM_RNU, vl), vl);
+      vim = __riscv_vadd_vv_i32m2(__riscv_vsmul_vv_i32m2(vim, vcr, __RISCV_VXRM_RNU, vl),
+                                  __riscv_vsmul_vv_i32m2(va, vci, __RISCV_VXRM_RNU, vl), vl);
+    }
+
+    v_tuple = __riscv_vset_v_i32m2_i32m2x2(v_tuple, 0, vre);
+    v_tuple = __riscv_vset_v_i32m2_i32m2x2(v_tuple, 1, vim);
+    __riscv_vsseg2e32_v_i32m2x2(pBins, v_tuple, vl);
+
+    pCoeffs += 2U * vl;
+    pBins += 2U * vl;
+  }
+#else
+  q31_t cr, ci, re, im, a;
+
+  while (blkCnt > 0U)
+  {
+    cr = pCoeffs[0];
+    ci = pCoeffs[1];
+    re = pBins[0];
+    im = pBins[1];
+
+    idx = S->pos;
+    for (n = 0U; n < blockSize; n++)
+    {
+      old = (n < N) ? S->pHist[idx] : pSrc[n - N];
+      idx = (idx + 1U == N) ? 0U : (idx + 1U);
+      d = (pSrc[n] >> shift) - (q31_t) (((q63_t) dampingN * (old >> shift) + 0x40000000LL) >> 31);
+
+      a = re + d;
+      re = (q31_t) (((q63_t) a * cr + 0x40000000LL) >> 31) - (q31_t) (((q63_t) im * ci + 0x40000000LL) >> 31);
+      im = (q31_t) (((q63_t) im * cr + 0x40000000LL) >> 31) + (q31_t) (((q63_t) a * ci + 0x40000000LL) >> 31);
+    }
+
+    pBins[0] = re;
+    pBins[1] = im;
+
+    pCoeffs += 2U;
+    pBins += 2U;
+    blkCnt--;
+  }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+  /* The history buffer keeps the last fftLen samples */
+  for (n = 0U; n < blockSize; n++)
+  {
+    S->pHist[S->pos] = pSrc[n];
+    S->pos = (uint16_t)((S->pos + 1U == N) ? 0U : (S->pos + 1U));
+  }
+
+  riscv_copy_q31(S->pBins, pDst, 2U * S->numBins);
+}
+
+/**
+  @} end of SDFT group
+ */
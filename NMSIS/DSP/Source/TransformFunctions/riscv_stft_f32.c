@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_stft_f32.c
+ * Description:  Streaming STFT Floating point process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/support_functions.h"
+
+/* Append n <= hopLen samples to the state buffer */
+static void riscv_stft_push_f32(
+  riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t n)
+{
+  uint32_t first = S->frameLen - S->pos;
+
+  if (n < first)
+  {
+    first = n;
+  }
+  riscv_copy_f32(pSrc, S->pState + S->pos, first);
+  riscv_copy_f32(pSrc + first, S->pState, n - first);
+
+  S->pos = (uint16_t)((S->pos + n) % S->frameLen);
+}
+
+/* Multiply the last frameLen samples by the window, the oldest sample being at pos */
+static void riscv_stft_window_f32(
+  const riscv_stft_instance_f32 * S,
+  float32_t * pFrame)
+{
+  uint32_t first = S->frameLen - S->pos;
+
+  riscv_mult_f32(S->pState + S->pos, S->pWindow, pFrame, first);
+  riscv_mult_f32(S->pState, S->pWindow + first, pFrame + first, S->pos);
+}
+
+static uint32_t riscv_stft_process_f32(
+  riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst,
+  float32_t * pTmp,
+  uint8_t magFlag)
+{
+  const uint32_t N = S->frameLen;
+  float32_t *pFrame = pTmp;
+  float32_t *pSpec = pTmp + N;
+  float32_t *pOut;
+  uint32_t numFrames = 0U;
+  uint32_t n;
+
+  while (blockSize > 0U)
+  {
+    n = S->hopLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+    riscv_stft_push_f32(S, pSrc, n);
+    pSrc += n;
+    blockSize -= n;
+    S->count = (uint16_t)(S->count + n);
+
+    if (S->count == S->hopLen)
+    {
+      S->count = 0U;
+
+      /* The window is applied while reading the state buffer, the RFFT writes the spectrum
+         to the output unless the magnitude is computed */
+      riscv_stft_window_f32(S, pFrame);
+      pOut = magFlag ? pSpec : pDst;
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+      riscv_rfft_fast_f32(&S->rfft, pFrame, pOut, pTmp + 2U * N, 0U);
+#else
+      riscv_rfft_fast_f32(&S->rfft, pFrame, pOut, 0U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32F) */
+
+      if (magFlag)
+      {
+        /* DC and Nyquist are real and packed in the first complex value */
+        pDst[0] = fabsf(pSpec[0]);
+        pDst[N / 2U] = fabsf(pSpec[1]);
+        riscv_cmplx_mag_f32(pSpec + 2, pDst + 1, N / 2U - 1U);
+        pDst += N / 2U + 1U;
+      }
+      else
+      {
+        pDst += N;
+      }
+      numFrames++;
+    }
+  }
+
+  return numFrames;
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Short-Time Fourier Transform
+
+  @par
+                   The STFT functions compute the spectra of overlapping frames of a stream. Each call
+                   accepts any number of input samples and outputs one spectrum every hopLen samples,
+                   computed on the last frameLen samples multiplied by the analysis window. The frames
+                   are windowed while they are read from the state buffer, directly into the real FFT
+                   input, and \ref riscv_stft_mag_f32 computes the magnitude directly from the FFT output
+                   into the output buffer, so there is no other copy of the data.
+  @par
+                   The ISTFT functions compute the real inverse FFT of each spectrum, multiply it by the
+                   synthesis window and overlap-add it, and output hopLen samples per spectrum. The ISTFT
+                   output is the STFT input delayed by frameLen - hopLen samples.
+  @par
+                   \ref riscv_stft_f32 outputs frameLen values per frame in the packed format of
+                   \ref riscv_rfft_fast_f32, \ref riscv_stft_q31 and \ref riscv_stft_q15 output
+                   frameLen + 2 values per frame with the format of \ref riscv_rfft_q31 and
+                   \ref riscv_rfft_q15. The magnitude functions output frameLen / 2 + 1 values per frame.
+                   The ISTFT functions take the same spectra as input.
+  @par
+                   The temporary buffer length is given by \ref riscv_stft_tmp_buffer_size.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point STFT.
+  @param[in,out] S              points to an instance of the floating-point STFT structure
+  @param[in]     pSrc           points to the block of input samples
+  @param[in]     blockSize      number of input samples
+  @param[out]    pDst           points to the output spectra, frameLen values per frame
+  @param[in]     pTmp           points to a temporary buffer of riscv_stft_tmp_buffer_size() values
+  @return        number of frames written to pDst
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_stft_f32(
+  riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst,
+  float32_t * pTmp)
+{
+  return riscv_stft_process_f32(S, pSrc, blockSize, pDst, pTmp, 0U);
+}
+
+/**
+  @brief         Processing function for the floating-point STFT magnitude.
+  @param[in,out] S              points to an instance of the floating-point STFT structure
+  @param[in]     pSrc           points to the block of input samples
+  @param[in]     blockSize      number of input samples
+  @param[out]    pDst           points to the output magnitudes, frameLen / 2 + 1 values per frame
+  @param[in]     pTmp           points to a temporary buffer of riscv_stft_tmp_buffer_size() values
+  @return        number of frames written to pDst
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_stft_mag_f32(
+  riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst,
+  float32_t * pTmp)
+{
+  return riscv_stft_process_f32(S, pSrc, blockSize, pDst, pTmp, 1U);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_stft_init_f32.c
+ * Description:  Initialization functions for the STFT and ISTFT f32 instances
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point STFT.
+  @param[in,out] S              points to an instance of the floating-point STFT structure
+  @param[in]     frameLen       length of the frames, a power of two in [32, 4096]
+  @param[in]     hopLen         number of samples between the starts of two frames, in [1, frameLen]
+  @param[in]     pWindow        points to the analysis window of frameLen values
+  @param[in]     pState         points to the state buffer of frameLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : frameLen or hopLen is not supported
+
+  @par           The state buffer is cleared, so the first frame is computed when hopLen samples
+                 have been received, its first frameLen - hopLen samples being zeros.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_stft_init_f32(
+  riscv_stft_instance_f32 * S,
+  uint16_t frameLen,
+  uint16_t hopLen,
+  const float32_t * pWindow,
+  float32_t * pState)
+{
+  if ((hopLen == 0U) || (hopLen > frameLen))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->frameLen = frameLen;
+  S->hopLen = hopLen;
+  S->pos = 0U;
+  S->count = 0U;
+  S->pWindow = pWindow;
+  S->pState = pState;
+
+  riscv_fill_f32(0.0f, pState, frameLen);
+
+  return riscv_rfft_fast_init_f32(&S->rfft, frameLen);
+}
+
+/**
+  @brief         Initialization function for the floating-point ISTFT.
+  @param[in,out] S              points to an instance of the floating-point ISTFT structure
+  @param[in]     frameLen       length of the frames, a power of two in [32, 4096]
+  @param[in]     hopLen         number of samples between the starts of two frames, in [1, frameLen]
+  @param[in]     pWindow        points to the synthesis window of frameLen values
+  @param[in]     pState         points to the overlap-add buffer of frameLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : frameLen or hopLen is not supported
+
+  @par           The overlap-added frames are scaled by hopLen / sum(w[n]^2), which gives a perfect
+                 reconstruction of the STFT input when the same window w is used for the analysis
+                 and the synthesis and when the shifted squared windows sum to a constant, for example
+                 the square root of a periodic Hann window with hopLen = frameLen / 2.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_istft_init_f32(
+  riscv_istft_instance_f32 * S,
+  uint16_t frameLen,
+  uint16_t hopLen,
+  const float32_t * pWindow,
+  float32_t * pState)
+{
+  float64_t energy = 0.0;
+
+  if ((hopLen == 0U) || (hopLen > frameLen))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint32_t i = 0U; i < frameLen; i++)
+  {
+    energy += (float64_t)pWindow[i] * pWindow[i];
+  }
+  if (energy <= 0.0)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->frameLen = frameLen;
+  S->hopLen = hopLen;
+  S->pos = 0U;
+  S->scale = (float32_t)((float64_t)hopLen / energy);
+  S->pWindow = pWindow;
+  S->pState = pState;
+
+  riscv_fill_f32(0.0f, pState, frameLen);
+
+  return riscv_rfft_fast_init_f32(&S->rfft, frameLen);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_stft_init_q31.c
+ * Description:  Initialization functions for the STFT and ISTFT q31 instances
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 STFT.
+  @param[in,out] S              points to an instance of the Q31 STFT structure
+  @param[in]     frameLen       length of the frames, a power of two in [32, 8192]
+  @param[in]     hopLen         number of samples between the starts of two frames, in [1, frameLen]
+  @param[in]     pWindow        points to the analysis window of frameLen values
+  @param[in]     pState         points to the state buffer of frameLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : frameLen or hopLen is not supported
+
+  @par           The state buffer is cleared, so the first frame is computed when hopLen samples
+                 have been received, its first frameLen - hopLen samples being zeros.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_stft_init_q31(
+  riscv_stft_instance_q31 * S,
+  uint16_t frameLen,
+  uint16_t hopLen,
+  const q31_t * pWindow,
+  q31_t * pState)
+{
+  if ((hopLen == 0U) || (hopLen > frameLen))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->frameLen = frameLen;
+  S->hopLen = hopLen;
+  S->pos = 0U;
+  S->count = 0U;
+  S->pWindow = pWindow;
+  S->pState = pState;
+
+  riscv_fill_q31(0, pState, frameLen);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  return riscv_rfft_init_q31(&S->rfft, frameLen);
+#else
+  return riscv_rfft_init_q31(&S->rfft, frameLen, 0U, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/**
+  @brief         Initialization function for the Q31 ISTFT.
+  @param[in,out] S              points to an instance of the Q31 ISTFT structure
+  @param[in]     frameLen       length of the frames, a power of two in [32, 8192]
+  @param[in]     hopLen         number of samples between the starts of two frames, in [1, frameLen]
+  @param[in]     pWindow        points to the synthesis window of frameLen values
+  @param[in]     pState         points to the overlap-add buffer of frameLen values
+  @return        execution status
+                   - \ref RISCV_MATH_SUCCESS        : Operation successful
+                   - \ref RISCV_MATH_ARGUMENT_ERROR : frameLen or hopLen is not supported
+
+  @par           The overlap-added frames are scaled by frameLen * hopLen / sum(w[n]^2), the factor
+                 frameLen compensating the 1/frameLen scaling of the RFFT and RIFFT round trip.
+                 This gives a perfect reconstruction of the STFT input when the same window w is used
+                 for the analysis and the synthesis and when the shifted squared windows sum to a
+                 constant, for example the square root of a periodic Hann window with hopLen = frameLen / 2.
+ */
+RISCV_DSP_ATTRIBUTE riscv_status riscv_istft_init_q31(
+  riscv_istft_instance_q31 * S,
+  uint16_t frameLen,
+  uint16_t hopLen,
+  const q31_t * pWindow,
+  q31_t * pState)
+{
+  float64_t energy = 0.0;
+  float64_t scale;
+  int8_t shift;
+
+  if ((hopLen == 0U) || (hopLen > frameLen))
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  for (uint32_t i = 0U; i < frameLen; i++)
+  {
+    energy += ((float64_t)pWindow[i] / 2147483648.0) * ((float64_t)pWindow[i] / 2147483648.0);
+  }
+  if (energy <= 0.0)
+  {
+    return RISCV_MATH_ARGUMENT_ERROR;
+  }
+
+  S->frameLen = frameLen;
+  S->hopLen = hopLen;
+  S->pos = 0U;
+  /* scaleFract * 2^shift = frameLen * hopLen / energy, with scaleFract < 1 */
+  scale = (float64_t)frameLen * (float64_t)hopLen / energy;
+  shift = 0;
+  while (scale >= 1.0)
+  {
+    scale *= 0.5;
+    shift++;
+  }
+  S->shift = shift;
+  /* scale * 2^31 rounds to 2^31 when scale is just below 1, which does not fit in a q31_t */
+  scale = round(scale * 2147483648.0);
+  S->scaleFract = (q31_t)((scale > 2147483647.0) ? 2147483647.0 : scale);
+  S->pWindow = pWindow;
+  S->pState = pState;
+
+  riscv_fill_q31(0, pState, frameLen);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+  return riscv_rfft_init_q31(&S->rfft, frameLen);
+#else
+  return riscv_rfft_init_q31(&S->rfft, frameLen, 1U, 1U);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS DSP Library
+ * Title:        riscv_stft_q15.c
+ * Description:  Streaming STFT Q15 process function
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: RISC-V Cores
+ * -------------------------------------------------------------------- */
+
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/support_functions.h"
+
+/* Append n <= hopLen samples to the state buffer */
+static void riscv_stft_push_q15(
+  riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t n)
+{
+  uint32_t first = S->frameLen - S->pos;
+
+  if (n < first)
+  {
+    first = n;
+  }
+  riscv_copy_q15(pSrc, S->pState + S->pos, first);
+  riscv_copy_q15(pSrc + first, S->pState, n - first);
+
+  S->pos = (uint16_t)((S->pos + n) % S->frameLen);
+}
+
+/* Multiply the last frameLen samples by the window, the oldest sample being at pos */
+static void riscv_stft_window_q15(
+  const riscv_stft_instance_q15 * S,
+  q15_t * pFrame)
+{
+  uint32_t first = S->frameLen - S->pos;
+
+  riscv_mult_q15(S->pState + S->pos, S->pWindow, pFrame, first);
+  riscv_mult_q15(S->pState, S->pWindow + first, pFrame + first, S->pos);
+}
+
+/*
+ * The windowed frame is widened to Q31 and transformed with the Q31 RFFT, whose output
+ * format is that of the Q15 RFFT with 16 more fractional bits, then narrowed to Q15.
+ * The Q15 RFFT loses too much of the spectrum of low level frames.
+ */
+static uint32_t riscv_stft_process_q15(
+  riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst,
+  q31_t * pTmp,
+  uint8_t magFlag)
+{
+  const uint32_t N = S->frameLen;
+  q31_t *pFrame = pTmp;
+  q31_t *pSpec = pTmp + N;
+  uint32_t numFrames = 0U;
+  uint32_t n;
+
+  while (blockSize > 0U)
+  {
+    n = S->hopLen - S->count;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+    riscv_stft_push_q15(S, pSrc, n);
+    pSrc += n;
+    blockSize -= n;
+    S->count = (uint16_t)(S->count + n);
+
+    if (S->count == S->hopLen)
+    {
+      S->count = 0U;
+
+      /* The window is applied while reading the state buffer, the spectrum buffer holding the Q15 frame */
+      riscv_stft_window_q15(S, (q15_t *)pSpec);
+      riscv_q15_to_q31((q15_t *)pSpec, pFrame, N);
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+      riscv_rfft_q31(&S->rfft, pFrame, pSpec, pTmp + 2U * N + 2U, 0U);
+#else
+      /* The RFFT writes the whole spectrum of frameLen complex values */
+      riscv_rfft_q31(&S->rfft, pFrame, pSpec);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+      if (magFlag)
+      {
+        riscv_cmplx_mag_q31(pSpec, pFrame, N / 2U + 1U);
+        riscv_q31_to_q15(pFrame, pDst, N / 2U + 1U);
+        pDst += N / 2U + 1U;
+      }
+      else
+      {
+        riscv_q31_to_q15(pSpec, pDst, N + 2U);
+        pDst += N + 2U;
+      }
+      numFrames++;
+    }
+  }
+
+  return numFrames;
+}
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 STFT.
+  @param[in,out] S              points to an instance of the Q15 STFT structure
+  @param[in]     pSrc           points to the block of input samples
+  @param[in]     blockSize      number of input samples
+  @param[out]    pDst           points to the output spectra, frameLen + 2 values per frame
+  @param[in]     pTmp           points to a Q31 temporary buffer of riscv_stft_tmp_buffer_size() values
+  @return        number of frames written to pDst
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_stft_q15(
+  riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst,
+  q31_t * pTmp)
+{
+  return riscv_stft_process_q15(S, pSrc, blockSize, pDst, pTmp, 0U);
+}
+
+/**
+  @brief         Processing function for the Q15 STFT magnitude.
+  @param[in,out] S              points to an instance of the Q15 STFT structure
+  @param[in]     pSrc           points to the block of input samples
+  @param[in]     blockSize      number of input samples
+  @param[out]    pDst           points to the output magnitudes, frameLen / 2 + 1 values per frame
+  @param[in]     pTmp           points to a Q31 temporary buffer of riscv_stft_tmp_buffer_size() values
+  @return        number of frames written to pDst
+ */
+RISCV_DSP_ATTRIBUTE uint32_t riscv_stft_mag_q15(
+  riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst,
+  q31_t * pTmp)
+{
+  return riscv_stft_process_q15(S, pSrc, blockSize, pDst, pTmp, 1U);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -1,4 +1,5 @@
 #include "dsp/transform_functions.h"
+#include "riscv_vec_fft.h"
 
 /**
   @ingroup groupTransforms
@@ -86,6 +87,114 @@ int32_t riscv_cifft_output_buffer_size(riscv_math_datatype dt,
     return nb_samples * 2U;
 }
 
+/** 
+ * @brief Calculate required length for the twiddle buffer of the mixed-radix CFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the twiddle buffer
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_cfft_mixed_twiddle_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    (void)dt;
+    uint32_t count = riscv_cfft_mixed_twiddle_count(nb_samples);
+    if (count == 0U)
+    {
+        return -1;
+    }
+    return count * 2U;
+}
+
+/** 
+ * @brief Calculate required length for the twiddle buffer of the large CFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the twiddle buffer
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_cfft_large_twiddle_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    uint16_t p = riscv_cfft_large_log2(nb_samples);
+    if ((dt != RISCV_MATH_F32) || (p == 0U))
+    {
+        return -1;
+    }
+    /* W_N^b for the row length, then W_N^(a*fftLenRow) for the column length */
+    return ((1U << (p - p / 2U)) + (1U << (p / 2U))) * 2U;
+}
+
+/** 
+ * @brief Calculate required length for the temporary buffer of the large CFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the temporary buffer
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_cfft_large_tmp_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    uint16_t p = riscv_cfft_large_log2(nb_samples);
+    uint32_t fftLenRow;
+    if ((dt != RISCV_MATH_F32) || (p == 0U))
+    {
+        return -1;
+    }
+    fftLenRow = 1U << (p - p / 2U);
+    /**
+     * One tile of tileLen columns or rows.
+     * The RVV sub-FFTs also need an output column and their own double buffer.
+     */
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+    return riscv_cfft_large_tile_len(fftLenRow) * fftLenRow * 2U + fftLenRow * 6U;
+#else
+    return riscv_cfft_large_tile_len(fftLenRow) * fftLenRow * 2U;
+#endif
+}
+
+/** 
+ * @brief Calculate required length for the table buffer of riscv_cfft_init_runtime_f32
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the table buffer
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_cfft_runtime_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    uint32_t len = riscv_cfft_runtime_table_len(nb_samples);
+    if ((dt != RISCV_MATH_F32) || (len == 0U))
+    {
+        return -1;
+    }
+    return len;
+}
+
+/**
+ * @brief Calculate required length for the twiddle buffer of the batched CFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the twiddle buffer
+ *
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_cfft_batch_twiddle_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    (void)dt;
+    if (riscv_cfft_batch_log2(nb_samples) == 0U)
+    {
+        return -1;
+    }
+    /* fftLen/2 complex twiddles shared by all the transforms */
+    return nb_samples;
+}
+
 /**
 * @} end of CFFTBuffers group
 */
@@ -180,6 +289,96 @@ int32_t riscv_rifft_input_buffer_size(riscv_math_datatype dt,
     }
 }
 
+/** 
+ * @brief Calculate required length for the twiddle buffer of the mixed-radix RFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the twiddle buffer
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_rfft_mixed_twiddle_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    (void)dt;
+    /* fftLen/2 points CFFT twiddles, followed by the fftLen/2 split twiddles */
+    uint32_t count = riscv_cfft_mixed_twiddle_count(nb_samples >> 1);
+    if ((count == 0U) || (nb_samples & 1U))
+    {
+        return -1;
+    }
+    return (count + (nb_samples >> 1)) * 2U;
+}
+
+/** 
+ * @brief Calculate required length for the temporary buffer of the fast RFFT and RIFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the temporary buffer
+ * 
+ * @note 0 means not applicable (temporary buffer not needed)
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_rfft_fast_tmp_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    if ((nb_samples < 32U) || (nb_samples > 8192U) || ((nb_samples & (nb_samples - 1U)) != 0U))
+    {
+        return -1;
+    }
+    switch(dt)
+    {
+        case RISCV_MATH_F32:
+           if (nb_samples > 4096U)
+           {
+               return -1;
+           }
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+           return nb_samples * 3U;
+#else
+           return 0;
+#endif
+        case RISCV_MATH_Q31:
+        case RISCV_MATH_Q15:
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+           /**
+            * The nb_samples / 2 points CFFT works in the output buffer
+            * and needs a double buffer of nb_samples complex numbers
+            */
+           return nb_samples * 2U;
+#else
+           return 0;
+#endif
+        default:
+           return -1;
+    }
+}
+
+/** 
+ * @brief Calculate required length for the output buffer of the fast RFFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Number of samples in the input data
+ * @return Length in datatype elements (real numbers) for the output buffer
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_rfft_fast_output_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    switch(dt)
+    {
+        case RISCV_MATH_F64:
+        case RISCV_MATH_F32:
+        case RISCV_MATH_F16:
+        case RISCV_MATH_Q31:
+        case RISCV_MATH_Q15:
+           /* DC and Nyquist real values followed by nb_samples / 2 - 1 complex numbers */
+           return(nb_samples);
+        default:
+           return -1;
+    }
+}
+
 /**
 * @} end of RFFTBuffers group
 */
@@ -245,3 +444,66 @@ int32_t riscv_mfcc_tmp_buffer_size(
 /**
 * @} end of MFCCBuffers group
 */
+
+/**
+  @ingroup TransformBuffers
+*/
+
+/**
+  @defgroup STFTBuffers Buffer Sizes for STFT
+*/
+
+
+/**
+  @addtogroup STFTBuffers
+  @{
+*/
+
+/** 
+ * @brief Calculate required length for the temporary buffer of the STFT and ISTFT
+ * @param[in] dt Data type of the input data
+ * @param[in] nb_samples Frame length
+ * @return Length in datatype elements (real numbers) for the temporary buffer,
+ *         in q31_t elements for RISCV_MATH_Q15
+ * 
+ * @note -1 means error : configuration not supported
+ */
+int32_t riscv_stft_tmp_buffer_size(riscv_math_datatype dt,
+    uint32_t nb_samples)
+{
+    if ((nb_samples < 32U) || (nb_samples > 8192U) || ((nb_samples & (nb_samples - 1U)) != 0U))
+    {
+        return -1;
+    }
+    /**
+     * The windowed frame, the spectrum and the temporary buffer of the RVV RFFT.
+     * The Q31 and Q15 RFFT without RVV write the full nb_samples complex spectrum.
+     * The Q15 functions use the Q31 RFFT, so their buffer holds as many q31_t values.
+     */
+    switch(dt)
+    {
+        case RISCV_MATH_F32:
+           if (nb_samples > 4096U)
+           {
+               return -1;
+           }
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+           return nb_samples * 5U;
+#else
+           return nb_samples * 2U;
+#endif
+        case RISCV_MATH_Q31:
+        case RISCV_MATH_Q15:
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+           return nb_samples * 5U + 2U;
+#else
+           return nb_samples * 3U;
+#endif
+        default:
+           return -1;
+    }
+}
+
+/**
+* @} end of STFTBuffers group
+*/
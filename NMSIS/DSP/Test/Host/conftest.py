@@ -0,0 +1,39 @@
+import os
+import zlib
+
+import numpy as np
+import pytest
+
+import nmsis_host
+
+def pytest_addoption(parser):
+    parser.addoption("--lib", default=None, help="Host library built by CMakeLists.txt of this directory, default is $NMSIS_HOST_LIB or build*/libnmsis_host.so")
+    parser.addoption("--seed", type=int, default=int(os.environ.get("NMSIS_HOST_SEED", "0")), help="Seed of the random inputs and shapes")
+    parser.addoption("--shapes", type=int, default=8, help="Number of random lengths or matrix shapes of each kernel")
+
+@pytest.fixture(scope="session")
+def lib(request):
+    path = request.config.getoption("--lib") or nmsis_host.find_library()
+    if path is None or os.path.isfile(path) == False:
+        pytest.skip("Host library not found, build it with cmake -S DSP/Test/Host -B DSP/Test/Host/build")
+    return nmsis_host.host_library(path)
+
+@pytest.fixture
+def rng(request):
+    # Each test has its own stream, so a failure can be replayed alone with the same --seed
+    seed = request.config.getoption("--seed")
+    return np.random.default_rng([seed, zlib.crc32(request.node.nodeid.encode())])
+
+@pytest.fixture
+def lengths(request, rng):
+    """ Block sizes around the loop unrolling and vector boundaries, plus random ones """
+    count = request.config.getoption("--shapes")
+    fixed = [1, 2, 3, 4, 7, 8, 15, 16, 17, 33]
+    return fixed + [int(n) for n in rng.integers(1, 1024, count)]
+
+@pytest.fixture
+def shapes(request, rng):
+    """ Matrix shapes (rows, inner, cols) """
+    count = request.config.getoption("--shapes")
+    fixed = [(1, 1, 1), (2, 3, 4), (4, 4, 4), (5, 7, 3), (16, 1, 9)]
+    return fixed + [tuple(int(d) for d in rng.integers(1, 40, 3)) for _ in range(count)]
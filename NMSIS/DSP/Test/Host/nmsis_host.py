@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+
+"""
+ctypes shim of the host build of NMSIS-DSP and NMSIS-NN, see CMakeLists.txt of this directory.
+
+The shared library contains the riscv_* kernels built from the generic C code and the
+reference implementations: ref_* of DSP/Test/ref.h and *_ref of NN/Tests/Ref. Arrays are
+passed as numpy arrays, and kernel(name, *args) converts the arguments using the
+signature given when the kernel is first looked up.
+"""
+
+import os
+import ctypes
+import glob
+
+import numpy as np
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Argument kinds of a signature, "p" prefix is a pointer to an array of this type
+CTYPES = {
+    "f64": ctypes.c_double, "f32": ctypes.c_float,
+    "q63": ctypes.c_int64, "q31": ctypes.c_int32, "q15": ctypes.c_int16, "q7": ctypes.c_int8,
+    "u32": ctypes.c_uint32, "u16": ctypes.c_uint16, "u8": ctypes.c_uint8,
+}
+
+DTYPES = {
+    "f64": np.float64, "f32": np.float32,
+    "q63": np.int64, "q31": np.int32, "q15": np.int16, "q7": np.int8,
+    "u32": np.uint32, "u16": np.uint16, "u8": np.uint8,
+}
+
+# Maximum difference allowed between a kernel and its reference, the DELTA* of DSP/Test/common.h
+DELTAS = {
+    "f64": 0.05, "f32": 0.2,
+    "q63": 1, "q31": 2, "q15": 1, "q7": 1,
+    "u32": 0, "u16": 0, "u8": 0,
+}
+
+LOW_PRECISION_DELTAS = {"f32": 2.0, "q31": 64, "q15": 5, "q7": 1}
+
+class matrix_instance(ctypes.Structure):
+    """ riscv_matrix_instance_* of matrix_functions.h, pData is a pointer of any element type """
+    _fields_ = [("numRows", ctypes.c_uint16), ("numCols", ctypes.c_uint16), ("pData", ctypes.c_void_p)]
+
+def find_library():
+    """ NMSIS_HOST_LIB set by ctest, or the library of a build directory next to this file """
+    lib = os.environ.get("NMSIS_HOST_LIB")
+    if lib:
+        return lib
+    candidates = glob.glob(os.path.join(SCRIPT_DIR, "build*", "libnmsis_host.*"))
+    return candidates[0] if candidates else None
+
+def ctype_of(kind):
+    if kind.startswith("p"):
+        return ctypes.c_void_p
+    if kind == "mat":
+        return ctypes.POINTER(matrix_instance)
+    return CTYPES[kind]
+
+def to_carg(kind, value):
+    if kind.startswith("p"):
+        return value.ctypes.data_as(ctypes.c_void_p)
+    if kind == "mat":
+        return ctypes.byref(value)
+    return value
+
+class host_library(object):
+    def __init__(self, path):
+        self.path = path
+        self.lib = ctypes.CDLL(path)
+        self.funcs = dict()
+        pass
+
+    def has(self, name):
+        return hasattr(self.lib, name)
+
+    def kernel(self, name, signature, restype=None):
+        """ Return a callable of function name, signature is the list of the argument kinds """
+        if name not in self.funcs:
+            func = getattr(self.lib, name)
+            func.argtypes = [ctype_of(kind) for kind in signature]
+            func.restype = restype
+            self.funcs[name] = (func, signature)
+        func, signature = self.funcs[name]
+        def call(*args):
+            return func(*[to_carg(kind, arg) for kind, arg in zip(signature, args)])
+        return call
+
+def matrix(rows, cols, data):
+    """ Return a matrix instance of the numpy array data, keep data alive while the instance is used """
+    mat = matrix_instance(rows, cols, data.ctypes.data_as(ctypes.c_void_p))
+    mat.keep = data
+    return mat
+
+def random_array(rng, kind, n, low=None, high=None):
+    """
+    Random elements of type kind, f32 and f64 in [-1, 1) by default, q types in [min + 1, max]
+    since several ref_* don't saturate the negation of the minimum value, u types in their full range
+    """
+    dtype = DTYPES[kind]
+    if kind in ("f32", "f64"):
+        low = -1.0 if low is None else low
+        high = 1.0 if high is None else high
+        return rng.uniform(low, high, n).astype(dtype)
+    info = np.iinfo(dtype)
+    low = (info.min + 1 if info.min < 0 else 0) if low is None else low
+    high = info.max if high is None else high
+    return rng.integers(low, high, n, dtype=dtype, endpoint=True)
+
+def max_diff(kind, ref, opt):
+    """ Return the maximum absolute difference of two arrays and the index where it is found """
+    ref = np.asarray(ref)
+    opt = np.asarray(opt)
+    if ref.size == 0:
+        return 0, -1
+    if kind in ("f32", "f64"):
+        diff = np.abs(ref.astype(np.float64) - opt.astype(np.float64))
+        diff[np.isnan(ref) & np.isnan(opt)] = 0
+    else:
+        diff = np.abs(ref.astype(object) - opt.astype(object)).astype(np.float64)
+    idx = int(np.argmax(diff))
+    return diff[idx], idx
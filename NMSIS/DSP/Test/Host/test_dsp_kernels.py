@@ -0,0 +1,385 @@
+"""
+Equivalence of the NMSIS-DSP kernels built for the host and the ref_* implementations of
+DSP/Test/ref.h over random block sizes and matrix shapes.
+
+Each kernel is described by the tokens of its argument list:
+
+  a, b     input arrays of the kernel type, of n elements or 2 * n for the complex kernels
+  d        output array of the kernel type, of 2 * n elements for the complex outputs
+  n        block size
+  r, r2    one element result of the result type
+  i        uint32_t index result
+  s        scalar of the kernel type
+  sh       int8_t shift
+  lo, hi   clip limits of the kernel type
+
+The transforms without a ref_* implementation, the mixed-radix CFFT, the Goertzel filter bank and
+the sliding DFT, are compared to numpy.fft or to their definition computed in float64.
+"""
+
+import ctypes
+import math
+
+import numpy as np
+import pytest
+
+import nmsis_host
+from nmsis_host import random_array, max_diff, DELTAS, LOW_PRECISION_DELTAS
+
+QTYPES = ["q31", "q15", "q7"]
+ALL_TYPES = ["f32"] + QTYPES
+UTYPES = ["u32", "u16", "u8"]
+QBITS = {"q31": 31, "q15": 15, "q7": 7}
+
+# riscv_status is an int sized enum
+STATUS = ctypes.c_int
+
+# (kernel, types, tokens, result kinds of each type, complex, options), the options are
+#   low       types compared with the LOW_PRECISION_DELTAS
+#   min_n     smallest block size supported by the kernel
+#   headroom  bits of headroom of the q inputs, for the ref_* which don't saturate
+KERNELS = [
+    ("abs", ALL_TYPES, "a d n", None, False, {}),
+    ("negate", ALL_TYPES, "a d n", None, False, {}),
+    ("copy", ALL_TYPES, "a d n", None, False, {}),
+    ("add", ALL_TYPES, "a b d n", None, False, {}),
+    ("sub", ALL_TYPES, "a b d n", None, False, {}),
+    ("mult", ALL_TYPES, "a b d n", None, False, {}),
+    ("offset", ALL_TYPES, "a s d n", None, False, {}),
+    ("scale", ["f32"], "a s d n", None, False, {}),
+    ("scale", QTYPES, "a s sh d n", None, False, {}),
+    ("shift", QTYPES, "a sh d n", None, False, dict(headroom=3)),
+    ("clip", ALL_TYPES, "a d lo hi n", None, False, {}),
+    ("and", UTYPES, "a b d n", None, False, {}),
+    ("or", UTYPES, "a b d n", None, False, {}),
+    ("xor", UTYPES, "a b d n", None, False, {}),
+    ("not", UTYPES, "a d n", None, False, {}),
+    ("dot_prod", ALL_TYPES, "a b n r", {"f32": "f32", "q31": "q63", "q15": "q63", "q7": "q31"}, False, {}),
+    ("mse", ALL_TYPES, "a b n r", None, False, dict(low=("f32", "q31"))),
+    ("mean", ALL_TYPES, "a n r", None, False, {}),
+    ("power", ALL_TYPES, "a n r", {"f32": "f32", "q31": "q63", "q15": "q63", "q7": "q31"}, False, {}),
+    ("rms", ["f32", "q31", "q15"], "a n r", None, False, dict(low=("q31", "q15"))),
+    ("std", ["f32", "q31", "q15"], "a n r", None, False, dict(low=("q31", "q15"), min_n=2)),
+    ("var", ["f32", "q31", "q15"], "a n r", None, False, dict(low=("q31", "q15"), min_n=2)),
+    ("max", ALL_TYPES, "a n r i", None, False, {}),
+    ("min", ALL_TYPES, "a n r i", None, False, {}),
+    ("absmax", ALL_TYPES, "a n r i", None, False, {}),
+    ("absmin", ALL_TYPES, "a n r i", None, False, {}),
+    ("max_no_idx", ALL_TYPES, "a n r", None, False, {}),
+    ("min_no_idx", ALL_TYPES, "a n r", None, False, {}),
+    ("absmax_no_idx", ALL_TYPES, "a n r", None, False, {}),
+    ("absmin_no_idx", ALL_TYPES, "a n r", None, False, {}),
+    ("cmplx_conj", ["f32", "q31", "q15"], "a d n", None, True, {}),
+    ("cmplx_mag", ["f32", "q31", "q15"], "a d n", None, True, dict(low=("q31", "q15"))),
+    ("cmplx_mag_squared", ["f32", "q31", "q15"], "a d n", None, True, {}),
+    ("cmplx_mult_cmplx", ["f32", "q31", "q15"], "a b d n", None, True, {}),
+    ("cmplx_dot_prod", ["f32", "q31", "q15"], "a b n r r2", {"f32": "f32", "q31": "q63", "q15": "q31"}, True, dict(low=("q31", "q15"))),
+]
+
+# (source type, destination type) of riscv_<src>_to_<dst>, f32 is named float
+CONVERSIONS = [
+    ("q31", "q15"), ("q31", "q7"), ("q15", "q31"), ("q15", "q7"), ("q7", "q31"), ("q7", "q15"),
+    ("q31", "f32"), ("q15", "f32"), ("q7", "f32"), ("f32", "q31"), ("f32", "q15"), ("f32", "q7"),
+]
+
+def kernel_cases():
+    for name, types, tokens, results, cplx, opts in KERNELS:
+        for kind in types:
+            yield pytest.param(name, kind, tokens.split(), (results or {}).get(kind, kind), cplx,
+                               opts, id="%s_%s" % (name, kind))
+
+def kernel_signature(tokens, kind):
+    signature = []
+    for token in tokens:
+        if token in ("a", "b", "d", "r", "r2", "i"):
+            signature.append("p")
+        elif token in ("s", "lo", "hi"):
+            signature.append(kind)
+        elif token == "sh":
+            signature.append("q7")
+        else:
+            signature.append("u32")
+    return signature
+
+def kernel_inputs(rng, name, tokens, kind, n, cplx, headroom):
+    """ Return the arguments of a call, the same random inputs are used by the kernel and its reference """
+    nelem = 2 * n if cplx else n
+    inputs = dict()
+    inputs["a"] = random_array(rng, kind, nelem)
+    inputs["b"] = random_array(rng, kind, nelem)
+    if kind in QBITS and headroom:
+        inputs["a"] >>= headroom
+        inputs["b"] >>= headroom
+    if kind == "f32":
+        inputs["s"] = np.float32(rng.uniform(-2.0, 2.0))
+        lo, hi = sorted(rng.uniform(-1.0, 1.0, 2))
+        inputs["lo"], inputs["hi"] = np.float32(lo), np.float32(hi)
+    elif kind in QBITS:
+        inputs["s"] = random_array(rng, kind, 1)[0]
+        lo, hi = sorted(random_array(rng, kind, 2))
+        inputs["lo"], inputs["hi"] = lo, hi
+        inputs["sh"] = int(rng.integers(-3, 4))
+    if name == "scale" and kind in QBITS:
+        # riscv_scale_q* shift is a left shift of the product, keep it small
+        inputs["sh"] = int(rng.integers(0, 3))
+    return inputs
+
+def run_kernel(func, tokens, inputs, kind, rkind, n, nout):
+    args = []
+    outputs = dict(d=np.zeros(nout, dtype=nmsis_host.DTYPES[kind]),
+                   r=np.zeros(1, dtype=nmsis_host.DTYPES[rkind]),
+                   r2=np.zeros(1, dtype=nmsis_host.DTYPES[rkind]),
+                   i=np.zeros(1, dtype=np.uint32))
+    for token in tokens:
+        if token in ("a", "b"):
+            args.append(inputs[token].copy())
+        elif token in outputs:
+            args.append(outputs[token])
+        elif token == "n":
+            args.append(n)
+        else:
+            args.append(inputs[token])
+    func(*args)
+    return outputs
+
+def check(kernel, kind, ref, opt, delta, n):
+    diff, idx = max_diff(kind, ref, opt)
+    assert diff <= delta, "%s n=%d mismatch at %d, expected %s, actual %s" \
+        % (kernel, n, idx, np.asarray(ref).ravel()[idx], np.asarray(opt).ravel()[idx])
+
+@pytest.mark.parametrize("name, kind, tokens, rkind, cplx, opts", list(kernel_cases()))
+def test_kernel(lib, rng, lengths, name, kind, tokens, rkind, cplx, opts):
+    kernel = "riscv_%s_%s" % (name, kind)
+    reference = "ref_%s_%s" % (name, kind)
+    if lib.has(kernel) == False or lib.has(reference) == False:
+        pytest.skip("%s or %s not built" % (kernel, reference))
+    signature = kernel_signature(tokens, kind)
+    func = lib.kernel(kernel, signature)
+    ref = lib.kernel(reference, signature)
+    nout = 2 if name in ("cmplx_conj", "cmplx_mult_cmplx") else 1
+    deltas = LOW_PRECISION_DELTAS if kind in opts.get("low", ()) else DELTAS
+    for n in lengths:
+        if n < opts.get("min_n", 1):
+            continue
+        inputs = kernel_inputs(rng, name, tokens, kind, n, cplx, opts.get("headroom", 0))
+        expected = run_kernel(ref, tokens, inputs, kind, rkind, n, nout * n)
+        actual = run_kernel(func, tokens, inputs, kind, rkind, n, nout * n)
+        check(kernel, kind, expected["d"], actual["d"], deltas.get(kind, 0), n)
+        for res in ("r", "r2"):
+            if res in tokens:
+                rdelta = deltas.get(rkind, DELTAS[rkind]) if rkind != "f32" else deltas["f32"] * max(1.0, abs(float(expected[res][0])) * 1e-5)
+                check(kernel, rkind, expected[res], actual[res], rdelta, n)
+        if "i" in tokens:
+            values = inputs["a"]
+            # Equal values can be found first at other indexes, compare the values at the indexes
+            assert values[expected["i"][0]] == values[actual["i"][0]], "%s n=%d index mismatch" % (kernel, n)
+
+@pytest.mark.parametrize("src, dst", CONVERSIONS, ids=["%s_to_%s" % c for c in CONVERSIONS])
+def test_conversion(lib, rng, lengths, src, dst):
+    name = "%s_to_%s" % ("float" if src == "f32" else src, "float" if dst == "f32" else dst)
+    kernel, reference = "riscv_" + name, "ref_" + name
+    signature = ["p", "p", "u32"]
+    func = lib.kernel(kernel, signature)
+    ref = lib.kernel(reference, signature)
+    for n in lengths:
+        data = random_array(rng, src, n)
+        expected = np.zeros(n, dtype=nmsis_host.DTYPES[dst])
+        actual = np.zeros(n, dtype=nmsis_host.DTYPES[dst])
+        ref(data.copy(), expected, n)
+        func(data.copy(), actual, n)
+        check(kernel, dst, expected, actual, DELTAS[dst], n)
+
+# (kernel, types, operands) of the matrix kernels, operands is "ab" for A op B and "a" for op A
+MATRIX_KERNELS = [
+    ("mat_add", ["f32", "q31", "q15"], "ab"),
+    ("mat_sub", ["f32", "q31", "q15"], "ab"),
+    ("mat_mult", ["f32", "q31", "q15", "q7"], "ab"),
+    ("mat_trans", ["f32", "q31", "q15"], "a"),
+]
+
+def matrix_cases():
+    for name, types, operands in MATRIX_KERNELS:
+        for kind in types:
+            yield pytest.param(name, kind, operands, id="%s_%s" % (name, kind))
+
+def matrix_dims(name, shape):
+    """ Return the (rows, cols) of A, B and the destination of shape (rows, inner, cols) """
+    rows, inner, cols = shape
+    if name == "mat_mult":
+        return (rows, inner), (inner, cols), (rows, cols)
+    if name == "mat_trans":
+        return (rows, cols), None, (cols, rows)
+    return (rows, cols), (rows, cols), (rows, cols)
+
+@pytest.mark.parametrize("name, kind, operands", list(matrix_cases()))
+def test_matrix(lib, rng, shapes, name, kind, operands):
+    kernel = "riscv_%s_%s" % (name, kind)
+    reference = "ref_%s_%s" % (name, kind)
+    if lib.has(reference) == False:
+        pytest.skip("%s not built" % (reference))
+    # riscv_mat_mult_q15 and riscv_mat_mult_q7 take a scratch buffer for the transposed B
+    state = name == "mat_mult" and kind in ("q15", "q7")
+    signature = ["mat"] * (len(operands) + 1)
+    func = lib.kernel(kernel, signature + (["p"] if state else []), STATUS)
+    ref = lib.kernel(reference, signature, STATUS)
+    # Keep the q accumulations of the products away from saturation
+    scale = 1.0 / 8 if kind in QBITS else 1.0
+    for shape in shapes:
+        dima, dimb, dimd = matrix_dims(name, shape)
+        a = (random_array(rng, kind, dima[0] * dima[1]) * scale).astype(nmsis_host.DTYPES[kind])
+        b = (random_array(rng, kind, dimb[0] * dimb[1]) * scale).astype(nmsis_host.DTYPES[kind]) if dimb else None
+        results = []
+        for call, extra in ((ref, []), (func, [np.zeros(dimb[0] * dimb[1], dtype=nmsis_host.DTYPES[kind])] if state else [])):
+            dst = np.zeros(dimd[0] * dimd[1], dtype=nmsis_host.DTYPES[kind])
+            args = [nmsis_host.matrix(dima[0], dima[1], a.copy())]
+            if dimb:
+                args.append(nmsis_host.matrix(dimb[0], dimb[1], b.copy()))
+            args.append(nmsis_host.matrix(dimd[0], dimd[1], dst))
+            status = call(*(args + extra))
+            results.append((status, dst))
+        (ref_status, expected), (status, actual) = results
+        assert status == ref_status, "%s %s status %d, expected %d" % (kernel, shape, status, ref_status)
+        check(kernel, kind, expected, actual, DELTAS[kind] * (dima[1] if name == "mat_mult" and kind == "f32" else 1), 0)
+
+# riscv_math_datatype of the *_twiddle_buffer_size functions
+DATATYPES = {"f32": 32, "q31": 31, "q15": 15}
+
+# Mixed-radix lengths made of radix 2, 3, 4 and 5 stages
+MIXED_LENGTHS = [2, 3, 4, 5, 6, 9, 12, 15, 16, 20, 25, 30, 45, 60, 64, 96, 120, 125, 240, 360, 480, 500, 960, 1024, 1500]
+
+class goertzel_bank_instance_q31(ctypes.Structure):
+    _fields_ = [("numBins", ctypes.c_uint16), ("blockLen", ctypes.c_uint16), ("shift", ctypes.c_uint8),
+                ("pCoeffs", ctypes.c_void_p)]
+
+class sdft_instance_q31(ctypes.Structure):
+    _fields_ = [("numBins", ctypes.c_uint16), ("fftLen", ctypes.c_uint16), ("pos", ctypes.c_uint16),
+                ("shift", ctypes.c_uint8), ("dampingN", ctypes.c_int32), ("pCoeffs", ctypes.c_void_p),
+                ("pBins", ctypes.c_void_p), ("pHist", ctypes.c_void_p)]
+
+def instance():
+    """ Storage of any transform instance structure, read with the structures above """
+    return np.zeros(64, dtype=np.uint8)
+
+def to_complex(kind, data):
+    data = data.astype(np.float64) / (2 ** QBITS[kind] if kind in QBITS else 1)
+    return data[0::2] + 1j * data[1::2]
+
+@pytest.mark.parametrize("ifft", [0, 1], ids=["cfft", "cifft"])
+@pytest.mark.parametrize("kind", ["f32", "q31", "q15"])
+def test_cfft_mixed(lib, rng, kind, ifft):
+    kernel = "riscv_cfft_mixed_%s" % kind
+    twiddle_size = lib.kernel("riscv_cfft_mixed_twiddle_buffer_size", ["u32", "u32"], ctypes.c_int32)
+    init = lib.kernel("riscv_cfft_mixed_init_%s" % kind, ["p", "u32", "p"], STATUS)
+    func = lib.kernel(kernel, ["p", "p", "p", "p", "u8"])
+    dtype = nmsis_host.DTYPES[kind]
+    for n in MIXED_LENGTHS:
+        S = instance()
+        twiddle = np.zeros(twiddle_size(DATATYPES[kind], n), dtype=dtype)
+        assert init(S, n, twiddle) == 0, "%s init n=%d failed" % (kernel, n)
+        data = random_array(rng, kind, 2 * n)
+        if kind in QBITS:
+            # The radix-3 and radix-5 butterflies need one bit of headroom
+            data >>= 1
+        actual = np.zeros(2 * n, dtype=dtype)
+        func(S, data, actual, np.zeros(2 * n, dtype=dtype), ifft)
+        # The inverse transforms and the q forward transforms are scaled by 1/n
+        expected = np.fft.ifft(to_complex(kind, data)) if ifft else np.fft.fft(to_complex(kind, data))
+        if ifft == 0 and kind in QBITS:
+            expected /= n
+        diff = np.abs(expected - to_complex(kind, actual))
+        if kind == "f32":
+            delta = 1e-5 * max(1.0, np.max(np.abs(expected)))
+        else:
+            # About one LSB of rounding per stage
+            delta = 2.0 * (math.log2(n) + 1) / 2 ** QBITS[kind]
+        idx = int(np.argmax(diff))
+        assert diff[idx] <= delta, "%s n=%d mismatch at %d, expected %s, actual %s" \
+            % (kernel, n, idx, expected[idx], to_complex(kind, actual)[idx])
+
+@pytest.mark.parametrize("kind", ["f32", "q31"])
+def test_goertzel_bank(lib, rng, lengths, kind):
+    kernel = "riscv_goertzel_bank_%s" % kind
+    init = lib.kernel("riscv_goertzel_bank_init_%s" % kind, ["p", "u16", "u16", "p", "p"], STATUS)
+    func = lib.kernel(kernel, ["p", "p", "p"])
+    dtype = nmsis_host.DTYPES[kind]
+    for n in lengths:
+        # The blocks have at least 2 samples
+        if n < 2:
+            continue
+        bins = int(rng.integers(1, 10))
+        normalized = rng.uniform(0.0, 0.5, bins)
+        # q31 frequencies are normalized to [0, 0.5] in Q31
+        freqs = normalized.astype(np.float32) if kind == "f32" else (normalized * 2 ** 31).astype(np.int32)
+        coeffs = np.zeros(bins, dtype=dtype)
+        S = instance()
+        assert init(S, bins, n, freqs, coeffs) == 0, "%s init n=%d failed" % (kernel, n)
+        data = random_array(rng, kind, n)
+        actual = np.zeros(bins, dtype=dtype)
+        func(S, data, actual)
+        # |DFT|^2 at the frequencies of the computed 2*cos(2*pi*f) coefficients, cos(2*pi*f) for q31
+        cosines = coeffs.astype(np.float64) / 2 if kind == "f32" else coeffs / 2 ** 31
+        check(kernel + "_init", "f64", np.cos(2 * np.pi * normalized), cosines, 1e-4, n)
+        freqs = np.arccos(np.clip(cosines, -1.0, 1.0)) / (2 * np.pi)
+        x = data.astype(np.float64) if kind == "f32" else data / 2 ** 31
+        expected = np.abs(np.exp(-2j * np.pi * np.outer(freqs, np.arange(n))) @ x) ** 2
+        if kind == "f32":
+            # s1^2 + s2^2 - 2*cos(2*pi*f)*s1*s2 cancels near f = 0 and f = 0.5, so the rounding
+            # errors scale with the square of the filter states rather than with the power
+            s1, s2, peak = np.zeros(bins), np.zeros(bins), np.zeros(bins)
+            for sample in x:
+                s1, s2 = sample + 2 * cosines * s1 - s2, s1
+                peak = np.maximum(peak, np.abs(s1))
+            scale = 2e-7 * n * (peak ** 2 + 1)
+            check(kernel, "f64", expected / scale, actual / scale, 1.0, n)
+        else:
+            # The samples are shifted right by S->shift so that the power stays below 0.25
+            shift = goertzel_bank_instance_q31.from_buffer(S).shift
+            expected = expected / 2 ** (2 * shift) * 2 ** 29
+            check(kernel, "f64", expected, actual.astype(np.float64), 4, n)
+
+@pytest.mark.parametrize("kind", ["f32", "q31"])
+def test_sdft(lib, rng, lengths, kind):
+    kernel = "riscv_sdft_%s" % kind
+    init = lib.kernel("riscv_sdft_init_%s" % kind, ["p", "u16", "u16", "p", kind, "p", "p"], STATUS)
+    func = lib.kernel(kernel, ["p", "p", "u32", "p"])
+    dtype = nmsis_host.DTYPES[kind]
+    for N in lengths:
+        bins = int(rng.integers(1, min(N, 9) + 1))
+        idx = rng.choice(N, bins, replace=False).astype(np.uint16)
+        coeffs = np.zeros(2 * bins, dtype=dtype)
+        state = np.zeros(2 * bins + N, dtype=dtype)
+        S = instance()
+        # The q31 damping factor is lower than 1
+        damping = np.float32(1.0) if kind == "f32" else 0x7FFFFFFF
+        status = init(S, N, bins, idx, damping, coeffs, state)
+        assert status == 0, "%s init N=%d failed" % (kernel, N)
+        # Up to three windows in random blocks
+        total = int(rng.integers(1, 3 * N + 3))
+        data = random_array(rng, kind, total)
+        actual = np.zeros(2 * bins, dtype=dtype)
+        pos = 0
+        while pos < total:
+            block = int(rng.integers(1, total - pos + 1))
+            func(S, data[pos:], block, actual)
+            pos += block
+        if kind == "f32":
+            # The bins are the DFT of the last N samples, zeros before the first one
+            window = np.concatenate([np.zeros(N), data.astype(np.float64)])[-N:]
+            expected = np.fft.fft(window)[idx]
+            delta = 1e-6 * total * max(1.0, np.max(np.abs(expected)))
+        else:
+            # Run the recurrence of the kernel in float64 with its twiddles, damping and shifted samples
+            params = sdft_instance_q31.from_buffer(S)
+            angles = 2 * np.pi * idx / N
+            check(kernel + "_init", "f64", np.column_stack([np.cos(angles), np.sin(angles)]).ravel(),
+                  coeffs / 2 ** 31, 1e-4, N)
+            twiddles = to_complex(kind, coeffs)
+            shifted = np.concatenate([np.zeros(N), (data >> params.shift).astype(np.float64)])
+            expected = np.zeros(bins, dtype=np.complex128)
+            for i in range(total):
+                expected = twiddles * (expected + shifted[i + N] - params.dampingN / 2 ** 31 * shifted[i])
+            # About one LSB of rounding per sample
+            delta = 1 + total / 2
+        ref = np.empty(2 * bins)
+        ref[0::2], ref[1::2] = expected.real, expected.imag
+        check(kernel, "f64", ref, actual.astype(np.float64), delta, N)
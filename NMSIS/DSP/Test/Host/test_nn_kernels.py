@@ -0,0 +1,318 @@
+"""
+Equivalence of the NMSIS-NN kernels built for the host and the *_ref implementations of
+NN/Tests/Ref over random block sizes.
+
+NN/Tests/Ref is no longer maintained, so only the kernels whose reference still matches the
+API of riscv_nnfunctions.h and riscv_nnsupportfunctions.h are listed here. The tokens of the
+argument lists are
+
+  io       array of the kernel type updated in place
+  a, b     input arrays of the kernel type
+  d        output array of the output type
+  n        block size
+  r        q31_t result
+  sh       uint16_t output shift
+  w        uint16_t integer width of the activation tables
+  t        riscv_nn_activation_type
+
+The s8 convolution and fully connected kernels added on top of the generic ones (direct, fused
+pooling and 2:4 sparse) are compared with the generic kernel they replace, which must give the
+same result bit for bit.
+"""
+
+import os
+import sys
+import ctypes
+
+import numpy as np
+import pytest
+
+import nmsis_host
+from nmsis_host import random_array, max_diff, DELTAS
+
+sys.path.insert(0, os.path.join(nmsis_host.SCRIPT_DIR, "..", "..", "..", "NN", "Scripts", "SparseWeights"))
+import sparse_weight_pack
+
+# (kernel, type, output type, tokens, block size kind)
+KERNELS = [
+    ("riscv_relu_q7", "q7", "q7", "io n", "u16"),
+    ("riscv_relu_q15", "q15", "q15", "io n", "u16"),
+    ("riscv_relu6_s8", "q7", "q7", "io n", "u16"),
+    ("riscv_nn_activations_direct_q7", "q7", "q7", "io n w t", "u16"),
+    ("riscv_nn_activations_direct_q15", "q15", "q15", "io n w t", "u16"),
+    ("riscv_softmax_q7", "q7", "q7", "a n d", "u16"),
+    ("riscv_q7_to_q15_no_shift", "q7", "q15", "a d n", "u32"),
+    ("riscv_nn_add_q7", "q7", "q31", "a r n", "u32"),
+    ("riscv_nn_mult_q7", "q7", "q7", "a b d sh n", "u32"),
+    ("riscv_nn_mult_q15", "q15", "q15", "a b d sh n", "u32"),
+]
+
+def kernel_signature(tokens, nkind):
+    kinds = {"io": "p", "a": "p", "b": "p", "d": "p", "r": "p", "n": nkind, "sh": "u16", "w": "u16", "t": "u32"}
+    return [kinds[token] for token in tokens]
+
+@pytest.mark.parametrize("name, kind, dkind, tokens, nkind", KERNELS, ids=[k[0] for k in KERNELS])
+def test_kernel(lib, rng, lengths, name, kind, dkind, tokens, nkind):
+    tokens = tokens.split()
+    reference = name + "_ref"
+    if lib.has(name) == False or lib.has(reference) == False:
+        pytest.skip("%s or %s not built" % (name, reference))
+    signature = kernel_signature(tokens, nkind)
+    func = lib.kernel(name, signature)
+    ref = lib.kernel(reference, signature)
+    for n in lengths:
+        inputs = dict(io=random_array(rng, kind, n), a=random_array(rng, kind, n), b=random_array(rng, kind, n),
+                      sh=int(rng.integers(0, 8 if kind == "q7" else 16)), w=int(rng.integers(0, 4)), t=int(rng.integers(0, 2)))
+        results = []
+        for call in (ref, func):
+            outputs = dict(io=inputs["io"].copy(), d=np.zeros(n, dtype=nmsis_host.DTYPES[dkind]),
+                           r=np.zeros(1, dtype=np.int32))
+            args = []
+            for token in tokens:
+                if token in outputs:
+                    args.append(outputs[token])
+                elif token in ("a", "b"):
+                    args.append(inputs[token].copy())
+                elif token == "n":
+                    args.append(n)
+                else:
+                    args.append(inputs[token])
+            call(*args)
+            results.append(outputs)
+        expected, actual = results
+        for out, okind in (("io", kind), ("d", dkind), ("r", "q31")):
+            if out in tokens:
+                diff, idx = max_diff(okind, expected[out], actual[out])
+                assert diff <= DELTAS[okind], "%s n=%d mismatch at %d, expected %s, actual %s" \
+                    % (name, n, idx, expected[out][idx], actual[out][idx])
+
+def requantize_params(rng):
+    """ Multiplier in [0.5, 1) of q31 and right shift, as generated by the TFLite micro converter """
+    return int(rng.integers(1 << 30, (1 << 31) - 1)), -int(rng.integers(1, 12))
+
+@pytest.mark.parametrize("name", ["riscv_elementwise_add_s8", "riscv_elementwise_mul_s8"])
+def test_elementwise_s8(lib, rng, lengths, name):
+    reference = name + "_ref"
+    if lib.has(name) == False or lib.has(reference) == False:
+        pytest.skip("%s or %s not built" % (name, reference))
+    add = name == "riscv_elementwise_add_s8"
+    if add:
+        signature = ["p", "p", "q31", "q31", "q31", "q31", "q31", "q31", "q31", "p", "q31", "q31", "q31", "q31", "q31", "q31"]
+    else:
+        signature = ["p", "p", "q31", "q31", "p", "q31", "q31", "q31", "q31", "q31", "q31"]
+    func = lib.kernel(name, signature, ctypes.c_int)
+    ref = lib.kernel(reference, signature, ctypes.c_int)
+    for n in lengths:
+        a = random_array(rng, "q7", n)
+        b = random_array(rng, "q7", n)
+        offsets = [int(o) for o in rng.integers(-127, 128, 3)]
+        act_min, act_max = sorted(int(v) for v in rng.integers(-128, 128, 2))
+        if add:
+            (m1, s1), (m2, s2), (mo, so) = [requantize_params(rng) for _ in range(3)]
+            params = [offsets[0], m1, s1, offsets[1], m2, s2, 20]
+            tail = [offsets[2], mo, so, act_min, act_max, n]
+        else:
+            mo, so = requantize_params(rng)
+            params = [offsets[0], offsets[1]]
+            tail = [offsets[2], mo, so, act_min, act_max, n]
+        results = []
+        for call in (ref, func):
+            dst = np.zeros(n, dtype=np.int8)
+            status = call(*([a.copy(), b.copy()] + params + [dst] + tail))
+            results.append((status, dst))
+        (ref_status, expected), (status, actual) = results
+        assert status == ref_status, "%s n=%d status %d, expected %d" % (name, n, status, ref_status)
+        diff, idx = max_diff("q7", expected, actual)
+        assert diff <= DELTAS["q7"], "%s n=%d mismatch at %d, expected %d, actual %d" \
+            % (name, n, idx, expected[idx], actual[idx])
+
+class nn_context(ctypes.Structure):
+    _fields_ = [("buf", ctypes.c_void_p), ("size", ctypes.c_int32)]
+
+class nn_dims(ctypes.Structure):
+    _fields_ = [("n", ctypes.c_int32), ("h", ctypes.c_int32), ("w", ctypes.c_int32), ("c", ctypes.c_int32)]
+
+class nn_tile(ctypes.Structure):
+    _fields_ = [("w", ctypes.c_int32), ("h", ctypes.c_int32)]
+
+class nn_activation(ctypes.Structure):
+    _fields_ = [("min", ctypes.c_int32), ("max", ctypes.c_int32)]
+
+class nn_conv_params(ctypes.Structure):
+    _fields_ = [("input_offset", ctypes.c_int32), ("output_offset", ctypes.c_int32), ("stride", nn_tile),
+                ("padding", nn_tile), ("dilation", nn_tile), ("activation", nn_activation)]
+
+class nn_pool_params(ctypes.Structure):
+    _fields_ = [("stride", nn_tile), ("padding", nn_tile), ("activation", nn_activation)]
+
+class nn_fc_params(ctypes.Structure):
+    _fields_ = [("input_offset", ctypes.c_int32), ("filter_offset", ctypes.c_int32), ("output_offset", ctypes.c_int32),
+                ("activation", nn_activation)]
+
+class nn_per_channel_quant_params(ctypes.Structure):
+    _fields_ = [("multiplier", ctypes.c_void_p), ("shift", ctypes.c_void_p)]
+
+class nn_per_tensor_quant_params(ctypes.Structure):
+    _fields_ = [("multiplier", ctypes.c_int32), ("shift", ctypes.c_int32)]
+
+def nn_func(lib, name):
+    """ Return the NMSIS-NN function name taking structures by reference and numpy arrays, None if not built """
+    if lib.has(name) == False:
+        return None
+    func = getattr(lib.lib, name)
+    func.restype = ctypes.c_int
+    def call(*args):
+        cargs = []
+        for arg in args:
+            if isinstance(arg, np.ndarray):
+                cargs.append(ctypes.c_void_p(arg.ctypes.data))
+            elif isinstance(arg, ctypes.Structure):
+                cargs.append(ctypes.byref(arg))
+            elif arg is None:
+                cargs.append(ctypes.c_void_p(None))
+            else:
+                cargs.append(ctypes.c_int(arg))
+        return func(*cargs)
+    return call
+
+def nn_buffer(lib, name, *dims):
+    """ Context holding a buffer of the size returned by name, the array is kept alive by the context """
+    getsize = nn_func(lib, name)
+    size = max(getsize(*dims), 0) if getsize else 0
+    buf = np.zeros(max(size, 1), dtype=np.int8)
+    ctx = nn_context(buf.ctypes.data, size)
+    ctx.keep = buf
+    return ctx
+
+def conv_case(rng, max_in_ch, max_out_ch, kernel_1x1=False):
+    """ Random shape, parameters and data of a s8 convolution """
+    in_ch = int(rng.integers(1, max_in_ch + 1))
+    out_ch = int(rng.integers(1, max_out_ch + 1))
+    kh, kw = (1, 1) if kernel_1x1 else (int(rng.integers(1, 4)), int(rng.integers(1, 4)))
+    sh, sw = (int(rng.integers(1, 3)), int(rng.integers(1, 3)))
+    dh, dw = (1, 1) if kernel_1x1 else (int(rng.integers(1, 3)), int(rng.integers(1, 3)))
+    ph, pw = (0, 0) if kernel_1x1 else (int(rng.integers(0, kh)), int(rng.integers(0, kw)))
+    in_h, in_w = int(rng.integers(dh * (kh - 1) + 1, 12)), int(rng.integers(dw * (kw - 1) + 1, 12))
+    out_h = (in_h + 2 * ph - dh * (kh - 1) - 1) // sh + 1
+    out_w = (in_w + 2 * pw - dw * (kw - 1) - 1) // sw + 1
+    batches = int(rng.integers(1, 3))
+    act_min, act_max = sorted(int(v) for v in rng.integers(-128, 128, 2))
+    params = nn_conv_params(int(rng.integers(-127, 129)), int(rng.integers(-128, 128)), nn_tile(sw, sh),
+                            nn_tile(pw, ph), nn_tile(dw, dh), nn_activation(act_min, act_max))
+    mult = rng.integers(1 << 30, (1 << 31) - 1, out_ch, dtype=np.int32)
+    shift = rng.integers(-10, 1, out_ch, dtype=np.int32)
+    quant = nn_per_channel_quant_params(mult.ctypes.data, shift.ctypes.data)
+    quant.keep = (mult, shift)
+    return dict(params=params, quant=quant,
+                input_dims=nn_dims(batches, in_h, in_w, in_ch), filter_dims=nn_dims(out_ch, kh, kw, in_ch),
+                bias_dims=nn_dims(1, 1, 1, out_ch), output_dims=nn_dims(batches, out_h, out_w, out_ch),
+                input=random_array(rng, "q7", batches * in_h * in_w * in_ch, -128, 127),
+                filter=random_array(rng, "q7", out_ch * kh * kw * in_ch, -128, 127),
+                bias=rng.integers(-(1 << 16), 1 << 16, out_ch, dtype=np.int32))
+
+def convolve_s8(lib, case, output_dims=None):
+    """ Output of the generic riscv_convolve_s8 """
+    output_dims = output_dims or case["output_dims"]
+    conv = nn_func(lib, "riscv_convolve_s8")
+    ctx = nn_buffer(lib, "riscv_convolve_s8_get_buffer_size", case["input_dims"], case["filter_dims"])
+    out = np.zeros(output_dims.n * output_dims.h * output_dims.w * output_dims.c, dtype=np.int8)
+    status = conv(ctx, case["params"], case["quant"], case["input_dims"], case["input"], case["filter_dims"],
+                  case["filter"], case["bias_dims"], case["bias"], nn_dims(1, 1, 1, 1), output_dims, out)
+    assert status == 0, "riscv_convolve_s8 status %d" % (status)
+    return out
+
+def check_s8(name, case, expected, actual):
+    diff, idx = max_diff("q7", expected, actual)
+    assert diff == 0, "%s input %s filter %s mismatch at %d, expected %d, actual %d" \
+        % (name, tuple(getattr(case["input_dims"], f) for f in "nhwc"), tuple(getattr(case["filter_dims"], f) for f in "nhwc"),
+           idx, expected[idx], actual[idx])
+
+def test_convolve_direct_s8(lib, rng, request):
+    direct = nn_func(lib, "riscv_convolve_direct_s8")
+    if direct is None:
+        pytest.skip("riscv_convolve_direct_s8 not built")
+    for _ in range(4 * request.config.getoption("--shapes")):
+        case = conv_case(rng, 4, 20)
+        expected = convolve_s8(lib, case)
+        actual = np.zeros_like(expected)
+        status = direct(None, case["params"], case["quant"], case["input_dims"], case["input"], case["filter_dims"],
+                        case["filter"], case["bias_dims"], case["bias"], case["output_dims"], actual)
+        assert status == 0, "riscv_convolve_direct_s8 status %d" % (status)
+        check_s8("riscv_convolve_direct_s8", case, expected, actual)
+
+@pytest.mark.parametrize("pool_type", [0, 1], ids=["max", "avg"])
+def test_convolve_pool_s8(lib, rng, request, pool_type):
+    fused = nn_func(lib, "riscv_convolve_pool_s8")
+    if fused is None:
+        pytest.skip("riscv_convolve_pool_s8 not built")
+    pool = nn_func(lib, "riscv_avgpool_s8" if pool_type else "riscv_max_pool_s8")
+    for _ in range(4 * request.config.getoption("--shapes")):
+        case = conv_case(rng, 8, 20)
+        conv_dims = case["output_dims"]
+        if conv_dims.h < 2 or conv_dims.w < 2:
+            continue
+        conv_out = convolve_s8(lib, case)
+        output_dims = nn_dims(conv_dims.n, conv_dims.h // 2, conv_dims.w // 2, conv_dims.c)
+        expected = np.zeros(output_dims.n * output_dims.h * output_dims.w * output_dims.c, dtype=np.int8)
+        act = case["params"].activation
+        pool_params = nn_pool_params(nn_tile(2, 2), nn_tile(0, 0), nn_activation(act.min, act.max))
+        pool_ctx = nn_buffer(lib, "riscv_avgpool_s8_get_buffer_size", output_dims.w, output_dims.c)
+        assert pool(pool_ctx, pool_params, conv_dims, conv_out, nn_dims(1, 2, 2, 1), output_dims, expected) == 0
+        actual = np.zeros_like(expected)
+        ctx = nn_buffer(lib, "riscv_convolve_pool_s8_get_buffer_size", case["input_dims"], case["filter_dims"], output_dims)
+        status = fused(ctx, case["params"], case["quant"], pool_type, case["input_dims"], case["input"], case["filter_dims"],
+                       case["filter"], case["bias_dims"], case["bias"], output_dims, actual)
+        assert status == 0, "riscv_convolve_pool_s8 status %d" % (status)
+        check_s8("riscv_convolve_pool_s8", case, expected, actual)
+
+def sparse_weights(rng, rows, cols):
+    """ Random 2:4 sparse weights, packed by NN/Scripts/SparseWeights/sparse_weight_pack.py """
+    dense, _ = sparse_weight_pack.prune_2_4(random_array(rng, "q7", rows * cols, -128, 127).reshape(rows, cols))
+    values, index = sparse_weight_pack.pack(dense)
+    return dense, np.ascontiguousarray(values.ravel()), np.ascontiguousarray(index.ravel())
+
+def test_convolve_1x1_sparse_s8(lib, rng, request):
+    sparse = nn_func(lib, "riscv_convolve_1x1_sparse_s8")
+    if sparse is None:
+        pytest.skip("riscv_convolve_1x1_sparse_s8 not built")
+    for _ in range(4 * request.config.getoption("--shapes")):
+        case = conv_case(rng, 6, 20, kernel_1x1=True)
+        in_ch = 4 * case["input_dims"].c
+        case["input_dims"].c = case["filter_dims"].c = in_ch
+        dims = case["input_dims"]
+        case["input"] = random_array(rng, "q7", dims.n * dims.h * dims.w * in_ch, -128, 127)
+        dense, values, index = sparse_weights(rng, case["filter_dims"].n, in_ch)
+        case["filter"] = np.ascontiguousarray(dense.ravel())
+        expected = convolve_s8(lib, case)
+        actual = np.zeros_like(expected)
+        status = sparse(None, case["params"], case["quant"], case["input_dims"], case["input"], case["filter_dims"],
+                        values, index, case["bias_dims"], case["bias"], case["output_dims"], actual)
+        assert status == 0, "riscv_convolve_1x1_sparse_s8 status %d" % (status)
+        check_s8("riscv_convolve_1x1_sparse_s8", case, expected, actual)
+
+def test_fully_connected_sparse_s8(lib, rng, request):
+    sparse = nn_func(lib, "riscv_fully_connected_sparse_s8")
+    if sparse is None:
+        pytest.skip("riscv_fully_connected_sparse_s8 not built")
+    dense_fc = nn_func(lib, "riscv_fully_connected_s8")
+    for _ in range(4 * request.config.getoption("--shapes")):
+        batches, depth, out_ch = int(rng.integers(1, 4)), 4 * int(rng.integers(1, 40)), int(rng.integers(1, 40))
+        act_min, act_max = sorted(int(v) for v in rng.integers(-128, 128, 2))
+        params = nn_fc_params(int(rng.integers(-127, 129)), 0, int(rng.integers(-128, 128)), nn_activation(act_min, act_max))
+        quant = nn_per_tensor_quant_params(*requantize_params(rng))
+        input_dims, filter_dims = nn_dims(batches, 1, 1, depth), nn_dims(depth, 1, 1, out_ch)
+        bias_dims, output_dims = nn_dims(1, 1, 1, out_ch), nn_dims(batches, 1, 1, out_ch)
+        data = random_array(rng, "q7", batches * depth, -128, 127)
+        bias = rng.integers(-(1 << 16), 1 << 16, out_ch, dtype=np.int32)
+        dense, values, index = sparse_weights(rng, out_ch, depth)
+        # riscv_fully_connected_s8 takes the weights as [C_OUT, depth] too
+        weights = np.ascontiguousarray(dense.ravel())
+        expected = np.zeros(batches * out_ch, dtype=np.int8)
+        ctx = nn_buffer(lib, "riscv_fully_connected_s8_get_buffer_size", filter_dims)
+        assert dense_fc(ctx, params, quant, input_dims, data, filter_dims, weights, bias_dims, bias, output_dims, expected) == 0
+        actual = np.zeros_like(expected)
+        status = sparse(None, params, quant, input_dims, data, filter_dims, values, index, bias_dims, bias, output_dims, actual)
+        assert status == 0, "riscv_fully_connected_sparse_s8 status %d" % (status)
+        diff, idx = max_diff("q7", expected, actual)
+        assert diff == 0, "riscv_fully_connected_sparse_s8 %dx%d mismatch at %d, expected %d, actual %d" \
+            % (out_ch, depth, idx, expected[idx], actual[idx])
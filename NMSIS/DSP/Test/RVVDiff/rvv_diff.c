@@ -0,0 +1,936 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Differential test driver of the RVV and scalar code of NMSIS-DSP.
+ *
+ * This program is built twice by rvv_diff.py, linked with a vector (such as rv64gcv) and a
+ * scalar (such as rv64gc) build of NMSIS-DSP, and both are run under qemu user mode with:
+ *
+ *   rvv_diff <output file> <seed> <vlen> <random lengths> [kernel filter]
+ *
+ * Each kernel is run for the lengths 0..3, VLMAX - 1, VLMAX and VLMAX + 1 of each SEW and LMUL,
+ * 4 * VLEN and random lengths up to 4 * VLEN, alternating aligned and misaligned buffers. The
+ * inputs only depend on the seed, the kernel name and the lengths, so both builds compute the same
+ * calls, and the outputs are written into the output file as records
+ *
+ *   char name[48]; uint32_t n, count, guard; char type[4]; element data[count]
+ *
+ * where the last guard elements follow the expected output and must keep the DIFF_SENTINEL bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+
+#define DIFF_MAX_VLEN       1024
+/* Longest length of a kernel call, in elements */
+#define DIFF_MAX_LEN        (4 * DIFF_MAX_VLEN)
+/* Elements checked after the output of each call */
+#define DIFF_GUARD          16
+/* Words of each buffer: complex data of DIFF_MAX_LEN samples, the guard and the misaligned offset */
+#define DIFF_BUF_WORDS      (2 * DIFF_MAX_LEN + 2 * DIFF_GUARD + 16)
+#define DIFF_SENTINEL       0xA5
+#define DIFF_MAX_LENGTHS    64
+#define DIFF_NAME_SIZE      48
+/* Taps of the FIR filters and longest second input of the convolutions */
+#define DIFF_NUM_TAPS       32
+/* Bits of headroom of the q inputs of the kernels which don't saturate their accumulation, log2(DIFF_NUM_TAPS) */
+#define DIFF_ACC_HEADROOM   5
+
+static uint32_t diff_a[DIFF_BUF_WORDS] __ALIGNED(64);
+static uint32_t diff_b[DIFF_BUF_WORDS] __ALIGNED(64);
+static uint32_t diff_d[DIFF_BUF_WORDS] __ALIGNED(64);
+static uint32_t diff_s[DIFF_BUF_WORDS] __ALIGNED(64);
+/* Filter coefficients and FFT twiddles */
+static uint32_t diff_w[DIFF_BUF_WORDS] __ALIGNED(64);
+
+static uint64_t diff_state;
+/* Misaligned offset in elements of the current call */
+static uint32_t diff_off;
+static FILE *diff_out;
+
+static uint32_t diff_rand(void)
+{
+    /* xorshift64*, the same sequence on any target */
+    diff_state ^= diff_state >> 12;
+    diff_state ^= diff_state << 25;
+    diff_state ^= diff_state >> 27;
+    return (uint32_t)((diff_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static void diff_seed(uint32_t seed, const char *name)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    /* FNV-1a of the name, so a kernel gets the same inputs whatever the filter */
+    while (*name) {
+        hash = (hash ^ (uint8_t)*name++) * 0x100000001B3ULL;
+    }
+    diff_state = hash ^ ((uint64_t)seed << 32) ^ seed;
+    if (diff_state == 0) {
+        diff_state = 1;
+    }
+}
+
+/* f32 and f64 in [-1, 1), q and u types in their full range */
+static void gen_f32(float32_t *p, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        p[i] = (float32_t)((int32_t)diff_rand() >> 8) / 8388608.0f;
+    }
+}
+
+static void gen_f64(float64_t *p, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        p[i] = (float64_t)((int32_t)diff_rand()) / 2147483648.0;
+    }
+}
+
+#define DIFF_GEN_INT(t, T, shift)                                   \
+static void gen_##t(T *p, uint32_t n)                               \
+{                                                                   \
+    for (uint32_t i = 0; i < n; i++) {                              \
+        p[i] = (T)(diff_rand() >> (shift));                         \
+    }                                                               \
+}
+
+DIFF_GEN_INT(q31, q31_t, 0)
+DIFF_GEN_INT(q15, q15_t, 16)
+DIFF_GEN_INT(q7, q7_t, 24)
+DIFF_GEN_INT(u32, uint32_t, 0)
+DIFF_GEN_INT(u16, uint16_t, 16)
+DIFF_GEN_INT(u8, uint8_t, 24)
+
+/*
+ * q inputs with headroom: _acc for the kernels whose accumulation is not saturated, such as
+ * riscv_fir_q31, _fft for the fixed point FFTs whose radix-3 and radix-5 butterflies can overflow
+ */
+#define DIFF_GEN_HEADROOM(t, T, suffix, bits)                       \
+static void gen_##t##suffix(T *p, uint32_t n)                       \
+{                                                                   \
+    gen_##t(p, n);                                                  \
+    for (uint32_t i = 0; i < n; i++) {                              \
+        p[i] = (T)(p[i] >> (bits));                                 \
+    }                                                               \
+}
+
+DIFF_GEN_HEADROOM(q31, q31_t, _acc, DIFF_ACC_HEADROOM)
+DIFF_GEN_HEADROOM(q31, q31_t, _fft, 1)
+DIFF_GEN_HEADROOM(q15, q15_t, _fft, 1)
+
+static void diff_clear(void)
+{
+    memset(diff_d, DIFF_SENTINEL, sizeof(diff_d));
+    memset(diff_s, DIFF_SENTINEL, sizeof(diff_s));
+}
+
+static void diff_emit(const char *name, uint32_t n, const char *type, const void *data, uint32_t count, uint32_t size)
+{
+    char header[DIFF_NAME_SIZE];
+    uint32_t fields[3] = { n, count + DIFF_GUARD, DIFF_GUARD };
+    char tag[4] = { 0 };
+
+    memset(header, 0, sizeof(header));
+    strncpy(header, name, sizeof(header) - 1);
+    memcpy(tag, type, strlen(type) < sizeof(tag) ? strlen(type) : sizeof(tag));
+    fwrite(header, 1, sizeof(header), diff_out);
+    fwrite(fields, sizeof(uint32_t), 3, diff_out);
+    fwrite(tag, 1, sizeof(tag), diff_out);
+    fwrite(data, size, count + DIFF_GUARD, diff_out);
+}
+
+#define DIFF_EMIT(fn, t, T, p, count)     diff_emit(#fn, n, #t, p, count, sizeof(T))
+
+/* fn(pSrc, pDst, n) with fin * n inputs and fout * n outputs */
+#define DIFF_MAP(fn, T, t, fin, D, dt, fout)                        \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    D *pD = (D *)diff_d + diff_off;                                 \
+    gen_##t(pA, (fin) * n);                                         \
+    diff_clear();                                                   \
+    fn(pA, pD, n);                                                  \
+    DIFF_EMIT(fn, dt, D, pD, (fout) * n);                           \
+}
+
+/* fn(pSrcA, pSrcB, pDst, n) */
+#define DIFF_ZIP(fn, T, t, fin, fout)                               \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pB = (T *)diff_b + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    gen_##t(pA, (fin) * n);                                         \
+    gen_##t(pB, (fin) * n);                                         \
+    diff_clear();                                                   \
+    fn(pA, pB, pD, n);                                              \
+    DIFF_EMIT(fn, t, T, pD, (fout) * n);                            \
+}
+
+/* fn(pSrc, scalar, pDst, n) */
+#define DIFF_SCALAR(fn, T, t)                                       \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    T scalar;                                                       \
+    gen_##t(&scalar, 1);                                            \
+    gen_##t(pA, n);                                                 \
+    diff_clear();                                                   \
+    fn(pA, scalar, pD, n);                                          \
+    DIFF_EMIT(fn, t, T, pD, n);                                     \
+}
+
+/* fn(pSrc, scaleFract, shift, pDst, n) */
+#define DIFF_SCALE(fn, T, t)                                        \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    T scale;                                                        \
+    int8_t shift = (int8_t)(diff_rand() % 5) - 2;                   \
+    gen_##t(&scale, 1);                                             \
+    gen_##t(pA, n);                                                 \
+    diff_clear();                                                   \
+    fn(pA, scale, shift, pD, n);                                    \
+    DIFF_EMIT(fn, t, T, pD, n);                                     \
+}
+
+/* fn(pSrc, shiftBits, pDst, n) */
+#define DIFF_SHIFT(fn, T, t)                                        \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    int8_t shift = (int8_t)(diff_rand() % 9) - 4;                   \
+    gen_##t(pA, n);                                                 \
+    diff_clear();                                                   \
+    fn(pA, shift, pD, n);                                           \
+    DIFF_EMIT(fn, t, T, pD, n);                                     \
+}
+
+/* fn(pSrc, pDst, low, high, n) */
+#define DIFF_CLIP(fn, T, t)                                         \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    T limits[2], tmp;                                               \
+    gen_##t(limits, 2);                                             \
+    if (limits[0] > limits[1]) {                                    \
+        tmp = limits[0]; limits[0] = limits[1]; limits[1] = tmp;    \
+    }                                                               \
+    gen_##t(pA, n);                                                 \
+    diff_clear();                                                   \
+    fn(pA, pD, limits[0], limits[1], n);                            \
+    DIFF_EMIT(fn, t, T, pD, n);                                     \
+}
+
+/* fn(pSrc, n, pResult) */
+#define DIFF_REDUCE(fn, T, t, R, rt)                                \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    R *pR = (R *)diff_d;                                            \
+    gen_##t(pA, n);                                                 \
+    diff_clear();                                                   \
+    fn(pA, n, pR);                                                  \
+    DIFF_EMIT(fn, rt, R, pR, 1);                                    \
+}
+
+/* fn(pSrc, n, pResult, pIndex), the index is checked by the driver */
+#define DIFF_REDUCE_IDX(fn, T, t)                                   \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pR = (T *)diff_d;                                            \
+    uint32_t *pIndex = diff_s;                                      \
+    gen_##t(pA, n);                                                 \
+    diff_clear();                                                   \
+    fn(pA, n, pR, pIndex);                                          \
+    /* Equal values can be found at other indexes, emit the value at the index */ \
+    pR[1] = (*pIndex < n) ? pA[*pIndex] : pR[0];                    \
+    DIFF_EMIT(fn, t, T, pR, 2);                                     \
+}
+
+/* fn(pSrcA, pSrcB, n, pResult) with fin * n inputs */
+#define DIFF_DOT(fn, T, t, fin, R, rt)                              \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pB = (T *)diff_b + diff_off;                                 \
+    R *pR = (R *)diff_d;                                            \
+    gen_##t(pA, (fin) * n);                                         \
+    gen_##t(pB, (fin) * n);                                         \
+    diff_clear();                                                   \
+    fn(pA, pB, n, pR);                                              \
+    DIFF_EMIT(fn, rt, R, pR, 1);                                    \
+}
+
+/* fn(pSrcA, pSrcB, n, pRealResult, pImagResult) */
+#define DIFF_CMPLX_DOT(fn, T, t, R, rt)                             \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pB = (T *)diff_b + diff_off;                                 \
+    R *pR = (R *)diff_d;                                            \
+    gen_##t(pA, 2 * n);                                             \
+    gen_##t(pB, 2 * n);                                             \
+    diff_clear();                                                   \
+    fn(pA, pB, n, &pR[0], &pR[1]);                                  \
+    DIFF_EMIT(fn, rt, R, pR, 2);                                    \
+}
+
+/*
+ * Matrix kernels, the length gives the columns of the result, which are the vector lanes of
+ * most RVV matrix kernels, and the other dimensions are random
+ */
+#define DIFF_MAT_COLS(n)      ((n) % 257U + 1U)
+
+/* call is DIFF_MAT_CALL, or DIFF_MAT_CALL_STATE for the kernels which take a scratch buffer */
+#define DIFF_MAT_CALL(fn)                   fn(&matA, &matB, &matD)
+#define DIFF_MAT_CALL_STATE(fn)             fn(&matA, &matB, &matD, pState)
+
+/* Product of a (rows x inner) and a (inner x cols) matrix */
+#define DIFF_MAT_MULT(fn, T, t, I, call)                            \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint16_t rows = (uint16_t)(diff_rand() % 8U + 1U);              \
+    uint16_t inner = (uint16_t)(diff_rand() % 16U + 1U);            \
+    uint16_t cols = (uint16_t)DIFF_MAT_COLS(n);                     \
+    I matA, matB, matD;                                             \
+    T *pState = (T *)diff_s;                                        \
+    gen_##t((T *)diff_a, rows * inner);                             \
+    gen_##t((T *)diff_b, inner * cols);                             \
+    diff_clear();                                                   \
+    matA.numRows = rows; matA.numCols = inner; matA.pData = (T *)diff_a; \
+    matB.numRows = inner; matB.numCols = cols; matB.pData = (T *)diff_b; \
+    matD.numRows = rows; matD.numCols = cols; matD.pData = (T *)diff_d; \
+    (void)pState;                                                   \
+    call(fn);                                                       \
+    DIFF_EMIT(fn, t, T, diff_d, rows * cols);                       \
+}
+
+/* fn(pSrcA, pSrcB, pDst) of two (rows x cols) matrices */
+#define DIFF_MAT_ZIP(fn, T, t, I)                                   \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint16_t rows = (uint16_t)(diff_rand() % 16U + 1U);             \
+    uint16_t cols = (uint16_t)DIFF_MAT_COLS(n);                     \
+    I matA, matB, matD;                                             \
+    gen_##t((T *)diff_a, rows * cols);                              \
+    gen_##t((T *)diff_b, rows * cols);                              \
+    diff_clear();                                                   \
+    matA.numRows = rows; matA.numCols = cols; matA.pData = (T *)diff_a; \
+    matB.numRows = rows; matB.numCols = cols; matB.pData = (T *)diff_b; \
+    matD.numRows = rows; matD.numCols = cols; matD.pData = (T *)diff_d; \
+    fn(&matA, &matB, &matD);                                        \
+    DIFF_EMIT(fn, t, T, diff_d, rows * cols);                       \
+}
+
+/* fn(pSrc, pDst) of a (rows x cols) matrix transposed */
+#define DIFF_MAT_TRANS(fn, T, t, I)                                 \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint16_t rows = (uint16_t)(diff_rand() % 16U + 1U);             \
+    uint16_t cols = (uint16_t)DIFF_MAT_COLS(n);                     \
+    I matA, matD;                                                   \
+    gen_##t((T *)diff_a, rows * cols);                              \
+    diff_clear();                                                   \
+    matA.numRows = rows; matA.numCols = cols; matA.pData = (T *)diff_a; \
+    matD.numRows = cols; matD.numCols = rows; matD.pData = (T *)diff_d; \
+    fn(&matA, &matD);                                               \
+    DIFF_EMIT(fn, t, T, diff_d, rows * cols);                       \
+}
+
+/* FIR filter fn(&S, pSrc, pDst, n) of DIFF_NUM_TAPS taps, init(&S, numTaps, pCoeffs, pState, n) */
+#define DIFF_FIR(fn, T, t, gen, I, init)                            \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    I S;                                                            \
+    gen((T *)diff_w, DIFF_NUM_TAPS);                                \
+    gen(pA, n);                                                     \
+    diff_clear();                                                   \
+    init(&S, DIFF_NUM_TAPS, (T *)diff_w, (T *)diff_s, n);           \
+    fn(&S, pA, pD, n);                                              \
+    DIFF_EMIT(fn, t, T, pD, n);                                     \
+}
+
+/* Decimator of a random factor M, the length is rounded down to a multiple of M */
+#define DIFF_FIR_DECIMATE(fn, T, t, gen, I, init)                   \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    uint8_t M = (uint8_t)(diff_rand() % 4U + 2U);                   \
+    uint32_t blockSize = n - n % M;                                 \
+    I S;                                                            \
+    gen((T *)diff_w, DIFF_NUM_TAPS);                                \
+    gen(pA, blockSize);                                             \
+    diff_clear();                                                   \
+    init(&S, DIFF_NUM_TAPS, M, (T *)diff_w, (T *)diff_s, blockSize); \
+    fn(&S, pA, pD, blockSize);                                      \
+    DIFF_EMIT(fn, t, T, pD, blockSize / M);                         \
+}
+
+/*
+ * fn(pSrcA, n, pSrcB, srcBLen, pDst) of a random srcBLen up to DIFF_NUM_TAPS, the output
+ * has n + srcBLen - 1 values for the convolutions and 2 * max(n, srcBLen) - 1 for the correlations
+ */
+#define DIFF_CONV(fn, T, t, gen, count)                             \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pB = (T *)diff_b + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    uint32_t srcBLen = diff_rand() % DIFF_NUM_TAPS + 1U;            \
+    gen(pA, n);                                                     \
+    gen(pB, srcBLen);                                               \
+    diff_clear();                                                   \
+    fn(pA, n, pB, srcBLen, pD);                                     \
+    DIFF_EMIT(fn, t, T, pD, count(n, srcBLen));                     \
+}
+
+#define DIFF_CONV_LEN(n, m)             ((n) + (m) - 1U)
+#define DIFF_CORR_LEN(n, m)             (2U * ((n) > (m) ? (n) : (m)) - 1U)
+
+/*
+ * Transform kernels, the length gives the largest FFT length radix^k in [16, max_len] not above it,
+ * the odd lengths run the inverse transform
+ */
+static uint32_t diff_fft_len(uint32_t n, uint32_t radix, uint32_t max_len)
+{
+    uint32_t fftLen = 16U;
+
+    while ((fftLen * radix <= n) && (fftLen * radix <= max_len)) {
+        fftLen *= radix;
+    }
+    return fftLen;
+}
+
+/* Legacy in place fn(&S, pSrc) initialized by init(&S, fftLen, ifftFlag, bitReverseFlag) */
+#define DIFF_CFFT_RADIX(fn, T, t, I, init, radix)                  \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint32_t fftLen = diff_fft_len(n, radix, DIFF_MAX_LEN);         \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    I S;                                                            \
+    diff_clear();                                                   \
+    gen_##t(pD, 2 * fftLen);                                        \
+    init(&S, (uint16_t)fftLen, (uint8_t)(n & 1U), 1U);              \
+    fn(&S, pD);                                                     \
+    DIFF_EMIT(fn, t, T, pD, 2 * fftLen);                            \
+}
+
+/*
+ * riscv_cfft_<t> and riscv_rfft_fast_f32 run out of place with a temporary buffer in the vector
+ * builds, and in place, with the bit reversal for the CFFTs, in the scalar builds
+ */
+#define DIFF_FFT_OUT(fn, T, pA, pD, count, ifft)    fn(&S, pA, pD, (T *)diff_s, ifft)
+#define DIFF_CFFT_IN(fn, T, pA, pD, count, ifft)    do { memcpy(pD, pA, (count) * sizeof(T)); fn(&S, pD, ifft, 1U); } while (0)
+#define DIFF_RFFT_IN(fn, T, pA, pD, count, ifft)    fn(&S, pA, pD, ifft)
+
+#if defined(RISCV_MATH_VECTOR_ZVE32F)
+#define DIFF_CFFT_F32                   DIFF_FFT_OUT
+#define DIFF_RFFT_F32                   DIFF_FFT_OUT
+#else
+#define DIFF_CFFT_F32                   DIFF_CFFT_IN
+#define DIFF_RFFT_F32                   DIFF_RFFT_IN
+#endif
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+#define DIFF_CFFT_Q                     DIFF_FFT_OUT
+#else
+#define DIFF_CFFT_Q                     DIFF_CFFT_IN
+#endif
+
+/* fn of a power of two length in [min_len, DIFF_MAX_LEN] initialized by init(&S, fftLen), count values */
+#define DIFF_FFT(fn, T, t, gen, I, init, min_len, count, call)      \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint32_t fftLen = diff_fft_len(n, 2U, DIFF_MAX_LEN);            \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    I S;                                                            \
+    fftLen = (fftLen < (min_len)) ? (min_len) : fftLen;             \
+    diff_clear();                                                   \
+    gen(pA, count);                                                 \
+    init(&S, (uint16_t)fftLen);                                     \
+    call(fn, T, pA, pD, count, (uint8_t)(n & 1U));                  \
+    DIFF_EMIT(fn, t, T, pD, count);                                 \
+}
+
+/* Largest product of 2, 3 and 5 not above n and max_len, at least 2 */
+static uint32_t diff_mixed_len(uint32_t n, uint32_t max_len)
+{
+    uint32_t len = (n < max_len) ? n : max_len;
+    uint32_t m;
+
+    for (; len > 2U; len--) {
+        m = len;
+        while (m % 2U == 0U) {
+            m /= 2U;
+        }
+        while (m % 3U == 0U) {
+            m /= 3U;
+        }
+        while (m % 5U == 0U) {
+            m /= 5U;
+        }
+        if (m == 1U) {
+            break;
+        }
+    }
+    return (len < 2U) ? 2U : len;
+}
+
+/* Mixed-radix fn(&S, pIn, pOut, pBuffer, ifftFlag) initialized by init(&S, fftLen, pTwiddle) */
+#define DIFF_FFT_MIXED(fn, T, t, gen, I, init, len, count)          \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint32_t fftLen = (len);                                        \
+    T *pA = (T *)diff_a + diff_off;                                 \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    I S;                                                            \
+    diff_clear();                                                   \
+    gen(pA, count);                                                 \
+    init(&S, fftLen, (T *)diff_w);                                  \
+    fn(&S, pA, pD, (T *)diff_s, (uint8_t)(n & 1U));                 \
+    DIFF_EMIT(fn, t, T, pD, count);                                 \
+}
+
+/*
+ * Batched fn(&S, pData, nTransforms, stride, ifftFlag) in place on up to n transforms of 16, 32
+ * or 64 points, the stride leaves a random gap of up to 2 complex values between them
+ */
+#define DIFF_CFFT_BATCH(fn, T, t, gen, I, init)                     \
+static void diff_##fn(uint32_t n)                                   \
+{                                                                   \
+    uint16_t fftLen = (uint16_t)(16U << (diff_rand() % 3U));        \
+    uint32_t stride = fftLen + diff_rand() % 3U;                    \
+    uint32_t nTransforms = (n < DIFF_MAX_LEN / stride) ? n : (DIFF_MAX_LEN / stride); \
+    T *pD = (T *)diff_d + diff_off;                                 \
+    I S;                                                            \
+    diff_clear();                                                   \
+    gen(pD, 2U * nTransforms * stride);                             \
+    init(&S, fftLen, (T *)diff_w);                                  \
+    fn(&S, pD, nTransforms, stride, (uint8_t)(n & 1U));             \
+    DIFF_EMIT(fn, t, T, pD, 2U * nTransforms * stride);             \
+}
+
+#define DIFF_ALL_TYPES(macro, name)                                 \
+    macro(riscv_##name##_f32, float32_t, f32)                       \
+    macro(riscv_##name##_q31, q31_t, q31)                           \
+    macro(riscv_##name##_q15, q15_t, q15)                           \
+    macro(riscv_##name##_q7, q7_t, q7)
+
+#define DIFF_MAP1(fn, T, t)                 DIFF_MAP(fn, T, t, 1, T, t, 1)
+#define DIFF_ZIP1(fn, T, t)                 DIFF_ZIP(fn, T, t, 1, 1)
+#define DIFF_REDUCE1(fn, T, t)              DIFF_REDUCE(fn, T, t, T, t)
+#define DIFF_DOT1(fn, T, t)                 DIFF_DOT(fn, T, t, 1, T, t)
+
+/* BasicMathFunctions */
+DIFF_ALL_TYPES(DIFF_MAP1, abs)
+DIFF_ALL_TYPES(DIFF_MAP1, negate)
+DIFF_ALL_TYPES(DIFF_ZIP1, add)
+DIFF_ALL_TYPES(DIFF_ZIP1, sub)
+DIFF_ALL_TYPES(DIFF_ZIP1, mult)
+DIFF_ALL_TYPES(DIFF_SCALAR, offset)
+DIFF_ALL_TYPES(DIFF_CLIP, clip)
+DIFF_SCALAR(riscv_scale_f32, float32_t, f32)
+DIFF_SCALE(riscv_scale_q31, q31_t, q31)
+DIFF_SCALE(riscv_scale_q15, q15_t, q15)
+DIFF_SCALE(riscv_scale_q7, q7_t, q7)
+DIFF_SHIFT(riscv_shift_q31, q31_t, q31)
+DIFF_SHIFT(riscv_shift_q15, q15_t, q15)
+DIFF_SHIFT(riscv_shift_q7, q7_t, q7)
+DIFF_ZIP1(riscv_and_u32, uint32_t, u32)
+DIFF_ZIP1(riscv_and_u16, uint16_t, u16)
+DIFF_ZIP1(riscv_and_u8, uint8_t, u8)
+DIFF_ZIP1(riscv_or_u32, uint32_t, u32)
+DIFF_ZIP1(riscv_or_u16, uint16_t, u16)
+DIFF_ZIP1(riscv_or_u8, uint8_t, u8)
+DIFF_ZIP1(riscv_xor_u32, uint32_t, u32)
+DIFF_ZIP1(riscv_xor_u16, uint16_t, u16)
+DIFF_ZIP1(riscv_xor_u8, uint8_t, u8)
+DIFF_MAP1(riscv_not_u32, uint32_t, u32)
+DIFF_MAP1(riscv_not_u16, uint16_t, u16)
+DIFF_MAP1(riscv_not_u8, uint8_t, u8)
+DIFF_DOT(riscv_dot_prod_f32, float32_t, f32, 1, float32_t, f32)
+DIFF_DOT(riscv_dot_prod_q31, q31_t, q31, 1, q63_t, q63)
+DIFF_DOT(riscv_dot_prod_q15, q15_t, q15, 1, q63_t, q63)
+DIFF_DOT(riscv_dot_prod_q7, q7_t, q7, 1, q31_t, q31)
+
+/* ComplexMathFunctions */
+DIFF_MAP(riscv_cmplx_conj_f32, float32_t, f32, 2, float32_t, f32, 2)
+DIFF_MAP(riscv_cmplx_conj_q31, q31_t, q31, 2, q31_t, q31, 2)
+DIFF_MAP(riscv_cmplx_conj_q15, q15_t, q15, 2, q15_t, q15, 2)
+DIFF_MAP(riscv_cmplx_mag_f32, float32_t, f32, 2, float32_t, f32, 1)
+DIFF_MAP(riscv_cmplx_mag_q31, q31_t, q31, 2, q31_t, q31, 1)
+DIFF_MAP(riscv_cmplx_mag_q15, q15_t, q15, 2, q15_t, q15, 1)
+DIFF_MAP(riscv_cmplx_mag_squared_f32, float32_t, f32, 2, float32_t, f32, 1)
+DIFF_MAP(riscv_cmplx_mag_squared_q31, q31_t, q31, 2, q31_t, q31, 1)
+DIFF_MAP(riscv_cmplx_mag_squared_q15, q15_t, q15, 2, q15_t, q15, 1)
+DIFF_ZIP(riscv_cmplx_mult_cmplx_f32, float32_t, f32, 2, 2)
+DIFF_ZIP(riscv_cmplx_mult_cmplx_q31, q31_t, q31, 2, 2)
+DIFF_ZIP(riscv_cmplx_mult_cmplx_q15, q15_t, q15, 2, 2)
+DIFF_CMPLX_DOT(riscv_cmplx_dot_prod_f32, float32_t, f32, float32_t, f32)
+DIFF_CMPLX_DOT(riscv_cmplx_dot_prod_q31, q31_t, q31, q63_t, q63)
+DIFF_CMPLX_DOT(riscv_cmplx_dot_prod_q15, q15_t, q15, q31_t, q31)
+
+/* StatisticsFunctions */
+DIFF_ALL_TYPES(DIFF_REDUCE1, mean)
+DIFF_ALL_TYPES(DIFF_REDUCE1, max_no_idx)
+DIFF_ALL_TYPES(DIFF_REDUCE1, min_no_idx)
+DIFF_ALL_TYPES(DIFF_REDUCE1, absmax_no_idx)
+DIFF_ALL_TYPES(DIFF_REDUCE1, absmin_no_idx)
+DIFF_ALL_TYPES(DIFF_REDUCE_IDX, max)
+DIFF_ALL_TYPES(DIFF_REDUCE_IDX, min)
+DIFF_ALL_TYPES(DIFF_REDUCE_IDX, absmax)
+DIFF_ALL_TYPES(DIFF_REDUCE_IDX, absmin)
+DIFF_ALL_TYPES(DIFF_DOT1, mse)
+DIFF_REDUCE1(riscv_rms_f32, float32_t, f32)
+DIFF_REDUCE1(riscv_rms_q31, q31_t, q31)
+DIFF_REDUCE1(riscv_rms_q15, q15_t, q15)
+DIFF_REDUCE1(riscv_std_f32, float32_t, f32)
+DIFF_REDUCE1(riscv_std_q31, q31_t, q31)
+DIFF_REDUCE1(riscv_std_q15, q15_t, q15)
+DIFF_REDUCE1(riscv_var_f32, float32_t, f32)
+DIFF_REDUCE1(riscv_var_q31, q31_t, q31)
+DIFF_REDUCE1(riscv_var_q15, q15_t, q15)
+DIFF_REDUCE(riscv_power_f32, float32_t, f32, float32_t, f32)
+DIFF_REDUCE(riscv_power_q31, q31_t, q31, q63_t, q63)
+DIFF_REDUCE(riscv_power_q15, q15_t, q15, q63_t, q63)
+DIFF_REDUCE(riscv_power_q7, q7_t, q7, q31_t, q31)
+
+/* SupportFunctions */
+DIFF_ALL_TYPES(DIFF_MAP1, copy)
+DIFF_MAP(riscv_q31_to_q15, q31_t, q31, 1, q15_t, q15, 1)
+DIFF_MAP(riscv_q31_to_q7, q31_t, q31, 1, q7_t, q7, 1)
+DIFF_MAP(riscv_q31_to_float, q31_t, q31, 1, float32_t, f32, 1)
+DIFF_MAP(riscv_q15_to_q31, q15_t, q15, 1, q31_t, q31, 1)
+DIFF_MAP(riscv_q15_to_q7, q15_t, q15, 1, q7_t, q7, 1)
+DIFF_MAP(riscv_q15_to_float, q15_t, q15, 1, float32_t, f32, 1)
+DIFF_MAP(riscv_q7_to_q31, q7_t, q7, 1, q31_t, q31, 1)
+DIFF_MAP(riscv_q7_to_q15, q7_t, q7, 1, q15_t, q15, 1)
+DIFF_MAP(riscv_q7_to_float, q7_t, q7, 1, float32_t, f32, 1)
+DIFF_MAP(riscv_float_to_q31, float32_t, f32, 1, q31_t, q31, 1)
+DIFF_MAP(riscv_float_to_q15, float32_t, f32, 1, q15_t, q15, 1)
+DIFF_MAP(riscv_float_to_q7, float32_t, f32, 1, q7_t, q7, 1)
+
+/* MatrixFunctions */
+DIFF_MAT_MULT(riscv_mat_mult_f32, float32_t, f32, riscv_matrix_instance_f32, DIFF_MAT_CALL)
+DIFF_MAT_MULT(riscv_mat_mult_q31, q31_t, q31, riscv_matrix_instance_q31, DIFF_MAT_CALL)
+DIFF_MAT_MULT(riscv_mat_mult_q15, q15_t, q15, riscv_matrix_instance_q15, DIFF_MAT_CALL_STATE)
+DIFF_MAT_MULT(riscv_mat_mult_q7, q7_t, q7, riscv_matrix_instance_q7, DIFF_MAT_CALL_STATE)
+DIFF_MAT_ZIP(riscv_mat_add_f32, float32_t, f32, riscv_matrix_instance_f32)
+DIFF_MAT_ZIP(riscv_mat_add_q31, q31_t, q31, riscv_matrix_instance_q31)
+DIFF_MAT_ZIP(riscv_mat_add_q15, q15_t, q15, riscv_matrix_instance_q15)
+DIFF_MAT_ZIP(riscv_mat_sub_f32, float32_t, f32, riscv_matrix_instance_f32)
+DIFF_MAT_ZIP(riscv_mat_sub_q31, q31_t, q31, riscv_matrix_instance_q31)
+DIFF_MAT_ZIP(riscv_mat_sub_q15, q15_t, q15, riscv_matrix_instance_q15)
+DIFF_MAT_TRANS(riscv_mat_trans_f32, float32_t, f32, riscv_matrix_instance_f32)
+DIFF_MAT_TRANS(riscv_mat_trans_q31, q31_t, q31, riscv_matrix_instance_q31)
+DIFF_MAT_TRANS(riscv_mat_trans_q15, q15_t, q15, riscv_matrix_instance_q15)
+DIFF_MAT_TRANS(riscv_mat_trans_q7, q7_t, q7, riscv_matrix_instance_q7)
+
+/* FilteringFunctions */
+DIFF_FIR(riscv_fir_f32, float32_t, f32, gen_f32, riscv_fir_instance_f32, riscv_fir_init_f32)
+DIFF_FIR(riscv_fir_q31, q31_t, q31, gen_q31_acc, riscv_fir_instance_q31, riscv_fir_init_q31)
+DIFF_FIR(riscv_fir_q15, q15_t, q15, gen_q15, riscv_fir_instance_q15, riscv_fir_init_q15)
+DIFF_FIR(riscv_fir_q7, q7_t, q7, gen_q7, riscv_fir_instance_q7, riscv_fir_init_q7)
+DIFF_FIR_DECIMATE(riscv_fir_decimate_f32, float32_t, f32, gen_f32, riscv_fir_decimate_instance_f32, riscv_fir_decimate_init_f32)
+DIFF_FIR_DECIMATE(riscv_fir_decimate_q31, q31_t, q31, gen_q31_acc, riscv_fir_decimate_instance_q31, riscv_fir_decimate_init_q31)
+DIFF_FIR_DECIMATE(riscv_fir_decimate_q15, q15_t, q15, gen_q15, riscv_fir_decimate_instance_q15, riscv_fir_decimate_init_q15)
+DIFF_CONV(riscv_conv_f32, float32_t, f32, gen_f32, DIFF_CONV_LEN)
+DIFF_CONV(riscv_conv_q31, q31_t, q31, gen_q31_acc, DIFF_CONV_LEN)
+DIFF_CONV(riscv_conv_q15, q15_t, q15, gen_q15, DIFF_CONV_LEN)
+DIFF_CONV(riscv_conv_q7, q7_t, q7, gen_q7, DIFF_CONV_LEN)
+DIFF_CONV(riscv_correlate_f32, float32_t, f32, gen_f32, DIFF_CORR_LEN)
+DIFF_CONV(riscv_correlate_q31, q31_t, q31, gen_q31_acc, DIFF_CORR_LEN)
+DIFF_CONV(riscv_correlate_q15, q15_t, q15, gen_q15, DIFF_CORR_LEN)
+DIFF_CONV(riscv_correlate_q7, q7_t, q7, gen_q7, DIFF_CORR_LEN)
+
+/* TransformFunctions, riscv_cfft_f64 runs the RVV riscv_bitreversal_64 */
+DIFF_CFFT_RADIX(riscv_cfft_radix2_f32, float32_t, f32, riscv_cfft_radix2_instance_f32, riscv_cfft_radix2_init_f32, 2U)
+DIFF_CFFT_RADIX(riscv_cfft_radix2_q31, q31_t, q31, riscv_cfft_radix2_instance_q31, riscv_cfft_radix2_init_q31, 2U)
+DIFF_CFFT_RADIX(riscv_cfft_radix2_q15, q15_t, q15, riscv_cfft_radix2_instance_q15, riscv_cfft_radix2_init_q15, 2U)
+DIFF_CFFT_RADIX(riscv_cfft_radix4_f32, float32_t, f32, riscv_cfft_radix4_instance_f32, riscv_cfft_radix4_init_f32, 4U)
+DIFF_CFFT_RADIX(riscv_cfft_radix4_q31, q31_t, q31, riscv_cfft_radix4_instance_q31, riscv_cfft_radix4_init_q31, 4U)
+DIFF_CFFT_RADIX(riscv_cfft_radix4_q15, q15_t, q15, riscv_cfft_radix4_instance_q15, riscv_cfft_radix4_init_q15, 4U)
+
+static void diff_riscv_cfft_f64(uint32_t n)
+{
+    /* A complex f64 value takes two words of a complex f32 value */
+    uint32_t fftLen = diff_fft_len(n, 2U, DIFF_MAX_LEN / 2U);
+    float64_t *pD = (float64_t *)diff_d;
+    riscv_cfft_instance_f64 S;
+
+    diff_clear();
+    gen_f64(pD, 2 * fftLen);
+    riscv_cfft_init_f64(&S, (uint16_t)fftLen);
+    riscv_cfft_f64(&S, pD, (uint8_t)(n & 1U), 1U);
+    DIFF_EMIT(riscv_cfft_f64, f64, float64_t, pD, 2 * fftLen);
+}
+
+DIFF_FFT(riscv_cfft_f32, float32_t, f32, gen_f32, riscv_cfft_instance_f32, riscv_cfft_init_f32, 16U, 2U * fftLen, DIFF_CFFT_F32)
+DIFF_FFT(riscv_cfft_q31, q31_t, q31, gen_q31, riscv_cfft_instance_q31, riscv_cfft_init_q31, 16U, 2U * fftLen, DIFF_CFFT_Q)
+DIFF_FFT(riscv_cfft_q15, q15_t, q15, gen_q15, riscv_cfft_instance_q15, riscv_cfft_init_q15, 16U, 2U * fftLen, DIFF_CFFT_Q)
+DIFF_FFT(riscv_rfft_fast_f32, float32_t, f32, gen_f32, riscv_rfft_fast_instance_f32, riscv_rfft_fast_init_f32, 32U, fftLen, DIFF_RFFT_F32)
+DIFF_FFT(riscv_rfft_fast_q31, q31_t, q31, gen_q31, riscv_rfft_fast_instance_q31, riscv_rfft_fast_init_q31, 32U, fftLen, DIFF_FFT_OUT)
+DIFF_FFT(riscv_rfft_fast_q15, q15_t, q15, gen_q15, riscv_rfft_fast_instance_q15, riscv_rfft_fast_init_q15, 32U, fftLen, DIFF_FFT_OUT)
+
+#define DIFF_CFFT_MIXED_LEN             diff_mixed_len(n, DIFF_MAX_LEN)
+#define DIFF_RFFT_MIXED_LEN             (2U * diff_mixed_len(n / 2U, DIFF_MAX_LEN))
+
+DIFF_FFT_MIXED(riscv_cfft_mixed_f32, float32_t, f32, gen_f32, riscv_cfft_mixed_instance_f32, riscv_cfft_mixed_init_f32, DIFF_CFFT_MIXED_LEN, 2U * fftLen)
+DIFF_FFT_MIXED(riscv_cfft_mixed_q31, q31_t, q31, gen_q31_fft, riscv_cfft_mixed_instance_q31, riscv_cfft_mixed_init_q31, DIFF_CFFT_MIXED_LEN, 2U * fftLen)
+DIFF_FFT_MIXED(riscv_cfft_mixed_q15, q15_t, q15, gen_q15_fft, riscv_cfft_mixed_instance_q15, riscv_cfft_mixed_init_q15, DIFF_CFFT_MIXED_LEN, 2U * fftLen)
+DIFF_FFT_MIXED(riscv_rfft_mixed_f32, float32_t, f32, gen_f32, riscv_rfft_mixed_instance_f32, riscv_rfft_mixed_init_f32, DIFF_RFFT_MIXED_LEN, fftLen)
+DIFF_FFT_MIXED(riscv_rfft_mixed_q31, q31_t, q31, gen_q31_fft, riscv_rfft_mixed_instance_q31, riscv_rfft_mixed_init_q31, DIFF_RFFT_MIXED_LEN, fftLen)
+DIFF_FFT_MIXED(riscv_rfft_mixed_q15, q15_t, q15, gen_q15_fft, riscv_rfft_mixed_instance_q15, riscv_rfft_mixed_init_q15, DIFF_RFFT_MIXED_LEN, fftLen)
+DIFF_CFFT_BATCH(riscv_cfft_batch_f32, float32_t, f32, gen_f32, riscv_cfft_batch_instance_f32, riscv_cfft_batch_init_f32)
+DIFF_CFFT_BATCH(riscv_cfft_batch_q31, q31_t, q31, gen_q31, riscv_cfft_batch_instance_q31, riscv_cfft_batch_init_q31)
+DIFF_CFFT_BATCH(riscv_cfft_batch_q15, q15_t, q15, gen_q15, riscv_cfft_batch_instance_q15, riscv_cfft_batch_init_q15)
+
+typedef struct {
+    const char *name;
+    void (*run)(uint32_t n);
+    /* Smallest length supported by the kernel */
+    uint32_t min_n;
+} diff_kernel_t;
+
+#define DIFF_ENTRY(fn, min_n)                       { #fn, diff_##fn, min_n },
+#define DIFF_ENTRIES(name, min_n)                   \
+    DIFF_ENTRY(riscv_##name##_f32, min_n)           \
+    DIFF_ENTRY(riscv_##name##_q31, min_n)           \
+    DIFF_ENTRY(riscv_##name##_q15, min_n)           \
+    DIFF_ENTRY(riscv_##name##_q7, min_n)
+
+static const diff_kernel_t diff_kernels[] = {
+    DIFF_ENTRIES(abs, 0)
+    DIFF_ENTRIES(negate, 0)
+    DIFF_ENTRIES(add, 0)
+    DIFF_ENTRIES(sub, 0)
+    DIFF_ENTRIES(mult, 0)
+    DIFF_ENTRIES(offset, 0)
+    DIFF_ENTRIES(clip, 0)
+    DIFF_ENTRIES(scale, 0)
+    DIFF_ENTRY(riscv_shift_q31, 0)
+    DIFF_ENTRY(riscv_shift_q15, 0)
+    DIFF_ENTRY(riscv_shift_q7, 0)
+    DIFF_ENTRY(riscv_and_u32, 0)
+    DIFF_ENTRY(riscv_and_u16, 0)
+    DIFF_ENTRY(riscv_and_u8, 0)
+    DIFF_ENTRY(riscv_or_u32, 0)
+    DIFF_ENTRY(riscv_or_u16, 0)
+    DIFF_ENTRY(riscv_or_u8, 0)
+    DIFF_ENTRY(riscv_xor_u32, 0)
+    DIFF_ENTRY(riscv_xor_u16, 0)
+    DIFF_ENTRY(riscv_xor_u8, 0)
+    DIFF_ENTRY(riscv_not_u32, 0)
+    DIFF_ENTRY(riscv_not_u16, 0)
+    DIFF_ENTRY(riscv_not_u8, 0)
+    DIFF_ENTRIES(dot_prod, 0)
+    DIFF_ENTRY(riscv_cmplx_conj_f32, 0)
+    DIFF_ENTRY(riscv_cmplx_conj_q31, 0)
+    DIFF_ENTRY(riscv_cmplx_conj_q15, 0)
+    DIFF_ENTRY(riscv_cmplx_mag_f32, 0)
+    DIFF_ENTRY(riscv_cmplx_mag_q31, 0)
+    DIFF_ENTRY(riscv_cmplx_mag_q15, 0)
+    DIFF_ENTRY(riscv_cmplx_mag_squared_f32, 0)
+    DIFF_ENTRY(riscv_cmplx_mag_squared_q31, 0)
+    DIFF_ENTRY(riscv_cmplx_mag_squared_q15, 0)
+    DIFF_ENTRY(riscv_cmplx_mult_cmplx_f32, 0)
+    DIFF_ENTRY(riscv_cmplx_mult_cmplx_q31, 0)
+    DIFF_ENTRY(riscv_cmplx_mult_cmplx_q15, 0)
+    DIFF_ENTRY(riscv_cmplx_dot_prod_f32, 0)
+    DIFF_ENTRY(riscv_cmplx_dot_prod_q31, 0)
+    DIFF_ENTRY(riscv_cmplx_dot_prod_q15, 0)
+    DIFF_ENTRIES(mean, 1)
+    DIFF_ENTRIES(max_no_idx, 1)
+    DIFF_ENTRIES(min_no_idx, 1)
+    DIFF_ENTRIES(absmax_no_idx, 1)
+    DIFF_ENTRIES(absmin_no_idx, 1)
+    DIFF_ENTRIES(max, 1)
+    DIFF_ENTRIES(min, 1)
+    DIFF_ENTRIES(absmax, 1)
+    DIFF_ENTRIES(absmin, 1)
+    DIFF_ENTRIES(mse, 1)
+    DIFF_ENTRY(riscv_rms_f32, 1)
+    DIFF_ENTRY(riscv_rms_q31, 1)
+    DIFF_ENTRY(riscv_rms_q15, 1)
+    DIFF_ENTRY(riscv_std_f32, 2)
+    DIFF_ENTRY(riscv_std_q31, 2)
+    DIFF_ENTRY(riscv_std_q15, 2)
+    DIFF_ENTRY(riscv_var_f32, 2)
+    DIFF_ENTRY(riscv_var_q31, 2)
+    DIFF_ENTRY(riscv_var_q15, 2)
+    DIFF_ENTRIES(power, 1)
+    DIFF_ENTRIES(copy, 0)
+    DIFF_ENTRY(riscv_q31_to_q15, 0)
+    DIFF_ENTRY(riscv_q31_to_q7, 0)
+    DIFF_ENTRY(riscv_q31_to_float, 0)
+    DIFF_ENTRY(riscv_q15_to_q31, 0)
+    DIFF_ENTRY(riscv_q15_to_q7, 0)
+    DIFF_ENTRY(riscv_q15_to_float, 0)
+    DIFF_ENTRY(riscv_q7_to_q31, 0)
+    DIFF_ENTRY(riscv_q7_to_q15, 0)
+    DIFF_ENTRY(riscv_q7_to_float, 0)
+    DIFF_ENTRY(riscv_float_to_q31, 0)
+    DIFF_ENTRY(riscv_float_to_q15, 0)
+    DIFF_ENTRY(riscv_float_to_q7, 0)
+    DIFF_ENTRIES(mat_mult, 0)
+    DIFF_ENTRY(riscv_mat_add_f32, 0)
+    DIFF_ENTRY(riscv_mat_add_q31, 0)
+    DIFF_ENTRY(riscv_mat_add_q15, 0)
+    DIFF_ENTRY(riscv_mat_sub_f32, 0)
+    DIFF_ENTRY(riscv_mat_sub_q31, 0)
+    DIFF_ENTRY(riscv_mat_sub_q15, 0)
+    DIFF_ENTRY(riscv_mat_trans_f32, 0)
+    DIFF_ENTRY(riscv_mat_trans_q31, 0)
+    DIFF_ENTRY(riscv_mat_trans_q15, 0)
+    DIFF_ENTRY(riscv_mat_trans_q7, 0)
+    DIFF_ENTRY(riscv_fir_f32, 0)
+    DIFF_ENTRY(riscv_fir_q31, 0)
+    DIFF_ENTRY(riscv_fir_q15, 0)
+    DIFF_ENTRY(riscv_fir_q7, 0)
+    DIFF_ENTRY(riscv_fir_decimate_f32, 0)
+    DIFF_ENTRY(riscv_fir_decimate_q31, 0)
+    DIFF_ENTRY(riscv_fir_decimate_q15, 0)
+    DIFF_ENTRY(riscv_conv_f32, 1)
+    DIFF_ENTRY(riscv_conv_q31, 1)
+    DIFF_ENTRY(riscv_conv_q15, 1)
+    DIFF_ENTRY(riscv_conv_q7, 1)
+    DIFF_ENTRY(riscv_correlate_f32, 1)
+    DIFF_ENTRY(riscv_correlate_q31, 1)
+    DIFF_ENTRY(riscv_correlate_q15, 1)
+    DIFF_ENTRY(riscv_correlate_q7, 1)
+    DIFF_ENTRY(riscv_cfft_radix2_f32, 0)
+    DIFF_ENTRY(riscv_cfft_radix2_q31, 0)
+    DIFF_ENTRY(riscv_cfft_radix2_q15, 0)
+    DIFF_ENTRY(riscv_cfft_radix4_f32, 0)
+    DIFF_ENTRY(riscv_cfft_radix4_q31, 0)
+    DIFF_ENTRY(riscv_cfft_radix4_q15, 0)
+    DIFF_ENTRY(riscv_cfft_f64, 0)
+    DIFF_ENTRY(riscv_cfft_f32, 0)
+    DIFF_ENTRY(riscv_cfft_q31, 0)
+    DIFF_ENTRY(riscv_cfft_q15, 0)
+    DIFF_ENTRY(riscv_rfft_fast_f32, 0)
+    DIFF_ENTRY(riscv_rfft_fast_q31, 0)
+    DIFF_ENTRY(riscv_rfft_fast_q15, 0)
+    DIFF_ENTRY(riscv_cfft_mixed_f32, 0)
+    DIFF_ENTRY(riscv_cfft_mixed_q31, 0)
+    DIFF_ENTRY(riscv_cfft_mixed_q15, 0)
+    DIFF_ENTRY(riscv_rfft_mixed_f32, 0)
+    DIFF_ENTRY(riscv_rfft_mixed_q31, 0)
+    DIFF_ENTRY(riscv_rfft_mixed_q15, 0)
+    DIFF_ENTRY(riscv_cfft_batch_f32, 0)
+    DIFF_ENTRY(riscv_cfft_batch_q31, 0)
+    DIFF_ENTRY(riscv_cfft_batch_q15, 0)
+};
+
+static uint32_t diff_add_length(uint32_t *lengths, uint32_t count, uint32_t n, uint32_t max_len)
+{
+    if ((n > max_len) || (count >= DIFF_MAX_LENGTHS)) {
+        return count;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (lengths[i] == n) {
+            return count;
+        }
+    }
+    lengths[count] = n;
+    return count + 1;
+}
+
+/*
+ * Lengths of the calls: 0..3, the VLMAX - 1, VLMAX and VLMAX + 1 of SEW 8, 16, 32 and 64 with
+ * LMUL 1, 2, 4 and 8 (the tails of the strip mining loops), 4 * VLEN, and nrand random lengths
+ */
+static uint32_t diff_lengths(uint32_t *lengths, uint32_t vlen, uint32_t nrand)
+{
+    uint32_t count = 0;
+    uint32_t max_len = 4 * vlen;
+
+    for (uint32_t n = 0; n < 4; n++) {
+        count = diff_add_length(lengths, count, n, max_len);
+    }
+    for (uint32_t sew = 8; sew <= 64; sew *= 2) {
+        for (uint32_t lmul = 1; lmul <= 8; lmul *= 2) {
+            uint32_t vlmax = vlen / sew * lmul;
+            count = diff_add_length(lengths, count, vlmax - 1, max_len);
+            count = diff_add_length(lengths, count, vlmax, max_len);
+            count = diff_add_length(lengths, count, vlmax + 1, max_len);
+        }
+    }
+    count = diff_add_length(lengths, count, max_len, max_len);
+    for (uint32_t i = 0; i < nrand; i++) {
+        count = diff_add_length(lengths, count, diff_rand() % (max_len + 1), max_len);
+    }
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t lengths[DIFF_MAX_LENGTHS];
+    uint32_t seed, vlen, nrand, count, calls = 0;
+    const char *filter = NULL;
+
+    if (argc < 5) {
+        printf("Usage: %s <output file> <seed> <vlen> <random lengths> [kernel filter]\n", argv[0]);
+        return 1;
+    }
+    seed = (uint32_t)strtoul(argv[2], NULL, 0);
+    vlen = (uint32_t)strtoul(argv[3], NULL, 0);
+    nrand = (uint32_t)strtoul(argv[4], NULL, 0);
+    filter = (argc > 5) ? argv[5] : NULL;
+    if ((vlen < 64) || (vlen > DIFF_MAX_VLEN) || (vlen & (vlen - 1))) {
+        printf("VLEN %lu must be a power of two in [64, %d]\n", (unsigned long)vlen, DIFF_MAX_VLEN);
+        return 1;
+    }
+    diff_out = fopen(argv[1], "wb");
+    if (diff_out == NULL) {
+        printf("Can't open %s\n", argv[1]);
+        return 1;
+    }
+    for (uint32_t k = 0; k < sizeof(diff_kernels) / sizeof(diff_kernels[0]); k++) {
+        const diff_kernel_t *kernel = &diff_kernels[k];
+        if (filter && (strstr(kernel->name, filter) == NULL)) {
+            continue;
+        }
+        diff_seed(seed, kernel->name);
+        count = diff_lengths(lengths, vlen, nrand);
+        for (uint32_t i = 0; i < count; i++) {
+            if (lengths[i] < kernel->min_n) {
+                continue;
+            }
+            /* Alternate aligned and misaligned buffers */
+            diff_off = i & 1U;
+            kernel->run(lengths[i]);
+            calls++;
+        }
+    }
+    fclose(diff_out);
+    printf("RVVDIFF, %lu calls\n", (unsigned long)calls);
+    return 0;
+}
@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import math
+import struct
+import argparse
+import subprocess
+
+try:
+    from prettytable import PrettyTable
+except Exception as exc:
+    print("Import Error: %s" % (exc))
+    print("Please install requried packages using: pip3 install prettytable")
+    sys.exit(1)
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Record header written by diff_emit in rvv_diff.c
+RECORD_HEADER = struct.Struct("<48sIII4s")
+# struct format and size of the element types of the records
+TYPE_FORMATS = {
+    "f64": ("d", 8), "f32": ("f", 4), "q63": ("q", 8), "q31": ("i", 4), "q15": ("h", 2), "q7": ("b", 1),
+    "u32": ("I", 4), "u16": ("H", 2), "u8": ("B", 1),
+}
+
+# Maximum difference of the vector and scalar outputs, the DELTA* of DSP/Test/common.h for
+# the q types, and atol + rtol * |scalar| for f32 where atol is multiplied by the length
+# for the reductions, since the vector code sums in another order
+TYPE_TOLERANCES = {
+    "f64": (1e-12, 1e-10), "f32": (1e-6, 1e-5), "q63": 1, "q31": 2, "q15": 1, "q7": 1, "u32": 0, "u16": 0, "u8": 0,
+}
+# Kernels with a larger tolerance, q63 accumulations of the dot products are allowed 1 per element
+KERNEL_TOLERANCES = {
+    "riscv_dot_prod_q31": "n", "riscv_dot_prod_q15": "n", "riscv_power_q31": "n", "riscv_power_q15": "n",
+    "riscv_cmplx_dot_prod_q31": "n", "riscv_cmplx_dot_prod_q15": "n",
+    "riscv_rms_q31": 64, "riscv_std_q31": 64, "riscv_var_q31": 64, "riscv_cmplx_mag_q31": 64,
+    "riscv_rms_q15": 5, "riscv_std_q15": 5, "riscv_var_q15": 5, "riscv_cmplx_mag_q15": 5,
+    # The fixed point legacy FFTs must be bit-exact, the f32 ones sum bins up to sqrt(4096) * |input|
+    "riscv_cfft_radix2_q31": 0, "riscv_cfft_radix2_q15": 0, "riscv_cfft_radix4_q31": 0, "riscv_cfft_radix4_q15": 0,
+    "riscv_cfft_radix2_f32": (1e-4, 1e-5), "riscv_cfft_radix4_f32": (1e-4, 1e-5),
+    # The vector FFTs round each stage in another order, about 1 per stage and 2 per radix 3 or 5 stage
+    "riscv_cfft_q31": 16, "riscv_cfft_q15": 16, "riscv_rfft_fast_q31": 16, "riscv_rfft_fast_q15": 16,
+    "riscv_cfft_mixed_q31": 16, "riscv_cfft_mixed_q15": 16, "riscv_rfft_mixed_q31": 16, "riscv_rfft_mixed_q15": 16,
+    "riscv_cfft_batch_q31": 8, "riscv_cfft_batch_q15": 8,
+    "riscv_cfft_f32": (1e-4, 1e-5), "riscv_rfft_fast_f32": (1e-4, 1e-5), "riscv_cfft_mixed_f32": (1e-4, 1e-5),
+    "riscv_rfft_mixed_f32": (1e-4, 1e-5), "riscv_cfft_batch_f32": (1e-4, 1e-5),
+}
+
+# Byte written by rvv_diff.c into the guard elements after each output, DIFF_SENTINEL
+DIFF_SENTINEL = 0xA5
+
+REPORT_FIELDS = ["VLEN", "Kernel", "Failed Calls", "First N", "Index", "Scalar", "Vector", "Reason"]
+
+def parse_records(outfile):
+    """ Return the list of (name, n, type, values, guard bytes) of an output file of rvv_diff """
+    records = []
+    with open(outfile, 'rb') as of:
+        data = of.read()
+    pos = 0
+    while pos + RECORD_HEADER.size <= len(data):
+        name, n, count, guard, tag = RECORD_HEADER.unpack_from(data, pos)
+        pos += RECORD_HEADER.size
+        name = name.split(b'\0')[0].decode()
+        tag = tag.split(b'\0')[0].decode()
+        fmt, size = TYPE_FORMATS[tag]
+        nbytes = count * size
+        if pos + nbytes > len(data):
+            break
+        values = struct.unpack_from("<%d%s" % (count - guard, fmt), data, pos)
+        guardbytes = data[pos + nbytes - guard * size:pos + nbytes]
+        records.append((name, n, tag, values, guardbytes))
+        pos += nbytes
+    return records
+
+def tolerance(name, tag, n, count):
+    tol = KERNEL_TOLERANCES.get(name, TYPE_TOLERANCES[tag])
+    if tol == "n":
+        tol = max(1, n)
+    if tag in ("f32", "f64") and count <= 2:
+        atol, rtol = tol
+        tol = (atol * max(1, n), rtol)
+    return tol
+
+def first_mismatch(name, tag, n, svalues, vvalues):
+    """ Return (index, scalar, vector) of the first element out of tolerance, or None """
+    tol = tolerance(name, tag, n, len(svalues))
+    for idx, (sval, vval) in enumerate(zip(svalues, vvalues)):
+        if tag in ("f32", "f64"):
+            if math.isnan(sval) and math.isnan(vval):
+                continue
+            atol, rtol = tol
+            if math.isinf(sval) or math.isinf(vval):
+                if sval != vval:
+                    return idx, sval, vval
+                continue
+            if abs(sval - vval) > atol + rtol * abs(sval) or math.isnan(sval) != math.isnan(vval):
+                return idx, sval, vval
+        elif abs(sval - vval) > tol:
+            return idx, sval, vval
+    return None
+
+def compare_records(scalar, vector):
+    """ Return {kernel: [failed calls, n, index, scalar, vector, reason]} of the differences of two runs """
+    failures = dict()
+    def fail(name, n, idx, sval, vval, reason):
+        item = failures.setdefault(name, [0, n, idx, sval, vval, reason])
+        item[0] += 1
+    if len(scalar) != len(vector):
+        print("Scalar run has %d records, vector run has %d records" % (len(scalar), len(vector)))
+    for srec, vrec in zip(scalar, vector):
+        sname, sn, stag, svalues, sguard = srec
+        vname, vn, vtag, vvalues, vguard = vrec
+        if (sname, sn) != (vname, vn):
+            fail(vname, vn, "-", sname, vname, "record order differs")
+            break
+        if len(svalues) != len(vvalues):
+            fail(sname, sn, "-", len(svalues), len(vvalues), "output length differs")
+            continue
+        mismatch = first_mismatch(sname, stag, sn, svalues, vvalues)
+        # Both builds can write after the output in the same way, so the guards are checked on their own
+        sentinel = bytes([DIFF_SENTINEL]) * len(sguard)
+        if mismatch:
+            fail(sname, sn, mismatch[0], mismatch[1], mismatch[2], "out of tolerance")
+        elif vguard != sentinel:
+            fail(sname, sn, len(svalues), "guard", "overwritten", "vector write after the output")
+        elif sguard != sentinel:
+            fail(sname, sn, len(svalues), "overwritten", "guard", "scalar write after the output")
+    if len(vector) < len(scalar):
+        name, n = scalar[len(vector)][0], scalar[len(vector)][1]
+        fail(name, n, "-", "-", "-", "vector run stopped, crash or hang")
+    return failures
+
+def build_driver(arch, abi, builddir, cmake_args):
+    """ Configure and build rvv_diff for arch, return the executable or None """
+    cmd = ["cmake", "-S", SCRIPT_DIR, "-B", builddir, "-DRISCV_ARCH=%s" % (arch), "-DRISCV_ABI=%s" % (abi)] + cmake_args
+    print("Build rvv_diff for %s in %s" % (arch, builddir))
+    if subprocess.run(cmd, stdout=subprocess.DEVNULL).returncode != 0:
+        return None
+    if subprocess.run(["cmake", "--build", builddir, "-j%d" % (os.cpu_count() or 1)], stdout=subprocess.DEVNULL).returncode != 0:
+        return None
+    return os.path.join(builddir, "rvv_diff")
+
+def run_driver(qemu, cpu, exe, outfile, seed, vlen, nrand, kernels, timeout):
+    """ Return the records of a run and None, or the records written before a failure and its reason """
+    cmd = [qemu, "-cpu", cpu, exe, outfile, str(seed), str(vlen), str(nrand)]
+    if kernels:
+        cmd.append(kernels)
+    # The output of a previous run would be compared if this one fails before opening it
+    if os.path.isfile(outfile):
+        os.remove(outfile)
+    print("Run %s" % (" ".join(cmd)))
+    reason = None
+    try:
+        ret = subprocess.run(cmd, timeout=timeout, capture_output=True, text=True)
+        if ret.returncode != 0:
+            reason = "exit with %d" % (ret.returncode)
+            print("%s %s: %s" % (exe, reason, ret.stdout.strip()))
+    except FileNotFoundError:
+        reason = "%s not found" % (qemu)
+        print(reason)
+    except subprocess.TimeoutExpired:
+        reason = "timeout after %d seconds" % (timeout)
+        print("%s %s" % (exe, reason))
+    return (parse_records(outfile) if os.path.isfile(outfile) else []), reason
+
+def write_report(report, rows, title):
+    lines = ["# %s" % (title), ""]
+    lines.append("| %s |" % (" | ".join(REPORT_FIELDS)))
+    lines.append("|%s" % ("---|" * len(REPORT_FIELDS)))
+    for row in rows:
+        lines.append("| %s |" % (" | ".join(str(c) for c in row)))
+    with open(report, 'w') as rf:
+        rf.write("\n".join(lines) + "\n")
+    print("Differential test report saved into %s" % (report))
+    pass
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei DSP RVV vs Scalar Differential Test Tool")
+    parser.add_argument('--arch', default="rv64gcv", help="Arch of the vector build")
+    parser.add_argument('--scalar_arch', default="rv64gc", help="Arch of the scalar build")
+    parser.add_argument('--abi', default="lp64d", help="ABI of both builds")
+    parser.add_argument('--vlens', nargs='+', type=int, default=[128, 256, 512, 1024], help="VLEN of the qemu vector cpu")
+    parser.add_argument('--seed', type=int, default=1, help="Seed of the random inputs and lengths")
+    parser.add_argument('--lengths', type=int, default=16, help="Random lengths in [0, 4 * VLEN] of each kernel, added to the VLMAX tails")
+    parser.add_argument('--kernels', help="Only run the kernels whose name contains this string, such as dot_prod")
+    parser.add_argument('--qemu', help="qemu user mode, default is qemu-riscv64 or qemu-riscv32 according to --arch")
+    parser.add_argument('--qemu_cpu', default="{xlen},v=true,vlen={vlen},elen=64,vext_spec=v1.0",
+                        help="qemu cpu of the vector runs, {xlen} and {vlen} are replaced, use {xlen},zve32f=true,vlen={vlen} for Zve32f")
+    parser.add_argument('--qemu_scalar_cpu', default="{xlen}", help="qemu cpu of the scalar runs")
+    parser.add_argument('--build', default="build_rvv_diff", help="Build directory, the two builds are done in subdirectories")
+    parser.add_argument('--skip_build', action='store_true', help="If specified, use the executables of a previous build")
+    parser.add_argument('--cmake_args', nargs='*', default=[], help="Extra cmake arguments of both builds, such as -DLOOPUNROLL=OFF")
+    parser.add_argument('--timeout', type=int, default=600, help="Timeout in seconds of each run")
+    parser.add_argument('--report', help="Save the failures into a markdown report")
+
+    args = parser.parse_args()
+
+    xlen = "rv32" if args.arch.startswith("rv32") else "rv64"
+    qemu = args.qemu if args.qemu else "qemu-riscv%s" % (xlen[2:])
+    builds = dict()
+    for name, arch in (("vector", args.arch), ("scalar", args.scalar_arch)):
+        builddir = os.path.join(args.build, arch)
+        exe = os.path.join(builddir, "rvv_diff") if args.skip_build else build_driver(arch, args.abi, builddir, args.cmake_args)
+        if exe is None or os.path.isfile(exe) == False:
+            print("rvv_diff build for %s not found" % (arch))
+            sys.exit(1)
+        builds[name] = (exe, builddir)
+
+    rows = []
+    total = 0
+    for vlen in args.vlens:
+        vexe, vdir = builds["vector"]
+        sexe, sdir = builds["scalar"]
+        scalar, sreason = run_driver(qemu, args.qemu_scalar_cpu.format(xlen=xlen, vlen=vlen), sexe,
+                                     os.path.join(sdir, "out_vlen%d.bin" % (vlen)), args.seed, vlen, args.lengths, args.kernels, args.timeout)
+        if sreason or len(scalar) == 0:
+            print("Scalar run with VLEN %d failed: %s" % (vlen, sreason if sreason else "no output"))
+            sys.exit(1)
+        vector, vreason = run_driver(qemu, args.qemu_cpu.format(xlen=xlen, vlen=vlen), vexe,
+                                     os.path.join(vdir, "out_vlen%d.bin" % (vlen)), args.seed, vlen, args.lengths, args.kernels, args.timeout)
+        total += len(scalar)
+        failures = compare_records(scalar, vector)
+        for kernel in sorted(failures):
+            rows.append([vlen, kernel] + failures[kernel])
+        if vreason:
+            # Also reported when all the records were written, such as a crash at exit
+            rows.append([vlen, "rvv_diff", 1, "-", "-", "-", "-", "vector run %s" % (vreason)])
+
+    title = "RVV differential test of %s against %s, seed %d, %d calls" % (args.arch, args.scalar_arch, args.seed, total)
+    print(title)
+    if len(rows) == 0:
+        print("All vector outputs match the scalar outputs")
+    else:
+        tb = PrettyTable()
+        tb.field_names = REPORT_FIELDS
+        for row in rows:
+            tb.add_row(row)
+        print(tb)
+    if args.report:
+        write_report(args.report, rows, title)
+    sys.exit(0 if len(rows) == 0 else 1)
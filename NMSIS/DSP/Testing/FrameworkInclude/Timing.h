@@ -10,6 +10,49 @@
 #include "riscv_math_types.h"
 #include "riscv_math_types_f16.h"
 
+#if defined(__riscv) && !defined(__GNUC_PYTHON__) && !defined(NOTIMING)
+#define RISCVTIMING
+#endif
+
+#if defined(RISCVTIMING)
+#include "nmsis_bench.h"
+
+/*
+
+Events which can be given to HPM_EVENTS, for example:
+make TIMING=1 HPM_EVENTS=HPM_DCACHE_MISS,HPM_EXU_STALL
+
+*/
+#define HPM_ICACHE_MISS  HPM_EVENT(EVENT_SEL_MEMORY_ACCESS, EVENT_MEMORY_ACCESS_ICACHE_MISS, MSU_EVENT_ENABLE)
+#define HPM_DCACHE_MISS  HPM_EVENT(EVENT_SEL_MEMORY_ACCESS, EVENT_MEMORY_ACCESS_DCACHE_MISS, MSU_EVENT_ENABLE)
+#define HPM_IFU_STALL    HPM_EVENT(EVENT_SEL_MEMORY_ACCESS, EVENT_MEMORY_ACCESS_IFU_STALL_CYCLE, MSU_EVENT_ENABLE)
+#define HPM_EXU_STALL    HPM_EVENT(EVENT_SEL_MEMORY_ACCESS, EVENT_MEMORY_ACCESS_EXU_STALL_CYCLE, MSU_EVENT_ENABLE)
+#define HPM_BRANCH_MISS  HPM_EVENT(EVENT_SEL_INSTRUCTION_COMMIT, EVENT_INSTRUCTION_COMMIT_CONDITIONAL_BRANCH_PREDICTION_FAIL, MSU_EVENT_ENABLE)
+
+/* Up to 4 events counted by mhpmcounter3 to mhpmcounter6, the count goes up to 8 to reject more */
+#define HPM_MAX_EVENTS 4
+#define HPM_NB_ARGS(...) HPM_NB_ARGS_(__VA_ARGS__,8,7,6,5,4,3,2,1)
+#define HPM_NB_ARGS_(e0,e1,e2,e3,e4,e5,e6,e7,n,...) n
+
+#if defined(RISCV_HPM_EVENTS)
+#if !defined(__HPM_PRESENT) || (__HPM_PRESENT != 1)
+#error "HPM_EVENTS needs a core with a hardware performance monitor"
+#endif
+#define RISCV_HPM_NB_EVENTS HPM_NB_ARGS(RISCV_HPM_EVENTS)
+#if RISCV_HPM_NB_EVENTS > HPM_MAX_EVENTS
+#error "HPM_EVENTS takes at most 4 events"
+#endif
+#else
+#define RISCV_HPM_NB_EVENTS 0
+#endif
+
+/* The instructions retired, then one value per HPM event */
+#define NB_EXTRA_COUNTERS (1 + RISCV_HPM_NB_EVENTS)
+
+/* Counters measured by the last getCycles() */
+extern Testing::cycles_t extraCounters[NB_EXTRA_COUNTERS];
+#endif
+
 void initCycleMeasurement();
 void cycleMeasurementStart();
 void cycleMeasurementStop();
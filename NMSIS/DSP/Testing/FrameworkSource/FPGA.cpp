@@ -35,6 +35,7 @@
 #include <string>
 #include <cstddef>
 #include "FPGA.h"
+#include "Timing.h"
 #include <cstdio>
 
 #include "Generators.h"
@@ -270,6 +271,14 @@ namespace Client
         {
 #ifdef EXTBENCH
             printf("S: %ld 0 0 t Y\n",this->currentId);
+#elif defined(RISCVTIMING)
+            /* The counters named by the "S: c" line of initCycleMeasurement */
+            printf("S: %ld 0 0 %" PRIu32 " Y",this->currentId, cycles);
+            for(int i=0;i < NB_EXTRA_COUNTERS;i++)
+            {
+                printf(" %" PRIu32,extraCounters[i]);
+            }
+            printf("\n");
 #else
             printf("S: %ld 0 0 %" PRIu32 " Y\n",this->currentId, cycles);
 #endif
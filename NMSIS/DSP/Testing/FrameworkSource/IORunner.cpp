@@ -50,6 +50,11 @@
 
 using namespace std;
 
+#if defined(RISCVTIMING)
+/* Overhead of the measurement for the counters other than the cycles */
+static Testing::cycles_t extraCalibration[NB_EXTRA_COUNTERS];
+#endif
+
 namespace Client
 {
 
@@ -168,6 +173,12 @@ fast models.
              current = getCycles();
           #endif
           calibration += current;
+          #if defined(RISCVTIMING)
+             for(int j=0;j < NB_EXTRA_COUNTERS;j++)
+             {
+               extraCalibration[j] += extraCounters[j];
+             }
+          #endif
           cycleMeasurementStop();
         }
 #if defined(EXTBENCH)  || defined(CACHEANALYSIS)
@@ -176,6 +187,12 @@ fast models.
 
 #ifndef EXTBENCH
         calibration=calibration / CALIBNB;
+#endif
+#if defined(RISCVTIMING)
+        for(int j=0;j < NB_EXTRA_COUNTERS;j++)
+        {
+          extraCalibration[j] = extraCalibration[j] / CALIBNB;
+        }
 #endif
       }
 
@@ -312,7 +329,14 @@ fast models.
 
 #ifndef EXTBENCH
                 cycles=getCycles();
-                cycles=cycles-calibration;
+                /* The counters are unsigned, a run faster than the calibration gives 0 */
+                cycles=(cycles > calibration) ? cycles-calibration : 0;
+#endif
+#if defined(RISCVTIMING)
+                for(int j=0;j < NB_EXTRA_COUNTERS;j++)
+                {
+                  extraCounters[j] = (extraCounters[j] > extraCalibration[j]) ? extraCounters[j] - extraCalibration[j] : 0;
+                }
 #endif
                 cycleMeasurementStop();
               }
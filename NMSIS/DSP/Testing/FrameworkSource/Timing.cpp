@@ -30,6 +30,26 @@ unsigned int startCycles;
 unsigned long sectionCounter=0;
 #endif
 
+#if defined(RISCVTIMING)
+#include <cstdio>
+
+static rv_counter_t startCycles;
+static unsigned long startCounters[NB_EXTRA_COUNTERS];
+Testing::cycles_t extraCounters[NB_EXTRA_COUNTERS];
+
+#if RISCV_HPM_NB_EVENTS > 0
+static const unsigned long hpmEvents[] = {RISCV_HPM_EVENTS};
+/* More than 8 events are not counted by HPM_NB_ARGS */
+static_assert(sizeof(hpmEvents) / sizeof(hpmEvents[0]) == RISCV_HPM_NB_EVENTS, "HPM_EVENTS takes at most 4 events");
+#endif
+
+/* minstret, then mhpmcounter3 and following ones */
+static inline unsigned long readExtraCounter(int i)
+{
+    return (i == 0) ? __read_instret_csr() : __read_hpm_counter(2 + i);
+}
+#endif
+
 void initCycleMeasurement()
 {
 #if !defined(NOTIMING)
@@ -75,6 +95,30 @@ void initCycleMeasurement()
       enable_timing();
 #endif
 #endif
+
+#if defined(RISCVTIMING)
+    __enable_mcycle_counter();
+    __enable_minstret_counter();
+#if RISCV_HPM_NB_EVENTS > 0
+    for(int i=0;i < RISCV_HPM_NB_EVENTS;i++)
+    {
+        __set_hpm_event(3 + i, hpmEvents[i]);
+        __set_hpm_counter(3 + i, 0);
+    }
+    __enable_mhpm_counters(((1UL << RISCV_HPM_NB_EVENTS) - 1) << 3);
+#endif
+    /* Names of the counters printed after the status of each test */
+#if defined(RISCV_HPM_EVENT_NAMES)
+    printf("S: c INSTRET,%s\n", RISCV_HPM_EVENT_NAMES);
+#else
+    printf("S: c INSTRET");
+    for(int i=0;i < RISCV_HPM_NB_EVENTS;i++)
+    {
+        printf(",HPM%d", 3 + i);
+    }
+    printf("\n");
+#endif
+#endif
 #endif
 }
 
@@ -106,6 +150,14 @@ void cycleMeasurementStart()
     startCycles = readCCNT();
     #endif
 #endif
+
+#if defined(RISCVTIMING)
+    for(int i=0;i < NB_EXTRA_COUNTERS;i++)
+    {
+        startCounters[i] = readExtraCounter(i);
+    }
+    startCycles = __get_rv_cycle();
+#endif
 #endif
 #endif
 }
@@ -164,6 +216,15 @@ return(0);
     return((Testing::cycles_t)(value - startCycles));
     #endif
 #endif
+
+#if defined(RISCVTIMING)
+    rv_counter_t value = __get_rv_cycle();
+    for(int i=0;i < NB_EXTRA_COUNTERS;i++)
+    {
+        extraCounters[i] = (Testing::cycles_t)(readExtraCounter(i) - startCounters[i]);
+    }
+    return((Testing::cycles_t)(value - startCycles));
+#endif
 #endif
 
 }
@@ -80,6 +80,8 @@ def joinit(iterable, delimiter):
 
 # Return test result as a text tree
 class TextFormatter:
+      counterNames = []
+
       def start(self):
           None
 
@@ -95,7 +97,7 @@ class TextFormatter:
            #print(elem.path)
            print(Style.BRIGHT + ("%s%s : %s (%d)" % (ident,kind,message,theId)) + Style.RESET_ALL)
 
-      def printTest(self,elem, theId, theError,errorDetail,theLine,passed,cycles,params):
+      def printTest(self,elem, theId, theError,errorDetail,theLine,passed,cycles,params,counters=None):
           message=elem.data["message"]
           func=elem.data["class"]
           if not elem.data["deprecated"]:
@@ -110,7 +112,8 @@ class TextFormatter:
                # because a coverage error applies to the full test suite
                # and not just to a test.
                if cycles > 0:
-                  print("%s%s %s(%s - %d)%s : %s (cycles = %d)" % (ident,message,Style.BRIGHT,func,theId,Style.RESET_ALL,p,cycles))
+                  extra = "".join(", %s = %d" % (n,v) for (n,v) in zip(self.counterNames,counters or []))
+                  print("%s%s %s(%s - %d)%s : %s (cycles = %d%s)" % (ident,message,Style.BRIGHT,func,theId,Style.RESET_ALL,p,cycles,extra))
                else:
                   print("%s%s %s(%s - %d)%s : %s" % (ident,message,Style.BRIGHT,func,theId,Style.RESET_ALL,p))
              if params:
@@ -170,7 +173,7 @@ class HTMLFormatter:
               print("</tr>")
            self.nb = self.nb + 1
 
-      def printTest(self,elem, theId, theError,errorDetail,theLine,passed,cycles,params):
+      def printTest(self,elem, theId, theError,errorDetail,theLine,passed,cycles,params,counters=None):
           message=elem.data["message"]
           if not elem.data["deprecated"]:
              kind = "Test"
@@ -214,12 +217,14 @@ class HTMLFormatter:
 # Return test result as a CSV
 class CSVFormatter:
 
+      counterNames = []
+
       def __init__(self):
         self.name=[]
         self._start=True
 
       def start(self):
-          print("CATEGORY,NAME,ID,STATUS,CYCLES,PARAMS")
+          print("CATEGORY,NAME,ID,STATUS,CYCLES,%sPARAMS" % "".join("%s," % n for n in self.counterNames))
 
       def printGroup(self,elem,theId):
         if elem is None:
@@ -236,13 +241,15 @@ class CSVFormatter:
            if elem.kind == TestScripts.Parser.TreeElem.GROUP:
               kind = "Group"
 
-      def printTest(self,elem, theId, theError, errorDetail,theLine,passed,cycles,params):
+      def printTest(self,elem, theId, theError, errorDetail,theLine,passed,cycles,params,counters=None):
           message=elem.data["message"]
           if not elem.data["deprecated"]:
              kind = "Test"
              name=elem.data["class"]
              category= "".join(list(joinit(self.name,":")))
-             print("%s,%s,%d,%d,%d,\"%s\"" % (category,name,theId,passed,cycles,params))
+             counters = counters or []
+             values = [counters[i] if i < len(counters) else 0 for i in range(len(self.counterNames))]
+             print("%s,%s,%d,%d,%d,%s\"%s\"" % (category,name,theId,passed,cycles,"".join("%d," % v for v in values),params))
 
       def pop(self):
          if self.name:
@@ -283,7 +290,7 @@ class MathematicaFormatter:
            #else:
            #   self._toPop.append("")
 
-      def printTest(self,elem, theId, theError,errorDetail,theLine,passed,cycles,params):
+      def printTest(self,elem, theId, theError,errorDetail,theLine,passed,cycles,params,counters=None):
           message=elem.data["message"]
           if not elem.data["deprecated"]:
              kind = "Test"
@@ -351,7 +358,7 @@ def extractDataFiles(results,outputDir):
 
 
 
-def writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config):
+def writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config,counters=None,counterNames=None):
   if benchFile:
     testname=elem.data["class"]
     #category= elem.categoryDesc()
@@ -361,7 +368,11 @@ def writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config):
     if "testData" in elem.data:
       if "oldID" in elem.data["testData"]:
          old=elem.data["testData"]["oldID"]
-    benchFile.write("\"%s\",\"%s\",\"%s\",%d,\"%s\",%s,%d,%s\n" % (category,testname,name,theId,old,params,cycles,config))
+    counters = counters or []
+    counterNames = counterNames or []
+    values = [counters[i] if i < len(counters) else 0 for i in range(len(counterNames))]
+    extra = "".join(",%d" % v for v in values)
+    benchFile.write("\"%s\",\"%s\",\"%s\",%d,\"%s\",%s,%d%s,%s\n" % (category,testname,name,theId,old,params,cycles,extra,config))
 
 def getCyclesFromTrace(trace):
   if not trace:
@@ -369,6 +380,15 @@ def getCyclesFromTrace(trace):
   else:
     return(TestScripts.ParseTrace.getCycles(trace))
 
+# Names of the counters displayed after the cycles
+# (RISC-V timing, line c INSTRET,HPM_DCACHE_MISS,...)
+def getCounterNames(results,prefix):
+    for l in results:
+        m = re.match(r'^%sc[ ]+([A-Za-z0-9_,]+)$' % prefix,l.strip())
+        if m:
+           return([n.strip() for n in m.group(1).split(",")])
+    return([])
+
 def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
     global resultStatus
     calibration = 0
@@ -376,10 +396,16 @@ def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
       # First cycle in the trace is the calibration data
       # The normalisation factor must be coherent with the C code one.
       calibration = int(getCyclesFromTrace(trace) / 20)
+    prefix=""
+    if embedded:
+       prefix = ".*[S]+:[ ]"
+    results = list(results)
+    counterNames = getCounterNames(results,prefix)
+    counters = []
+    formatter.counterNames = counterNames
     formatter.start()
     path = []
     state = NORMAL
-    prefix=""
     elem=None
     theId=None
     theError=None
@@ -389,8 +415,6 @@ def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
     cycles=None
     benchFile = None
     config=""
-    if embedded:
-       prefix = ".*[S]+:[ ]"
 
     # Parse the result file.
     # NORMAL mode is when we are parsing suite or group.
@@ -450,7 +474,8 @@ def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
                           #print(configList)
                           config = "".join(list(joinit(configList[0],",")))
                           configHeaders = "".join(list(joinit(csvheaders,",")))
-                       benchFile.write("CATEGORY,TESTNAME,NAME,ID,OLDID,%s,CYCLES,%s\n" % (header,configHeaders))
+                       extraHeaders = "".join(",%s" % n for n in counterNames)
+                       benchFile.write("CATEGORY,TESTNAME,NAME,ID,OLDID,%s,CYCLES%s,%s\n" % (header,extraHeaders,configHeaders))
 
                     formatter.printGroup(elem,theId)
 
@@ -472,7 +497,8 @@ def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
                # In test mode, we are looking for test status.
                # A line starting with S
                # (There may be empty lines or line for data files)
-               passRe = r'^%s([0-9]+)[ ]+([0-9]+)[ ]+([0-9]+)[ ]+([t0-9]+)[ ]+([YN]).*$'  % prefix
+               # The status may be followed by the values of the counters
+               passRe = r'^%s([0-9]+)[ ]+([0-9]+)[ ]+([0-9]+)[ ]+([t0-9]+)[ ]+([YN])([ 0-9]*).*$'  % prefix
                if re.match(passRe,l):
                     # If we have found a test status then we will start again
                     # in normal mode after this.
@@ -498,6 +524,8 @@ def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
                     status=m.group(5)
                     passed=0
 
+                    counters = [int(x) for x in m.group(6).split()]
+
                     # Convert status to number as used by formatter.
                     if status=="Y":
                        passed = 1
@@ -541,14 +569,14 @@ def analyseResult(resultPath,root,results,embedded,benchmark,trace,formatter):
                    # Format the node
                    #print(elem.fullPath())
                    #createMissingDir(destPath)
-                   writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config)
+                   writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config,counters,counterNames)
                 else:
                    params=""
-                   writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config)
+                   writeBenchmark(elem,benchFile,theId,theError,passed,cycles,params,config,counters,counterNames)
                    # Format the node
                 if not passed:
                    resultStatus=1
-                formatter.printTest(elem,theId,theError,errorDetail,theLine,passed,cycles,params)
+                formatter.printTest(elem,theId,theError,errorDetail,theLine,passed,cycles,params,counters)
 
 
     formatter.end()
@@ -46,10 +46,14 @@ int main()
     conv_1_x_n_1_riscv_convolve_s8();
     kernel1x1_riscv_convolve_1x1_s4();
     kernel1x1_riscv_convolve_1x1_s8();
+    kernel1x1_riscv_convolve_1x1_sparse_s8();
     kernel1x1_riscv_convolve_1x1_s4_fast();
     kernel1x1_riscv_convolve_1x1_s8_fast();
     basic_riscv_convolve_s4();
     basic_riscv_convolve_s8();
+    basic_riscv_convolve_pool_s8();
+    basic_avg_riscv_convolve_pool_s8();
+    depthwise_kernel_3x3_riscv_convolve_direct_s8();
     int16xint8_riscv_convolve_s16();
     transpose_conv_1_riscv_transpose_conv_s8();
 
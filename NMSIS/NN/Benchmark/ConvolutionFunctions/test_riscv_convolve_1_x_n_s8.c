@@ -75,6 +75,7 @@ void conv_1_x_n_1_riscv_convolve_s8(void)
 
     int32_t buf_size = riscv_convolve_1_x_n_s8_get_buffer_size(&conv_params, &input_dims, &filter_dims, &output_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = 0;
     BENCH_START(riscv_convolve_1_x_n_s8);
     riscv_nmsis_nn_status result = riscv_convolve_1_x_n_s8(&ctx,
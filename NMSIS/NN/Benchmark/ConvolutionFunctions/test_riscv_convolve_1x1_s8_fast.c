@@ -77,6 +77,7 @@ void kernel1x1_riscv_convolve_1x1_s8_fast(void)
 
     const int32_t buf_size = riscv_convolve_1x1_s8_fast_get_buffer_size(&input_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = 0;
 
     BENCH_START(riscv_convolve_1x1_s8_fast);
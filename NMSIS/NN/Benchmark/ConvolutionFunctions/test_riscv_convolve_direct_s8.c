@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdlib.h>
+
+#include <riscv_nnfunctions.h>
+
+#include "TestData/depthwise_kernel_3x3/test_data.h"
+#include "Utils/validate.h"
+#include <nmsis_bench.h>
+
+BENCH_DECLARE_VAR()
+
+/* The depthwise_kernel_3x3 data set is reused as a regular conv with 4 input and 4 output channels */
+void depthwise_kernel_3x3_riscv_convolve_direct_s8(void)
+{
+    const riscv_nmsis_nn_status expected = RISCV_NMSIS_NN_SUCCESS;
+    int8_t output[DEPTHWISE_KERNEL_3X3_DST_SIZE] = {0};
+    int8_t output_ref[DEPTHWISE_KERNEL_3X3_DST_SIZE] = {0};
+
+    nmsis_nn_context ctx;
+    nmsis_nn_conv_params conv_params;
+    nmsis_nn_per_channel_quant_params quant_params;
+    nmsis_nn_dims input_dims;
+    nmsis_nn_dims filter_dims;
+    nmsis_nn_dims bias_dims;
+    nmsis_nn_dims output_dims;
+
+    const int32_t *bias_data = depthwise_kernel_3x3_biases;
+    const int8_t *kernel_data = depthwise_kernel_3x3_weights;
+    const int8_t *input_data = depthwise_kernel_3x3_input;
+    const int32_t output_ref_size = DEPTHWISE_KERNEL_3X3_DST_SIZE;
+
+    input_dims.n = DEPTHWISE_KERNEL_3X3_INPUT_BATCHES;
+    input_dims.w = DEPTHWISE_KERNEL_3X3_INPUT_W;
+    input_dims.h = DEPTHWISE_KERNEL_3X3_INPUT_H;
+    input_dims.c = DEPTHWISE_KERNEL_3X3_IN_CH;
+    filter_dims.n = DEPTHWISE_KERNEL_3X3_OUT_CH;
+    filter_dims.w = DEPTHWISE_KERNEL_3X3_FILTER_X;
+    filter_dims.h = DEPTHWISE_KERNEL_3X3_FILTER_Y;
+    filter_dims.c = DEPTHWISE_KERNEL_3X3_IN_CH;
+    output_dims.w = DEPTHWISE_KERNEL_3X3_OUTPUT_W;
+    output_dims.h = DEPTHWISE_KERNEL_3X3_OUTPUT_H;
+    output_dims.c = DEPTHWISE_KERNEL_3X3_OUT_CH;
+
+    conv_params.padding.w = DEPTHWISE_KERNEL_3X3_PAD_X;
+    conv_params.padding.h = DEPTHWISE_KERNEL_3X3_PAD_Y;
+    conv_params.stride.w = DEPTHWISE_KERNEL_3X3_STRIDE_X;
+    conv_params.stride.h = DEPTHWISE_KERNEL_3X3_STRIDE_Y;
+    conv_params.dilation.w = DEPTHWISE_KERNEL_3X3_DILATION_X;
+    conv_params.dilation.h = DEPTHWISE_KERNEL_3X3_DILATION_Y;
+
+    conv_params.input_offset = DEPTHWISE_KERNEL_3X3_INPUT_OFFSET;
+    conv_params.output_offset = DEPTHWISE_KERNEL_3X3_OUTPUT_OFFSET;
+    conv_params.activation.min = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_kernel_3x3_output_mult;
+    quant_params.shift = (int32_t *)depthwise_kernel_3x3_output_shift;
+
+    generate_rand_s8(depthwise_kernel_3x3_input, DEPTHWISE_KERNEL_3X3_INPUT_SIZE);
+    generate_rand_s8(depthwise_kernel_3x3_weights, DEPTHWISE_KERNEL_3X3_KERNEL_SIZE);
+
+    /* riscv_convolve_direct_s8 works in place on the input, no scratch buffer is needed */
+    ctx.buf = NULL;
+    ctx.size = 0;
+    BENCH_START(riscv_convolve_direct_s8);
+    riscv_nmsis_nn_status result = riscv_convolve_direct_s8(&ctx,
+                                                        &conv_params,
+                                                        &quant_params,
+                                                        &input_dims,
+                                                        input_data,
+                                                        &filter_dims,
+                                                        kernel_data,
+                                                        &bias_dims,
+                                                        bias_data,
+                                                        &output_dims,
+                                                        output);
+    BENCH_END(riscv_convolve_direct_s8);
+    TEST_ASSERT_EQUAL(expected, result);
+
+    int32_t buf_size = riscv_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = 0;
+
+    BENCH_START(riscv_convolve_s8);
+    result = riscv_convolve_s8(&ctx,
+                             &conv_params,
+                             &quant_params,
+                             &input_dims,
+                             input_data,
+                             &filter_dims,
+                             kernel_data,
+                             &bias_dims,
+                             bias_data,
+                             NULL,
+                             &output_dims,
+                             output_ref);
+    BENCH_END(riscv_convolve_s8);
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+}
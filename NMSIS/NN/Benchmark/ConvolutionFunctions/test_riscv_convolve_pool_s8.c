@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include <riscv_nnfunctions.h>
+
+
+#include "TestData/basic/test_data.h"
+#include "Utils/validate.h"
+#include "nmsis_bench.h"
+
+BENCH_DECLARE_VAR();
+
+#define BASIC_POOL_OUTPUT_W (BASIC_OUTPUT_W / 2)
+#define BASIC_POOL_OUTPUT_H (BASIC_OUTPUT_H / 2)
+#define BASIC_POOL_DST_SIZE (BASIC_INPUT_BATCHES * BASIC_POOL_OUTPUT_H * BASIC_POOL_OUTPUT_W * BASIC_OUT_CH)
+
+static void convolve_pool_s8(const riscv_nn_pool_type pool_type)
+{
+    const riscv_nmsis_nn_status expected = RISCV_NMSIS_NN_SUCCESS;
+    int8_t conv_output[BASIC_DST_SIZE] = {0};
+    int8_t output_ref[BASIC_POOL_DST_SIZE] = {0};
+    int8_t output[BASIC_POOL_DST_SIZE] = {0};
+
+    nmsis_nn_context ctx;
+    nmsis_nn_conv_params conv_params;
+    nmsis_nn_pool_params pool_params;
+    nmsis_nn_per_channel_quant_params quant_params;
+    nmsis_nn_dims input_dims;
+    nmsis_nn_dims filter_dims;
+    nmsis_nn_dims bias_dims;
+    nmsis_nn_dims conv_output_dims;
+    nmsis_nn_dims pool_filter_dims;
+    nmsis_nn_dims output_dims;
+
+    const int32_t *bias_data = basic_biases;
+    const int8_t *kernel_data = basic_weights;
+    const int8_t *input_data = basic_input;
+
+    input_dims.n = BASIC_INPUT_BATCHES;
+    input_dims.w = BASIC_INPUT_W;
+    input_dims.h = BASIC_INPUT_H;
+    input_dims.c = BASIC_IN_CH;
+    filter_dims.w = BASIC_FILTER_X;
+    filter_dims.h = BASIC_FILTER_Y;
+    filter_dims.c = BASIC_IN_CH;
+    conv_output_dims.n = BASIC_INPUT_BATCHES;
+    conv_output_dims.w = BASIC_OUTPUT_W;
+    conv_output_dims.h = BASIC_OUTPUT_H;
+    conv_output_dims.c = BASIC_OUT_CH;
+    output_dims.n = BASIC_INPUT_BATCHES;
+    output_dims.w = BASIC_POOL_OUTPUT_W;
+    output_dims.h = BASIC_POOL_OUTPUT_H;
+    output_dims.c = BASIC_OUT_CH;
+    pool_filter_dims.w = 2;
+    pool_filter_dims.h = 2;
+
+    conv_params.padding.w = BASIC_PAD_X;
+    conv_params.padding.h = BASIC_PAD_Y;
+    conv_params.stride.w = BASIC_STRIDE_X;
+    conv_params.stride.h = BASIC_STRIDE_Y;
+    conv_params.dilation.w = BASIC_DILATION_X;
+    conv_params.dilation.h = BASIC_DILATION_Y;
+
+    conv_params.input_offset = BASIC_INPUT_OFFSET;
+    conv_params.output_offset = BASIC_OUTPUT_OFFSET;
+    conv_params.activation.min = BASIC_OUT_ACTIVATION_MIN;
+    conv_params.activation.max = BASIC_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)basic_output_mult;
+    quant_params.shift = (int32_t *)basic_output_shift;
+
+    pool_params.padding.w = 0;
+    pool_params.padding.h = 0;
+    pool_params.stride.w = 2;
+    pool_params.stride.h = 2;
+    pool_params.activation.min = BASIC_OUT_ACTIVATION_MIN;
+    pool_params.activation.max = BASIC_OUT_ACTIVATION_MAX;
+
+    generate_rand_s8(basic_input, BASIC_INPUT_SIZE);
+    generate_rand_s8(basic_weights, BASIC_KERNEL_SIZE);
+
+    /* Reference: full resolution convolution followed by max or average pooling */
+    int32_t buf_size = riscv_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
+    const int32_t pool_buf_size = riscv_avgpool_s8_get_buffer_size(output_dims.w, output_dims.c);
+    buf_size = buf_size > pool_buf_size ? buf_size : pool_buf_size;
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = buf_size;
+
+    if (pool_type == RISCV_NN_POOL_MAX)
+    {
+        BENCH_START(riscv_convolve_s8_max_pool_s8);
+        riscv_convolve_s8(&ctx,
+                        &conv_params,
+                        &quant_params,
+                        &input_dims,
+                        input_data,
+                        &filter_dims,
+                        kernel_data,
+                        &bias_dims,
+                        bias_data,
+                        NULL,
+                        &conv_output_dims,
+                        conv_output);
+        riscv_max_pool_s8(&ctx, &pool_params, &conv_output_dims, conv_output, &pool_filter_dims, &output_dims, output_ref);
+        BENCH_END(riscv_convolve_s8_max_pool_s8);
+    }
+    else
+    {
+        BENCH_START(riscv_convolve_s8_avgpool_s8);
+        riscv_convolve_s8(&ctx,
+                        &conv_params,
+                        &quant_params,
+                        &input_dims,
+                        input_data,
+                        &filter_dims,
+                        kernel_data,
+                        &bias_dims,
+                        bias_data,
+                        NULL,
+                        &conv_output_dims,
+                        conv_output);
+        riscv_avgpool_s8(&ctx, &pool_params, &conv_output_dims, conv_output, &pool_filter_dims, &output_dims, output_ref);
+        BENCH_END(riscv_convolve_s8_avgpool_s8);
+    }
+
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+
+    buf_size = riscv_convolve_pool_s8_get_buffer_size(&input_dims, &filter_dims, &output_dims);
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = buf_size;
+
+    riscv_nmsis_nn_status result;
+    /* Distinct names, so the two pooling types are not merged by the result tools */
+    if (pool_type == RISCV_NN_POOL_MAX)
+    {
+        BENCH_START(riscv_convolve_pool_s8);
+        result = riscv_convolve_pool_s8(&ctx,
+                                        &conv_params,
+                                        &quant_params,
+                                        pool_type,
+                                        &input_dims,
+                                        input_data,
+                                        &filter_dims,
+                                        kernel_data,
+                                        &bias_dims,
+                                        bias_data,
+                                        &output_dims,
+                                        output);
+        BENCH_END(riscv_convolve_pool_s8);
+    }
+    else
+    {
+        BENCH_START(riscv_convolve_pool_s8_avg);
+        result = riscv_convolve_pool_s8(&ctx,
+                                        &conv_params,
+                                        &quant_params,
+                                        pool_type,
+                                        &input_dims,
+                                        input_data,
+                                        &filter_dims,
+                                        kernel_data,
+                                        &bias_dims,
+                                        bias_data,
+                                        &output_dims,
+                                        output);
+        BENCH_END(riscv_convolve_pool_s8_avg);
+    }
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, BASIC_POOL_DST_SIZE));
+}
+
+void basic_riscv_convolve_pool_s8(void) { convolve_pool_s8(RISCV_NN_POOL_MAX); }
+
+void basic_avg_riscv_convolve_pool_s8(void) { convolve_pool_s8(RISCV_NN_POOL_AVG); }
@@ -75,6 +75,7 @@ void int16xint8_riscv_convolve_s16(void)
 
     int buf_size = riscv_convolve_s16_get_buffer_size(&input_dims, &filter_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
 
     BENCH_START(riscv_convolve_s16);
     riscv_nmsis_nn_status result = riscv_convolve_s16(&ctx,
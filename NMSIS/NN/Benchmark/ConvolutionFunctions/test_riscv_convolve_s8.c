@@ -76,6 +76,7 @@ void basic_riscv_convolve_s8(void)
 
     int32_t buf_size = riscv_convolve_s8_get_buffer_size(&input_dims, &filter_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = 0;
 
     BENCH_START(riscv_convolve_s8);
@@ -59,6 +59,7 @@ void transpose_conv_1_riscv_transpose_conv_s8(void)
 
     output_ctx.size = output_dims.w * output_dims.h * output_dims.c * sizeof(int32_t);
     output_ctx.buf = malloc(output_ctx.size);
+    BENCH_SCRATCH(output_ctx.buf, output_ctx.size);
 
     transpose_conv_params.padding.w = TRANSPOSE_CONV_1_PAD_X;
     transpose_conv_params.padding.h = TRANSPOSE_CONV_1_PAD_Y;
@@ -82,6 +83,7 @@ void transpose_conv_1_riscv_transpose_conv_s8(void)
 
     const int32_t buf_size = riscv_transpose_conv_s8_get_buffer_size(&transpose_conv_params, &input_dims, &filter_dims, &output_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = buf_size;
 
     BENCH_START(riscv_transpose_conv_s8);
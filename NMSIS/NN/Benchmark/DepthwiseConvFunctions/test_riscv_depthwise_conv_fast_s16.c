@@ -76,6 +76,7 @@ void dw_int16xint8_fast_riscv_depthwise_conv_fast_s16(void)
 
     int buf_size = riscv_depthwise_conv_fast_s16_get_buffer_size(&input_dims, &filter_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
 
     BENCH_START(riscv_depthwise_conv_fast_s16);
     riscv_nmsis_nn_status result = riscv_depthwise_conv_fast_s16(&ctx,
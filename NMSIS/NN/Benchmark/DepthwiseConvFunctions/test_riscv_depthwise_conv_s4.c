@@ -76,6 +76,7 @@ void depthwise_int4_generic_riscv_depthwise_conv_s4(void)
     TEST_ASSERT_TRUE(ctx.size > 0);
 
     ctx.buf = malloc(ctx.size);
+    BENCH_SCRATCH(ctx.buf, ctx.size);
 
     BENCH_START(riscv_depthwise_conv_s4);
     riscv_nmsis_nn_status result = riscv_depthwise_conv_s4(&ctx,
@@ -78,6 +78,7 @@ void depthwise_int4_1_riscv_depthwise_conv_s4_opt(void)
     TEST_ASSERT_TRUE(ctx.size > 0);
 
     ctx.buf = malloc(ctx.size);
+    BENCH_SCRATCH(ctx.buf, ctx.size);
 
     BENCH_START(riscv_depthwise_conv_s4_opt);
     riscv_nmsis_nn_status result = riscv_depthwise_conv_s4_opt(&ctx,
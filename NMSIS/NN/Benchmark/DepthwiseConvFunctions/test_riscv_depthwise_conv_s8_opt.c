@@ -82,6 +82,7 @@ void basic_riscv_depthwise_conv_s8_opt(void)
 #endif
 
     ctx.buf = malloc(ctx.size);
+    BENCH_SCRATCH(ctx.buf, ctx.size);
 
     BENCH_START(riscv_depthwise_conv_s8_opt);
     riscv_nmsis_nn_status result = riscv_depthwise_conv_s8_opt(&ctx,
@@ -45,6 +45,8 @@ int main()
 
     fully_connected_int4_riscv_fully_connected_s4();
     fully_connected_riscv_fully_connected_s8();
+    fully_connected_riscv_fully_connected_sparse_s8();
+    sparse_fc_riscv_fully_connected_sparse_s8();
     fully_connected_int16_riscv_fully_connected_s16();
 
     printf("All tests are passed.\n");
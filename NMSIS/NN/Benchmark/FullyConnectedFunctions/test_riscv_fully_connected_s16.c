@@ -69,6 +69,7 @@ void fully_connected_int16_riscv_fully_connected_s16(void)
 
     int32_t buf_size = riscv_fully_connected_s16_get_buffer_size(&filter_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = buf_size;
 
     BENCH_START(riscv_fully_connected_s16);
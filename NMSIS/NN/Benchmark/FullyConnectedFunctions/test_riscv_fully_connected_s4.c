@@ -67,6 +67,7 @@ void fully_connected_int4_riscv_fully_connected_s4(void)
 
     int32_t buf_size = 0;
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = buf_size;
 
     BENCH_START(riscv_fully_connected_s4);
@@ -68,6 +68,7 @@ void fully_connected_riscv_fully_connected_s8(void)
 
     const int32_t buf_size = riscv_fully_connected_s8_get_buffer_size(&filter_dims);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = buf_size;
 
     BENCH_START(riscv_fully_connected_s8);
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <riscv_nnfunctions.h>
+#include <stdlib.h>
+
+#include "TestData/fully_connected/test_data.h"
+#include "Utils/utils.h"
+#include "Utils/validate.h"
+#include "nmsis_bench.h"
+
+BENCH_DECLARE_VAR();
+
+void fully_connected_riscv_fully_connected_sparse_s8(void)
+{
+    const riscv_nmsis_nn_status expected = RISCV_NMSIS_NN_SUCCESS;
+    int8_t output[FULLY_CONNECTED_DST_SIZE] = {0};
+    int8_t output_ref[FULLY_CONNECTED_DST_SIZE] = {0};
+    int8_t sparse_values[FULLY_CONNECTED_OUT_CH * RISCV_NN_SPARSE_VALUES_SIZE(FULLY_CONNECTED_ACCUMULATION_DEPTH)];
+    uint8_t sparse_index[FULLY_CONNECTED_OUT_CH * RISCV_NN_SPARSE_INDEX_SIZE(FULLY_CONNECTED_ACCUMULATION_DEPTH)];
+
+    nmsis_nn_context ctx;
+    nmsis_nn_fc_params fc_params;
+    nmsis_nn_per_tensor_quant_params quant_params;
+    nmsis_nn_dims input_dims;
+    nmsis_nn_dims filter_dims;
+    nmsis_nn_dims bias_dims;
+    nmsis_nn_dims output_dims;
+
+    const int32_t *bias_data = fully_connected_biases;
+    const int8_t *kernel_data = fully_connected_weights;
+    const int8_t *input_data = fully_connected_input;
+    const int32_t output_ref_size = FULLY_CONNECTED_DST_SIZE;
+
+    input_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+    input_dims.w = FULLY_CONNECTED_INPUT_W;
+    input_dims.h = FULLY_CONNECTED_INPUT_H;
+    input_dims.c = FULLY_CONNECTED_IN_CH;
+    filter_dims.n = FULLY_CONNECTED_ACCUMULATION_DEPTH;
+    filter_dims.c = FULLY_CONNECTED_OUT_CH;
+    output_dims.n = FULLY_CONNECTED_INPUT_BATCHES;
+    output_dims.c = FULLY_CONNECTED_OUT_CH;
+
+    fc_params.input_offset = FULLY_CONNECTED_INPUT_OFFSET;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = FULLY_CONNECTED_OUTPUT_OFFSET;
+    fc_params.activation.min = FULLY_CONNECTED_OUT_ACTIVATION_MIN;
+    fc_params.activation.max = FULLY_CONNECTED_OUT_ACTIVATION_MAX;
+
+    quant_params.multiplier = FULLY_CONNECTED_OUTPUT_MULTIPLIER;
+    quant_params.shift = FULLY_CONNECTED_OUTPUT_SHIFT;
+
+    generate_rand_s8(fully_connected_input, FULLY_CONNECTED_INPUT_SIZE);
+    generate_rand_s8(fully_connected_weights, FULLY_CONNECTED_KERNEL_SIZE);
+    /* The dense weights are pruned in place, so both functions compute the same result */
+    prune_and_pack_2_4_s8(fully_connected_weights,
+                          FULLY_CONNECTED_OUT_CH,
+                          FULLY_CONNECTED_ACCUMULATION_DEPTH,
+                          sparse_values,
+                          sparse_index);
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    BENCH_START(riscv_fully_connected_sparse_s8);
+    riscv_nmsis_nn_status result = riscv_fully_connected_sparse_s8(&ctx,
+                                                               &fc_params,
+                                                               &quant_params,
+                                                               &input_dims,
+                                                               input_data,
+                                                               &filter_dims,
+                                                               sparse_values,
+                                                               sparse_index,
+                                                               &bias_dims,
+                                                               bias_data,
+                                                               &output_dims,
+                                                               output);
+    BENCH_END(riscv_fully_connected_sparse_s8);
+    TEST_ASSERT_EQUAL(expected, result);
+
+    const int32_t buf_size = riscv_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = buf_size;
+
+    BENCH_START(riscv_fully_connected_sparse_s8_dense);
+    result = riscv_fully_connected_s8(&ctx,
+                                    &fc_params,
+                                    &quant_params,
+                                    &input_dims,
+                                    input_data,
+                                    &filter_dims,
+                                    kernel_data,
+                                    &bias_dims,
+                                    bias_data,
+                                    &output_dims,
+                                    output_ref);
+    BENCH_END(riscv_fully_connected_sparse_s8_dense);
+
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, output_ref_size));
+
+    /* The accumulation depth must be whole 2:4 groups and the output depth must match the packed rows */
+    filter_dims.n = FULLY_CONNECTED_ACCUMULATION_DEPTH - 2;
+    result = riscv_fully_connected_sparse_s8(&ctx, &fc_params, &quant_params, &input_dims, input_data, &filter_dims,
+                                           sparse_values, sparse_index, &bias_dims, bias_data, &output_dims, output);
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, result);
+    filter_dims.n = FULLY_CONNECTED_ACCUMULATION_DEPTH;
+    output_dims.c = FULLY_CONNECTED_OUT_CH - 1;
+    result = riscv_fully_connected_sparse_s8(&ctx, &fc_params, &quant_params, &input_dims, input_data, &filter_dims,
+                                           sparse_values, sparse_index, &bias_dims, bias_data, &output_dims, output);
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, result);
+}
+
+/* Sparse against dense on a layer deep enough for the skipped multiply-accumulates to show */
+#define SPARSE_FC_ACCUMULATION_DEPTH (256)
+#define SPARSE_FC_OUT_CH             (64)
+
+static int8_t sparse_fc_input[SPARSE_FC_ACCUMULATION_DEPTH];
+static int8_t sparse_fc_weights[SPARSE_FC_OUT_CH * SPARSE_FC_ACCUMULATION_DEPTH];
+static int8_t sparse_fc_values[SPARSE_FC_OUT_CH * RISCV_NN_SPARSE_VALUES_SIZE(SPARSE_FC_ACCUMULATION_DEPTH)];
+static uint8_t sparse_fc_index[SPARSE_FC_OUT_CH * RISCV_NN_SPARSE_INDEX_SIZE(SPARSE_FC_ACCUMULATION_DEPTH)];
+static int32_t sparse_fc_biases[SPARSE_FC_OUT_CH];
+
+void sparse_fc_riscv_fully_connected_sparse_s8(void)
+{
+    const riscv_nmsis_nn_status expected = RISCV_NMSIS_NN_SUCCESS;
+    int8_t output[SPARSE_FC_OUT_CH] = {0};
+    int8_t output_ref[SPARSE_FC_OUT_CH] = {0};
+
+    nmsis_nn_context ctx;
+    nmsis_nn_fc_params fc_params;
+    nmsis_nn_per_tensor_quant_params quant_params;
+    nmsis_nn_dims input_dims = {1, 1, 1, SPARSE_FC_ACCUMULATION_DEPTH};
+    nmsis_nn_dims filter_dims = {SPARSE_FC_ACCUMULATION_DEPTH, 1, 1, SPARSE_FC_OUT_CH};
+    nmsis_nn_dims bias_dims = {1, 1, 1, SPARSE_FC_OUT_CH};
+    nmsis_nn_dims output_dims = {1, 1, 1, SPARSE_FC_OUT_CH};
+
+    fc_params.input_offset = 128;
+    fc_params.filter_offset = 0;
+    fc_params.output_offset = -3;
+    fc_params.activation.min = -128;
+    fc_params.activation.max = 127;
+    quant_params.multiplier = 1283412608;
+    quant_params.shift = -9;
+
+    generate_rand_s8(sparse_fc_input, SPARSE_FC_ACCUMULATION_DEPTH);
+    generate_rand_s8(sparse_fc_weights, SPARSE_FC_OUT_CH * SPARSE_FC_ACCUMULATION_DEPTH);
+    for (int32_t i = 0; i < SPARSE_FC_OUT_CH; i++)
+    {
+        sparse_fc_biases[i] = (rand() % 4096) - 2048;
+    }
+    prune_and_pack_2_4_s8(sparse_fc_weights,
+                          SPARSE_FC_OUT_CH,
+                          SPARSE_FC_ACCUMULATION_DEPTH,
+                          sparse_fc_values,
+                          sparse_fc_index);
+
+    ctx.buf = NULL;
+    ctx.size = 0;
+
+    BENCH_START(riscv_fully_connected_sparse_s8_256x64);
+    riscv_nmsis_nn_status result = riscv_fully_connected_sparse_s8(&ctx,
+                                                               &fc_params,
+                                                               &quant_params,
+                                                               &input_dims,
+                                                               sparse_fc_input,
+                                                               &filter_dims,
+                                                               sparse_fc_values,
+                                                               sparse_fc_index,
+                                                               &bias_dims,
+                                                               sparse_fc_biases,
+                                                               &output_dims,
+                                                               output);
+    BENCH_END(riscv_fully_connected_sparse_s8_256x64);
+    TEST_ASSERT_EQUAL(expected, result);
+
+    const int32_t buf_size = riscv_fully_connected_s8_get_buffer_size(&filter_dims);
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = buf_size;
+
+    BENCH_START(riscv_fully_connected_sparse_s8_256x64_dense);
+    result = riscv_fully_connected_s8(&ctx,
+                                    &fc_params,
+                                    &quant_params,
+                                    &input_dims,
+                                    sparse_fc_input,
+                                    &filter_dims,
+                                    sparse_fc_weights,
+                                    &bias_dims,
+                                    sparse_fc_biases,
+                                    &output_dims,
+                                    output_ref);
+    BENCH_END(riscv_fully_connected_sparse_s8_256x64_dense);
+
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, SPARSE_FC_OUT_CH));
+}
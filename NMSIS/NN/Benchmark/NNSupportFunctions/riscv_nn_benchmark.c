@@ -45,6 +45,8 @@ int main()
 
     matMult_riscv_nn_mat_mult_nt_t_s8();
     vecMatMult_riscv_nn_vec_mat_mult_t_s8();
+    depthwise_kernel_3x3_riscv_nn_band_chain_s8();
+    arena_riscv_nn_arena();
 
     printf("All tests are passed.\n");
     printf("Finish NNSupportFunctions benchmark\n");
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdint.h>
+
+#include <riscv_nnfunctions.h>
+
+#include "Utils/validate.h"
+#include "nmsis_bench.h"
+
+BENCH_DECLARE_VAR();
+
+#define ARENA_TEST_SIZE (256)
+#define ARENA_IS_ALIGNED(ptr) ((((uintptr_t)(ptr)) & (RISCV_NN_ARENA_ALIGNMENT - 1)) == 0)
+
+static int8_t arena_test_buf[ARENA_TEST_SIZE + RISCV_NN_ARENA_ALIGNMENT];
+
+void arena_riscv_nn_arena(void)
+{
+    nmsis_nn_arena arena;
+    nmsis_nn_context ctx;
+
+    /* Invalid arguments */
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, riscv_nn_arena_init(NULL, arena_test_buf, ARENA_TEST_SIZE));
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, riscv_nn_arena_init(&arena, NULL, ARENA_TEST_SIZE));
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, riscv_nn_arena_init(&arena, arena_test_buf, 0));
+    TEST_ASSERT_TRUE(riscv_nn_arena_alloc(NULL, 1) == NULL);
+    TEST_ASSERT_TRUE(riscv_nn_arena_push(NULL, 1) == NULL);
+    riscv_nn_arena_reset(NULL);
+    TEST_ASSERT_EQUAL(0, riscv_nn_arena_get_mark(NULL));
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, riscv_nn_arena_pop(NULL, 0));
+    TEST_ASSERT_EQUAL(0, riscv_nn_arena_get_free_size(NULL));
+    TEST_ASSERT_EQUAL(0, riscv_nn_arena_get_peak_size(NULL));
+
+    /* An unaligned start is skipped and the usable size is a multiple of the alignment */
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_SUCCESS, riscv_nn_arena_init(&arena, arena_test_buf + 1, ARENA_TEST_SIZE));
+    TEST_ASSERT_TRUE(ARENA_IS_ALIGNED(arena.base));
+    TEST_ASSERT_TRUE((arena.size & (RISCV_NN_ARENA_ALIGNMENT - 1)) == 0);
+    TEST_ASSERT_TRUE(arena.size <= ARENA_TEST_SIZE && arena.size > ARENA_TEST_SIZE - 2 * RISCV_NN_ARENA_ALIGNMENT);
+    TEST_ASSERT_EQUAL(arena.size, riscv_nn_arena_get_free_size(&arena));
+
+    /* Linear allocations are aligned, rounded up and do not overlap */
+    int8_t *a = riscv_nn_arena_alloc(&arena, 1);
+    int8_t *b = riscv_nn_arena_alloc(&arena, RISCV_NN_ARENA_ALIGNMENT + 1);
+    int8_t *c = riscv_nn_arena_alloc(&arena, 0);
+    TEST_ASSERT_TRUE(a != NULL && b != NULL && c != NULL);
+    TEST_ASSERT_TRUE(ARENA_IS_ALIGNED(a) && ARENA_IS_ALIGNED(b) && ARENA_IS_ALIGNED(c));
+    TEST_ASSERT_TRUE(b == a + RISCV_NN_ARENA_ALIGNMENT);
+    TEST_ASSERT_TRUE(c == b + 2 * RISCV_NN_ARENA_ALIGNMENT);
+    TEST_ASSERT_TRUE(riscv_nn_arena_alloc(&arena, -1) == NULL);
+
+    /* Scratch buffers are pushed from the end and released in LIFO order */
+    const int32_t mark = riscv_nn_arena_get_mark(&arena);
+    int8_t *s1 = riscv_nn_arena_push(&arena, 3);
+    int8_t *s2 = riscv_nn_arena_push(&arena, RISCV_NN_ARENA_ALIGNMENT);
+    TEST_ASSERT_TRUE(s1 != NULL && s2 != NULL && ARENA_IS_ALIGNED(s1) && ARENA_IS_ALIGNED(s2));
+    TEST_ASSERT_TRUE(s1 == arena.base + arena.size - RISCV_NN_ARENA_ALIGNMENT);
+    TEST_ASSERT_TRUE(s2 == s1 - RISCV_NN_ARENA_ALIGNMENT);
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, riscv_nn_arena_pop(&arena, arena.size + 1));
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_SUCCESS, riscv_nn_arena_pop(&arena, mark));
+    TEST_ASSERT_EQUAL(mark, riscv_nn_arena_get_mark(&arena));
+
+    /* Exhaustion, including the sizes whose rounding would overflow */
+    const int32_t free_size = riscv_nn_arena_get_free_size(&arena);
+    TEST_ASSERT_TRUE(riscv_nn_arena_alloc(&arena, free_size + 1) == NULL);
+    TEST_ASSERT_TRUE(riscv_nn_arena_push(&arena, free_size + 1) == NULL);
+    TEST_ASSERT_TRUE(riscv_nn_arena_alloc(&arena, INT32_MAX) == NULL);
+    TEST_ASSERT_TRUE(riscv_nn_arena_push(&arena, INT32_MAX) == NULL);
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_ARG_ERROR, riscv_nn_arena_get_context(&arena, free_size + 1, &ctx));
+    TEST_ASSERT_TRUE(ctx.buf == NULL && ctx.size == 0);
+    TEST_ASSERT_EQUAL(free_size, riscv_nn_arena_get_free_size(&arena));
+    TEST_ASSERT_EQUAL(RISCV_NMSIS_NN_SUCCESS, riscv_nn_arena_get_context(&arena, free_size, &ctx));
+    TEST_ASSERT_TRUE(ctx.buf == c && ctx.size == free_size);
+    TEST_ASSERT_EQUAL(0, riscv_nn_arena_get_free_size(&arena));
+    TEST_ASSERT_TRUE(riscv_nn_arena_alloc(&arena, 1) == NULL);
+    TEST_ASSERT_EQUAL(arena.size, riscv_nn_arena_get_peak_size(&arena));
+
+    /* Reset releases everything but keeps the peak */
+    riscv_nn_arena_reset(&arena);
+    TEST_ASSERT_EQUAL(arena.size, riscv_nn_arena_get_free_size(&arena));
+    TEST_ASSERT_EQUAL(arena.size, riscv_nn_arena_get_peak_size(&arena));
+    TEST_ASSERT_TRUE(riscv_nn_arena_alloc(&arena, 1) == arena.base);
+
+    BENCH_START(riscv_nn_arena_alloc);
+    riscv_nn_arena_reset(&arena);
+    while (riscv_nn_arena_alloc(&arena, 1) != NULL)
+    {
+    }
+    BENCH_END(riscv_nn_arena_alloc);
+}
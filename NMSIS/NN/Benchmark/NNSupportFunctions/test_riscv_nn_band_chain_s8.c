@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include <riscv_nnfunctions.h>
+
+
+#include "TestData/depthwise_kernel_3x3/test_data.h"
+#include "Utils/validate.h"
+#include "nmsis_bench.h"
+
+BENCH_DECLARE_VAR();
+
+/* Chain of the depthwise_kernel_3x3 layer followed by a 3x3 average pooling with SAME padding */
+#define BAND_CHAIN_POOL_DST_SIZE (DEPTHWISE_KERNEL_3X3_DST_SIZE)
+#define BAND_CHAIN_BAND_ROWS (1)
+
+void depthwise_kernel_3x3_riscv_nn_band_chain_s8(void)
+{
+    const riscv_nmsis_nn_status expected = RISCV_NMSIS_NN_SUCCESS;
+    int8_t dw_output[DEPTHWISE_KERNEL_3X3_DST_SIZE] = {0};
+    int8_t output_ref[BAND_CHAIN_POOL_DST_SIZE] = {0};
+    int8_t output[BAND_CHAIN_POOL_DST_SIZE] = {0};
+
+    nmsis_nn_context ctx;
+    nmsis_nn_dw_conv_params dw_conv_params;
+    nmsis_nn_pool_params pool_params;
+    nmsis_nn_per_channel_quant_params quant_params;
+    nmsis_nn_band_layer layers[2] = {};
+
+    const int8_t *input_data = depthwise_kernel_3x3_input;
+
+    dw_conv_params.padding.w = DEPTHWISE_KERNEL_3X3_PAD_X;
+    dw_conv_params.padding.h = DEPTHWISE_KERNEL_3X3_PAD_Y;
+    dw_conv_params.stride.w = DEPTHWISE_KERNEL_3X3_STRIDE_X;
+    dw_conv_params.stride.h = DEPTHWISE_KERNEL_3X3_STRIDE_Y;
+    dw_conv_params.dilation.w = DEPTHWISE_KERNEL_3X3_DILATION_X;
+    dw_conv_params.dilation.h = DEPTHWISE_KERNEL_3X3_DILATION_Y;
+    dw_conv_params.ch_mult = DEPTHWISE_KERNEL_3X3_CH_MULT;
+    dw_conv_params.input_offset = DEPTHWISE_KERNEL_3X3_INPUT_OFFSET;
+    dw_conv_params.output_offset = DEPTHWISE_KERNEL_3X3_OUTPUT_OFFSET;
+    dw_conv_params.activation.min = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MIN;
+    dw_conv_params.activation.max = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MAX;
+    quant_params.multiplier = (int32_t *)depthwise_kernel_3x3_output_mult;
+    quant_params.shift = (int32_t *)depthwise_kernel_3x3_output_shift;
+
+    pool_params.padding.w = 1;
+    pool_params.padding.h = 1;
+    pool_params.stride.w = 1;
+    pool_params.stride.h = 1;
+    pool_params.activation.min = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MIN;
+    pool_params.activation.max = DEPTHWISE_KERNEL_3X3_OUT_ACTIVATION_MAX;
+
+    layers[0].type = RISCV_NN_BAND_DW_CONV;
+    layers[0].dw_conv_params = &dw_conv_params;
+    layers[0].quant_params = &quant_params;
+    layers[0].input_dims.n = DEPTHWISE_KERNEL_3X3_INPUT_BATCHES;
+    layers[0].input_dims.w = DEPTHWISE_KERNEL_3X3_INPUT_W;
+    layers[0].input_dims.h = DEPTHWISE_KERNEL_3X3_INPUT_H;
+    layers[0].input_dims.c = DEPTHWISE_KERNEL_3X3_IN_CH;
+    layers[0].filter_dims.w = DEPTHWISE_KERNEL_3X3_FILTER_X;
+    layers[0].filter_dims.h = DEPTHWISE_KERNEL_3X3_FILTER_Y;
+    layers[0].filter_data = depthwise_kernel_3x3_weights;
+    layers[0].bias_data = depthwise_kernel_3x3_biases;
+    layers[0].output_dims.n = DEPTHWISE_KERNEL_3X3_INPUT_BATCHES;
+    layers[0].output_dims.w = DEPTHWISE_KERNEL_3X3_OUTPUT_W;
+    layers[0].output_dims.h = DEPTHWISE_KERNEL_3X3_OUTPUT_H;
+    layers[0].output_dims.c = DEPTHWISE_KERNEL_3X3_OUT_CH;
+
+    layers[1].type = RISCV_NN_BAND_AVG_POOL;
+    layers[1].pool_params = &pool_params;
+    layers[1].input_dims = layers[0].output_dims;
+    layers[1].filter_dims.w = 3;
+    layers[1].filter_dims.h = 3;
+    layers[1].output_dims = layers[0].output_dims;
+
+    generate_rand_s8(depthwise_kernel_3x3_input, DEPTHWISE_KERNEL_3X3_INPUT_SIZE);
+    generate_rand_s8(depthwise_kernel_3x3_weights, DEPTHWISE_KERNEL_3X3_KERNEL_SIZE);
+
+    /* Reference: the whole tensor operators layer after layer */
+    int32_t buf_size = riscv_avgpool_s8_get_buffer_size(layers[1].output_dims.w, layers[1].input_dims.c);
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = buf_size;
+
+    BENCH_START(riscv_depthwise_conv_wrapper_s8_avgpool_s8);
+    riscv_depthwise_conv_wrapper_s8(&ctx,
+                                  &dw_conv_params,
+                                  &quant_params,
+                                  &layers[0].input_dims,
+                                  input_data,
+                                  &layers[0].filter_dims,
+                                  layers[0].filter_data,
+                                  &layers[0].bias_dims,
+                                  layers[0].bias_data,
+                                  &layers[0].output_dims,
+                                  dw_output);
+    riscv_avgpool_s8(
+        &ctx, &pool_params, &layers[1].input_dims, dw_output, &layers[1].filter_dims, &layers[1].output_dims, output_ref);
+    BENCH_END(riscv_depthwise_conv_wrapper_s8_avgpool_s8);
+
+    if (ctx.buf)
+    {
+        // The caller is responsible to clear the scratch buffers for security reasons if applicable.
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+
+    buf_size = riscv_nn_band_chain_s8_get_buffer_size(layers, 2, BAND_CHAIN_BAND_ROWS);
+    ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
+    ctx.size = buf_size;
+
+    BENCH_START(riscv_nn_band_chain_s8);
+    riscv_nmsis_nn_status result = riscv_nn_band_chain_s8(&ctx, layers, 2, BAND_CHAIN_BAND_ROWS, input_data, output);
+    BENCH_END(riscv_nn_band_chain_s8);
+
+    if (ctx.buf)
+    {
+        memset(ctx.buf, 0, buf_size);
+        free(ctx.buf);
+    }
+    TEST_ASSERT_EQUAL(expected, result);
+    TEST_ASSERT_TRUE(validate(output, output_ref, BAND_CHAIN_POOL_DST_SIZE));
+}
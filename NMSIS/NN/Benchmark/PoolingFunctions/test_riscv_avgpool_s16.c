@@ -59,6 +59,7 @@ void avgpooling_int16_riscv_avgpool_s16(void)
 
     ctx.size = riscv_avgpool_s16_get_buffer_size(AVGPOOLING_INT16_OUTPUT_W, AVGPOOLING_INT16_IN_CH);
     ctx.buf = malloc(ctx.size);
+    BENCH_SCRATCH(ctx.buf, ctx.size);
 
     BENCH_START(riscv_avgpool_s16);
     riscv_nmsis_nn_status result =
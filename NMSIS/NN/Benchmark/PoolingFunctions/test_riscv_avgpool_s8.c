@@ -59,6 +59,7 @@ void avgpooling_riscv_avgpool_s8(void)
 
     ctx.size = riscv_avgpool_s8_get_buffer_size(AVGPOOLING_OUTPUT_W, AVGPOOLING_IN_CH);
     ctx.buf = malloc(ctx.size);
+    BENCH_SCRATCH(ctx.buf, ctx.size);
 
     BENCH_START(riscv_avgpool_s8);
     riscv_nmsis_nn_status result =
@@ -72,6 +72,7 @@ void svdf_int8_riscv_svdf_s8(void)
     nmsis_nn_context ctx;
     const int32_t buf_size = weights_feature_dims.n * sizeof(int32_t);
     ctx.buf = malloc(buf_size);
+    BENCH_SCRATCH(ctx.buf, buf_size);
     ctx.size = buf_size;
 
     // + SVDF_INT8_TIME_BATCHES additional bytes to make sure it is not overwritten
@@ -79,7 +80,9 @@ void svdf_int8_riscv_svdf_s8(void)
     const int8_t initial_data = 66;
 
     input_ctx.buf = malloc(scratch_size);
+    BENCH_SCRATCH(input_ctx.buf, scratch_size);
     output_ctx.buf = malloc(scratch_size_out);
+    BENCH_SCRATCH(output_ctx.buf, scratch_size_out);
 
     int8_t *input_data = malloc(input_round_size);
     int8_t *state_data = malloc(state_data_size);
@@ -84,7 +84,9 @@ void svdf_riscv_svdf_state_s16_s8(void)
     const int scratch_size_out = SVDF_INPUT_BATCHES * number_units * sizeof(int32_t);
 
     input_ctx.buf = malloc(scratch_size);
+    BENCH_SCRATCH(input_ctx.buf, scratch_size);
     output_ctx.buf = malloc(scratch_size_out);
+    BENCH_SCRATCH(output_ctx.buf, scratch_size_out);
 
     int8_t *input_data = malloc(input_round_size);
     int16_t *state_data = malloc(sizeof(svdf_state));
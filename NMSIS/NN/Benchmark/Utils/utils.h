@@ -18,6 +18,7 @@
 
 #pragma once
 #include <stdint.h>
+#include <stdlib.h>
 
 static inline const int32_t *get_bias_address(const int32_t *bias, int32_t size)
 {
@@ -46,3 +47,65 @@ static inline const int64_t *get_bias_s64_address(const int64_t *bias, int32_t s
     }
     return return_bias;
 }
+
+/* Prune a dense [rows, cols] s8 matrix in place to 2:4 structured sparsity by keeping the two largest
+   magnitudes of every group of four columns, and pack it the way sparse_weight_pack.py does. */
+static inline void prune_and_pack_2_4_s8(int8_t *weights, int32_t rows, int32_t cols, int8_t *values, uint8_t *index)
+{
+    const int32_t num_values = (cols + 3) / 4 * 2;
+    const int32_t index_size = (num_values + 3) / 4;
+
+    for (int32_t row = 0; row < rows; row++)
+    {
+        int8_t *w = weights + row * cols;
+        int8_t *v = values + row * num_values;
+        uint8_t *idx = index + row * index_size;
+
+        for (int32_t i = 0; i < index_size; i++)
+        {
+            idx[i] = 0;
+        }
+        for (int32_t group = 0; group < num_values / 2; group++)
+        {
+            int8_t *g = w + group * 4;
+            const int32_t n = (cols - group * 4) < 4 ? (cols - group * 4) : 4;
+            int32_t pos[2] = {0, 0};
+
+            for (int32_t k = 1; k < n; k++)
+            {
+                if (abs(g[k]) > abs(g[pos[0]]))
+                {
+                    pos[0] = k;
+                }
+            }
+            pos[1] = pos[0] == 0 && n > 1 ? 1 : 0;
+            for (int32_t k = 0; k < n; k++)
+            {
+                if (k != pos[0] && abs(g[k]) > abs(g[pos[1]]))
+                {
+                    pos[1] = k;
+                }
+            }
+            if (pos[1] < pos[0])
+            {
+                const int32_t tmp = pos[0];
+                pos[0] = pos[1];
+                pos[1] = tmp;
+            }
+            for (int32_t k = 0; k < n; k++)
+            {
+                if (k != pos[0] && k != pos[1])
+                {
+                    g[k] = 0;
+                }
+            }
+            for (int32_t slot = 0; slot < 2; slot++)
+            {
+                const int32_t i = group * 2 + slot;
+                /* A last group with a single column uses it for both slots */
+                v[i] = (slot == 0 || pos[1] != pos[0]) ? g[pos[slot]] : 0;
+                idx[i >> 2] |= (uint8_t)(pos[slot] << ((i & 3) * 2));
+            }
+        }
+    }
+}
@@ -5,14 +5,20 @@ extern void activ_riscv_nn_activation_s16();
 extern void relu6_riscv_relu6_s8();
 extern void matMult_riscv_nn_mat_mult_nt_t_s8();
 extern void vecMatMult_riscv_nn_vec_mat_mult_t_s8();
+extern void depthwise_kernel_3x3_riscv_nn_band_chain_s8();
+extern void arena_riscv_nn_arena();
 extern void conv_1_x_n_1_riscv_convolve_s8();
 extern void kernel1x1_riscv_convolve_1x1_s4();
 extern void kernel1x1_riscv_convolve_1x1_s8();
+extern void kernel1x1_riscv_convolve_1x1_sparse_s8();
 extern void kernel1x1_riscv_convolve_1x1_s4_fast();
 extern void kernel1x1_riscv_convolve_1x1_s8_fast();
 extern void int16xint8_riscv_convolve_fast_s16();
 extern void basic_riscv_convolve_s4();
 extern void basic_riscv_convolve_s8();
+extern void basic_riscv_convolve_pool_s8();
+extern void basic_avg_riscv_convolve_pool_s8();
+extern void depthwise_kernel_3x3_riscv_convolve_direct_s8();
 extern void int16xint8_riscv_convolve_s16();
 extern void transpose_conv_1_riscv_transpose_conv_s8();
 
@@ -36,6 +42,8 @@ extern void maxpool_int16_riscv_max_pool_s16();
 
 extern void fully_connected_int4_riscv_fully_connected_s4();
 extern void fully_connected_riscv_fully_connected_s8();
+extern void fully_connected_riscv_fully_connected_sparse_s8();
+extern void sparse_fc_riscv_fully_connected_sparse_s8();
 extern void fully_connected_int16_riscv_fully_connected_s16();
 
 extern void lstm_1_riscv_lstm_unidirectional_s8();
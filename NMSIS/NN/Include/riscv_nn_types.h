@@ -49,6 +49,22 @@ typedef enum
     RISCV_TANH = 1,    /**< Tanh activation function */
 } riscv_nn_activation_type;
 
+/** Enum for specifying the pooling operation of fused pooling operators */
+typedef enum
+{
+    RISCV_NN_POOL_MAX = 0, /**< Max pooling */
+    RISCV_NN_POOL_AVG = 1, /**< Average pooling */
+} riscv_nn_pool_type;
+
+/** Enum for specifying the operator of a layer in a tiled (row band) execution chain */
+typedef enum
+{
+    RISCV_NN_BAND_CONV = 0,     /**< Convolution, see riscv_convolve_band_s8() */
+    RISCV_NN_BAND_DW_CONV = 1,  /**< Depthwise convolution, see riscv_depthwise_conv_band_s8() */
+    RISCV_NN_BAND_MAX_POOL = 2, /**< Max pooling, see riscv_pool_band_s8() */
+    RISCV_NN_BAND_AVG_POOL = 3, /**< Average pooling, see riscv_pool_band_s8() */
+} riscv_nn_band_layer_type;
+
 /** Function return codes */
 typedef enum
 {
@@ -72,6 +88,19 @@ typedef struct
     int32_t size; /**< Buffer size */
 } nmsis_nn_context;
 
+/** NMSIS-NN object for the tensor arena memory allocator.
+ *  Linear (persistent) allocations grow upwards from the start of the arena, scratch allocations are
+ *  pushed downwards from the end of the arena and released in LIFO order.
+ */
+typedef struct
+{
+    int8_t *base; /**< Aligned start address of the arena memory */
+    int32_t size; /**< Usable arena size in bytes */
+    int32_t head; /**< Offset of the next linear allocation */
+    int32_t tail; /**< Offset of the top of the scratch stack */
+    int32_t peak; /**< High-water mark of the used arena bytes */
+} nmsis_nn_arena;
+
 /** NMSIS-NN object used to hold bias data for int16 variants. */
 typedef struct
 {
@@ -89,6 +118,20 @@ typedef struct
     int32_t c; /**< Input channels */
 } nmsis_nn_dims;
 
+/** NMSIS-NN object for one call of an operator recorded by the profiler, see riscv_nn_profile_read() */
+typedef struct
+{
+    const char *op;       /**< Name of the operator function */
+    uint32_t seq;         /**< Sequence number of the call since riscv_nn_profile_reset() */
+    int32_t depth;        /**< Nesting depth, 0 for the operators called by the application */
+    nmsis_nn_dims input;  /**< Input tensor dimensions */
+    nmsis_nn_dims output; /**< Output tensor dimensions */
+    uint64_t start;       /**< Cycle counter at the entry of the operator */
+    uint64_t cycles;      /**< Cycles of the call including the nested operators, 0 if the call has not returned */
+    uint64_t instret;     /**< Retired instructions of the call */
+    uint64_t hpm[2];      /**< Counts of the RISCV_NN_PROFILE_HPM0 and RISCV_NN_PROFILE_HPM1 counters */
+} nmsis_nn_profile_record;
+
 /** NMSIS-NN object to contain LSTM specific input parameters related to dimensions */
 typedef struct
 {
@@ -173,6 +216,29 @@ typedef struct
     nmsis_nn_activation activation;
 } nmsis_nn_pool_params;
 
+/** NMSIS-NN object to describe a band of consecutive rows of an activation tensor */
+typedef struct
+{
+    int32_t start; /**< Index of the first row of the band in the full tensor */
+    int32_t rows;  /**< Number of rows in the band */
+} nmsis_nn_band;
+
+/** NMSIS-NN object for one layer of a tiled (row band) execution chain */
+typedef struct
+{
+    riscv_nn_band_layer_type type;
+    const nmsis_nn_conv_params *conv_params;       /**< Used by RISCV_NN_BAND_CONV */
+    const nmsis_nn_dw_conv_params *dw_conv_params; /**< Used by RISCV_NN_BAND_DW_CONV */
+    const nmsis_nn_pool_params *pool_params;       /**< Used by RISCV_NN_BAND_MAX_POOL and RISCV_NN_BAND_AVG_POOL */
+    const nmsis_nn_per_channel_quant_params *quant_params; /**< Used by the convolution layers */
+    nmsis_nn_dims input_dims;  /**< Full input tensor dimensions. Format: [1, H, W, C_IN] */
+    nmsis_nn_dims filter_dims; /**< Filter dimensions, or the pooling window [H, W] for the pooling layers */
+    const int8_t *filter_data; /**< Filter data, not used by the pooling layers */
+    nmsis_nn_dims bias_dims;   /**< Bias dimensions, not used by the pooling layers */
+    const int32_t *bias_data;  /**< Optional bias data, not used by the pooling layers */
+    nmsis_nn_dims output_dims; /**< Full output tensor dimensions. Format: [1, H, W, C_OUT] */
+} nmsis_nn_band_layer;
+
 /** NMSIS-NN object for Fully Connected layer parameters */
 typedef struct
 {
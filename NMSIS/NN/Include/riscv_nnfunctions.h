@@ -384,6 +384,117 @@ int32_t riscv_convolve_s4_get_buffer_size(const nmsis_nn_dims *input_dims, const
  */
 int32_t riscv_convolve_s8_get_buffer_size(const nmsis_nn_dims *input_dims, const nmsis_nn_dims *filter_dims);
 
+/**
+ * @brief s8 convolution without im2col for layers with few input channels
+ *
+ * @param[in, out] ctx            Function context. Not used, the function needs no additional buffer.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+ *                                spatial filter dimensions
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. Supported framework: TensorFlow Lite micro
+ *    2. Additional constraints:
+ *      - input_dims->c is at most 4 and equal to filter_dims->c, i.e. no grouped convolution
+ *    3. With so few input channels an im2col column is only a few bytes long, so widening it to s16 costs more than
+ *       the multiply-accumulates. The vector implementation instead vectorizes over the output channels: for a
+ *       tile of up to 4 output pixels it walks the kernel taps, multiplying a strided load of the weights of the
+ *       tap with the scalar input of each pixel, and stores each pixel contiguously. Taps in the padding are skipped.
+ *    4. Selected by riscv_convolve_wrapper_s8() for such layers that the 1x1 and 1xN kernels don't handle, except on
+ *       P extension only builds.
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_direct_s8(const nmsis_nn_context *ctx,
+                                           const nmsis_nn_conv_params *conv_params,
+                                           const nmsis_nn_per_channel_quant_params *quant_params,
+                                           const nmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const nmsis_nn_dims *filter_dims,
+                                           const int8_t *filter_data,
+                                           const nmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const nmsis_nn_dims *output_dims,
+                                           int8_t *output_data);
+
+/**
+ * @brief s8 convolution fused with a 2x2 max or average pooling of stride 2
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                riscv_convolve_pool_s8_get_buffer_size will return the buffer_size if required.
+ *                                The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]      conv_params    Convolution parameters (e.g. strides, dilations, pads,...).
+ *                                Range of conv_params->input_offset  : [-127, 128]
+ *                                Range of conv_params->output_offset : [-128, 127]
+ *                                conv_params->activation is applied to the convolution output, before pooling.
+ * @param[in]      quant_params   Per-channel quantization info.
+ *                                It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      pool_type      Pooling operation, RISCV_NN_POOL_MAX or RISCV_NN_POOL_AVG
+ * @param[in]      input_dims     Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data     Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK are the
+ *                                spatial filter dimensions.
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Pooled output tensor dimensions. Format: [N, H, W, C_OUT], where H and W are the
+ *                                convolution output height and width divided by two (VALID pooling).
+ * @param[out]     output_data    Pooled output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. The result is identical to riscv_convolve_s8() followed by riscv_max_pool_s8() or riscv_avgpool_s8() with a
+ *       2x2 filter, stride 2, no padding and the same activation range.
+ *    2. The convolution output is computed two rows at a time into a ring buffer taken from ctx and immediately
+ *       pooled, so the full resolution convolution output is never written to memory. This removes one
+ *       read/write pass over the activations and the largest activation buffer from the peak RAM of the layer.
+ *    3. Additional memory is required for optimization. Refer to argument 'ctx' for details.
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_pool_s8(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_conv_params *conv_params,
+                                         const nmsis_nn_per_channel_quant_params *quant_params,
+                                         const riscv_nn_pool_type pool_type,
+                                         const nmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const nmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const nmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const nmsis_nn_dims *output_dims,
+                                         int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for riscv_convolve_pool_s8
+ *
+ * @param[in]       input_dims            Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]       filter_dims           Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN] where HK and WK
+ *                                        are the spatial filter dimensions
+ * @param[in]       output_dims           Pooled output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @return          The function returns required buffer size(bytes)
+ *
+ */
+int32_t riscv_convolve_pool_s8_get_buffer_size(const nmsis_nn_dims *input_dims,
+                                             const nmsis_nn_dims *filter_dims,
+                                             const nmsis_nn_dims *output_dims);
+
 /**
  * @brief Wrapper to select optimal transposed convolution algorithm depending on parameters.
  * @param[in, out] ctx                   Function context that contains the additional buffer if required by the
@@ -759,6 +870,77 @@ riscv_nmsis_nn_status riscv_convolve_1x1_s8(const nmsis_nn_context *ctx,
                                         const nmsis_nn_dims *output_dims,
                                         int8_t *output_data);
 
+/**
+ * @brief Number of int8 values kept per row of a 2:4 structured sparse weight matrix with <code>cols</code> columns
+ *
+ * @details In a 2:4 structured sparse matrix every group of 4 consecutive columns of a row holds at most 2 non-zero
+ *          weights, <code>cols</code> is a multiple of 4. A row is stored as two arrays:
+ *            - values: the 2 kept weights of each group, in column order.
+ *            - index: the position (0-3) of each kept weight inside its group, 2 bits per value, 4 values per byte.
+ *              Value <code>i</code> uses bits [2 * (i % 4) + 1 : 2 * (i % 4)] of byte <code>i / 4</code>.
+ *
+ *          Rows are stored one after the other, each row starting on a new index byte. The weights take
+ *          <code>RISCV_NN_SPARSE_VALUES_SIZE(cols) + RISCV_NN_SPARSE_INDEX_SIZE(cols)</code> bytes per row, i.e.
+ *          5/8 of the dense size rather than 1/2: half for the values plus 1/8 for the index. Use
+ *          NN/Scripts/SparseWeights/sparse_weight_pack.py to prune and pack the weights.
+ */
+#define RISCV_NN_SPARSE_VALUES_SIZE(cols) ((((cols) + 3) >> 2) << 1)
+
+/**
+ * @brief Number of index bytes per row of a 2:4 structured sparse weight matrix with <code>cols</code> columns
+ */
+#define RISCV_NN_SPARSE_INDEX_SIZE(cols) ((RISCV_NN_SPARSE_VALUES_SIZE(cols) + 3) >> 2)
+
+/**
+ * @brief s8 version for 1x1 convolution with 2:4 structured sparse weights
+ *
+ * @param[in, out] ctx           Function context that contains the additional buffer if required by the function.
+ *                               None is required by this function.
+ * @param[in]      conv_params   Convolution parameters (e.g. strides, dilations, pads,...).
+ *                               Range of conv_params->input_offset  : [-127, 128]
+ *                               Range of conv_params->output_offset : [-128, 127]
+ * @param[in]      quant_params  Per-channel quantization info.
+ *                               It contains the multiplier and shift values to be applied to each output channel
+ * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims   Filter tensor dimensions. Format: [C_OUT, 1, 1, C_IN]
+ * @param[in]      filter_data   Kept filter values. Size: C_OUT * RISCV_NN_SPARSE_VALUES_SIZE(C_IN). Data type: int8
+ * @param[in]      filter_index  Position of the kept filter values. Size: C_OUT * RISCV_NN_SPARSE_INDEX_SIZE(C_IN).
+ *                               Data type: uint8
+ * @param[in]      bias_dims     Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data     Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims   Output tensor dimensions. Format: [N, H, W, C_OUT]
+ * @param[out]     output_data   Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ * @details
+ *   - Supported framework : TensorFlow Lite Micro
+ *   - The weights are stored in the 2:4 structured sparse format described at RISCV_NN_SPARSE_VALUES_SIZE, which
+ *     halves the number of multiply-accumulates compared to riscv_convolve_1x1_s8
+ *   - With vector extension, each kept weight is multiplied with a strided load of its input channel over a row
+ *     of output pixels, zero weights are skipped
+ *   - The following constrains on the arguments apply
+ *      -# conv_params->padding.w = conv_params->padding.h = 0
+ *      -# input_dims->c is a multiple of 4 and equals filter_dims->c
+ *      -# filter_dims->h = filter_dims->w = 1 and filter_dims->n equals output_dims->c, so the packed weights
+ *         have the size given above
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_1x1_sparse_s8(const nmsis_nn_context *ctx,
+                                               const nmsis_nn_conv_params *conv_params,
+                                               const nmsis_nn_per_channel_quant_params *quant_params,
+                                               const nmsis_nn_dims *input_dims,
+                                               const int8_t *input_data,
+                                               const nmsis_nn_dims *filter_dims,
+                                               const int8_t *filter_data,
+                                               const uint8_t *filter_index,
+                                               const nmsis_nn_dims *bias_dims,
+                                               const int32_t *bias_data,
+                                               const nmsis_nn_dims *output_dims,
+                                               int8_t *output_data);
+
 /**
  * @brief Basic Q7 convolution function
  * @param[in]       Im_in       pointer to input tensor
@@ -2141,6 +2323,59 @@ riscv_nmsis_nn_status riscv_fully_connected_per_channel_s8(const nmsis_nn_contex
                                                        const nmsis_nn_dims *output_dims,
                                                        int8_t *output_data);
 
+/**
+ * @brief s8 Fully Connected function with 2:4 structured sparse weights.
+ *
+ * @param[in, out] ctx           Function context (e.g. temporary buffer). None is required by this function.
+ * @param[in]      fc_params     Fully Connected layer parameters.
+ *                               Range of fc_params->input_offset  : [-127, 128]
+ *                               fc_params->filter_offset : 0
+ *                               Range of fc_params->output_offset : [-128, 127]
+ * @param[in]      quant_params  Per-tensor quantization info.
+ *                               It contains the multiplier and shift value to be applied to the output tensor.
+ * @param[in]      input_dims    Input (activation) tensor dimensions. Format: [N, H, W, C_IN]
+ *                               Input dimension is taken as Nx(H * W * C_IN)
+ * @param[in]      input_data    Input (activation) data pointer. Data type: int8
+ * @param[in]      filter_dims   Two dimensional filter dimensions. Format: [N, C]
+ *                               N : accumulation depth and equals (H * W * C_IN) from input_dims
+ *                               C : output depth and equals C_OUT in output_dims
+ *                               H & W : Not used
+ * @param[in]      filter_data   Kept filter values. Size: C_OUT * RISCV_NN_SPARSE_VALUES_SIZE(N). Data type: int8
+ * @param[in]      filter_index  Position of the kept filter values. Size: C_OUT * RISCV_NN_SPARSE_INDEX_SIZE(N).
+ *                               Data type: uint8
+ * @param[in]      bias_dims     Bias tensor dimensions. Format: [C_OUT]
+ *                               N, H, W : Not used
+ * @param[in]      bias_data     Bias data pointer. Data type: int32
+ * @param[in]      output_dims   Output tensor dimensions. Format: [N, C_OUT]
+ *                               N : Batches
+ *                               C_OUT : Output depth
+ *                               H & W : Not used.
+ * @param[in, out] output_data    Output data pointer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    - Supported framework: TensorFlow Lite
+ *    - The weights are stored in the 2:4 structured sparse format described at RISCV_NN_SPARSE_VALUES_SIZE.
+ *      Only the kept weights are multiplied, the matching inputs are gathered with their index.
+ *    - filter_dims->n is a multiple of 4 and filter_dims->c equals output_dims->c, so the packed weights have the
+ *      size given above.
+ */
+riscv_nmsis_nn_status riscv_fully_connected_sparse_s8(const nmsis_nn_context *ctx,
+                                                  const nmsis_nn_fc_params *fc_params,
+                                                  const nmsis_nn_per_tensor_quant_params *quant_params,
+                                                  const nmsis_nn_dims *input_dims,
+                                                  const int8_t *input_data,
+                                                  const nmsis_nn_dims *filter_dims,
+                                                  const int8_t *filter_data,
+                                                  const uint8_t *filter_index,
+                                                  const nmsis_nn_dims *bias_dims,
+                                                  const int32_t *bias_data,
+                                                  const nmsis_nn_dims *output_dims,
+                                                  int8_t *output_data);
+
 /**
  * @brief s8 Fully Connected layer wrapper function
  *
@@ -3662,6 +3897,415 @@ riscv_nmsis_nn_status riscv_maximum_s8(const nmsis_nn_context *ctx,
                                    int8_t *output_data,
                                    const nmsis_nn_dims *output_dims);
 
+/**
+ * @defgroup NNArena Tensor Arena Functions
+ *
+ * A small allocator to share one statically reserved memory region (the tensor arena) between the activation
+ * tensors and the scratch buffers (<code>nmsis_nn_context</code>) of a model.
+ *
+ * Linear allocations are taken from the start of the arena and are meant for buffers that live for the whole
+ * inference, e.g. the packed activation layout generated by <code>NN/Scripts/MemoryPlanner/arena_planner.py</code>.
+ * Scratch allocations are pushed from the end of the arena and released in LIFO order with
+ * riscv_nn_arena_pop(), so the scratch buffer of one operator can be reused by the next one.
+ *
+ * All returned pointers are aligned to <code>RISCV_NN_ARENA_ALIGNMENT</code> bytes, which is at least the size of
+ * a 128-bit vector register so that RVV unit-stride loads and stores never cross an element boundary.
+ */
+
+#ifndef RISCV_NN_ARENA_ALIGNMENT
+    #define RISCV_NN_ARENA_ALIGNMENT (16)
+#endif
+
+/** Round up <code>x</code> to the alignment of the tensor arena, <code>x</code> must be at most the largest value of its type
+ *  minus <code>RISCV_NN_ARENA_ALIGNMENT - 1</code> */
+#define RISCV_NN_ARENA_ALIGN(x) (((x) + (RISCV_NN_ARENA_ALIGNMENT - 1)) & ~(RISCV_NN_ARENA_ALIGNMENT - 1))
+
+/**
+ * @brief Initialize a tensor arena on a caller provided memory region.
+ *
+ * @param[out]  arena     Arena instance
+ * @param[in]   buf       Start of the arena memory. It does not need to be aligned, the unaligned head is skipped.
+ * @param[in]   size      Size of the arena memory in bytes
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if the memory region is too small or NULL. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ */
+riscv_nmsis_nn_status riscv_nn_arena_init(nmsis_nn_arena *arena, void *buf, int32_t size);
+
+/**
+ * @brief Release all allocations of a tensor arena. The peak usage is kept.
+ *
+ * @param[in, out]  arena     Arena instance
+ */
+void riscv_nn_arena_reset(nmsis_nn_arena *arena);
+
+/**
+ * @brief Allocate a buffer from the start of the arena. Linear allocations are only released by
+ *        riscv_nn_arena_reset().
+ *
+ * @param[in, out]  arena     Arena instance
+ * @param[in]       size      Number of bytes to allocate
+ *
+ * @return     Aligned pointer to the buffer, or NULL if the arena has not enough free memory.
+ */
+void *riscv_nn_arena_alloc(nmsis_nn_arena *arena, int32_t size);
+
+/**
+ * @brief Push a scratch buffer on the stack at the end of the arena.
+ *
+ * @param[in, out]  arena     Arena instance
+ * @param[in]       size      Number of bytes to allocate
+ *
+ * @return     Aligned pointer to the buffer, or NULL if the arena has not enough free memory.
+ */
+void *riscv_nn_arena_push(nmsis_nn_arena *arena, int32_t size);
+
+/**
+ * @brief Get the current top of the scratch stack, to be restored later with riscv_nn_arena_pop().
+ *
+ * @param[in]   arena     Arena instance
+ *
+ * @return     The scratch stack mark, 0 for a NULL arena
+ */
+int32_t riscv_nn_arena_get_mark(const nmsis_nn_arena *arena);
+
+/**
+ * @brief Release all scratch buffers pushed after <code>mark</code> was taken.
+ *
+ * @param[in, out]  arena     Arena instance
+ * @param[in]       mark      Mark returned by riscv_nn_arena_get_mark()
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if <code>arena</code> is NULL or <code>mark</code> is not a valid stack position. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ */
+riscv_nmsis_nn_status riscv_nn_arena_pop(nmsis_nn_arena *arena, int32_t mark);
+
+/**
+ * @brief Fill a function context with a scratch buffer taken from the arena.
+ *
+ * @param[in, out]  arena     Arena instance
+ * @param[in]       size      Buffer size as returned by the <code>*_get_buffer_size()</code> function of the operator.
+ *                            A size of zero results in a context with a NULL buffer.
+ * @param[out]      ctx       Function context to be passed to the operator
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if the arena has not enough free memory. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details    Typical use for one operator:
+ *             <pre>
+ *               const int32_t mark = riscv_nn_arena_get_mark(&arena);
+ *               riscv_nn_arena_get_context(&arena, riscv_convolve_wrapper_s8_get_buffer_size(...), &ctx);
+ *               riscv_convolve_wrapper_s8(&ctx, ...);
+ *               riscv_nn_arena_pop(&arena, mark);
+ *             </pre>
+ */
+riscv_nmsis_nn_status riscv_nn_arena_get_context(nmsis_nn_arena *arena, int32_t size, nmsis_nn_context *ctx);
+
+/**
+ * @brief Get the number of bytes still available between the linear allocations and the scratch stack.
+ *
+ * @param[in]   arena     Arena instance
+ *
+ * @return     Free bytes, 0 for a NULL arena
+ */
+int32_t riscv_nn_arena_get_free_size(const nmsis_nn_arena *arena);
+
+/**
+ * @brief Get the peak number of bytes used since riscv_nn_arena_init(), alignment padding included.
+ *        Use it to trim the arena reservation of a model.
+ *
+ * @param[in]   arena     Arena instance
+ *
+ * @return     Peak used bytes, 0 for a NULL arena
+ */
+int32_t riscv_nn_arena_get_peak_size(const nmsis_nn_arena *arena);
+
+/**
+ * @defgroup NNTiling Tiled Execution Functions
+ *
+ * Operators that compute a band of consecutive output rows from the band of input rows it depends on, and a helper
+ * to run a chain of such layers band by band (patch-based inference).
+ *
+ * The whole tensor operators need the full input and output activations of every layer in memory at the same time,
+ * so the first high resolution layers of a network usually set the peak RAM of the model. Running the first layers
+ * of the network band by band only keeps a few rows of every intermediate activation alive. The rows shared by
+ * consecutive bands (the halo of the receptive field) are recomputed, which trades some extra MACs for a bounded
+ * working set, and the result is bit exact with the whole tensor operators.
+ *
+ * Bands are full width row ranges of an NHWC tensor with a batch size of one, so a band is a contiguous memory
+ * region and no copy is needed to feed the whole tensor operators used underneath. Every filter or pooling window
+ * must cover at least one row of its input tensor, i.e. the padding is smaller than the (dilated) kernel height.
+ */
+
+/**
+ * @brief Get the band of input rows needed to compute a band of output rows.
+ *
+ * @param[in]   output_band   Output rows
+ * @param[in]   input_y       Height of the full input tensor
+ * @param[in]   kernel_y      Kernel (or pooling window) height
+ * @param[in]   stride_y      Stride along the height
+ * @param[in]   pad_y         Top padding
+ * @param[in]   dilation_y    Dilation along the height, 1 for pooling
+ * @param[out]  input_band    Input rows, clipped to the full input tensor. Rows falling into the padding are not
+ *                            part of the band.
+ */
+void riscv_nn_band_get_input_band(const nmsis_nn_band *output_band,
+                                  const int32_t input_y,
+                                  const int32_t kernel_y,
+                                  const int32_t stride_y,
+                                  const int32_t pad_y,
+                                  const int32_t dilation_y,
+                                  nmsis_nn_band *input_band);
+
+/**
+ * @brief s8 convolution of a band of output rows
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                riscv_convolve_band_s8_get_buffer_size will return the buffer_size if required.
+ *                                The caller is expected to clear the buffer, if applicable, for security reasons.
+ * @param[in]      conv_params    Convolution parameters of the full tensor operation. Refer to
+ *                                riscv_convolve_wrapper_s8() for details.
+ * @param[in]      quant_params   Per-channel quantization info.
+ * @param[in]      input_dims     Full input tensor dimensions. Format: [1, H, W, C_IN]
+ * @param[in]      input_band     Input rows held in input_data. It must include all the rows returned by
+ *                                riscv_nn_band_get_input_band() for output_band.
+ * @param[in]      input_data     Pointer to the first row of the input band. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Full output tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      output_band    Output rows to be computed
+ * @param[out]     output_data    Pointer to the first row of the output band. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail, e.g. the input band does not
+ *                  hold all the needed rows. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details    The output rows are identical to the same rows of riscv_convolve_wrapper_s8() on the full tensor.
+ */
+riscv_nmsis_nn_status riscv_convolve_band_s8(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_conv_params *conv_params,
+                                         const nmsis_nn_per_channel_quant_params *quant_params,
+                                         const nmsis_nn_dims *input_dims,
+                                         const nmsis_nn_band *input_band,
+                                         const int8_t *input_data,
+                                         const nmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const nmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const nmsis_nn_dims *output_dims,
+                                         const nmsis_nn_band *output_band,
+                                         int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for riscv_convolve_band_s8, valid for any band of the tensor
+ *
+ * @param[in]      conv_params    Convolution parameters of the full tensor operation
+ * @param[in]      input_dims     Full input tensor dimensions. Format: [1, H, W, C_IN]
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [C_OUT, HK, WK, C_IN]
+ * @param[in]      output_dims    Full output tensor dimensions. Format: [1, H, W, C_OUT]
+ * @return         The function returns required buffer size(bytes)
+ */
+int32_t riscv_convolve_band_s8_get_buffer_size(const nmsis_nn_conv_params *conv_params,
+                                             const nmsis_nn_dims *input_dims,
+                                             const nmsis_nn_dims *filter_dims,
+                                             const nmsis_nn_dims *output_dims);
+
+/**
+ * @brief s8 depthwise convolution of a band of output rows
+ *
+ * @param[in, out] ctx            Function context that contains the additional buffer if required by the function.
+ *                                riscv_depthwise_conv_band_s8_get_buffer_size will return the buffer_size if
+ *                                required. The caller is expected to clear the buffer, if applicable, for security
+ *                                reasons.
+ * @param[in]      dw_conv_params Depthwise convolution parameters of the full tensor operation. Refer to
+ *                                riscv_depthwise_conv_wrapper_s8() for details.
+ * @param[in]      quant_params   Per-channel quantization info.
+ * @param[in]      input_dims     Full input tensor dimensions. Format: [1, H, W, C_IN]
+ * @param[in]      input_band     Input rows held in input_data. It must include all the rows returned by
+ *                                riscv_nn_band_get_input_band() for output_band.
+ * @param[in]      input_data     Pointer to the first row of the input band. Data type: int8
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      filter_data    Filter data pointer. Data type: int8
+ * @param[in]      bias_dims      Bias tensor dimensions. Format: [C_OUT]
+ * @param[in]      bias_data      Optional bias data pointer. Data type: int32
+ * @param[in]      output_dims    Full output tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      output_band    Output rows to be computed
+ * @param[out]     output_data    Pointer to the first row of the output band. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail, e.g. the input band does not
+ *                  hold all the needed rows. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details    The output rows are identical to the same rows of riscv_depthwise_conv_wrapper_s8() on the full tensor.
+ */
+riscv_nmsis_nn_status riscv_depthwise_conv_band_s8(const nmsis_nn_context *ctx,
+                                               const nmsis_nn_dw_conv_params *dw_conv_params,
+                                               const nmsis_nn_per_channel_quant_params *quant_params,
+                                               const nmsis_nn_dims *input_dims,
+                                               const nmsis_nn_band *input_band,
+                                               const int8_t *input_data,
+                                               const nmsis_nn_dims *filter_dims,
+                                               const int8_t *filter_data,
+                                               const nmsis_nn_dims *bias_dims,
+                                               const int32_t *bias_data,
+                                               const nmsis_nn_dims *output_dims,
+                                               const nmsis_nn_band *output_band,
+                                               int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for riscv_depthwise_conv_band_s8, valid for any band of the tensor
+ *
+ * @param[in]      dw_conv_params Depthwise convolution parameters of the full tensor operation
+ * @param[in]      input_dims     Full input tensor dimensions. Format: [1, H, W, C_IN]
+ * @param[in]      filter_dims    Filter tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      output_dims    Full output tensor dimensions. Format: [1, H, W, C_OUT]
+ * @return         The function returns required buffer size(bytes)
+ */
+int32_t riscv_depthwise_conv_band_s8_get_buffer_size(const nmsis_nn_dw_conv_params *dw_conv_params,
+                                                   const nmsis_nn_dims *input_dims,
+                                                   const nmsis_nn_dims *filter_dims,
+                                                   const nmsis_nn_dims *output_dims);
+
+/**
+ * @brief s8 max or average pooling of a band of output rows
+ *
+ * @param[in, out] ctx            Function context (e.g. temporary buffer). riscv_pool_band_s8_get_buffer_size will
+ *                                return the buffer_size if required.
+ * @param[in]      pool_params    Pooling parameters of the full tensor operation
+ * @param[in]      pool_type      Pooling operation, RISCV_NN_POOL_MAX or RISCV_NN_POOL_AVG
+ * @param[in]      input_dims     Full input tensor dimensions. Format: [1, H, W, C_IN]
+ * @param[in]      input_band     Input rows held in input_data. It must include all the rows returned by
+ *                                riscv_nn_band_get_input_band() for output_band.
+ * @param[in]      input_data     Pointer to the first row of the input band. Data type: int8
+ * @param[in]      filter_dims    Pooling window dimensions. Format: [H, W]
+ * @param[in]      output_dims    Full output tensor dimensions. Format: [1, H, W, C_OUT]
+ * @param[in]      output_band    Output rows to be computed
+ * @param[out]     output_data    Pointer to the first row of the output band. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail, e.g. the input band does not
+ *                  hold all the needed rows. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details    The output rows are identical to the same rows of riscv_max_pool_s8() or riscv_avgpool_s8() on the
+ *             full tensor, the average excludes the padding in the same way.
+ */
+riscv_nmsis_nn_status riscv_pool_band_s8(const nmsis_nn_context *ctx,
+                                     const nmsis_nn_pool_params *pool_params,
+                                     const riscv_nn_pool_type pool_type,
+                                     const nmsis_nn_dims *input_dims,
+                                     const nmsis_nn_band *input_band,
+                                     const int8_t *input_data,
+                                     const nmsis_nn_dims *filter_dims,
+                                     const nmsis_nn_dims *output_dims,
+                                     const nmsis_nn_band *output_band,
+                                     int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for riscv_pool_band_s8
+ *
+ * @param[in]      pool_type      Pooling operation, RISCV_NN_POOL_MAX or RISCV_NN_POOL_AVG
+ * @param[in]      input_dims     Full input tensor dimensions. Format: [1, H, W, C_IN]
+ * @param[in]      output_dims    Full output tensor dimensions. Format: [1, H, W, C_OUT]
+ * @return         The function returns required buffer size(bytes)
+ */
+int32_t riscv_pool_band_s8_get_buffer_size(const riscv_nn_pool_type pool_type,
+                                         const nmsis_nn_dims *input_dims,
+                                         const nmsis_nn_dims *output_dims);
+
+/**
+ * @brief Run a chain of s8 layers band by band
+ *
+ * @param[in, out] ctx            Function context with the buffer returned by riscv_nn_band_chain_s8_get_buffer_size.
+ *                                It holds the scratch buffer of the operators and two buffers for the intermediate
+ *                                bands.
+ * @param[in]      layers         Layers of the chain. The output tensor of one layer is the input tensor of the next
+ *                                one.
+ * @param[in]      num_layers     Number of layers
+ * @param[in]      band_rows      Number of output rows of the last layer computed per band. Smaller bands need less
+ *                                memory and recompute more halo rows.
+ * @param[in]      input_data     Full input tensor of the first layer. Data type: int8
+ * @param[out]     output_data    Full output tensor of the last layer. Data type: int8
+ *
+ * @return     The function returns either
+ *                  <code>RISCV_NMSIS_NN_ARG_ERROR</code> if argument constraints fail. or,
+ *                  <code>RISCV_NMSIS_NN_SUCCESS</code> on successful completion.
+ *
+ * @details
+ *    1. For every band of output rows of the last layer, the rows of each layer it depends on are computed from the
+ *       first layer down, so the intermediate tensors of the chain never exist as a whole.
+ *    2. The output is identical to running the whole tensor operators layer after layer.
+ *    3. Pick band_rows with riscv_nn_band_chain_s8_get_buffer_size(): the memory of the chain is the buffer size
+ *       plus the input and output tensors, against the sum of the two largest consecutive activations otherwise.
+ */
+riscv_nmsis_nn_status riscv_nn_band_chain_s8(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_band_layer *layers,
+                                         const int32_t num_layers,
+                                         const int32_t band_rows,
+                                         const int8_t *input_data,
+                                         int8_t *output_data);
+
+/**
+ * @brief Get the required buffer size for riscv_nn_band_chain_s8
+ *
+ * @param[in]      layers         Layers of the chain
+ * @param[in]      num_layers     Number of layers
+ * @param[in]      band_rows      Number of output rows of the last layer computed per band
+ * @return         The function returns required buffer size(bytes), or 0 if the chain is not valid
+ */
+int32_t riscv_nn_band_chain_s8_get_buffer_size(const nmsis_nn_band_layer *layers,
+                                             const int32_t num_layers,
+                                             const int32_t band_rows);
+
+/**
+ * @defgroup NNProfile Operator Profiler Functions
+ *
+ * When the library is built with <code>RISCV_NN_PROFILE</code> defined (the <code>PROFILE</code> option of
+ * <code>NN/Source/CMakeLists.txt</code>), each s4/s8/s16 operator records its name, nesting depth, input and
+ * output dimensions, cycles and retired instructions into a ring buffer of <code>RISCV_NN_PROFILE_RECORDS</code>
+ * entries. With <code>RISCV_NN_PROFILE_HPM</code> also defined, the counts of the HPM counters
+ * <code>RISCV_NN_PROFILE_HPM0</code> and <code>RISCV_NN_PROFILE_HPM1</code> (3 and 4 by default) are recorded,
+ * their events, such as the data and instruction cache misses, must be selected by the application.
+ *
+ * The wrappers record the operator they dispatch to as a nested call, the cycles of a record include its nested
+ * records. The records are dumped with riscv_nn_profile_dump() and converted into a per layer CSV and flame chart
+ * by <code>NN/Scripts/Profiler/nn_profile.py</code>. Without <code>RISCV_NN_PROFILE</code>, or with a compiler other
+ * than GCC and Clang, such as IAR, the operators have no profiling code and these functions record nothing.
+ */
+
+#ifndef RISCV_NN_PROFILE_RECORDS
+    #define RISCV_NN_PROFILE_RECORDS (256)
+#endif
+
+/**
+ * @brief Clear the records of the profiler and restart the sequence numbers from 0.
+ */
+void riscv_nn_profile_reset(void);
+
+/**
+ * @brief Copy the records of the profiler, oldest first.
+ *
+ * @param[out]  records   Destination of the records
+ * @param[in]   max       Maximum number of records copied
+ * @return      Number of records copied. When more than <code>RISCV_NN_PROFILE_RECORDS</code> calls were
+ *              recorded since riscv_nn_profile_reset(), only the latest ones are available.
+ */
+int32_t riscv_nn_profile_read(nmsis_nn_profile_record *records, int32_t max);
+
+/**
+ * @brief Print the records of the profiler, oldest first, one line per record:
+ *        <code>NNPROF, seq, depth, op, in n, in h, in w, in c, out n, out h, out w, out c, start, cycles, instret,
+ *        hpm0, hpm1</code>, preceded by <code>NNPROF_DROPPED, count</code> if older records were overwritten.
+ */
+void riscv_nn_profile_dump(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,39 @@ extern "C" {
 // channels. This is based on heuristics and may be finetuned depending on other parameters of the operator
 #define REVERSE_TCOL_EFFICIENT_THRESHOLD (16)
 
+// riscv_convolve_wrapper_s8 selects the im2col free riscv_convolve_direct_s8 for up to this number of input channels,
+// e.g. the RGB or mono first layer of a network, unless the 1x1 or 1xN kernels handle the shape. P extension only
+// builds keep the SIMD im2col kernel.
+#define CONV_DIRECT_MAX_INPUT_CH (4)
+#if defined(RISCV_MATH_VECTOR_ZVE32X) || !defined(RISCV_MATH_DSP)
+    #define USE_CONV_DIRECT_S8_FUNCTION(conv_params, input_dims, filter_dims)                                          \
+        ((input_dims)->c <= CONV_DIRECT_MAX_INPUT_CH && (input_dims)->c == (filter_dims)->c &&                         \
+         !((conv_params)->padding.w == 0 && (conv_params)->padding.h == 0 && (filter_dims)->w == 1 &&                  \
+           (filter_dims)->h == 1 && (conv_params)->dilation.w == 1 && (conv_params)->dilation.h == 1) &&               \
+         !((input_dims)->h == 1 && (conv_params)->dilation.w == 1 && (filter_dims)->h == 1 &&                          \
+           ((conv_params)->stride.w * (input_dims)->c) % 4 == 0))
+#else
+    #define USE_CONV_DIRECT_S8_FUNCTION(conv_params, input_dims, filter_dims) (0)
+#endif
+
+// Profiling hook of the public operators, see the NNProfile group of riscv_nnfunctions.h. RISCV_NN_PROFILE_OP is
+// placed at the start of an operator and records the call until the operator returns, RISCV_NN_PROFILE_SHAPE is
+// used by the operators without tensor dimensions. Both expand to nothing unless RISCV_NN_PROFILE is defined, and
+// with the compilers without the cleanup attribute of GCC and Clang, such as IAR, which are not profiled.
+#if defined(RISCV_NN_PROFILE) && (defined(__GNUC__) || defined(__clang__))
+uint32_t riscv_nn_profile_enter(const char *op, const nmsis_nn_dims *input, const nmsis_nn_dims *output);
+void riscv_nn_profile_exit(const uint32_t *seq);
+    #define RISCV_NN_PROFILE_OP(input, output)                                                                         \
+        const uint32_t riscv_nn_profile_seq __attribute__((cleanup(riscv_nn_profile_exit), unused)) =                  \
+            riscv_nn_profile_enter(__func__, (input), (output))
+    #define RISCV_NN_PROFILE_SHAPE(n, h, w, c)                                                                         \
+        const nmsis_nn_dims riscv_nn_profile_dims = {(int32_t)(n), (int32_t)(h), (int32_t)(w), (int32_t)(c)};          \
+        RISCV_NN_PROFILE_OP(&riscv_nn_profile_dims, &riscv_nn_profile_dims)
+#else
+    #define RISCV_NN_PROFILE_OP(input, output)
+    #define RISCV_NN_PROFILE_SHAPE(n, h, w, c)
+#endif
+
 // By default this will have no effect. During compilation this may be set to __restrict,
 // which may be beneficial for performance. See README.md for more intformation.
 #ifndef OPTIONAL_RESTRICT_KEYWORD
@@ -875,6 +908,42 @@ riscv_nmsis_nn_status riscv_nn_vec_mat_mult_t_per_ch_s8(const int8_t *lhs,
                                                     const int32_t address_offset,
                                                     const int32_t rhs_offset);
 
+/**
+ * @brief s8 Vector by 2:4 structured sparse Matrix (transposed) multiplication
+ *
+ * @param[in]      lhs             Input left-hand side vector
+ * @param[in]      rhs_values      Kept values of the right-hand side matrix (transposed).
+ *                                 Size: rhs_rows * RISCV_NN_SPARSE_VALUES_SIZE(rhs_cols)
+ * @param[in]      rhs_index       Position of the kept values. Size: rhs_rows * RISCV_NN_SPARSE_INDEX_SIZE(rhs_cols)
+ * @param[in]      bias            Input bias
+ * @param[out]     dst             Output vector
+ * @param[in]      lhs_offset      Offset to be added to the input values of the left-hand side vector.
+ *                                 Range: -127 to 128
+ * @param[in]      dst_offset      Offset to be added to the output values. Range: -127 to 128
+ * @param[in]      dst_multiplier  Output multiplier
+ * @param[in]      dst_shift       Output shift
+ * @param[in]      rhs_cols        Number of columns in the dense right-hand side matrix
+ * @param[in]      rhs_rows        Number of rows in the right-hand side matrix
+ * @param[in]      activation_min  Minimum value to clamp the output to. Range: int8
+ * @param[in]      activation_max  Maximum value to clamp the output to. Range: int8
+ *
+ * @return         The function returns <code>RISCV_NMSIS_NN_SUCCESS</code>
+ *
+ */
+riscv_nmsis_nn_status riscv_nn_vec_mat_mult_t_sparse_s8(const int8_t *lhs,
+                                                    const int8_t *rhs_values,
+                                                    const uint8_t *rhs_index,
+                                                    const int32_t *bias,
+                                                    int8_t *dst,
+                                                    const int32_t lhs_offset,
+                                                    const int32_t dst_offset,
+                                                    const int32_t dst_multiplier,
+                                                    const int32_t dst_shift,
+                                                    const int32_t rhs_cols,
+                                                    const int32_t rhs_rows,
+                                                    const int32_t activation_min,
+                                                    const int32_t activation_max);
+
 /**
  * @brief s16 Vector by s8 Matrix (transposed) multiplication
  *
@@ -2651,6 +2720,87 @@ __STATIC_FORCEINLINE int32_t riscv_check_broadcast_required(const nmsis_nn_dims
     return 0;
 }
 
+/**
+ * @brief Present a band of input rows as a whole tensor for the rows of one output band.
+ * @param[in]       input_dims          Full input tensor dimensions
+ * @param[in]       input_band          Rows of the full input tensor held in input_data
+ * @param[in]       input_data          Pointer to the first row of the input band
+ * @param[in]       output_band         Output rows to be computed
+ * @param[in]       kernel_y            Kernel height
+ * @param[in]       stride_y            Stride along the height
+ * @param[in]       pad_y               Top padding of the full tensor
+ * @param[in]       dilation_y          Dilation along the height
+ * @param[out]      view_dims           Dimensions of the view. Format: [1, H, W, C_IN]
+ * @param[out]      view_data           Pointer to the first row of the view
+ * @param[out]      view_pad_y          Top padding of the view
+ * @return          The function returns <code>RISCV_NMSIS_NN_ARG_ERROR</code> if the input band does not hold all
+ *                  the rows needed by the output band, or <code>RISCV_NMSIS_NN_SUCCESS</code>.
+ *
+ * @details   The view starts at the first input row used by the output band, with the remaining top padding, and
+ *            ends at the last used row. Rows below the full tensor are left to the bottom padding of the operator.
+ */
+__STATIC_FORCEINLINE riscv_nmsis_nn_status riscv_nn_band_view_s8(const nmsis_nn_dims *input_dims,
+                                                                 const nmsis_nn_band *input_band,
+                                                                 const int8_t *input_data,
+                                                                 const nmsis_nn_band *output_band,
+                                                                 const int32_t kernel_y,
+                                                                 const int32_t stride_y,
+                                                                 const int32_t pad_y,
+                                                                 const int32_t dilation_y,
+                                                                 nmsis_nn_dims *view_dims,
+                                                                 const int8_t **view_data,
+                                                                 int32_t *view_pad_y)
+{
+    const int32_t first_y = output_band->start * stride_y - pad_y;
+    const int32_t last_y =
+        (output_band->start + output_band->rows - 1) * stride_y - pad_y + (kernel_y - 1) * dilation_y;
+    const int32_t start_y = MAX(first_y, 0);
+    const int32_t end_y = MIN(last_y + 1, input_dims->h);
+
+    if (output_band->rows <= 0 || start_y >= end_y || start_y < input_band->start ||
+        end_y > input_band->start + input_band->rows)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    *view_dims = *input_dims;
+    view_dims->n = 1;
+    view_dims->h = end_y - start_y;
+    *view_data = input_data + (start_y - input_band->start) * input_dims->w * input_dims->c;
+    *view_pad_y = start_y - first_y;
+
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+/**
+ * @brief Dot product of an s8 vector with one row of a 2:4 structured sparse s8 matrix.
+ * @param[in]       lhs          Dense input vector
+ * @param[in]       values       Kept values of the row
+ * @param[in]       index        Position of the kept values, see RISCV_NN_SPARSE_VALUES_SIZE
+ * @param[in]       num_values   Number of kept values in the row, i.e. RISCV_NN_SPARSE_VALUES_SIZE(cols)
+ * @param[in]       lhs_offset   Offset to be added to the input values
+ * @return          Sum of (lhs[col] + lhs_offset) * value over the kept values
+ */
+__STATIC_FORCEINLINE int32_t riscv_nn_sparse_dot_s8(const int8_t *lhs,
+                                                  const int8_t *values,
+                                                  const uint8_t *index,
+                                                  const int32_t num_values,
+                                                  const int32_t lhs_offset)
+{
+    int32_t sum = 0;
+
+    /* Two kept values per group of four columns */
+    for (int32_t i = 0; i < num_values; i += 2)
+    {
+        const int8_t *lhs_group = lhs + (i << 1);
+        const int32_t pos = index[i >> 2] >> ((i & 3) << 1);
+        sum += (lhs_group[pos & 3] + lhs_offset) * values[i];
+        sum += (lhs_group[(pos >> 2) & 3] + lhs_offset) * values[i + 1];
+    }
+
+    return sum;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""
+Offline tensor arena planner for NMSIS-NN models.
+
+The planner reads a layer list (JSON), derives the lifetime of every activation
+tensor and of every per-layer scratch buffer, and packs them into a single
+arena with a greedy-by-size first-fit placement, so that buffers whose
+lifetimes do not overlap share memory.  The result is written as a C header
+with one offset/size pair per buffer, to be used together with
+riscv_nn_arena_alloc():
+
+    int8_t *plan = riscv_nn_arena_alloc(&arena, KWS_ARENA_SIZE);
+    int8_t *conv1_out = plan + KWS_CONV1_OUT_OFFSET;
+    nmsis_nn_context ctx = {plan + KWS_CONV1_SCRATCH_OFFSET, KWS_CONV1_SCRATCH_SIZE};
+
+Layer list format (see example_model.json):
+
+    {
+      "name": "kws",
+      "alignment": 16,
+      "tensors": {"input": {"shape": [1, 49, 10, 1], "dtype": "int8"}, "conv1_out": 4000},
+      "inputs": ["input"],
+      "outputs": ["output"],
+      "layers": [
+        {"name": "conv1", "inputs": ["input"], "outputs": ["conv1_out"], "scratch": 1024},
+        ...
+      ]
+    }
+
+Layers must be listed in execution order.  "scratch" is the value returned by
+the *_get_buffer_size() function of the operator.  Graph inputs are live from
+the first layer, graph outputs until the last one.
+
+Usage:
+    python3 arena_planner.py example_model.json -o kws_arena.h
+"""
+
+import argparse
+import json
+import os
+import sys
+
+DTYPE_BYTES = {
+    "int4": 0.5,
+    "int8": 1,
+    "uint8": 1,
+    "int16": 2,
+    "int32": 4,
+    "int64": 8,
+    "float32": 4,
+}
+
+
+class Buffer(object):
+
+    def __init__(self, name, size, first, last):
+        self.name = name
+        self.size = size
+        self.first = first
+        self.last = last
+        self.offset = None
+
+    def overlaps(self, other):
+        return not (self.last < other.first or other.last < self.first)
+
+
+def align_up(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def tensor_size(desc):
+    if isinstance(desc, int):
+        return desc
+    count = 1
+    for dim in desc["shape"]:
+        count *= dim
+    return int(count * DTYPE_BYTES[desc.get("dtype", "int8")] + 0.5)
+
+
+def build_buffers(model):
+    layers = model["layers"]
+    tensors = model["tensors"]
+    last_layer = len(layers) - 1
+    first_use = {}
+    last_use = {}
+
+    for name in model.get("inputs", []):
+        first_use[name] = 0
+        last_use[name] = 0
+    for idx, layer in enumerate(layers):
+        for name in layer.get("inputs", []) + layer.get("outputs", []):
+            if name not in tensors:
+                raise ValueError("layer %s uses unknown tensor %s" % (layer["name"], name))
+            first_use.setdefault(name, idx)
+            last_use[name] = idx
+    for name in model.get("outputs", []):
+        last_use[name] = last_layer
+
+    buffers = []
+    for name in tensors:
+        if name not in first_use:
+            print("warning: tensor %s is never used, skipped" % name, file=sys.stderr)
+            continue
+        buffers.append(Buffer(name, tensor_size(tensors[name]), first_use[name], last_use[name]))
+    for idx, layer in enumerate(layers):
+        scratch = layer.get("scratch", 0)
+        if scratch > 0:
+            buffers.append(Buffer(layer["name"] + "_scratch", scratch, idx, idx))
+    return buffers
+
+
+def plan(buffers, alignment):
+    """Greedy by size: place the largest buffer first at the lowest aligned offset
+    that does not collide with an already placed buffer of overlapping lifetime."""
+    placed = []
+    for buf in sorted(buffers, key=lambda b: (-b.size, b.first, b.name)):
+        conflicts = sorted((p for p in placed if p.overlaps(buf)), key=lambda p: p.offset)
+        offset = 0
+        for other in conflicts:
+            if offset + buf.size <= other.offset:
+                break
+            offset = max(offset, align_up(other.offset + other.size, alignment))
+        buf.offset = offset
+        placed.append(buf)
+    return align_up(max([b.offset + b.size for b in placed] + [0]), alignment)
+
+
+def lower_bound(buffers, num_layers, alignment):
+    """Largest sum of live buffer sizes over all layers, no plan can be smaller."""
+    peak = 0
+    for idx in range(num_layers):
+        live = sum(align_up(b.size, alignment) for b in buffers if b.first <= idx <= b.last)
+        peak = max(peak, live)
+    return peak
+
+
+def c_name(name):
+    return "".join(ch if ch.isalnum() else "_" for ch in name).upper()
+
+
+def emit_header(model, buffers, arena_size, source):
+    prefix = c_name(model.get("name", "model"))
+    guard = prefix + "_ARENA_LAYOUT_H"
+    lines = [
+        "/* Generated by arena_planner.py from %s, do not edit. */" % os.path.basename(source),
+        "",
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "#define %s_ARENA_ALIGNMENT (%d)" % (prefix, model.get("alignment", 16)),
+        "#define %s_ARENA_SIZE (%d)" % (prefix, arena_size),
+        "",
+    ]
+    for buf in sorted(buffers, key=lambda b: (b.first, b.name)):
+        lines.append("/* %s: layers [%d, %d] */" % (buf.name, buf.first, buf.last))
+        lines.append("#define %s_%s_OFFSET (%d)" % (prefix, c_name(buf.name), buf.offset))
+        lines.append("#define %s_%s_SIZE (%d)" % (prefix, c_name(buf.name), buf.size))
+    lines += ["", "#endif /* %s */" % guard, ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Plan a packed NMSIS-NN tensor arena from a layer list")
+    parser.add_argument("model", help="layer list in JSON format")
+    parser.add_argument("-o", "--output", help="generated C header, default: <name>_arena.h")
+    parser.add_argument("-a", "--alignment", type=int, help="buffer alignment in bytes, overrides the model file")
+    args = parser.parse_args()
+
+    with open(args.model) as fp:
+        model = json.load(fp)
+    if args.alignment:
+        model["alignment"] = args.alignment
+    alignment = model.setdefault("alignment", 16)
+    if alignment <= 0 or alignment & (alignment - 1):
+        parser.error("alignment must be a power of two")
+
+    buffers = build_buffers(model)
+    arena_size = plan(buffers, alignment)
+    naive_size = sum(align_up(b.size, alignment) for b in buffers)
+    bound = lower_bound(buffers, len(model["layers"]), alignment)
+
+    output = args.output or "%s_arena.h" % model.get("name", "model")
+    with open(output, "w") as fp:
+        fp.write(emit_header(model, buffers, arena_size, args.model))
+
+    print("Buffers        : %d" % len(buffers))
+    print("Naive size     : %d bytes" % naive_size)
+    print("Planned size   : %d bytes" % arena_size)
+    print("Lower bound    : %d bytes" % bound)
+    print("Layout written to %s" % output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
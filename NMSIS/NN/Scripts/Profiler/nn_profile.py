@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+Per layer report of the NMSIS-NN operator profiler.
+
+The NMSIS-NN library built with RISCV_NN_PROFILE records each call of the
+s4/s8/s16 operators into a ring buffer, which the application prints with
+riscv_nn_profile_dump() after an inference:
+
+    NNPROF, seq, depth, op, in n, in h, in w, in c, out n, out h, out w, out c, start, cycles, instret, hpm0, hpm1
+
+The operators called by the application (depth 0) are the layers of the
+model, the operators called by them, such as riscv_convolve_s8 called by
+riscv_convolve_wrapper_s8, are nested records with a larger depth. This script
+reads the run log and writes:
+
+    - a CSV with one row per call, its self cycles (without the nested calls)
+      and its share of the total cycles of the layers
+    - a Chrome trace (chrome://tracing or https://ui.perfetto.dev) showing the
+      calls as a flame chart on the cycle timeline
+    - a folded stack file for flamegraph.pl or https://www.speedscope.app
+
+Usage:
+    python3 nn_profile.py run.log -o model_profile.csv --trace model_trace.json --folded model.folded
+"""
+
+import argparse
+import csv
+import json
+import re
+import sys
+
+NNPROF_RE = re.compile(r'NNPROF,\s*(\d+),\s*(\d+),\s*(\w+),' + r'\s*(-?\d+),' * 8 + r'\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+)')
+DROPPED_RE = re.compile(r'NNPROF_DROPPED,\s*(\d+)')
+
+CSV_FIELDS = ["seq", "depth", "layer", "op", "input", "output", "start", "cycles", "self_cycles", "percent",
+              "instret", "ipc", "hpm0", "hpm1"]
+
+
+def parse_log(log):
+    """Return the records and the number of dropped records of the last dump of the log"""
+    records = []
+    dropped = 0
+    with open(log, "r", errors="ignore") as fp:
+        for line in fp:
+            match = DROPPED_RE.search(line)
+            if match:
+                dropped = int(match.group(1))
+                continue
+            match = NNPROF_RE.search(line)
+            if match is None:
+                continue
+            values = [int(v) if i != 2 else v for i, v in enumerate(match.groups())]
+            rec = {
+                "seq": values[0], "depth": values[1], "op": values[2],
+                "input": "x".join(str(v) for v in values[3:7]), "output": "x".join(str(v) for v in values[7:11]),
+                "start": values[11], "cycles": values[12], "instret": values[13],
+                "hpm0": values[14], "hpm1": values[15],
+            }
+            # A new dump restarts from the oldest record
+            if records and rec["seq"] <= records[-1]["seq"]:
+                records = []
+            records.append(rec)
+    return records, dropped
+
+
+def annotate(records):
+    """Add the layer index, self cycles, share of the total cycles and IPC of each record"""
+    total = sum(rec["cycles"] for rec in records if rec["depth"] == 0)
+    layer = -1
+    for i, rec in enumerate(records):
+        if rec["depth"] == 0:
+            layer += 1
+        rec["layer"] = layer
+        nested = 0
+        for child in records[i + 1:]:
+            if child["depth"] <= rec["depth"]:
+                break
+            if child["depth"] == rec["depth"] + 1:
+                nested += child["cycles"]
+        rec["self_cycles"] = max(0, rec["cycles"] - nested)
+        rec["percent"] = "%.2f" % (100.0 * rec["self_cycles"] / total) if total else "0.00"
+        rec["ipc"] = "%.3f" % (rec["instret"] / rec["cycles"]) if rec["cycles"] else "0.000"
+    return total
+
+
+def write_csv(records, output):
+    with open(output, "w", newline="") as fp:
+        writer = csv.DictWriter(fp, fieldnames=CSV_FIELDS, extrasaction="ignore")
+        writer.writeheader()
+        for rec in records:
+            writer.writerow(rec)
+
+
+def write_trace(records, output, mhz):
+    """Chrome trace event format, the timestamps are in us, so 1 cycle is 1 us with the default mhz"""
+    t0 = records[0]["start"] if records else 0
+    events = []
+    for rec in records:
+        events.append({
+            "name": rec["op"], "cat": "layer%d" % (rec["layer"]), "ph": "X", "pid": 0, "tid": 0,
+            "ts": (rec["start"] - t0) / mhz, "dur": rec["cycles"] / mhz,
+            "args": {"seq": rec["seq"], "input": rec["input"], "output": rec["output"], "cycles": rec["cycles"],
+                     "self_cycles": rec["self_cycles"], "instret": rec["instret"], "hpm0": rec["hpm0"],
+                     "hpm1": rec["hpm1"]},
+        })
+    with open(output, "w") as fp:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, fp, indent=1)
+
+
+def write_folded(records, output):
+    """One line per call stack with the sum of its self cycles"""
+    stacks = {}
+    path = []
+    for rec in records:
+        del path[rec["depth"]:]
+        path.append("%s[%s]" % (rec["op"], rec["output"]))
+        key = ";".join(path)
+        stacks[key] = stacks.get(key, 0) + rec["self_cycles"]
+    with open(output, "w") as fp:
+        for key, cycles in stacks.items():
+            fp.write("%s %d\n" % (key, cycles))
+
+
+def print_layers(records, total):
+    print("%-6s %-40s %-14s %-14s %12s %8s %7s" % ("Layer", "Operator", "Input", "Output", "Cycles", "Percent", "IPC"))
+    for rec in records:
+        if rec["depth"] != 0:
+            continue
+        percent = 100.0 * rec["cycles"] / total if total else 0.0
+        print("%-6d %-40s %-14s %-14s %12d %7.2f%% %7s" % (rec["layer"], rec["op"], rec["input"], rec["output"],
+                                                         rec["cycles"], percent, rec["ipc"]))
+    print("Total cycles of %d layers: %d" % (len([rec for rec in records if rec["depth"] == 0]), total))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="NMSIS-NN per layer profile report")
+    parser.add_argument("log", help="run log containing the output of riscv_nn_profile_dump()")
+    parser.add_argument("-o", "--output", help="CSV file of the calls")
+    parser.add_argument("--trace", help="Chrome trace JSON file of the calls")
+    parser.add_argument("--folded", help="folded stack file of the calls, for flamegraph.pl")
+    parser.add_argument("--mhz", type=float, default=1.0, help="core frequency, to show the trace in real time")
+    args = parser.parse_args()
+
+    records, dropped = parse_log(args.log)
+    if not records:
+        print("No NNPROF record found in %s, is NMSIS-NN built with RISCV_NN_PROFILE?" % args.log)
+        return 1
+    if dropped:
+        print("Warning: %d older calls were overwritten, increase RISCV_NN_PROFILE_RECORDS" % dropped)
+    unfinished = [rec for rec in records if rec["cycles"] == 0]
+    if unfinished:
+        print("Warning: %d calls had not returned when dumped" % len(unfinished))
+
+    total = annotate(records)
+    print_layers(records, total)
+    if args.output:
+        write_csv(records, args.output)
+        print("Calls written to %s" % args.output)
+    if args.trace:
+        write_trace(records, args.trace, args.mhz)
+        print("Trace written to %s" % args.trace)
+    if args.folded:
+        write_folded(records, args.folded)
+        print("Folded stacks written to %s" % args.folded)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""
+2:4 structured sparse weight packer for NMSIS-NN.
+
+riscv_fully_connected_sparse_s8() and riscv_convolve_1x1_sparse_s8() take
+int8 weights where every group of 4 consecutive values along the accumulation
+depth holds at most 2 non-zero values, the accumulation depth being a multiple
+of 4.  Each row (output channel) is stored as:
+
+    values: the 2 kept values of every group, in column order
+    index : the position (0-3) of every kept value inside its group,
+            2 bits per value, 4 values per byte, value i at bits 2*(i%4)
+
+Rows start on a new index byte, so a row takes
+RISCV_NN_SPARSE_VALUES_SIZE(cols) + RISCV_NN_SPARSE_INDEX_SIZE(cols) bytes,
+5/8 of the dense size rather than 1/2 because of the index.
+
+The input is a .npy file with int8 weights in the NMSIS-NN layout:
+[C_OUT, C_IN] for fully connected layers, [C_OUT, 1, 1, C_IN] for 1x1
+convolutions.  Groups holding more than 2 non-zero values are pruned by
+magnitude; use --strict to fail instead when the model was not pruned to 2:4.
+
+Usage:
+    python3 sparse_weight_pack.py fc1_weights.npy -n fc1 -o fc1_sparse_weights.h
+"""
+
+import argparse
+import os
+import sys
+
+import numpy as np
+
+GROUP_SIZE = 4
+GROUP_KEEP = 2
+
+
+def values_size(cols):
+    return (cols + GROUP_SIZE - 1) // GROUP_SIZE * GROUP_KEEP
+
+
+def index_size(cols):
+    return (values_size(cols) + 3) // 4
+
+
+def prune_2_4(weights):
+    """Keep the 2 largest magnitudes of every group of 4, return the pruned
+    weights and the number of non-zero values that were dropped."""
+    rows, cols = weights.shape
+    pruned = np.zeros_like(weights)
+    dropped = 0
+    for row in range(rows):
+        for start in range(0, cols, GROUP_SIZE):
+            group = weights[row, start:start + GROUP_SIZE].astype(np.int32)
+            # Stable sort so that ties keep the lower column
+            keep = np.argsort(-np.abs(group), kind="stable")[:GROUP_KEEP]
+            pruned[row, start + keep] = weights[row, start + keep]
+            dropped += np.count_nonzero(group) - np.count_nonzero(group[keep])
+    return pruned, dropped
+
+
+def pack(weights):
+    """Pack 2:4 sparse weights [rows, cols] into (values, index) arrays."""
+    rows, cols = weights.shape
+    num_values = values_size(cols)
+    num_index = index_size(cols)
+    values = np.zeros((rows, num_values), dtype=np.int8)
+    index = np.zeros((rows, num_index), dtype=np.uint8)
+
+    for row in range(rows):
+        for group, start in enumerate(range(0, cols, GROUP_SIZE)):
+            group_vals = weights[row, start:start + GROUP_SIZE]
+            nonzero = list(np.flatnonzero(group_vals))
+            if len(nonzero) > GROUP_KEEP:
+                raise ValueError("row %d columns %d-%d are not 2:4 sparse" % (row, start, start + GROUP_SIZE - 1))
+            # Fill up with zero weights on valid columns, the kernels gather the input at every position.
+            # A last group with a single column uses it for both slots.
+            positions = nonzero + [pos for pos in range(len(group_vals)) if pos not in nonzero]
+            positions = sorted(positions[:GROUP_KEEP])
+            for slot in range(GROUP_KEEP):
+                i = group * GROUP_KEEP + slot
+                if slot < len(positions):
+                    pos = positions[slot]
+                    values[row, i] = group_vals[pos]
+                else:
+                    pos = positions[0]
+                index[row, i >> 2] |= pos << ((i & 3) * 2)
+    return values, index
+
+
+def unpack(values, index, cols):
+    """Rebuild the dense weights, used to check the packed arrays."""
+    rows = values.shape[0]
+    dense = np.zeros((rows, values_size(cols) * 2), dtype=np.int8)
+    for row in range(rows):
+        for i in range(values.shape[1]):
+            pos = (int(index[row, i >> 2]) >> ((i & 3) * 2)) & 3
+            dense[row, (i >> 1) * GROUP_SIZE + pos] += values[row, i]
+    return dense[:, :cols]
+
+
+def c_name(name):
+    return "".join(ch if ch.isalnum() else "_" for ch in name)
+
+
+def c_array(ctype, name, data):
+    items = ", ".join(str(int(v)) for v in data.flatten())
+    return "static const %s %s[%d] = {%s};" % (ctype, name, data.size, items)
+
+
+def emit_header(name, rows, cols, values, index, source):
+    lower = c_name(name).lower()
+    upper = lower.upper()
+    guard = upper + "_SPARSE_WEIGHTS_H"
+    lines = [
+        "/* Generated by sparse_weight_pack.py from %s, do not edit. */" % os.path.basename(source),
+        "",
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define %s_ROWS (%d)" % (upper, rows),
+        "#define %s_COLS (%d)" % (upper, cols),
+        "#define %s_VALUES_SIZE (%d)" % (upper, values.size),
+        "#define %s_INDEX_SIZE (%d)" % (upper, index.size),
+        "",
+        c_array("int8_t", lower + "_sparse_values", values),
+        c_array("uint8_t", lower + "_sparse_index", index),
+        "",
+        "#endif /* %s */" % guard,
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Prune and pack int8 weights to the NMSIS-NN 2:4 sparse format")
+    parser.add_argument("weights", help="int8 weights in .npy format, first dimension is the output depth")
+    parser.add_argument("-n", "--name", help="C name prefix, default: weights file name")
+    parser.add_argument("-o", "--output", help="generated C header, default: <name>_sparse_weights.h")
+    parser.add_argument("--strict", action="store_true", help="fail if a non-zero weight would be pruned")
+    args = parser.parse_args()
+
+    weights = np.load(args.weights)
+    if weights.dtype != np.int8:
+        parser.error("weights must be int8, got %s" % weights.dtype)
+    weights = weights.reshape(weights.shape[0], -1)
+    rows, cols = weights.shape
+    if cols % GROUP_SIZE:
+        parser.error("accumulation depth %d is not a multiple of %d" % (cols, GROUP_SIZE))
+
+    pruned, dropped = prune_2_4(weights)
+    if dropped and args.strict:
+        print("error: %d non-zero weights are not 2:4 sparse" % dropped, file=sys.stderr)
+        return 1
+
+    values, index = pack(pruned)
+    assert np.array_equal(unpack(values, index, cols), pruned)
+
+    name = args.name or os.path.splitext(os.path.basename(args.weights))[0]
+    output = args.output or "%s_sparse_weights.h" % c_name(name).lower()
+    with open(output, "w") as fp:
+        fp.write(emit_header(name, rows, cols, values, index, args.weights))
+
+    print("Shape          : %d x %d" % (rows, cols))
+    print("Pruned weights : %d" % dropped)
+    print("Dense size     : %d bytes" % weights.size)
+    print("Packed size    : %d bytes (%.1f%% of dense)" % (values.size + index.size,
+                                                          100.0 * (values.size + index.size) / weights.size))
+    print("Packed weights written to %s" % output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -31,6 +31,7 @@
 
 #include "riscv_nn_tables.h"
 #include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
 
 /**
  *  @ingroup groupNN
@@ -54,6 +55,7 @@ riscv_nmsis_nn_status riscv_nn_activation_s16(const int16_t *input,
                                           const int32_t left_shift,
                                           const riscv_nn_activation_type type)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, 1, size);
     uint32_t abs_input_shift, max_saturation;
     switch (type)
     {
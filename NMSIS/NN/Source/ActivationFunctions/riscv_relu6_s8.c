@@ -50,6 +50,7 @@
 
 void riscv_relu6_s8(int8_t *data, uint16_t size)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, 1, size);
     int32_t i;
 
 #if defined(RISCV_MATH_VECTOR_ZVE32X)
@@ -59,6 +59,7 @@ riscv_nmsis_nn_status riscv_elementwise_mul_s16(const int16_t *input_1_vect,
                                             const int32_t out_activation_max,
                                             const int32_t block_size)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, 1, block_size);
     (void)input_1_offset;
     (void)input_2_offset;
     (void)out_offset;
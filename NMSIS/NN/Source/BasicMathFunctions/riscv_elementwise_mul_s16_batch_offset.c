@@ -57,6 +57,7 @@ riscv_nmsis_nn_status riscv_elementwise_mul_s16_batch_offset(const int16_t *inpu
                                                          const int32_t batch_size,
                                                          const int32_t batch_offset)
 {
+    RISCV_NN_PROFILE_SHAPE(batch_size, 1, 1, block_size);
 
     int32_t loop_count;
 
@@ -56,6 +56,7 @@ riscv_nmsis_nn_status riscv_elementwise_mul_s16_s8(const int16_t *input_1_vect,
                                                const int32_t batch_size,
                                                const int32_t batch_offset)
 {
+    RISCV_NN_PROFILE_SHAPE(batch_size, 1, 1, block_size);
 
     for (int i = 0; i < batch_size; i++)
     {
@@ -60,6 +60,7 @@ riscv_nmsis_nn_status riscv_elementwise_mul_s8(const int8_t *input_1_vect,
                                            const int32_t out_activation_max,
                                            const int32_t block_size)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, 1, block_size);
 
     int32_t loop_count;
     int32_t input_1;
@@ -82,6 +82,7 @@ riscv_nmsis_nn_status riscv_minimum_s8(const nmsis_nn_context *ctx,
                                    int8_t *output_data,
                                    const nmsis_nn_dims *output_dims)
 {
+    RISCV_NN_PROFILE_OP(input_1_dims, output_dims);
     (void)ctx;
     const int32_t output_batch = output_dims->n;
     const int32_t output_height = output_dims->h;
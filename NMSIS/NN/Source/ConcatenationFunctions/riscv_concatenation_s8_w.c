@@ -55,6 +55,7 @@ void riscv_concatenation_s8_w(const int8_t *input,
                             int8_t *output,
                             const uint32_t offset_w)
 {
+    RISCV_NN_PROFILE_SHAPE(input_w, input_y, input_x, input_z);
     const uint32_t input_copy_size = input_x * input_y * input_z * input_w;
 
     output += offset_w * (input_x * input_y * input_z);
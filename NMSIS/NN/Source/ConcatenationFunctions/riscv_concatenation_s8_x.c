@@ -56,6 +56,7 @@ void riscv_concatenation_s8_x(const int8_t *input,
                             const uint16_t output_x,
                             const uint32_t offset_x)
 {
+    RISCV_NN_PROFILE_SHAPE(input_w, input_y, input_x, input_z);
     const uint32_t num_iterations = input_y * input_z * input_w;
 
     output += offset_x;
@@ -56,6 +56,7 @@ void riscv_concatenation_s8_y(const int8_t *input,
                             const uint16_t output_y,
                             const uint32_t offset_y)
 {
+    RISCV_NN_PROFILE_SHAPE(input_w, input_y, input_x, input_z);
     const uint32_t num_iterations = input_z * input_w;
     const uint32_t input_copy_size = input_x * input_y;
     const uint32_t output_stride = input_x * output_y;
@@ -56,6 +56,7 @@ void riscv_concatenation_s8_z(const int8_t *input,
                             const uint16_t output_z,
                             const uint32_t offset_z)
 {
+    RISCV_NN_PROFILE_SHAPE(input_w, input_y, input_x, input_z);
     const uint32_t input_copy_size = input_x * input_y * input_z;
     const uint32_t output_stride = input_x * input_y * output_z;
 
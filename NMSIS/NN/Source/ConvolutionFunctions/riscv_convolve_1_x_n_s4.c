@@ -59,6 +59,7 @@ riscv_nmsis_nn_status riscv_convolve_1_x_n_s4(const nmsis_nn_context *ctx,
                                           const nmsis_nn_dims *output_dims,
                                           int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     riscv_nmsis_nn_status status = RISCV_NMSIS_NN_SUCCESS;
     int32_t buffer_size = riscv_convolve_1_x_n_s4_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
     /* The wrapper API is the ultimate reference for argument check */
@@ -58,6 +58,7 @@ riscv_nmsis_nn_status riscv_convolve_1_x_n_s8(const nmsis_nn_context *ctx,
                                           const nmsis_nn_dims *output_dims,
                                           int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     riscv_nmsis_nn_status status = RISCV_NMSIS_NN_SUCCESS;
 
     /* The wrapper API is the ultimate reference for argument check */
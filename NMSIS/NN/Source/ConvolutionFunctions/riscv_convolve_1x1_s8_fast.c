@@ -59,6 +59,7 @@ riscv_nmsis_nn_status riscv_convolve_1x1_s8_fast(const nmsis_nn_context *ctx,
                                              const nmsis_nn_dims *output_dims,
                                              int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     if (conv_params->padding.w != 0 || conv_params->padding.h != 0 || conv_params->stride.w != 1 ||
         conv_params->stride.h != 1)
     {
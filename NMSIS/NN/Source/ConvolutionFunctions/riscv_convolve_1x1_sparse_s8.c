@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_convolve_1x1_sparse_s8.c
+ * Description:  s8 1x1 convolution with 2:4 structured sparse weights
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 1x1 convolution with 2:4 structured sparse weights, for any stride.
+ *
+ * Refer header file for details.
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_1x1_sparse_s8(const nmsis_nn_context *ctx,
+                                               const nmsis_nn_conv_params *conv_params,
+                                               const nmsis_nn_per_channel_quant_params *quant_params,
+                                               const nmsis_nn_dims *input_dims,
+                                               const int8_t *input_data,
+                                               const nmsis_nn_dims *filter_dims,
+                                               const int8_t *filter_data,
+                                               const uint8_t *filter_index,
+                                               const nmsis_nn_dims *bias_dims,
+                                               const int32_t *bias_data,
+                                               const nmsis_nn_dims *output_dims,
+                                               int8_t *output_data)
+{
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
+    (void)ctx;
+    (void)bias_dims;
+    /* Whole 2:4 groups of input channels, and the packed weights are sized by the filter dimensions */
+    if (conv_params->padding.w != 0 || conv_params->padding.h != 0 || (input_dims->c & 3) != 0 ||
+        filter_dims->c != input_dims->c || filter_dims->w != 1 || filter_dims->h != 1 ||
+        filter_dims->n != output_dims->c)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_ch = output_dims->c;
+    const int32_t stride_w = conv_params->stride.w;
+    const int32_t stride_h = conv_params->stride.h;
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t out_offset = conv_params->output_offset;
+    const int32_t out_activation_min = conv_params->activation.min;
+    const int32_t out_activation_max = conv_params->activation.max;
+    const int32_t num_values = RISCV_NN_SPARSE_VALUES_SIZE(input_ch);
+    const int32_t index_size = RISCV_NN_SPARSE_INDEX_SIZE(input_ch);
+
+    /* With unity strides the output pixels of a batch are processed as a single row */
+    const int32_t unity_stride = (stride_w == 1) && (stride_h == 1);
+    const int32_t row_pixels = unity_stride ? output_dims->w * output_dims->h : output_dims->w;
+    const int32_t rows = unity_stride ? 1 : output_dims->h;
+    const int32_t pixel_stride = stride_w * input_ch;
+    const int32_t input_inc = input_dims->w * stride_h * input_ch;
+
+    for (int32_t i_batch = 0; i_batch < input_dims->n; i_batch++)
+    {
+        const int8_t *input_row = input_data + i_batch * input_dims->w * input_dims->h * input_ch;
+
+        for (int32_t i_row = 0; i_row < rows; i_row++)
+        {
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+            /* Vectorized over the output pixels: every kept weight is multiplied with a strided load of the
+               input channel it belongs to, so only half of the input channels are read */
+            for (int32_t i_out_ch = 0; i_out_ch < output_ch; i_out_ch++)
+            {
+                const int8_t *ker = filter_data + i_out_ch * num_values;
+                const uint8_t *ker_index = filter_index + i_out_ch * index_size;
+                const int32_t bias = bias_data ? bias_data[i_out_ch] : 0;
+                const int32_t out_mult = quant_params->multiplier[i_out_ch];
+                const int32_t out_shift = quant_params->shift[i_out_ch];
+                const int8_t *in = input_row;
+                int8_t *out = output_data + i_out_ch;
+                int32_t blkCnt = row_pixels;
+                size_t l;
+
+                for (; (l = __riscv_vsetvl_e32m4(blkCnt)) > 0; blkCnt -= l)
+                {
+                    vint32m4_t sum = __riscv_vmv_v_x_i32m4(bias, l);
+
+                    for (int32_t i = 0; i < num_values; i++)
+                    {
+                        const int32_t ker_val = ker[i];
+                        if (ker_val == 0)
+                        {
+                            continue;
+                        }
+                        const int32_t col = ((i >> 1) << 2) + ((ker_index[i >> 2] >> ((i & 3) << 1)) & 3);
+                        vint16m2_t in16 = __riscv_vsext_vf2_i16m2(__riscv_vlse8_v_i8m1(in + col, pixel_stride, l), l);
+                        in16 = __riscv_vadd_vx_i16m2(in16, (int16_t)input_offset, l);
+                        sum = __riscv_vwmacc_vx_i32m4(sum, (int16_t)ker_val, in16, l);
+                    }
+
+                    sum = riscv_nn_requantize_m4_rvv(sum, l, out_mult, out_shift);
+                    sum = __riscv_vadd_vx_i32m4(sum, out_offset, l);
+                    sum = __riscv_vmax_vx_i32m4(sum, out_activation_min, l);
+                    sum = __riscv_vmin_vx_i32m4(sum, out_activation_max, l);
+                    __riscv_vsse8_v_i8m1(out,
+                                         output_ch,
+                                         __riscv_vnsra_wx_i8m1(__riscv_vnsra_wx_i16m2(sum, 0, l), 0, l),
+                                         l);
+                    in += l * pixel_stride;
+                    out += l * output_ch;
+                }
+            }
+#else
+            int8_t *out = output_data;
+            for (int32_t i_pixel = 0; i_pixel < row_pixels; i_pixel++)
+            {
+                const int8_t *in = input_row + i_pixel * pixel_stride;
+                const int8_t *ker = filter_data;
+                const uint8_t *ker_index = filter_index;
+
+                for (int32_t i_out_ch = 0; i_out_ch < output_ch; i_out_ch++)
+                {
+                    int32_t sum = bias_data ? bias_data[i_out_ch] : 0;
+                    sum += riscv_nn_sparse_dot_s8(in, ker, ker_index, num_values, input_offset);
+
+                    sum = riscv_nn_requantize(sum, quant_params->multiplier[i_out_ch], quant_params->shift[i_out_ch]);
+                    sum += out_offset;
+                    sum = MAX(sum, out_activation_min);
+                    sum = MIN(sum, out_activation_max);
+                    *out++ = (int8_t)sum;
+
+                    ker += num_values;
+                    ker_index += index_size;
+                }
+            }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+            input_row += input_inc;
+            output_data += row_pixels * output_ch;
+        }
+    }
+
+    /* Return to application */
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
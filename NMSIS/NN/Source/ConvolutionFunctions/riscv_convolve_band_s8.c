@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_convolve_band_s8.c
+ * Description:  s8 convolution of a band of output rows
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNTiling
+ * @{
+ */
+
+/*
+ * s8 convolution of a band of output rows.
+ *
+ * Refer header file for details.
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_band_s8(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_conv_params *conv_params,
+                                         const nmsis_nn_per_channel_quant_params *quant_params,
+                                         const nmsis_nn_dims *input_dims,
+                                         const nmsis_nn_band *input_band,
+                                         const int8_t *input_data,
+                                         const nmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const nmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const nmsis_nn_dims *output_dims,
+                                         const nmsis_nn_band *output_band,
+                                         int8_t *output_data)
+{
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
+    if (output_band->start < 0 || output_band->start + output_band->rows > output_dims->h)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    nmsis_nn_dims view_input_dims;
+    const int8_t *view_input_data;
+    nmsis_nn_conv_params view_conv_params = *conv_params;
+
+    riscv_nmsis_nn_status status = riscv_nn_band_view_s8(input_dims,
+                                                         input_band,
+                                                         input_data,
+                                                         output_band,
+                                                         filter_dims->h,
+                                                         conv_params->stride.h,
+                                                         conv_params->padding.h,
+                                                         conv_params->dilation.h,
+                                                         &view_input_dims,
+                                                         &view_input_data,
+                                                         &view_conv_params.padding.h);
+    if (status != RISCV_NMSIS_NN_SUCCESS)
+    {
+        return status;
+    }
+
+    nmsis_nn_dims view_output_dims = *output_dims;
+    view_output_dims.n = 1;
+    view_output_dims.h = output_band->rows;
+
+    return riscv_convolve_wrapper_s8(ctx,
+                                     &view_conv_params,
+                                     quant_params,
+                                     &view_input_dims,
+                                     view_input_data,
+                                     filter_dims,
+                                     filter_data,
+                                     bias_dims,
+                                     bias_data,
+                                     &view_output_dims,
+                                     output_data);
+}
+
+/**
+ * @} end of NNTiling group
+ */
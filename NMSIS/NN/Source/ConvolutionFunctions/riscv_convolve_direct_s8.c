@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_convolve_direct_s8.c
+ * Description:  s8 im2col free convolution for few input channels
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+#if !defined(RISCV_MATH_VECTOR_ZVE32X)
+/*
+ * Compute the output pixels [x_start, x_end) of one output row for all the output channels. The kernel rows
+ * [ker_y_start, ker_y_end) are inside the input, the kernel columns are checked against the left and right padding.
+ */
+static void riscv_nn_conv_direct_pixels_s8(const nmsis_nn_conv_params *conv_params,
+                                           const nmsis_nn_per_channel_quant_params *quant_params,
+                                           const nmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const nmsis_nn_dims *filter_dims,
+                                           const int8_t *filter_data,
+                                           const int32_t *bias_data,
+                                           const int32_t output_ch,
+                                           const int32_t base_idx_y,
+                                           const int32_t ker_y_start,
+                                           const int32_t ker_y_end,
+                                           const int32_t x_start,
+                                           const int32_t x_end,
+                                           int8_t *output_row)
+{
+    const int32_t input_x = input_dims->w;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_size = filter_dims->h * kernel_x * input_ch;
+    const int32_t input_offset = conv_params->input_offset;
+
+    for (int32_t i_out_x = x_start; i_out_x < x_end; i_out_x++)
+    {
+        const int32_t base_idx_x = i_out_x * conv_params->stride.w - conv_params->padding.w;
+        int8_t *out = output_row + i_out_x * output_ch;
+
+        for (int32_t i_out_ch = 0; i_out_ch < output_ch; i_out_ch++)
+        {
+            const int8_t *ker = filter_data + i_out_ch * kernel_size;
+            int32_t sum = bias_data ? bias_data[i_out_ch] : 0;
+
+            for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+            {
+                const int32_t k_y = base_idx_y + i_ker_y * conv_params->dilation.h;
+
+                for (int32_t i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+                {
+                    const int32_t k_x = base_idx_x + i_ker_x * conv_params->dilation.w;
+                    if (k_x < 0 || k_x >= input_x)
+                    {
+                        continue;
+                    }
+
+                    const int8_t *in = input_data + (k_y * input_x + k_x) * input_ch;
+                    const int8_t *ker_ch = ker + (i_ker_y * kernel_x + i_ker_x) * input_ch;
+                    for (int32_t i_ch = 0; i_ch < input_ch; i_ch++)
+                    {
+                        sum += (in[i_ch] + input_offset) * ker_ch[i_ch];
+                    }
+                }
+            }
+
+            sum = riscv_nn_requantize(sum, quant_params->multiplier[i_out_ch], quant_params->shift[i_out_ch]);
+            sum += conv_params->output_offset;
+            sum = MAX(sum, conv_params->activation.min);
+            sum = MIN(sum, conv_params->activation.max);
+            *out++ = (int8_t)sum;
+        }
+    }
+}
+
+#else
+/* Output pixels computed together, the weights of a kernel tap are loaded once for all of them */
+    #define CONV_DIRECT_TILE_X (4)
+
+/* riscv_nn_requantize() of each lane with its own multiplier and shift, the per channel quantization */
+__STATIC_FORCEINLINE vint32m2_t riscv_nn_conv_direct_requantize_m2(vint32m2_t val,
+                                                                  const int32_t *multiplier,
+                                                                  const int32_t *shift,
+                                                                  size_t l)
+{
+    const vint32m2_t vshift = __riscv_vle32_v_i32m2(shift, l);
+    const vuint32m2_t left = __riscv_vreinterpret_v_i32m2_u32m2(__riscv_vmax_vx_i32m2(vshift, 0, l));
+    const vuint32m2_t right =
+        __riscv_vreinterpret_v_i32m2_u32m2(__riscv_vmax_vx_i32m2(__riscv_vneg_v_i32m2(vshift, l), 0, l));
+
+    val = __riscv_vsll_vv_i32m2(val, left, l);
+    val = __riscv_vsmul_vv_i32m2(val, __riscv_vle32_v_i32m2(multiplier, l), __RISCV_VXRM_RNU, l);
+
+    /* riscv_nn_divide_by_power_of_two(): round half away from zero */
+    const vint32m2_t remainder_mask = __riscv_vsub_vx_i32m2(__riscv_vsll_vv_i32m2(__riscv_vmv_v_x_i32m2(1, l), right, l), 1, l);
+    const vint32m2_t remainder = __riscv_vand_vv_i32m2(val, remainder_mask, l);
+    vint32m2_t threshold = __riscv_vsra_vx_i32m2(remainder_mask, 1, l);
+    val = __riscv_vsra_vv_i32m2(val, right, l);
+    vbool16_t mask = __riscv_vmslt_vx_i32m2_b16(val, 0, l);
+    threshold = __riscv_vadd_vx_i32m2_tumu(mask, threshold, threshold, 1, l);
+    mask = __riscv_vmsgt_vv_i32m2_b16(remainder, threshold, l);
+    return __riscv_vadd_vx_i32m2_tumu(mask, val, val, 1, l);
+}
+
+__STATIC_FORCEINLINE void riscv_nn_conv_direct_store_m2(vint32m2_t sum,
+                                                        const nmsis_nn_conv_params *conv_params,
+                                                        const nmsis_nn_per_channel_quant_params *quant_params,
+                                                        const int32_t i_out_ch,
+                                                        int8_t *out,
+                                                        size_t l)
+{
+    sum = riscv_nn_conv_direct_requantize_m2(sum, quant_params->multiplier + i_out_ch, quant_params->shift + i_out_ch, l);
+    sum = __riscv_vadd_vx_i32m2(sum, conv_params->output_offset, l);
+    sum = __riscv_vmax_vx_i32m2(sum, conv_params->activation.min, l);
+    sum = __riscv_vmin_vx_i32m2(sum, conv_params->activation.max, l);
+    __riscv_vse8_v_i8mf2(out, __riscv_vnsra_wx_i8mf2(__riscv_vnsra_wx_i16m1(sum, 0, l), 0, l), l);
+}
+
+/*
+ * Compute up to CONV_DIRECT_TILE_X output pixels starting at x_start, vectorized over the output channels: each
+ * kernel tap is a strided load of the weights of all the output channels, multiplied by the scalar input value
+ * of each pixel. Taps in the left or right padding are skipped per pixel, the results are stored contiguously.
+ */
+static void riscv_nn_conv_direct_tile_s8(const nmsis_nn_conv_params *conv_params,
+                                         const nmsis_nn_per_channel_quant_params *quant_params,
+                                         const nmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const nmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const int32_t *bias_data,
+                                         const int32_t output_ch,
+                                         const int32_t base_idx_y,
+                                         const int32_t ker_y_start,
+                                         const int32_t ker_y_end,
+                                         const int32_t x_start,
+                                         const int32_t num_x,
+                                         int8_t *output_row)
+{
+    const int32_t input_x = input_dims->w;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_x = filter_dims->w;
+    const int32_t kernel_size = filter_dims->h * kernel_x * input_ch;
+    const int32_t input_offset = conv_params->input_offset;
+    const int32_t stride_x = conv_params->stride.w;
+    const int32_t base_idx_x = x_start * stride_x - conv_params->padding.w;
+    int32_t blkCnt = output_ch;
+    int32_t i_out_ch = 0;
+    size_t l;
+
+    for (; (l = __riscv_vsetvl_e32m2(blkCnt)) > 0; blkCnt -= l, i_out_ch += l)
+    {
+        vint32m2_t sum0, sum1, sum2, sum3;
+        if (bias_data)
+        {
+            sum0 = __riscv_vle32_v_i32m2(bias_data + i_out_ch, l);
+        }
+        else
+        {
+            sum0 = __riscv_vmv_v_x_i32m2(0, l);
+        }
+        sum1 = sum0;
+        sum2 = sum0;
+        sum3 = sum0;
+
+        for (int32_t i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+        {
+            const int8_t *in_row = input_data + (base_idx_y + i_ker_y * conv_params->dilation.h) * input_x * input_ch;
+
+            for (int32_t i_ker_x = 0; i_ker_x < kernel_x; i_ker_x++)
+            {
+                const int8_t *ker = filter_data + i_out_ch * kernel_size + (i_ker_y * kernel_x + i_ker_x) * input_ch;
+                const int32_t k_x = base_idx_x + i_ker_x * conv_params->dilation.w;
+                /* Input of each pixel of the tile for this tap, NULL in the padding or after the tile */
+                const int8_t *in0 = (k_x >= 0 && k_x < input_x) ? in_row + k_x * input_ch : NULL;
+                const int8_t *in1 = (num_x > 1 && k_x + stride_x >= 0 && k_x + stride_x < input_x)
+                    ? in_row + (k_x + stride_x) * input_ch
+                    : NULL;
+                const int8_t *in2 = (num_x > 2 && k_x + 2 * stride_x >= 0 && k_x + 2 * stride_x < input_x)
+                    ? in_row + (k_x + 2 * stride_x) * input_ch
+                    : NULL;
+                const int8_t *in3 = (num_x > 3 && k_x + 3 * stride_x >= 0 && k_x + 3 * stride_x < input_x)
+                    ? in_row + (k_x + 3 * stride_x) * input_ch
+                    : NULL;
+
+                for (int32_t i_ch = 0; i_ch < input_ch; i_ch++)
+                {
+                    const vint16m1_t ker16 =
+                        __riscv_vsext_vf2_i16m1(__riscv_vlse8_v_i8mf2(ker + i_ch, kernel_size, l), l);
+                    if (in0)
+                    {
+                        sum0 = __riscv_vwmacc_vx_i32m2(sum0, (int16_t)(in0[i_ch] + input_offset), ker16, l);
+                    }
+                    if (in1)
+                    {
+                        sum1 = __riscv_vwmacc_vx_i32m2(sum1, (int16_t)(in1[i_ch] + input_offset), ker16, l);
+                    }
+                    if (in2)
+                    {
+                        sum2 = __riscv_vwmacc_vx_i32m2(sum2, (int16_t)(in2[i_ch] + input_offset), ker16, l);
+                    }
+                    if (in3)
+                    {
+                        sum3 = __riscv_vwmacc_vx_i32m2(sum3, (int16_t)(in3[i_ch] + input_offset), ker16, l);
+                    }
+                }
+            }
+        }
+
+        int8_t *out = output_row + x_start * output_ch + i_out_ch;
+        riscv_nn_conv_direct_store_m2(sum0, conv_params, quant_params, i_out_ch, out, l);
+        if (num_x > 1)
+        {
+            riscv_nn_conv_direct_store_m2(sum1, conv_params, quant_params, i_out_ch, out + output_ch, l);
+        }
+        if (num_x > 2)
+        {
+            riscv_nn_conv_direct_store_m2(sum2, conv_params, quant_params, i_out_ch, out + 2 * output_ch, l);
+        }
+        if (num_x > 3)
+        {
+            riscv_nn_conv_direct_store_m2(sum3, conv_params, quant_params, i_out_ch, out + 3 * output_ch, l);
+        }
+    }
+}
+#endif /* !defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 im2col free convolution for few input channels.
+ *
+ * Refer header file for details.
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_direct_s8(const nmsis_nn_context *ctx,
+                                           const nmsis_nn_conv_params *conv_params,
+                                           const nmsis_nn_per_channel_quant_params *quant_params,
+                                           const nmsis_nn_dims *input_dims,
+                                           const int8_t *input_data,
+                                           const nmsis_nn_dims *filter_dims,
+                                           const int8_t *filter_data,
+                                           const nmsis_nn_dims *bias_dims,
+                                           const int32_t *bias_data,
+                                           const nmsis_nn_dims *output_dims,
+                                           int8_t *output_data)
+{
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
+    (void)ctx;
+    (void)bias_dims;
+
+    if (input_dims->c > CONV_DIRECT_MAX_INPUT_CH || input_dims->c != filter_dims->c)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t kernel_y = filter_dims->h;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+    const int32_t stride_y = conv_params->stride.h;
+    const int32_t pad_y = conv_params->padding.h;
+    const int32_t dilation_y = conv_params->dilation.h;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            const int32_t base_idx_y = i_out_y * stride_y - pad_y;
+            /* Kernel rows falling into the padding add nothing and are skipped */
+            const int32_t ker_y_start = base_idx_y < 0 ? (-base_idx_y + dilation_y - 1) / dilation_y : 0;
+            const int32_t ker_y_end =
+                base_idx_y >= input_y ? 0 : MIN(kernel_y, (input_y - base_idx_y + dilation_y - 1) / dilation_y);
+            int8_t *output_row = output_data + i_out_y * output_x * output_ch;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+            for (int32_t i_out_x = 0; i_out_x < output_x; i_out_x += CONV_DIRECT_TILE_X)
+            {
+                riscv_nn_conv_direct_tile_s8(conv_params,
+                                             quant_params,
+                                             input_dims,
+                                             input_data,
+                                             filter_dims,
+                                             filter_data,
+                                             bias_data,
+                                             output_ch,
+                                             base_idx_y,
+                                             ker_y_start,
+                                             ker_y_end,
+                                             i_out_x,
+                                             MIN(CONV_DIRECT_TILE_X, output_x - i_out_x),
+                                             output_row);
+            }
+#else
+            riscv_nn_conv_direct_pixels_s8(conv_params,
+                                           quant_params,
+                                           input_dims,
+                                           input_data,
+                                           filter_dims,
+                                           filter_data,
+                                           bias_data,
+                                           output_ch,
+                                           base_idx_y,
+                                           ker_y_start,
+                                           ker_y_end,
+                                           0,
+                                           output_x,
+                                           output_row);
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+        }
+
+        /* Advance to the next batch */
+        input_data += input_x * input_y * input_ch;
+        output_data += output_x * output_y * output_ch;
+    }
+
+    /* Return to application */
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -52,6 +52,31 @@ int32_t riscv_convolve_s8_get_buffer_size(const nmsis_nn_dims *input_dims, const
     return (2 * aligned_rhs_cols) * (int32_t)sizeof(int16_t);
 }
 
+int32_t riscv_convolve_pool_s8_get_buffer_size(const nmsis_nn_dims *input_dims,
+                                             const nmsis_nn_dims *filter_dims,
+                                             const nmsis_nn_dims *output_dims)
+{
+    /* im2col buffer of riscv_convolve_s8 and two rows of convolution output */
+    return riscv_convolve_s8_get_buffer_size(input_dims, filter_dims) + 2 * (2 * output_dims->w) * output_dims->c;
+}
+
+int32_t riscv_convolve_band_s8_get_buffer_size(const nmsis_nn_conv_params *conv_params,
+                                             const nmsis_nn_dims *input_dims,
+                                             const nmsis_nn_dims *filter_dims,
+                                             const nmsis_nn_dims *output_dims)
+{
+    /* Bands away from the top edge have no top padding and may select another kernel in the wrapper */
+    nmsis_nn_conv_params inner_conv_params = *conv_params;
+    inner_conv_params.padding.h = 0;
+
+    const int32_t edge_size =
+        riscv_convolve_wrapper_s8_get_buffer_size(conv_params, input_dims, filter_dims, output_dims);
+    const int32_t inner_size =
+        riscv_convolve_wrapper_s8_get_buffer_size(&inner_conv_params, input_dims, filter_dims, output_dims);
+
+    return MAX(edge_size, inner_size);
+}
+
 int32_t riscv_convolve_1_x_n_s8_get_buffer_size(const nmsis_nn_conv_params *conv_params,
                                               const nmsis_nn_dims *input_dims,
                                               const nmsis_nn_dims *filter_dims,
@@ -86,6 +111,11 @@ int32_t riscv_convolve_wrapper_s8_get_buffer_size(const nmsis_nn_conv_params *co
                                                 const nmsis_nn_dims *filter_dims,
                                                 const nmsis_nn_dims *output_dims)
 {
+    if (USE_CONV_DIRECT_S8_FUNCTION(conv_params, input_dims, filter_dims))
+    {
+        /* riscv_convolve_direct_s8 needs no buffer */
+        return 0;
+    }
 #if defined(RISCV_MATH_DSP)
     return riscv_convolve_wrapper_s8_get_buffer_size_dsp(conv_params, input_dims, filter_dims, output_dims);
 #else
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_convolve_pool_s8.c
+ * Description:  s8 convolution fused with a 2x2 max or average pooling
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+/*
+ * Pool two rows of conv output [conv_x, ch] with a 2x2 window and stride 2 into one row of [output_x, ch].
+ * The conv output is already clamped to the activation range, so is the pooled result.
+ */
+static void riscv_nn_pool_2x2_rows_s8(const int8_t *row_0,
+                                      const int8_t *row_1,
+                                      const int32_t output_x,
+                                      const int32_t ch,
+                                      const riscv_nn_pool_type pool_type,
+                                      int8_t *dst)
+{
+    for (int32_t i_x = 0; i_x < output_x; i_x++)
+    {
+        const int8_t *p0 = row_0 + 2 * i_x * ch;
+        const int8_t *p1 = row_1 + 2 * i_x * ch;
+        int32_t blkCnt = ch;
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+        size_t l;
+        if (pool_type == RISCV_NN_POOL_MAX)
+        {
+            for (; (l = __riscv_vsetvl_e8m4(blkCnt)) > 0; blkCnt -= l)
+            {
+                vint8m4_t va = __riscv_vmax_vv_i8m4(__riscv_vle8_v_i8m4(p0, l), __riscv_vle8_v_i8m4(p0 + ch, l), l);
+                vint8m4_t vb = __riscv_vmax_vv_i8m4(__riscv_vle8_v_i8m4(p1, l), __riscv_vle8_v_i8m4(p1 + ch, l), l);
+                __riscv_vse8_v_i8m4(dst, __riscv_vmax_vv_i8m4(va, vb, l), l);
+                p0 += l;
+                p1 += l;
+                dst += l;
+            }
+        }
+        else
+        {
+            for (; (l = __riscv_vsetvl_e8m2(blkCnt)) > 0; blkCnt -= l)
+            {
+                vint16m4_t vsum = __riscv_vwadd_vv_i16m4(__riscv_vle8_v_i8m2(p0, l), __riscv_vle8_v_i8m2(p0 + ch, l), l);
+                vsum = __riscv_vwadd_wv_i16m4(vsum, __riscv_vle8_v_i8m2(p1, l), l);
+                vsum = __riscv_vwadd_wv_i16m4(vsum, __riscv_vle8_v_i8m2(p1 + ch, l), l);
+                /* Round half away from zero, same as riscv_avgpool_s8 */
+                vbool4_t mask = __riscv_vmsgt_vx_i16m4_b4(vsum, 0, l);
+                vsum = __riscv_vmerge_vvm_i16m4(__riscv_vsub_vx_i16m4(vsum, 2, l), __riscv_vadd_vx_i16m4(vsum, 2, l), mask, l);
+                vsum = __riscv_vdiv_vx_i16m4(vsum, 4, l);
+                __riscv_vse8_v_i8m2(dst, __riscv_vnsra_wx_i8m2(vsum, 0, l), l);
+                p0 += l;
+                p1 += l;
+                dst += l;
+            }
+        }
+#else
+        if (pool_type == RISCV_NN_POOL_MAX)
+        {
+            while (blkCnt > 0)
+            {
+                const int32_t max_0 = MAX(p0[0], p0[ch]);
+                const int32_t max_1 = MAX(p1[0], p1[ch]);
+                *dst++ = (int8_t)MAX(max_0, max_1);
+                p0++;
+                p1++;
+                blkCnt--;
+            }
+        }
+        else
+        {
+            while (blkCnt > 0)
+            {
+                int32_t sum = p0[0] + p0[ch] + p1[0] + p1[ch];
+                sum = sum > 0 ? (sum + 2) / 4 : (sum - 2) / 4;
+                *dst++ = (int8_t)sum;
+                p0++;
+                p1++;
+                blkCnt--;
+            }
+        }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+    }
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+ * s8 convolution fused with 2x2 pooling.
+ *
+ * Refer header file for details.
+ *
+ */
+riscv_nmsis_nn_status riscv_convolve_pool_s8(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_conv_params *conv_params,
+                                         const nmsis_nn_per_channel_quant_params *quant_params,
+                                         const riscv_nn_pool_type pool_type,
+                                         const nmsis_nn_dims *input_dims,
+                                         const int8_t *input_data,
+                                         const nmsis_nn_dims *filter_dims,
+                                         const int8_t *filter_data,
+                                         const nmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const nmsis_nn_dims *output_dims,
+                                         int8_t *output_data)
+{
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
+    if (ctx->buf == NULL)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+    if (pool_type != RISCV_NN_POOL_MAX && pool_type != RISCV_NN_POOL_AVG)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    const int32_t input_batches = input_dims->n;
+    const int32_t input_x = input_dims->w;
+    const int32_t input_y = input_dims->h;
+    const int32_t input_ch = input_dims->c;
+    const int32_t output_x = output_dims->w;
+    const int32_t output_y = output_dims->h;
+    const int32_t output_ch = output_dims->c;
+    const int32_t stride_y = conv_params->stride.h;
+    const int32_t pad_y = conv_params->padding.h;
+
+    /* Only the conv output rows and columns covered by the VALID 2x2 pooling window are computed */
+    const int32_t conv_x = output_x * 2;
+    const int32_t conv_row_size = conv_x * output_ch;
+
+    /* The im2col buffer of riscv_convolve_s8 comes first, followed by the two row ring buffer */
+    int8_t *ring_buf = (int8_t *)ctx->buf + riscv_convolve_s8_get_buffer_size(input_dims, filter_dims);
+    nmsis_nn_context conv_ctx = {ctx->buf, riscv_convolve_s8_get_buffer_size(input_dims, filter_dims)};
+
+    nmsis_nn_conv_params row_conv_params = *conv_params;
+    nmsis_nn_dims row_input_dims = *input_dims;
+    nmsis_nn_dims row_output_dims = {1, 1, conv_x, output_ch};
+    row_input_dims.n = 1;
+
+    for (int32_t i_batch = 0; i_batch < input_batches; i_batch++)
+    {
+        for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y++)
+        {
+            for (int32_t i_row = 0; i_row < 2; i_row++)
+            {
+                const int32_t base_idx_y = (2 * i_out_y + i_row) * stride_y - pad_y;
+                const int8_t *row_input = input_data;
+
+                /* Present the input as a tensor starting at the first row used by this conv output row, with
+                   the remaining top padding. Bottom padding is handled by riscv_convolve_s8 itself. */
+                if (base_idx_y >= 0)
+                {
+                    row_input += base_idx_y * input_x * input_ch;
+                    row_input_dims.h = input_y - base_idx_y;
+                    row_conv_params.padding.h = 0;
+                }
+                else
+                {
+                    row_input_dims.h = input_y;
+                    row_conv_params.padding.h = -base_idx_y;
+                }
+
+                riscv_nmsis_nn_status status = riscv_convolve_s8(&conv_ctx,
+                                                                 &row_conv_params,
+                                                                 quant_params,
+                                                                 &row_input_dims,
+                                                                 row_input,
+                                                                 filter_dims,
+                                                                 filter_data,
+                                                                 bias_dims,
+                                                                 bias_data,
+                                                                 NULL,
+                                                                 &row_output_dims,
+                                                                 ring_buf + i_row * conv_row_size);
+                if (status != RISCV_NMSIS_NN_SUCCESS)
+                {
+                    return status;
+                }
+            }
+
+            riscv_nn_pool_2x2_rows_s8(ring_buf, ring_buf + conv_row_size, output_x, output_ch, pool_type, output_data);
+            output_data += output_x * output_ch;
+        }
+
+        /* Advance to the next batch */
+        input_data += input_x * input_y * input_ch;
+    }
+
+    /* Return to application */
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -60,6 +60,7 @@ riscv_nmsis_nn_status riscv_convolve_s8(const nmsis_nn_context *ctx,
                                     const nmsis_nn_dims *output_dims,
                                     int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     (void)bias_dims;
 
     if (ctx->buf == NULL)
@@ -31,6 +31,7 @@
  * -------------------------------------------------------------------- */
 
 #include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
 
 /**
  *  @ingroup Public
@@ -60,6 +61,7 @@ riscv_nmsis_nn_status riscv_convolve_wrapper_s16(const nmsis_nn_context *ctx,
                                              const nmsis_nn_dims *output_dims,
                                              int16_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     return riscv_convolve_s16(ctx,
                             conv_params,
                             quant_params,
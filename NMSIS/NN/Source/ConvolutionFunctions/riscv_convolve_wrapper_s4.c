@@ -31,6 +31,7 @@
  * -------------------------------------------------------------------- */
 
 #include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
 
 /**
  *  @ingroup Public
@@ -60,6 +61,7 @@ riscv_nmsis_nn_status riscv_convolve_wrapper_s4(const nmsis_nn_context *ctx,
                                             const nmsis_nn_dims *output_dims,
                                             int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     if ((conv_params->padding.w == 0) && (conv_params->padding.h == 0) && (filter_dims->w == 1) &&
         (filter_dims->h == 1) && (conv_params->dilation.w == 1 && conv_params->dilation.h == 1))
     {
@@ -62,6 +62,7 @@ riscv_nmsis_nn_status riscv_depthwise_conv_3x3_s8(const nmsis_nn_context *ctx,
                                               const nmsis_nn_dims *output_dims,
                                               int8_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     (void)ctx;
     (void)bias_dims;
 
@@ -100,6 +100,14 @@ int32_t riscv_depthwise_conv_wrapper_s8_get_buffer_size_dsp(const nmsis_nn_dw_co
     return size;
 }
 
+int32_t riscv_depthwise_conv_band_s8_get_buffer_size(const nmsis_nn_dw_conv_params *dw_conv_params,
+                                                   const nmsis_nn_dims *input_dims,
+                                                   const nmsis_nn_dims *filter_dims,
+                                                   const nmsis_nn_dims *output_dims)
+{
+    /* The top padding of a band never exceeds the one of the full tensor, so the wrapper needs at most this */
+    return riscv_depthwise_conv_wrapper_s8_get_buffer_size(dw_conv_params, input_dims, filter_dims, output_dims);
+}
 
 /**
  * @} end of GetBufferSizeNNConv group
@@ -251,6 +251,7 @@ riscv_nmsis_nn_status riscv_depthwise_conv_s16(const nmsis_nn_context *ctx,
                                            const nmsis_nn_dims *output_dims,
                                            int16_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     const uint16_t dilation_x = dw_conv_params->dilation.w;
     const uint16_t dilation_y = dw_conv_params->dilation.h;
 
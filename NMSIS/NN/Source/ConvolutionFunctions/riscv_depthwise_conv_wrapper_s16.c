@@ -60,6 +60,7 @@ riscv_nmsis_nn_status riscv_depthwise_conv_wrapper_s16(const nmsis_nn_context *c
                                                    const nmsis_nn_dims *output_dims,
                                                    int16_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     riscv_nmsis_nn_status status = RISCV_NMSIS_NN_SUCCESS;
 
     if (USE_FAST_DW_CONV_S16_FUNCTION(dw_conv_params, filter_dims, input_dims))
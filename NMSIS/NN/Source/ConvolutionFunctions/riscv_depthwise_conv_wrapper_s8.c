@@ -60,6 +60,7 @@ riscv_nmsis_nn_status riscv_depthwise_conv_wrapper_s8(const nmsis_nn_context *ct
                                                   const nmsis_nn_dims *output_dims,
                                                   int8_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     riscv_nmsis_nn_status status = RISCV_NMSIS_NN_SUCCESS;
     if (1 == dw_conv_params->ch_mult && input_dims->n == 1 && dw_conv_params->dilation.w == 1 &&
         dw_conv_params->dilation.h == 1)
@@ -61,6 +61,7 @@ riscv_nmsis_nn_status riscv_transpose_conv_wrapper_s8(const nmsis_nn_context *ct
                                                   const nmsis_nn_dims *output_dims,
                                                   int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
 
     if (ctx->buf == NULL)
     {
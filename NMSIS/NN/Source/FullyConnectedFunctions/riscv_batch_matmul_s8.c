@@ -54,6 +54,7 @@ riscv_nmsis_nn_status riscv_batch_matmul_s8(const nmsis_nn_context *ctx,
                                         const nmsis_nn_dims *output_dims,
                                         int8_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_lhs_dims, output_dims);
     (void)ctx;
     const int32_t output_batch = output_dims->n;
     const int32_t output_height = output_dims->h;
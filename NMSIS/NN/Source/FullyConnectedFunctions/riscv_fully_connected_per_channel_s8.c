@@ -59,6 +59,7 @@ riscv_nmsis_nn_status riscv_fully_connected_per_channel_s8(const nmsis_nn_contex
                                                        const nmsis_nn_dims *output_dims,
                                                        int8_t *output_data)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     (void)bias_dims;
 
     int32_t batch_cnt = input_dims->n;
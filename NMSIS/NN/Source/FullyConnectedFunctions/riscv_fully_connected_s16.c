@@ -59,6 +59,7 @@ riscv_nmsis_nn_status riscv_fully_connected_s16(const nmsis_nn_context *ctx,
                                             const nmsis_nn_dims *output_dims,
                                             int16_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     (void)bias_dims;
     (void)ctx;
     (void)fc_params->filter_offset;
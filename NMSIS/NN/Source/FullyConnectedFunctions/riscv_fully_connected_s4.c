@@ -60,6 +60,7 @@ riscv_nmsis_nn_status riscv_fully_connected_s4(const nmsis_nn_context *ctx,
                                            const nmsis_nn_dims *output_dims,
                                            int8_t *output)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     (void)bias_dims;
     (void)ctx;
     (void)fc_params->filter_offset;
@@ -54,6 +54,7 @@ riscv_nmsis_nn_status riscv_vector_sum_s8(int32_t *vector_sum_buf,
                                       const int32_t rhs_offset,
                                       const int32_t *bias_data)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, vector_rows, vector_cols);
 
     if (bias_data)
     {
@@ -53,6 +53,7 @@ riscv_nmsis_nn_status riscv_vector_sum_s8_s64(int64_t *vector_sum_buf,
                                           const int32_t lhs_offset,
                                           const int64_t *bias_data)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, vector_rows, vector_cols);
 
     if (bias_data)
     {
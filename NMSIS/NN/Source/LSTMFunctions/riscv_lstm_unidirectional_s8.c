@@ -52,6 +52,7 @@ riscv_nmsis_nn_status riscv_lstm_unidirectional_s8(const int8_t *input,
                                                const nmsis_nn_lstm_params *params,
                                                nmsis_nn_lstm_context *buffers)
 {
+    RISCV_NN_PROFILE_SHAPE(params->batch_size, params->time_steps, 1, params->input_size);
 
     int8_t *hidden_in = NULL;
     memset(buffers->cell_state, 0, params->batch_size * params->hidden_size * sizeof(int16_t));
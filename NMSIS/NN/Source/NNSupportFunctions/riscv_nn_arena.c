@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_nn_arena.c
+ * Description:  Tensor arena allocator for activation and scratch buffers
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNArena
+ * @{
+ */
+
+static void riscv_nn_arena_update_peak(nmsis_nn_arena *arena)
+{
+    const int32_t used = arena->head + (arena->size - arena->tail);
+    arena->peak = MAX(arena->peak, used);
+}
+
+riscv_nmsis_nn_status riscv_nn_arena_init(nmsis_nn_arena *arena, void *buf, int32_t size)
+{
+    if (arena == NULL || buf == NULL || size <= 0)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    const uintptr_t start = (uintptr_t)buf;
+    /* Rounding up would wrap around at the end of the address space */
+    if (start > UINTPTR_MAX - (RISCV_NN_ARENA_ALIGNMENT - 1))
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+    const uintptr_t aligned_start = RISCV_NN_ARENA_ALIGN(start);
+    const int32_t skip = (int32_t)(aligned_start - start);
+
+    if (size <= skip)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    arena->base = (int8_t *)aligned_start;
+    /* Keep the end aligned too, so that every scratch buffer starts on an aligned address */
+    arena->size = (size - skip) & ~(RISCV_NN_ARENA_ALIGNMENT - 1);
+    arena->head = 0;
+    arena->tail = arena->size;
+    arena->peak = 0;
+
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+void riscv_nn_arena_reset(nmsis_nn_arena *arena)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+    arena->head = 0;
+    arena->tail = arena->size;
+}
+
+void *riscv_nn_arena_alloc(nmsis_nn_arena *arena, int32_t size)
+{
+    /* The free size is a multiple of the alignment, so checking the size before rounding it up
+     * is enough and avoids the overflow of the rounding for sizes close to INT32_MAX */
+    if (arena == NULL || size < 0 || size > arena->tail - arena->head)
+    {
+        return NULL;
+    }
+
+    const int32_t aligned_size = RISCV_NN_ARENA_ALIGN(size);
+
+    int8_t *ptr = arena->base + arena->head;
+    arena->head += aligned_size;
+    riscv_nn_arena_update_peak(arena);
+
+    return ptr;
+}
+
+void *riscv_nn_arena_push(nmsis_nn_arena *arena, int32_t size)
+{
+    /* Checked before the rounding, see riscv_nn_arena_alloc() */
+    if (arena == NULL || size < 0 || size > arena->tail - arena->head)
+    {
+        return NULL;
+    }
+
+    const int32_t aligned_size = RISCV_NN_ARENA_ALIGN(size);
+
+    arena->tail -= aligned_size;
+    riscv_nn_arena_update_peak(arena);
+
+    return arena->base + arena->tail;
+}
+
+int32_t riscv_nn_arena_get_mark(const nmsis_nn_arena *arena)
+{
+    if (arena == NULL)
+    {
+        return 0;
+    }
+    return arena->tail;
+}
+
+riscv_nmsis_nn_status riscv_nn_arena_pop(nmsis_nn_arena *arena, int32_t mark)
+{
+    if (arena == NULL || mark < arena->tail || mark > arena->size)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+    arena->tail = mark;
+
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+riscv_nmsis_nn_status riscv_nn_arena_get_context(nmsis_nn_arena *arena, int32_t size, nmsis_nn_context *ctx)
+{
+    ctx->buf = NULL;
+    ctx->size = 0;
+
+    if (size > 0)
+    {
+        ctx->buf = riscv_nn_arena_push(arena, size);
+        if (ctx->buf == NULL)
+        {
+            return RISCV_NMSIS_NN_ARG_ERROR;
+        }
+        ctx->size = size;
+    }
+
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+int32_t riscv_nn_arena_get_free_size(const nmsis_nn_arena *arena)
+{
+    if (arena == NULL)
+    {
+        return 0;
+    }
+    return arena->tail - arena->head;
+}
+
+int32_t riscv_nn_arena_get_peak_size(const nmsis_nn_arena *arena)
+{
+    if (arena == NULL)
+    {
+        return 0;
+    }
+    return arena->peak;
+}
+
+/**
+ * @} end of NNArena group
+ */
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_nn_band_chain_s8.c
+ * Description:  Tiled (row band) execution of a chain of s8 convolution and pooling layers
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+#define RISCV_NN_BAND_ALIGN(x) (((x) + 3) & ~3)
+
+static void riscv_nn_band_layer_input_band(const nmsis_nn_band_layer *layer,
+                                           const nmsis_nn_band *output_band,
+                                           nmsis_nn_band *input_band)
+{
+    int32_t stride_y;
+    int32_t pad_y;
+    int32_t dilation_y = 1;
+
+    switch (layer->type)
+    {
+    case RISCV_NN_BAND_CONV:
+        stride_y = layer->conv_params->stride.h;
+        pad_y = layer->conv_params->padding.h;
+        dilation_y = layer->conv_params->dilation.h;
+        break;
+    case RISCV_NN_BAND_DW_CONV:
+        stride_y = layer->dw_conv_params->stride.h;
+        pad_y = layer->dw_conv_params->padding.h;
+        dilation_y = layer->dw_conv_params->dilation.h;
+        break;
+    default:
+        stride_y = layer->pool_params->stride.h;
+        pad_y = layer->pool_params->padding.h;
+        break;
+    }
+
+    riscv_nn_band_get_input_band(
+        output_band, layer->input_dims.h, layer->filter_dims.h, stride_y, pad_y, dilation_y, input_band);
+}
+
+/* Rows of the output of layer idx needed to compute the rows last_band of the output of the chain */
+static void riscv_nn_band_chain_layer_band(const nmsis_nn_band_layer *layers,
+                                           const int32_t num_layers,
+                                           const int32_t idx,
+                                           const nmsis_nn_band *last_band,
+                                           nmsis_nn_band *band)
+{
+    nmsis_nn_band input_band;
+
+    *band = *last_band;
+    for (int32_t i = num_layers - 1; i > idx; i--)
+    {
+        riscv_nn_band_layer_input_band(&layers[i], band, &input_band);
+        *band = input_band;
+    }
+}
+
+static int32_t riscv_nn_band_layer_get_buffer_size(const nmsis_nn_band_layer *layer)
+{
+    switch (layer->type)
+    {
+    case RISCV_NN_BAND_CONV:
+        return riscv_convolve_band_s8_get_buffer_size(
+            layer->conv_params, &layer->input_dims, &layer->filter_dims, &layer->output_dims);
+    case RISCV_NN_BAND_DW_CONV:
+        return riscv_depthwise_conv_band_s8_get_buffer_size(
+            layer->dw_conv_params, &layer->input_dims, &layer->filter_dims, &layer->output_dims);
+    case RISCV_NN_BAND_MAX_POOL:
+        return riscv_pool_band_s8_get_buffer_size(RISCV_NN_POOL_MAX, &layer->input_dims, &layer->output_dims);
+    default:
+        return riscv_pool_band_s8_get_buffer_size(RISCV_NN_POOL_AVG, &layer->input_dims, &layer->output_dims);
+    }
+}
+
+static riscv_nmsis_nn_status riscv_nn_band_layer_run(const nmsis_nn_context *ctx,
+                                                     const nmsis_nn_band_layer *layer,
+                                                     const nmsis_nn_band *input_band,
+                                                     const int8_t *input_data,
+                                                     const nmsis_nn_band *output_band,
+                                                     int8_t *output_data)
+{
+    switch (layer->type)
+    {
+    case RISCV_NN_BAND_CONV:
+        return riscv_convolve_band_s8(ctx,
+                                      layer->conv_params,
+                                      layer->quant_params,
+                                      &layer->input_dims,
+                                      input_band,
+                                      input_data,
+                                      &layer->filter_dims,
+                                      layer->filter_data,
+                                      &layer->bias_dims,
+                                      layer->bias_data,
+                                      &layer->output_dims,
+                                      output_band,
+                                      output_data);
+    case RISCV_NN_BAND_DW_CONV:
+        return riscv_depthwise_conv_band_s8(ctx,
+                                            layer->dw_conv_params,
+                                            layer->quant_params,
+                                            &layer->input_dims,
+                                            input_band,
+                                            input_data,
+                                            &layer->filter_dims,
+                                            layer->filter_data,
+                                            &layer->bias_dims,
+                                            layer->bias_data,
+                                            &layer->output_dims,
+                                            output_band,
+                                            output_data);
+    case RISCV_NN_BAND_MAX_POOL:
+        return riscv_pool_band_s8(ctx,
+                                  layer->pool_params,
+                                  RISCV_NN_POOL_MAX,
+                                  &layer->input_dims,
+                                  input_band,
+                                  input_data,
+                                  &layer->filter_dims,
+                                  &layer->output_dims,
+                                  output_band,
+                                  output_data);
+    case RISCV_NN_BAND_AVG_POOL:
+        return riscv_pool_band_s8(ctx,
+                                  layer->pool_params,
+                                  RISCV_NN_POOL_AVG,
+                                  &layer->input_dims,
+                                  input_band,
+                                  input_data,
+                                  &layer->filter_dims,
+                                  &layer->output_dims,
+                                  output_band,
+                                  output_data);
+    default:
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+}
+
+static riscv_nmsis_nn_status riscv_nn_band_chain_check(const nmsis_nn_band_layer *layers,
+                                                       const int32_t num_layers,
+                                                       const int32_t band_rows)
+{
+    if (layers == NULL || num_layers < 1 || band_rows < 1)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    for (int32_t i = 0; i < num_layers; i++)
+    {
+        const nmsis_nn_band_layer *layer = &layers[i];
+        const void *params = layer->type == RISCV_NN_BAND_CONV      ? (const void *)layer->conv_params
+                             : layer->type == RISCV_NN_BAND_DW_CONV ? (const void *)layer->dw_conv_params
+                                                                     : (const void *)layer->pool_params;
+
+        if (params == NULL || layer->type < RISCV_NN_BAND_CONV || layer->type > RISCV_NN_BAND_AVG_POOL ||
+            layer->input_dims.n != 1)
+        {
+            return RISCV_NMSIS_NN_ARG_ERROR;
+        }
+        /* Every layer consumes the whole output tensor of the previous one */
+        if (i > 0 && (layers[i - 1].output_dims.h != layer->input_dims.h ||
+                      layers[i - 1].output_dims.w != layer->input_dims.w ||
+                      layers[i - 1].output_dims.c != layer->input_dims.c))
+        {
+            return RISCV_NMSIS_NN_ARG_ERROR;
+        }
+    }
+
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+/* Largest intermediate band of the chain, in bytes */
+static int32_t riscv_nn_band_chain_get_band_size(const nmsis_nn_band_layer *layers,
+                                                 const int32_t num_layers,
+                                                 const int32_t band_rows)
+{
+    const int32_t output_y = layers[num_layers - 1].output_dims.h;
+    int32_t band_size = 0;
+
+    for (int32_t i_out_y = 0; i_out_y < output_y; i_out_y += band_rows)
+    {
+        const nmsis_nn_band last_band = {i_out_y, MIN(band_rows, output_y - i_out_y)};
+
+        for (int32_t i = 0; i < num_layers - 1; i++)
+        {
+            nmsis_nn_band band;
+            riscv_nn_band_chain_layer_band(layers, num_layers, i, &last_band, &band);
+            band_size = MAX(band_size, band.rows * layers[i].output_dims.w * layers[i].output_dims.c);
+        }
+    }
+
+    return RISCV_NN_BAND_ALIGN(band_size);
+}
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNTiling
+ * @{
+ */
+
+void riscv_nn_band_get_input_band(const nmsis_nn_band *output_band,
+                                  const int32_t input_y,
+                                  const int32_t kernel_y,
+                                  const int32_t stride_y,
+                                  const int32_t pad_y,
+                                  const int32_t dilation_y,
+                                  nmsis_nn_band *input_band)
+{
+    const int32_t first_y = output_band->start * stride_y - pad_y;
+    const int32_t last_y =
+        (output_band->start + output_band->rows - 1) * stride_y - pad_y + (kernel_y - 1) * dilation_y;
+    const int32_t start_y = MAX(first_y, 0);
+    const int32_t end_y = MIN(last_y + 1, input_y);
+
+    input_band->start = start_y;
+    input_band->rows = MAX(end_y - start_y, 0);
+}
+
+riscv_nmsis_nn_status riscv_nn_band_chain_s8(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_band_layer *layers,
+                                         const int32_t num_layers,
+                                         const int32_t band_rows,
+                                         const int8_t *input_data,
+                                         int8_t *output_data)
+{
+    RISCV_NN_PROFILE_OP(num_layers > 0 ? &layers[0].input_dims : NULL,
+                        num_layers > 0 ? &layers[num_layers - 1].output_dims : NULL);
+    riscv_nmsis_nn_status status = riscv_nn_band_chain_check(layers, num_layers, band_rows);
+    if (status != RISCV_NMSIS_NN_SUCCESS)
+    {
+        return status;
+    }
+
+    int32_t scratch_size = 0;
+    for (int32_t i = 0; i < num_layers; i++)
+    {
+        scratch_size = MAX(scratch_size, riscv_nn_band_layer_get_buffer_size(&layers[i]));
+    }
+    scratch_size = RISCV_NN_BAND_ALIGN(scratch_size);
+    const int32_t band_size = riscv_nn_band_chain_get_band_size(layers, num_layers, band_rows);
+
+    if (ctx->buf == NULL && (scratch_size + band_size) > 0)
+    {
+        return RISCV_NMSIS_NN_ARG_ERROR;
+    }
+
+    /* The operator scratch buffer comes first, followed by two ping-pong buffers for the intermediate bands */
+    const nmsis_nn_context layer_ctx = {ctx->buf, scratch_size};
+    int8_t *band_buf[2] = {(int8_t *)ctx->buf + scratch_size, (int8_t *)ctx->buf + scratch_size + band_size};
+
+    const nmsis_nn_dims *output_dims = &layers[num_layers - 1].output_dims;
+    const int32_t output_row_size = output_dims->w * output_dims->c;
+
+    for (int32_t i_out_y = 0; i_out_y < output_dims->h; i_out_y += band_rows)
+    {
+        const nmsis_nn_band last_band = {i_out_y, MIN(band_rows, output_dims->h - i_out_y)};
+        nmsis_nn_band input_band = {0, layers[0].input_dims.h};
+        const int8_t *src = input_data;
+
+        /* Compute the rows of every layer needed by this band of the chain output. The overlap (halo) between
+           consecutive bands is recomputed rather than stored. */
+        for (int32_t i = 0; i < num_layers; i++)
+        {
+            nmsis_nn_band band;
+            riscv_nn_band_chain_layer_band(layers, num_layers, i, &last_band, &band);
+
+            int8_t *dst = (i == num_layers - 1) ? output_data + i_out_y * output_row_size : band_buf[i & 1];
+
+            status = riscv_nn_band_layer_run(&layer_ctx, &layers[i], &input_band, src, &band, dst);
+            if (status != RISCV_NMSIS_NN_SUCCESS)
+            {
+                return status;
+            }
+
+            input_band = band;
+            src = dst;
+        }
+    }
+
+    /* Return to application */
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+int32_t riscv_nn_band_chain_s8_get_buffer_size(const nmsis_nn_band_layer *layers,
+                                             const int32_t num_layers,
+                                             const int32_t band_rows)
+{
+    if (riscv_nn_band_chain_check(layers, num_layers, band_rows) != RISCV_NMSIS_NN_SUCCESS)
+    {
+        return 0;
+    }
+
+    int32_t scratch_size = 0;
+    for (int32_t i = 0; i < num_layers; i++)
+    {
+        scratch_size = MAX(scratch_size, riscv_nn_band_layer_get_buffer_size(&layers[i]));
+    }
+
+    return RISCV_NN_BAND_ALIGN(scratch_size) + 2 * riscv_nn_band_chain_get_band_size(layers, num_layers, band_rows);
+}
+
+/**
+ * @} end of NNTiling group
+ */
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_nn_profile.c
+ * Description:  Per operator cycle profiler with a ring buffer of records
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+#if defined(RISCV_NN_PROFILE)
+    #include <stdio.h>
+
+    #ifndef RISCV_NN_PROFILE_HPM0
+        #define RISCV_NN_PROFILE_HPM0 (3)
+    #endif
+    #ifndef RISCV_NN_PROFILE_HPM1
+        #define RISCV_NN_PROFILE_HPM1 (4)
+    #endif
+
+static nmsis_nn_profile_record riscv_nn_profile_records[RISCV_NN_PROFILE_RECORDS];
+/* Number of calls recorded since the reset, the next sequence number */
+static uint32_t riscv_nn_profile_count;
+static int32_t riscv_nn_profile_depth;
+
+__STATIC_FORCEINLINE void riscv_nn_profile_read_counters(uint64_t *cycle, uint64_t *instret, uint64_t *hpm)
+{
+    #if defined(RISCV_NN_PROFILE_HPM)
+    hpm[0] = __get_hpm_counter(RISCV_NN_PROFILE_HPM0);
+    hpm[1] = __get_hpm_counter(RISCV_NN_PROFILE_HPM1);
+    #else
+    hpm[0] = 0;
+    hpm[1] = 0;
+    #endif
+    *instret = __get_rv_instret();
+    *cycle = __get_rv_cycle();
+}
+
+uint32_t riscv_nn_profile_enter(const char *op, const nmsis_nn_dims *input, const nmsis_nn_dims *output)
+{
+    const nmsis_nn_dims none = {0, 0, 0, 0};
+    const uint32_t seq = riscv_nn_profile_count++;
+    nmsis_nn_profile_record *rec = &riscv_nn_profile_records[seq % RISCV_NN_PROFILE_RECORDS];
+
+    rec->op = op;
+    rec->seq = seq;
+    rec->depth = riscv_nn_profile_depth++;
+    rec->input = input ? *input : none;
+    rec->output = output ? *output : none;
+    rec->cycles = 0;
+    /* The counters are read last, so the cost of the bookkeeping above is not counted */
+    riscv_nn_profile_read_counters(&rec->start, &rec->instret, rec->hpm);
+    return seq;
+}
+
+void riscv_nn_profile_exit(const uint32_t *seq)
+{
+    uint64_t cycle, instret, hpm[2];
+    nmsis_nn_profile_record *rec = &riscv_nn_profile_records[*seq % RISCV_NN_PROFILE_RECORDS];
+
+    riscv_nn_profile_read_counters(&cycle, &instret, hpm);
+    riscv_nn_profile_depth--;
+    /* The record was overwritten by the nested calls if the ring buffer is too small */
+    if (rec->seq == *seq)
+    {
+        rec->cycles = cycle - rec->start;
+        rec->instret = instret - rec->instret;
+        rec->hpm[0] = hpm[0] - rec->hpm[0];
+        rec->hpm[1] = hpm[1] - rec->hpm[1];
+    }
+}
+#endif
+
+/**
+ *  @ingroup Public
+ */
+
+/**
+ * @addtogroup NNProfile
+ * @{
+ */
+
+void riscv_nn_profile_reset(void)
+{
+#if defined(RISCV_NN_PROFILE)
+    riscv_nn_profile_count = 0;
+    riscv_nn_profile_depth = 0;
+#endif
+}
+
+int32_t riscv_nn_profile_read(nmsis_nn_profile_record *records, int32_t max)
+{
+#if defined(RISCV_NN_PROFILE)
+    const uint32_t count = riscv_nn_profile_count;
+    const uint32_t first = count > RISCV_NN_PROFILE_RECORDS ? count - RISCV_NN_PROFILE_RECORDS : 0;
+    int32_t num = 0;
+
+    for (uint32_t seq = first; seq < count && num < max; seq++)
+    {
+        records[num++] = riscv_nn_profile_records[seq % RISCV_NN_PROFILE_RECORDS];
+    }
+    return num;
+#else
+    (void)records;
+    (void)max;
+    return 0;
+#endif
+}
+
+void riscv_nn_profile_dump(void)
+{
+#if defined(RISCV_NN_PROFILE)
+    const uint32_t count = riscv_nn_profile_count;
+    const uint32_t first = count > RISCV_NN_PROFILE_RECORDS ? count - RISCV_NN_PROFILE_RECORDS : 0;
+
+    if (first > 0)
+    {
+        printf("NNPROF_DROPPED, %lu\n", (unsigned long)first);
+    }
+    for (uint32_t seq = first; seq < count; seq++)
+    {
+        const nmsis_nn_profile_record *rec = &riscv_nn_profile_records[seq % RISCV_NN_PROFILE_RECORDS];
+        printf("NNPROF, %lu, %ld, %s, %ld, %ld, %ld, %ld, %ld, %ld, %ld, %ld, %llu, %llu, %llu, %llu, %llu\n",
+               (unsigned long)rec->seq,
+               (long)rec->depth,
+               rec->op,
+               (long)rec->input.n,
+               (long)rec->input.h,
+               (long)rec->input.w,
+               (long)rec->input.c,
+               (long)rec->output.n,
+               (long)rec->output.h,
+               (long)rec->output.w,
+               (long)rec->output.c,
+               (unsigned long long)rec->start,
+               (unsigned long long)rec->cycles,
+               (unsigned long long)rec->instret,
+               (unsigned long long)rec->hpm[0],
+               (unsigned long long)rec->hpm[1]);
+    }
+#endif
+}
+
+/**
+ * @} end of NNProfile group
+ */
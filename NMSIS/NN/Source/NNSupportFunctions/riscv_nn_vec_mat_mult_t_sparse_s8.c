@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      NMSIS NN Library
+ * Title:        riscv_nn_vec_mat_mult_t_sparse_s8
+ * Description:  s8 vector by 2:4 structured sparse matrix (transposed) multiplication
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target : RISC-V Cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "riscv_nnfunctions.h"
+#include "riscv_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup supportFC
+ * @{
+ */
+
+/*
+ * s8 vector(lhs) by 2:4 structured sparse matrix (transposed) multiplication
+ *
+ * Refer header file for details.
+ *
+ */
+riscv_nmsis_nn_status riscv_nn_vec_mat_mult_t_sparse_s8(const int8_t *lhs,
+                                                    const int8_t *rhs_values,
+                                                    const uint8_t *rhs_index,
+                                                    const int32_t *bias,
+                                                    int8_t *dst,
+                                                    const int32_t lhs_offset,
+                                                    const int32_t dst_offset,
+                                                    const int32_t dst_multiplier,
+                                                    const int32_t dst_shift,
+                                                    const int32_t rhs_cols,
+                                                    const int32_t rhs_rows,
+                                                    const int32_t activation_min,
+                                                    const int32_t activation_max)
+{
+    const int32_t num_values = RISCV_NN_SPARSE_VALUES_SIZE(rhs_cols);
+    const int32_t index_size = RISCV_NN_SPARSE_INDEX_SIZE(rhs_cols);
+
+#if defined(RISCV_MATH_VECTOR_ZVE32X)
+    size_t l;
+    int32_t blkCnt = rhs_rows;
+
+    /* Vectorized over the rows. Every row keeps a different input column in each group, so the inputs
+       are gathered with the 2 bit position of the kept value, relative to the first column of the group. */
+    for (; (l = __riscv_vsetvl_e8m1(blkCnt)) > 0; blkCnt -= l)
+    {
+        vint32m4_t sum;
+        vuint8m1_t pos;
+
+        if (bias)
+        {
+            sum = __riscv_vle32_v_i32m4(bias, l);
+            bias += l;
+        }
+        else
+        {
+            sum = __riscv_vmv_v_x_i32m4(0, l);
+        }
+
+        for (int32_t i = 0; i < num_values; i++)
+        {
+            if ((i & 3) == 0)
+            {
+                pos = __riscv_vlse8_v_u8m1(rhs_index + (i >> 2), index_size, l);
+            }
+            vuint8m1_t col = __riscv_vand_vx_u8m1(__riscv_vsrl_vx_u8m1(pos, (i & 3) << 1, l), 3, l);
+            vint16m2_t in16 = __riscv_vsext_vf2_i16m2(__riscv_vluxei8_v_i8m1(lhs + ((i >> 1) << 2), col, l), l);
+            vint16m2_t ker16 = __riscv_vsext_vf2_i16m2(__riscv_vlse8_v_i8m1(rhs_values + i, num_values, l), l);
+            in16 = __riscv_vadd_vx_i16m2(in16, (int16_t)lhs_offset, l);
+            sum = __riscv_vwmacc_vv_i32m4(sum, ker16, in16, l);
+        }
+
+        sum = riscv_nn_requantize_m4_rvv(sum, l, dst_multiplier, dst_shift);
+        sum = __riscv_vadd_vx_i32m4(sum, dst_offset, l);
+        sum = __riscv_vmax_vx_i32m4(sum, activation_min, l);
+        sum = __riscv_vmin_vx_i32m4(sum, activation_max, l);
+        __riscv_vse8_v_i8m1(dst, __riscv_vnsra_wx_i8m1(__riscv_vnsra_wx_i16m2(sum, 0, l), 0, l), l);
+
+        rhs_values += l * num_values;
+        rhs_index += l * index_size;
+        dst += l;
+    }
+#else
+    for (int32_t i_row = 0; i_row < rhs_rows; i_row++)
+    {
+        int32_t sum = bias ? bias[i_row] : 0;
+
+        sum += riscv_nn_sparse_dot_s8(lhs, rhs_values, rhs_index, num_values, lhs_offset);
+
+        sum = riscv_nn_requantize(sum, dst_multiplier, dst_shift);
+        sum += dst_offset;
+        sum = MAX(sum, activation_min);
+        sum = MIN(sum, activation_max);
+        *dst++ = (int8_t)sum;
+
+        rhs_values += num_values;
+        rhs_index += index_size;
+    }
+#endif /* defined(RISCV_MATH_VECTOR_ZVE32X) */
+
+    return RISCV_NMSIS_NN_SUCCESS;
+}
+
+/**
+ * @} end of supportFC group
+ */
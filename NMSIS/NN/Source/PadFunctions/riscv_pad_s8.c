@@ -56,6 +56,7 @@ riscv_nmsis_nn_status riscv_pad_s8(const int8_t *input,
                                const nmsis_nn_dims *pre_pad,
                                const nmsis_nn_dims *post_pad)
 {
+    RISCV_NN_PROFILE_OP(input_size, NULL);
 
     const nmsis_nn_dims output_size = {pre_pad->n + input_size->n + post_pad->n,
                                        pre_pad->h + input_size->h + post_pad->h,
@@ -119,6 +119,7 @@ riscv_nmsis_nn_status riscv_max_pool_s16(const nmsis_nn_context *ctx,
                                      const nmsis_nn_dims *output_dims,
                                      int16_t *dst)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     (void)ctx;
     const int32_t input_y = input_dims->h;
     const int32_t input_x = input_dims->w;
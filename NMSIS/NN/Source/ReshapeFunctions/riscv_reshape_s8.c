@@ -50,6 +50,7 @@
 
 void riscv_reshape_s8(const int8_t *input, int8_t *output, const uint32_t total_size)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, 1, total_size);
     riscv_memcpy_s8(output, input, total_size);
 }
 
@@ -45,6 +45,7 @@ riscv_nmsis_nn_status riscv_softmax_s16(const int16_t *input,
                                     const nmsis_nn_softmax_lut_s16 *softmax_params,
                                     int16_t *output)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, num_rows, row_size);
     int32_t col = 0;
     int32_t row_idx;
 
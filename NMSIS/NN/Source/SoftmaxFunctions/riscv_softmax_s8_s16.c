@@ -49,6 +49,7 @@ void riscv_softmax_s8_s16(const int8_t *input,
                         const int32_t diff_min,
                         int16_t *output)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, num_rows, row_size);
     riscv_nn_softmax_common_s8(input, num_rows, row_size, mult, shift, diff_min, true, (void *)output);
 }
 /**
@@ -50,6 +50,7 @@ void riscv_softmax_u8(const uint8_t *input,
                     const int32_t diff_min,
                     uint8_t *output)
 {
+    RISCV_NN_PROFILE_SHAPE(1, 1, num_rows, row_size);
     const int32_t mask = (1 << shift);
 
     int32_t col = 0;
@@ -134,6 +134,7 @@ riscv_nmsis_nn_status riscv_transpose_s8(const int8_t *input,
                                      const nmsis_nn_dims *const output_dims,
                                      const nmsis_nn_transpose_params *const transpose_params)
 {
+    RISCV_NN_PROFILE_OP(input_dims, output_dims);
     int32_t in_strides[4];
     int32_t out_strides[4] = {0};
 
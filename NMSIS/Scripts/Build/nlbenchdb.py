@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import re
+import glob
+import time
+import sqlite3
+import argparse
+
+try:
+    from prettytable import PrettyTable
+except Exception as exc:
+    print("Import Error: %s" % (exc))
+    print("Please install requried packages using: pip3 install prettytable")
+    sys.exit(1)
+
+from nlsweep import SWEEP_RE, BENCHRUN_RE
+
+# CSV line printed by BENCH_END, BENCH_STOP and BENCH_RUN in nmsis_bench.h
+CSV_RE = re.compile(r'^CSV,\s*(\w+),\s*(\d+)')
+
+DB_SCHEMA = '''CREATE TABLE IF NOT EXISTS results (
+    kernel TEXT NOT NULL,
+    size INTEGER NOT NULL,
+    offset INTEGER NOT NULL,
+    seq INTEGER NOT NULL DEFAULT 0,
+    config TEXT NOT NULL,
+    rev TEXT NOT NULL,
+    iters INTEGER,
+    min INTEGER,
+    median INTEGER,
+    p90 INTEGER,
+    max INTEGER,
+    log TEXT,
+    stamp TEXT
+)'''
+DB_INDEX = 'CREATE INDEX IF NOT EXISTS results_key ON results (kernel, size, offset, seq, config, rev)'
+DB_FIELDS = ['kernel', 'size', 'offset', 'seq', 'config', 'rev', 'iters', 'min', 'median', 'p90', 'max', 'log', 'stamp']
+
+def parse_bench_log(log):
+    """
+    Return the records of the CSV, BENCHRUN and SWEEP lines of a benchmark run log. A kernel measured
+    several times with the same size and offset in a log, such as a CSV line of the same name printed by
+    two cases, gets the occurrence index seq 0, 1, ... so that its results are not merged.
+    """
+    records = []
+    seen = dict()
+    sweep = None
+    lastrun = None
+    with open(log, 'r', errors='ignore') as lf:
+        for line in lf.readlines():
+            line = line.strip()
+            match = SWEEP_RE.match(line)
+            if match:
+                sweep = (match.group(1), int(match.group(2)), int(match.group(3)))
+                continue
+            match = BENCHRUN_RE.match(line)
+            if match:
+                kernel = match.group(1)
+                size, offset = int(match.group(3)), 0
+                if sweep and sweep[0] == kernel:
+                    size, offset = sweep[1], sweep[2]
+                records.append(dict(kernel=kernel, size=size, offset=offset, iters=int(match.group(2)),
+                                    min=int(match.group(4)), median=int(match.group(5)),
+                                    p90=int(match.group(6)), max=int(match.group(8)), log=log))
+                sweep = None
+                lastrun = kernel
+                continue
+            match = CSV_RE.match(line)
+            if match:
+                kernel = match.group(1)
+                # BENCH_RUN also prints a CSV line with its median
+                if kernel != lastrun:
+                    cycles = int(match.group(2))
+                    records.append(dict(kernel=kernel, size=0, offset=0, iters=1, min=cycles,
+                                        median=cycles, p90=cycles, max=cycles, log=log))
+                lastrun = None
+    for rec in records:
+        key = (rec["kernel"], rec["size"], rec["offset"])
+        rec["seq"] = seen.get(key, 0)
+        seen[key] = rec["seq"] + 1
+    return records
+
+def open_db(dbfile):
+    dbdir = os.path.dirname(dbfile)
+    if dbdir and os.path.isdir(dbdir) == False:
+        os.makedirs(dbdir)
+    db = sqlite3.connect(dbfile)
+    db.row_factory = sqlite3.Row
+    db.execute(DB_SCHEMA)
+    # Databases created before the seq column store a single occurrence of each key
+    columns = [row["name"] for row in db.execute("PRAGMA table_info(results)").fetchall()]
+    if "seq" not in columns:
+        db.execute("ALTER TABLE results ADD COLUMN seq INTEGER NOT NULL DEFAULT 0")
+    db.execute(DB_INDEX)
+    return db
+
+def store_results(dbfile, logpatterns, config, rev, replace=False):
+    """ Store the results of the logs matching logpatterns for config and rev, return the number of records """
+    records = []
+    for pattern in logpatterns:
+        for log in sorted(glob.glob(pattern, recursive=True)):
+            records.extend(parse_bench_log(log))
+    if len(records) == 0:
+        print("No benchmark result found in %s" % (logpatterns))
+        return 0
+    db = open_db(dbfile)
+    with db:
+        if replace:
+            db.execute("DELETE FROM results WHERE config = ? AND rev = ?", (config, rev))
+        stamp = time.strftime("%Y-%m-%d %H:%M:%S")
+        for rec in records:
+            row = dict(rec, config=config, rev=rev, stamp=stamp)
+            db.execute("INSERT INTO results (%s) VALUES (%s)" % (", ".join(DB_FIELDS), ", ".join("?" * len(DB_FIELDS))),
+                       [row[field] for field in DB_FIELDS])
+    db.close()
+    print("Stored %d results of config %s revision %s into %s" % (len(records), config, rev, dbfile))
+    return len(records)
+
+def resolve_run(db, run):
+    """ run is config@rev, or config for the latest revision stored for it """
+    if "@" in run:
+        config, rev = run.split("@", 1)
+        return config, rev
+    row = db.execute("SELECT rev FROM results WHERE config = ? ORDER BY rowid DESC LIMIT 1", (run,)).fetchone()
+    if row is None:
+        return run, None
+    return run, row["rev"]
+
+def load_run(db, config, rev):
+    """ Return {(kernel, size, offset, seq): stats} merging the repeated runs of a key """
+    rows = db.execute("SELECT * FROM results WHERE config = ? AND rev = ?", (config, rev)).fetchall()
+    groups = dict()
+    for row in rows:
+        groups.setdefault((row["kernel"], row["size"], row["offset"], row["seq"]), []).append(row)
+    results = dict()
+    for key, runs in groups.items():
+        medians = sorted(r["median"] for r in runs)
+        results[key] = dict(median=medians[(len(medians) - 1) // 2],
+                            lo=min(r["min"] for r in runs), hi=max(r["p90"] for r in runs),
+                            samples=sum(r["iters"] for r in runs))
+    return results
+
+def compare_runs(base, new, threshold):
+    """
+    Classify each key found in both runs. A change is significant when the medians differ by more
+    than threshold percent and, when both runs have more than one sample, the [min, p90] ranges
+    of the two runs do not overlap, so that the noise of a run can not be taken for a change.
+    """
+    regressions, improvements, unchanged = [], [], []
+    for key in sorted(set(base) & set(new)):
+        b, n = base[key], new[key]
+        change = (n["median"] - b["median"]) * 100.0 / max(b["median"], 1)
+        sampled = b["samples"] > 1 and n["samples"] > 1
+        item = (key, b, n, change)
+        if change > threshold and (not sampled or n["lo"] > b["hi"]):
+            regressions.append(item)
+        elif change < -threshold and (not sampled or n["hi"] < b["lo"]):
+            improvements.append(item)
+        else:
+            unchanged.append(item)
+    regressions.sort(key=lambda x: -x[3])
+    improvements.sort(key=lambda x: x[3])
+    missing = sorted(set(base) ^ set(new))
+    return regressions, improvements, unchanged, missing
+
+def format_key(key):
+    kernel, size, offset, seq = key
+    if seq > 0:
+        kernel = "%s#%d" % (kernel, seq)
+    if size == 0:
+        return kernel, "-", "-"
+    return kernel, str(size), str(offset)
+
+def report_rows(items):
+    return [ list(format_key(key)) + [str(b["median"]), str(n["median"]), "%+.2f%%" % (change)] for key, b, n, change in items ]
+
+REPORT_FIELDS = ["Kernel", "N", "Offset", "Base Cycles", "New Cycles", "Change"]
+
+def write_report(report, title, sections, summary):
+    if report.endswith(".html") or report.endswith(".htm"):
+        lines = ["<html><head><meta charset=\"utf-8\"><title>%s</title></head><body>" % (title), "<h1>%s</h1>" % (title)]
+        lines += ["<p>%s</p>" % (line) for line in summary]
+        for name, items in sections:
+            lines.append("<h2>%s (%d)</h2>" % (name, len(items)))
+            if len(items) == 0:
+                continue
+            lines.append("<table border=\"1\"><tr>%s</tr>" % ("".join("<th>%s</th>" % (f) for f in REPORT_FIELDS)))
+            for row in report_rows(items):
+                lines.append("<tr>%s</tr>" % ("".join("<td>%s</td>" % (c) for c in row)))
+            lines.append("</table>")
+        lines.append("</body></html>")
+    else:
+        lines = ["# %s" % (title), ""]
+        lines += ["- %s" % (line) for line in summary]
+        for name, items in sections:
+            lines += ["", "## %s (%d)" % (name, len(items)), ""]
+            if len(items) == 0:
+                continue
+            lines.append("| %s |" % (" | ".join(REPORT_FIELDS)))
+            lines.append("|%s" % ("---|" * len(REPORT_FIELDS)))
+            for row in report_rows(items):
+                lines.append("| %s |" % (" | ".join(row)))
+    with open(report, 'w') as rf:
+        rf.write("\n".join(lines) + "\n")
+    print("Comparison report saved into %s" % (report))
+    pass
+
+def compare_results(dbfile, baserun, newrun, threshold, report=None):
+    """ Compare two runs stored in dbfile, return False when regressions are found """
+    if os.path.isfile(dbfile) == False:
+        print("Benchmark database %s not found" % (dbfile))
+        return False
+    db = open_db(dbfile)
+    baseconfig, baserev = resolve_run(db, baserun)
+    newconfig, newrev = resolve_run(db, newrun)
+    if baserev is None or newrev is None:
+        print("No result stored for %s" % (baserun if baserev is None else newrun))
+        db.close()
+        return False
+    base = load_run(db, baseconfig, baserev)
+    new = load_run(db, newconfig, newrev)
+    db.close()
+    regressions, improvements, unchanged, missing = compare_runs(base, new, threshold)
+    title = "Benchmark comparison of %s@%s (base) and %s@%s (new)" % (baseconfig, baserev, newconfig, newrev)
+    summary = ["Threshold: %.2f%% of the median cycles, with non overlapping [min, p90] ranges" % (threshold),
+               "Regressions: %d, improvements: %d, unchanged: %d, not in both runs: %d" \
+               % (len(regressions), len(improvements), len(unchanged), len(missing))]
+    print(title)
+    for line in summary:
+        print(line)
+    for name, items in (("Regressions", regressions), ("Improvements", improvements)):
+        if len(items) == 0:
+            continue
+        tb = PrettyTable()
+        tb.field_names = REPORT_FIELDS
+        for row in report_rows(items):
+            tb.add_row(row)
+        print(name)
+        print(tb)
+    if report:
+        write_report(report, title, (("Regressions", regressions), ("Improvements", improvements)), summary)
+    return len(regressions) == 0
+
+def list_runs(dbfile):
+    if os.path.isfile(dbfile) == False:
+        print("Benchmark database %s not found" % (dbfile))
+        return False
+    db = open_db(dbfile)
+    rows = db.execute("SELECT config, rev, COUNT(*) AS cnt, MAX(stamp) AS stamp FROM results GROUP BY config, rev ORDER BY MAX(rowid)").fetchall()
+    db.close()
+    tb = PrettyTable()
+    tb.field_names = ["Config", "Revision", "Results", "Stored"]
+    for row in rows:
+        tb.add_row([row["config"], row["rev"], row["cnt"], row["stamp"]])
+    print(tb)
+    return True
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei Benchmark Result Database Tool")
+    parser.add_argument('--db', default="nmsis_bench.db", help="SQLite database of the benchmark results")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    store_parser = subparsers.add_parser("store", help="Store the results of benchmark run logs")
+    store_parser.add_argument('--logs', required=True, nargs='+', help="Benchmark run logs, glob patterns such as logs/**/*.log are supported")
+    store_parser.add_argument('--config', required=True, help="Arch configuration of the run, such as rv32imafcpv or _zve32f_xxldspn3x")
+    store_parser.add_argument('--rev', required=True, help="Revision of the library which produced the logs, such as its git describe")
+    store_parser.add_argument('--replace', action='store_true', help="If specified, remove the results previously stored for this config and revision")
+
+    compare_parser = subparsers.add_parser("compare", help="Compare two stored runs")
+    compare_parser.add_argument('--base', required=True, help="Base run, config@rev or config for its latest stored revision")
+    compare_parser.add_argument('--new', required=True, help="New run, config@rev or config for its latest stored revision")
+    compare_parser.add_argument('--threshold', type=float, default=5.0, help="Minimum change of the median cycles in percent, default 5")
+    compare_parser.add_argument('--report', help="Save the comparison into a markdown (.md) or HTML (.html) report")
+
+    subparsers.add_parser("list", help="List the stored runs")
+
+    args = parser.parse_args()
+
+    if args.command == "store":
+        ret = store_results(args.db, args.logs, args.config, args.rev, args.replace) > 0
+    elif args.command == "compare":
+        ret = compare_results(args.db, args.base, args.new, args.threshold, args.report)
+    else:
+        ret = list_runs(args.db)
+    sys.exit(0 if ret else 1)
@@ -19,6 +19,8 @@ except Exception as exc:
     print("Please install requried packages using: pip3 install prettytable")
     sys.exit(1)
 
+import nlsweep
+
 
 def mkdirs(dir, remove_first=False):
     if os.path.isdir(dir) == False:
@@ -259,6 +261,8 @@ if __name__ == '__main__':
     parser.add_argument('--parallel', default="-j4", help="parallel build library, default -j4")
     parser.add_argument('--ignore_fail', action='store_true', help="If specified, will ignore fail even any build configuration failed")
     parser.add_argument('--toolchain', default="nuclei_gnu", help="Select the toolchain profile to use (e.g., nuclei_gnu, nuclei_llvm, terapines)")
+    parser.add_argument('--sweep_logs', nargs='+', help="Run logs of DSP/Benchmark/SizeSweep built with this library, gathered into CSV/JSON after the build, glob patterns are supported")
+    parser.add_argument('--sweep_result', default="sweep", help="Result file prefix of the gathered size sweep, prefix.csv and prefix.json are generated")
 
     args = parser.parse_args()
 
@@ -342,6 +346,10 @@ if __name__ == '__main__':
     aliascfgs = get_aliascfgs(jsoncfg)
     runrst = install_library(args.lib_src, buildcfgs, aliascfgs, args.lib_prefix, args.lib_root, args.target, args.strip, args.parallel, args.ignore_fail, args.norebuild, all_cmake_extra_args)
     print("Build Library %s with config %s, generated into %s status: %s" %(args.lib_src, args.config, args.lib_root, runrst))
+    if args.sweep_logs:
+        print("Gather size sweep results of %s into %s" % (args.sweep_logs, args.sweep_result))
+        if nlsweep.gather_sweep(args.sweep_logs, args.sweep_result) == False:
+            runrst = False
     if args.norebuild:
         print("!!!Use Caution: This build is not fully rebuilt, please take care!!!!")
     if runrst:
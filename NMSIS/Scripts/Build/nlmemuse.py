@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import re
+import csv
+import glob
+import json
+import argparse
+
+try:
+    from prettytable import PrettyTable
+except Exception as exc:
+    print("Import Error: %s" % (exc))
+    print("Please install requried packages using: pip3 install prettytable")
+    sys.exit(1)
+
+# Lines printed by BENCH_END when the benchmark is built with BENCH_MEMORY=ON, see nmsis_bench.h
+SCRATCH_RE = re.compile(r'^SCRATCH,\s*(\w+),\s*(\w+),\s*([^,]+),\s*(\d+),\s*(\d+)')
+MEMUSE_RE = re.compile(r'^MEMUSE,\s*(\w+),\s*(\w+),\s*(\d+),\s*(\d+),\s*(\d+)')
+
+MEMUSE_FIELDS = ["kernel", "case", "stack", "scratch_used", "scratch_size", "buffers", "log"]
+
+def parse_memuse_log(log):
+    """ Return the list of memory usage records found in a run log """
+    records = []
+    if os.path.isfile(log) == False:
+        print("Memory usage log %s not found" % (log))
+        return records
+    buffers = []
+    with open(log, 'r', errors='ignore') as lf:
+        for line in lf.readlines():
+            line = line.strip()
+            match = SCRATCH_RE.match(line)
+            if match:
+                buffers.append("%s %s/%s" % (match.group(3).strip(), match.group(4), match.group(5)))
+                continue
+            match = MEMUSE_RE.match(line)
+            if match:
+                records.append({
+                    "kernel": match.group(1), "case": match.group(2), "stack": int(match.group(3)),
+                    "scratch_used": int(match.group(4)), "scratch_size": int(match.group(5)),
+                    "buffers": "; ".join(buffers), "log": log
+                })
+                buffers = []
+    return records
+
+def show_memuse_tables(records, paint_size):
+    logs = sorted(set(rec["log"] for rec in records))
+    for log in logs:
+        tb = PrettyTable()
+        tb.field_names = ["Kernel", "Case", "Stack", "Scratch Used", "Scratch Size", "Scratch Unused", "Buffers (used/size)"]
+        tb.align = "l"
+        for rec in sorted([rec for rec in records if rec["log"] == log], key=lambda rec: (rec["kernel"], rec["case"])):
+            stack = rec["stack"]
+            # the whole painted stack was used, so the real usage is unknown
+            stack = ">=%d" % (stack) if stack >= paint_size else stack
+            unused = rec["scratch_size"] - rec["scratch_used"]
+            tb.add_row([rec["kernel"], rec["case"], stack, rec["scratch_used"], rec["scratch_size"],
+                        unused if rec["scratch_size"] > 0 else "-", rec["buffers"] if rec["buffers"] else "-"])
+        print("Stack and scratch usage in bytes of %s" % (log))
+        print(tb)
+    pass
+
+def save_memuse_results(records, prefix):
+    """ Save the records into prefix.csv, and the largest usage of each kernel and case into prefix.json """
+    outdir = os.path.dirname(prefix)
+    if outdir and os.path.isdir(outdir) == False:
+        os.makedirs(outdir)
+    csvfile = prefix + ".csv"
+    with open(csvfile, 'w', newline='') as cf:
+        writer = csv.DictWriter(cf, fieldnames=MEMUSE_FIELDS)
+        writer.writeheader()
+        for rec in records:
+            writer.writerow(rec)
+    jsonfile = prefix + ".json"
+    jsondata = dict()
+    for rec in records:
+        item = jsondata.setdefault(rec["kernel"], dict()).setdefault(rec["case"], dict(stack=0, scratch_used=0, scratch_size=0))
+        for key in ("stack", "scratch_used", "scratch_size"):
+            item[key] = max(item[key], rec[key])
+    with open(jsonfile, 'w') as jf:
+        json.dump(jsondata, jf, indent=4, sort_keys=True)
+    print("Memory usage results saved into %s and %s" % (csvfile, jsonfile))
+    return csvfile, jsonfile
+
+def gather_memuse(logpatterns, prefix, paint_size, show=True):
+    """ Gather the memory usage results of the logs matching logpatterns, return False when no result found """
+    if isinstance(logpatterns, str):
+        logpatterns = [logpatterns]
+    records = []
+    for pattern in logpatterns:
+        for log in sorted(glob.glob(pattern, recursive=True)):
+            records.extend(parse_memuse_log(log))
+    if len(records) == 0:
+        print("No memory usage result found in %s, are the benchmarks built with BENCH_MEMORY=ON?" % (logpatterns))
+        return False
+    if show:
+        show_memuse_tables(records, paint_size)
+    save_memuse_results(records, prefix)
+    return True
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei DSP/NN Stack and Scratch Usage Result Tool")
+    parser.add_argument('--logs', required=True, nargs='+', help="Run logs of the benchmarks built with BENCH_MEMORY=ON, glob patterns such as logs/**/run.log are supported")
+    parser.add_argument('--result', default="memuse", help="Result file prefix, prefix.csv and prefix.json are generated")
+    parser.add_argument('--paint_size', type=int, default=8192, help="BENCH_STACK_PAINT_SIZE of the benchmarks, a stack usage reaching it is shown as >=")
+    parser.add_argument('--quiet', action='store_true', help="If specified, don't show the usage tables")
+
+    args = parser.parse_args()
+
+    ret = gather_memuse(args.logs, args.result, args.paint_size, not args.quiet)
+    sys.exit(0 if ret else 1)
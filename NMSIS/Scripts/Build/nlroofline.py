@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import re
+import csv
+import glob
+import math
+import json
+import argparse
+
+try:
+    from prettytable import PrettyTable
+except Exception as exc:
+    print("Import Error: %s" % (exc))
+    print("Please install requried packages using: pip3 install prettytable")
+    sys.exit(1)
+
+import nlbenchdb
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_COSTS = os.path.join(SCRIPT_DIR, "nmsis_kernel_costs.json")
+DEFAULT_ROOT = os.path.abspath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+DEFINE_RE = re.compile(r'^\s*#define\s+(\w+)\s+(.+)$')
+INCLUDE_RE = re.compile(r'^\s*#include\s+"(.+)"')
+EVAL_GLOBALS = {"__builtins__": {}, "log2": math.log2, "max": max, "min": min}
+
+REPORT_FIELDS = ["Kernel", "N", "Cycles", "MACs", "Bytes", "MAC/Byte", "MAC/Cycle", "Byte/Cycle", "Bound", "Efficiency"]
+
+def read_header_defines(header, exprs):
+    """ Collect the #define of header and of the headers it includes with quotes """
+    with open(header, 'r', errors='ignore') as hf:
+        for line in hf.readlines():
+            line = re.sub(r'/\*.*?\*/', '', line.split("//")[0]).strip()
+            match = INCLUDE_RE.match(line)
+            if match:
+                incfile = os.path.join(os.path.dirname(header), match.group(1))
+                if os.path.isfile(incfile):
+                    read_header_defines(incfile, exprs)
+                continue
+            match = DEFINE_RE.match(line)
+            if match:
+                exprs[match.group(1)] = match.group(2).strip()
+    return exprs
+
+def load_header_macros(header):
+    """ Return the integer values of the #define of a test data header """
+    exprs = read_header_defines(header, dict())
+    values = dict()
+    # Macros can use the macros defined before or after them
+    for _ in range(len(exprs)):
+        resolved = False
+        for name, expr in exprs.items():
+            if name in values:
+                continue
+            try:
+                values[name] = eval(expr, EVAL_GLOBALS, values)
+                resolved = True
+            except Exception:
+                pass
+        if resolved == False:
+            break
+    return values
+
+class kernel_costs(object):
+    def __init__(self, costfile, root):
+        self.root = root
+        self.kernels = json.load(open(costfile, 'r')).get("kernels", dict())
+        self.headers = dict()
+        pass
+
+    def params(self, kernel):
+        meta = self.kernels[kernel]
+        macros = dict()
+        if meta.get("header"):
+            header = os.path.join(self.root, meta["header"])
+            if header not in self.headers:
+                self.headers[header] = load_header_macros(header) if os.path.isfile(header) else dict()
+            macros = self.headers[header]
+        params = dict()
+        for name, value in meta["params"].items():
+            if isinstance(value, str) and value in macros:
+                params[name] = macros[value]
+            else:
+                params[name] = int(value)
+        return params
+
+    def costs(self, kernel, size=0):
+        """ Return the MACs and bytes moved by a call of kernel, size replaces the n param when not 0 """
+        if kernel not in self.kernels:
+            return None
+        meta = self.kernels[kernel]
+        try:
+            params = self.params(kernel)
+            if size > 0:
+                params["n"] = size
+            macs = eval(meta["macs"], EVAL_GLOBALS, params)
+            nbytes = eval(meta["read"], EVAL_GLOBALS, params) + eval(meta["write"], EVAL_GLOBALS, params)
+        except Exception as exc:
+            print("Cost model of %s can not be evaluated: %s" % (kernel, exc))
+            return None
+        return macs, nbytes, params.get("n", "-")
+
+def roofline(results, costs, peak_macs, peak_bytes):
+    """ Return the report rows of the results of known kernels """
+    rows = []
+    ridge = peak_macs / peak_bytes
+    for (kernel, size, offset, seq), stats in sorted(results.items()):
+        cost = costs.costs(kernel, size)
+        if cost is None or stats["median"] == 0:
+            continue
+        macs, nbytes, n = cost
+        cycles = stats["median"]
+        intensity = macs / nbytes if nbytes else float("inf")
+        attainable = min(peak_macs, intensity * peak_bytes)
+        achieved = macs / cycles
+        if macs == 0:
+            bound, efficiency = "memory", (nbytes / cycles) / peak_bytes
+        else:
+            bound = "memory" if intensity < ridge else "compute"
+            efficiency = achieved / attainable
+        name = kernel if seq == 0 else "%s#%d" % (kernel, seq)
+        rows.append([name if offset == 0 else "%s@%d" % (name, offset), n, cycles, round(macs), nbytes,
+                     round(intensity, 3), round(achieved, 3), round(nbytes / cycles, 3), bound, "%.1f%%" % (efficiency * 100)])
+    return rows
+
+def write_report(report, rows, title):
+    if report.endswith(".csv"):
+        with open(report, 'w', newline='') as cf:
+            writer = csv.writer(cf)
+            writer.writerow(REPORT_FIELDS)
+            writer.writerows(rows)
+    else:
+        lines = ["# %s" % (title), ""]
+        lines.append("| %s |" % (" | ".join(REPORT_FIELDS)))
+        lines.append("|%s" % ("---|" * len(REPORT_FIELDS)))
+        for row in rows:
+            lines.append("| %s |" % (" | ".join(str(c) for c in row)))
+        with open(report, 'w') as rf:
+            rf.write("\n".join(lines) + "\n")
+    print("Roofline report saved into %s" % (report))
+    pass
+
+def load_log_results(logpatterns):
+    """ Return {(kernel, size, offset, seq): stats} of the run logs, the last result of a key is kept """
+    results = dict()
+    for pattern in logpatterns:
+        for log in sorted(glob.glob(pattern, recursive=True)):
+            for rec in nlbenchdb.parse_bench_log(log):
+                results[(rec["kernel"], rec["size"], rec["offset"], rec["seq"])] = rec
+    return results
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei Benchmark Roofline Report Tool")
+    parser.add_argument('--logs', nargs='+', help="Benchmark run logs, glob patterns such as logs/**/*.log are supported")
+    parser.add_argument('--db', help="SQLite database of nlbenchdb.py, used with --run instead of --logs")
+    parser.add_argument('--run', help="Run stored in --db, config@rev or config for its latest stored revision")
+    parser.add_argument('--peak_macs', type=float, default=1.0, help="Peak MACs per cycle of the core, such as 1 for a scalar FPU or VLEN/32 for a f32 vector MAC unit")
+    parser.add_argument('--peak_bytes', type=float, default=4.0, help="Peak bytes per cycle of the core load store path")
+    parser.add_argument('--costs', default=DEFAULT_COSTS, help="Kernel cost model json file")
+    parser.add_argument('--root', default=DEFAULT_ROOT, help="NMSIS directory where the test data headers of the cost model are located")
+    parser.add_argument('--report', help="Save the report into a markdown (.md) or CSV (.csv) file")
+
+    args = parser.parse_args()
+
+    if args.db and args.run:
+        db = nlbenchdb.open_db(args.db)
+        config, rev = nlbenchdb.resolve_run(db, args.run)
+        results = nlbenchdb.load_run(db, config, rev) if rev else dict()
+        db.close()
+        title = "Roofline of %s@%s" % (config, rev)
+    elif args.logs:
+        results = load_log_results(args.logs)
+        title = "Roofline of %s" % (" ".join(args.logs))
+    else:
+        print("Please specify --logs or --db with --run")
+        sys.exit(1)
+
+    costs = kernel_costs(args.costs, args.root)
+    rows = roofline(results, costs, args.peak_macs, args.peak_bytes)
+    if len(rows) == 0:
+        print("No result of a kernel with a cost model found")
+        sys.exit(1)
+    title += ", peak %g MAC/cycle and %g byte/cycle, ridge point %g MAC/byte" \
+             % (args.peak_macs, args.peak_bytes, args.peak_macs / args.peak_bytes)
+    tb = PrettyTable()
+    tb.field_names = REPORT_FIELDS
+    for row in rows:
+        tb.add_row(row)
+    print(title)
+    print(tb)
+    if args.report:
+        write_report(args.report, rows, title)
+    sys.exit(0)
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import re
+import csv
+import glob
+import json
+import argparse
+
+try:
+    from prettytable import PrettyTable
+except Exception as exc:
+    print("Import Error: %s" % (exc))
+    print("Please install requried packages using: pip3 install prettytable")
+    sys.exit(1)
+
+# Lines printed by DSP/Benchmark/SizeSweep, see sweep.h and BENCH_RUN in nmsis_bench.h
+SWEEP_RE = re.compile(r'^SWEEP,\s*(\w+),\s*(\d+),\s*(\d+)')
+BENCHRUN_RE = re.compile(r'^BENCHRUN,\s*(\w+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*([\d.]+)')
+
+SWEEP_FIELDS = ["kernel", "n", "offset", "iters", "min", "median", "p90", "p99", "max", "cpe", "log"]
+
+def parse_sweep_log(log):
+    """ Return the list of sweep records found in a run log """
+    records = []
+    if os.path.isfile(log) == False:
+        print("Sweep log %s not found" % (log))
+        return records
+    current = None
+    with open(log, 'r', errors='ignore') as lf:
+        for line in lf.readlines():
+            line = line.strip()
+            match = SWEEP_RE.match(line)
+            if match:
+                current = (match.group(1), int(match.group(2)), int(match.group(3)))
+                continue
+            match = BENCHRUN_RE.match(line)
+            if match and current and match.group(1) == current[0]:
+                records.append({
+                    "kernel": current[0], "n": current[1], "offset": current[2],
+                    "iters": int(match.group(2)), "min": int(match.group(4)),
+                    "median": int(match.group(5)), "p90": int(match.group(6)),
+                    "p99": int(match.group(7)), "max": int(match.group(8)),
+                    "cpe": float(match.group(9)), "log": log
+                })
+                current = None
+    return records
+
+def sweep_tables(records):
+    """ Return {log: {kernel: {n: {offset: record}}}} """
+    tables = dict()
+    for rec in records:
+        logtables = tables.setdefault(rec["log"], dict())
+        logtables.setdefault(rec["kernel"], dict()).setdefault(rec["n"], dict())[rec["offset"]] = rec
+    return tables
+
+def show_sweep_tables(tables):
+    for log in sorted(tables):
+        print("Size sweep results of %s" % (log))
+        show_log_tables(tables[log])
+    pass
+
+def show_log_tables(tables):
+    for kernel in sorted(tables):
+        sizes = tables[kernel]
+        offsets = sorted(set(off for n in sizes for off in sizes[n]))
+        tb = PrettyTable()
+        tb.field_names = ["N"] + ["cycles@%d" % (off) for off in offsets] + ["cpe@%d" % (off) for off in offsets]
+        for n in sorted(sizes):
+            row = [n]
+            row += [sizes[n][off]["median"] if off in sizes[n] else "-" for off in offsets]
+            row += [sizes[n][off]["cpe"] if off in sizes[n] else "-" for off in offsets]
+            tb.add_row(row)
+        print("Cycles vs N of %s, median of each size, offset in elements" % (kernel))
+        print(tb)
+    pass
+
+def save_sweep_results(records, prefix):
+    """ Save the records into prefix.csv and the per log and kernel tables into prefix.json """
+    outdir = os.path.dirname(prefix)
+    if outdir and os.path.isdir(outdir) == False:
+        os.makedirs(outdir)
+    csvfile = prefix + ".csv"
+    with open(csvfile, 'w', newline='') as cf:
+        writer = csv.DictWriter(cf, fieldnames=SWEEP_FIELDS)
+        writer.writeheader()
+        for rec in records:
+            writer.writerow(rec)
+    jsonfile = prefix + ".json"
+    tables = sweep_tables(records)
+    jsondata = dict()
+    for log in tables:
+        jsondata[log] = dict()
+        for kernel in tables[log]:
+            jsondata[log][kernel] = [ dict(n=n, offset=off, median=rec["median"], min=rec["min"], p90=rec["p90"],
+                                           p99=rec["p99"], max=rec["max"], cpe=rec["cpe"])
+                                      for n in sorted(tables[log][kernel])
+                                      for off, rec in sorted(tables[log][kernel][n].items()) ]
+    with open(jsonfile, 'w') as jf:
+        json.dump(jsondata, jf, indent=4)
+    print("Sweep results saved into %s and %s" % (csvfile, jsonfile))
+    return csvfile, jsonfile
+
+def gather_sweep(logpatterns, prefix, show=True):
+    """ Gather the size sweep results of the logs matching logpatterns, return False when no result found """
+    if isinstance(logpatterns, str):
+        logpatterns = [logpatterns]
+    records = []
+    for pattern in logpatterns:
+        for log in sorted(glob.glob(pattern, recursive=True)):
+            records.extend(parse_sweep_log(log))
+    if len(records) == 0:
+        print("No size sweep result found in %s" % (logpatterns))
+        return False
+    if show:
+        show_sweep_tables(sweep_tables(records))
+    save_sweep_results(records, prefix)
+    return True
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei DSP Size Sweep Result Tool")
+    parser.add_argument('--logs', required=True, nargs='+', help="Run logs of DSP/Benchmark/SizeSweep, glob patterns such as logs/**/run.log are supported")
+    parser.add_argument('--result', default="sweep", help="Result file prefix, prefix.csv and prefix.json are generated")
+    parser.add_argument('--quiet', action='store_true', help="If specified, don't show the cycles vs N tables")
+
+    args = parser.parse_args()
+
+    ret = gather_sweep(args.logs, args.result, not args.quiet)
+    sys.exit(0 if ret else 1)
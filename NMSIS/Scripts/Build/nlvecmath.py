@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import re
+import csv
+import glob
+import json
+import argparse
+
+try:
+    from prettytable import PrettyTable
+except Exception as exc:
+    print("Import Error: %s" % (exc))
+    print("Please install requried packages using: pip3 install prettytable")
+    sys.exit(1)
+
+# Lines printed by DSP/Benchmark/VecMath, see vecmath.h and BENCH_RUN in nmsis_bench.h
+VLEN_RE = re.compile(r'^VECMATH_VLEN,\s*(\d+)')
+VECMATH_RE = re.compile(r'^VECMATH,\s*(\w+),\s*(\w+),\s*(\d+)')
+BENCHRUN_RE = re.compile(r'^BENCHRUN,\s*(\w+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*([\d.]+)')
+ULP_RE = re.compile(r'^ULP,\s*(\w+),\s*(\w+),\s*([\d.]+|inf),\s*([^,]+),\s*(\d+)')
+
+VECMATH_FIELDS = ["func", "variant", "vlen", "n", "median", "min", "max", "cpe", "max_ulp", "worst_input", "samples", "log"]
+
+# A larger LMUL is only preferred when it is faster by more than this ratio, since it leaves
+# less vector registers to the kernel calling the function
+LMUL_GAIN = 0.02
+
+def parse_vecmath_log(log):
+    """ Return the list of throughput and accuracy records found in a run log """
+    records = dict()
+    if os.path.isfile(log) == False:
+        print("VecMath log %s not found" % (log))
+        return []
+    vlen = 0
+    current = None
+    def record(func, variant):
+        return records.setdefault((func, variant), {
+            "func": func, "variant": variant, "vlen": vlen, "n": "-", "median": "-", "min": "-", "max": "-",
+            "cpe": "-", "max_ulp": "-", "worst_input": "-", "samples": "-", "log": log
+        })
+    with open(log, 'r', errors='ignore') as lf:
+        for line in lf.readlines():
+            line = line.strip()
+            match = VLEN_RE.match(line)
+            if match:
+                vlen = int(match.group(1))
+                continue
+            match = VECMATH_RE.match(line)
+            if match:
+                current = (match.group(1), match.group(2), int(match.group(3)))
+                continue
+            match = BENCHRUN_RE.match(line)
+            if match and current:
+                rec = record(current[0], current[1])
+                rec.update({"n": current[2], "min": int(match.group(4)), "median": int(match.group(5)),
+                            "max": int(match.group(8)), "cpe": float(match.group(9))})
+                current = None
+                continue
+            match = ULP_RE.match(line)
+            if match:
+                rec = record(match.group(1), match.group(2))
+                rec.update({"max_ulp": float(match.group(3)), "worst_input": match.group(4).strip(),
+                            "samples": int(match.group(5))})
+    return list(records.values())
+
+def lmul_of(variant):
+    return int(variant[1:]) if re.match(r'^m\d+$', variant) else None
+
+def best_lmul(records):
+    """ Return the variant of the smallest LMUL whose cycles per element are within LMUL_GAIN of the fastest one """
+    timed = sorted([rec for rec in records if lmul_of(rec["variant"]) and rec["cpe"] != "-"],
+                   key=lambda rec: lmul_of(rec["variant"]))
+    if len(timed) == 0:
+        return "-"
+    fastest = min(rec["cpe"] for rec in timed)
+    for rec in timed:
+        if rec["cpe"] <= fastest * (1.0 + LMUL_GAIN):
+            return rec["variant"]
+    return "-"
+
+def vecmath_tables(records):
+    """ Return {log: {func: [records]}} """
+    tables = dict()
+    for rec in records:
+        tables.setdefault(rec["log"], dict()).setdefault(rec["func"], []).append(rec)
+    return tables
+
+def show_vecmath_tables(tables):
+    for log in sorted(tables):
+        funcs = tables[log]
+        vlen = max(rec["vlen"] for recs in funcs.values() for rec in recs)
+        variants = sorted(set(rec["variant"] for recs in funcs.values() for rec in recs))
+        lmuls = sorted([v for v in variants if lmul_of(v)], key=lmul_of)
+        aligns = [v for v in variants if not lmul_of(v)]
+        if lmuls:
+            tb = PrettyTable()
+            tb.field_names = ["Function"] + ["cpe@%s" % (v) for v in lmuls] + ["Best LMUL"] + ["ulp@%s" % (v) for v in lmuls] + ["Worst Input"]
+            for func in sorted(funcs):
+                recs = {rec["variant"]: rec for rec in funcs[func]}
+                if not any(lmul_of(v) for v in recs):
+                    continue
+                row = [func] + [recs[v]["cpe"] if v in recs else "-" for v in lmuls] + [best_lmul(funcs[func])]
+                row += [recs[v]["max_ulp"] if v in recs else "-" for v in lmuls]
+                row += [recs[lmuls[0]]["worst_input"] if lmuls[0] in recs else "-"]
+                tb.add_row(row)
+            print("Cycles per element and max ULP error of the vector math functions of %s, VLEN %d" % (log, vlen))
+            print(tb)
+        if aligns:
+            tb = PrettyTable()
+            tb.field_names = ["Helper"] + ["cpe@%s" % (v) for v in aligns]
+            for func in sorted(funcs):
+                recs = {rec["variant"]: rec for rec in funcs[func]}
+                if any(lmul_of(v) for v in recs):
+                    continue
+                tb.add_row([func] + [recs[v]["cpe"] if v in recs else "-" for v in aligns])
+            print("Cycles per element of the memory helpers of %s, offset in elements" % (log))
+            print(tb)
+    pass
+
+def save_vecmath_results(records, prefix):
+    """ Save the records into prefix.csv, and the per log results and the best LMUL of each function per VLEN into prefix.json """
+    outdir = os.path.dirname(prefix)
+    if outdir and os.path.isdir(outdir) == False:
+        os.makedirs(outdir)
+    csvfile = prefix + ".csv"
+    with open(csvfile, 'w', newline='') as cf:
+        writer = csv.DictWriter(cf, fieldnames=VECMATH_FIELDS)
+        writer.writeheader()
+        for rec in records:
+            writer.writerow(rec)
+    jsonfile = prefix + ".json"
+    tables = vecmath_tables(records)
+    jsondata = dict(logs=dict(), best_lmul=dict())
+    for log in tables:
+        jsondata["logs"][log] = dict()
+        for func, recs in tables[log].items():
+            jsondata["logs"][log][func] = { rec["variant"]: dict(vlen=rec["vlen"], cpe=rec["cpe"], median=rec["median"],
+                                                                 max_ulp=rec["max_ulp"], worst_input=rec["worst_input"])
+                                            for rec in recs }
+            best = best_lmul(recs)
+            if best != "-":
+                jsondata["best_lmul"].setdefault(str(recs[0]["vlen"]), dict())[func] = best
+    with open(jsonfile, 'w') as jf:
+        json.dump(jsondata, jf, indent=4, sort_keys=True)
+    print("VecMath results saved into %s and %s" % (csvfile, jsonfile))
+    return csvfile, jsonfile
+
+def gather_vecmath(logpatterns, prefix, show=True):
+    """ Gather the VecMath results of the logs matching logpatterns, return False when no result found """
+    if isinstance(logpatterns, str):
+        logpatterns = [logpatterns]
+    records = []
+    for pattern in logpatterns:
+        for log in sorted(glob.glob(pattern, recursive=True)):
+            records.extend(parse_vecmath_log(log))
+    if len(records) == 0:
+        print("No VecMath result found in %s" % (logpatterns))
+        return False
+    if show:
+        show_vecmath_tables(vecmath_tables(records))
+    save_vecmath_results(records, prefix)
+    return True
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei DSP Vector Math and Memory Helper Result Tool")
+    parser.add_argument('--logs', required=True, nargs='+', help="Run logs of DSP/Benchmark/VecMath, one per core or VLEN, glob patterns such as logs/**/run.log are supported")
+    parser.add_argument('--result', default="vecmath", help="Result file prefix, prefix.csv and prefix.json are generated")
+    parser.add_argument('--quiet', action='store_true', help="If specified, don't show the result tables")
+
+    args = parser.parse_args()
+
+    ret = gather_vecmath(args.logs, args.result, not args.quiet)
+    sys.exit(0 if ret else 1)